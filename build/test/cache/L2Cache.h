@@ -0,0 +1,103 @@
+#include "Statistics.h"
+#include "StackDistance.h"
+#include "MainMem.h"
+#include "L2Stream.h"
+#include "Config.h"
+#include "Access.h"
+typedef struct _l2_cache_t * l2_cache_t;
+
+l2_cache_t L2Cache_Create(main_mem_t mem,
+
+                          cache_stats_t * stats,
+
+                          cache_param_t const * config);
+
+
+
+
+
+
+
+
+
+
+
+void L2Cache_Destroy(l2_cache_t cache);
+
+uint32_t L2Cache_Access(l2_cache_t cache, access_t const * access);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void L2Cache_Prefetch(l2_cache_t cache, uint64_t address);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+_Bool 
+
+    L2Cache_PrefetchEnabled(l2_cache_t cache);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void L2Cache_AttachStackDistance(l2_cache_t cache, stack_distance_t stack_distance);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void L2Cache_AttachCapture(l2_cache_t cache, l2_stream_writer_t writer);
+
+
+
+
+
+
+
+
+
+
+
+void L2Cache_Print(l2_cache_t cache);
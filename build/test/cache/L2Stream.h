@@ -0,0 +1,64 @@
+#include "Statistics.h"
+#include "Config.h"
+#include "Access.h"
+typedef struct _l2_stream_writer_t * l2_stream_writer_t;
+
+
+
+
+
+typedef struct _l2_stream_reader_t * l2_stream_reader_t;
+
+l2_stream_writer_t L2Stream_CreateWriter(char const * path, cache_param_t const * l1_config);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void L2Stream_DestroyWriter(l2_stream_writer_t writer);
+
+void L2Stream_SetOrigin(l2_stream_writer_t writer, uint8_t type);
+
+void L2Stream_Record(l2_stream_writer_t writer, access_t const * access, uint32_t cycles);
+
+void L2Stream_Finish(l2_stream_writer_t writer, stats_t const * stats);
+
+l2_stream_reader_t L2Stream_CreateReader(char const * path);
+
+
+
+
+
+
+
+
+
+
+
+void L2Stream_DestroyReader(l2_stream_reader_t reader);
+
+
+
+
+
+cache_param_t const * L2Stream_Config(l2_stream_reader_t reader);
+
+void L2Stream_ReadStats(l2_stream_reader_t reader, stats_t * stats);
+
+uint32_t L2Stream_Read(l2_stream_reader_t reader,
+
+                       access_t * accesses,
+
+                       uint8_t * origins,
+
+                       uint32_t max_accesses);
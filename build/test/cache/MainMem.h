@@ -0,0 +1,19 @@
+#include "Config.h"
+#include "Access.h"
+typedef struct _main_mem_t * main_mem_t;
+
+main_mem_t MainMem_Create(memory_param_t const * config);
+
+
+
+
+
+
+
+
+
+
+
+void MainMem_Destroy(main_mem_t mem);
+
+uint32_t MainMem_Access(main_mem_t mem, access_t const * access);
@@ -0,0 +1,131 @@
+#include "CacheData.h"
+#include "Access.h"
+typedef struct _cache_stats_t {
+
+    const char * name;
+
+    uint64_t hit_count;
+
+
+
+    uint64_t miss_count;
+
+
+
+    uint64_t kickouts;
+
+
+
+    uint64_t dirty_kickouts;
+
+
+
+
+
+    uint64_t transfers;
+
+
+
+    uint64_t vc_hit_count;
+
+
+
+} cache_stats_t;
+
+
+
+
+
+typedef struct _stats_t {
+
+    uint64_t read_count;
+
+    uint64_t read_count_aligned;
+
+    uint64_t read_cycles;
+
+
+
+    uint64_t write_count;
+
+    uint64_t write_count_aligned;
+
+    uint64_t write_cycles;
+
+
+
+    uint64_t instr_count;
+
+    uint64_t instr_count_aligned;
+
+    uint64_t instr_cycles;
+
+
+
+
+
+    cache_stats_t l1i;
+
+
+
+    cache_stats_t l1d;
+
+
+
+    cache_stats_t l2;
+
+} stats_t;
+
+void Statistics_Create(stats_t * stats);
+
+
+
+
+
+
+
+
+
+
+
+void Statistics_Print(stats_t const * stats);
+
+void Statistics_RecordAccess(stats_t * stats,
+
+                             uint8_t type,
+
+                             uint32_t cycles,
+
+                             uint32_t n_aligned);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void Statistics_RecordCycles(stats_t * stats, uint8_t type, uint32_t cycles);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void Statistics_RecordCacheAccess(cache_stats_t * cache_stats, result_t result);
+
+void Statistics_RecordCacheHits(cache_stats_t * cache_stats, uint32_t n_hits);
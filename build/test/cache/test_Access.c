@@ -0,0 +1,875 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "unity_Helper.h"
+#include "Access.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+static void shouldCauseException(const char * line, access_t * access, volatile unsigned int expected_e, const char * message);
+
+
+
+
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_InstrAccess(void)
+
+{
+
+    access_t expected_access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x7F81CE2206B0,
+
+        .n_bytes = 3,
+
+    };
+
+
+
+    access_t access;
+
+    memset(&(access), 0, sizeof(access));
+
+
+
+    Access_ParseLine("I 7f81ce2206b0 3\n", &access);
+
+
+
+    AssertEqual_access_t(expected_access, access, 59, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_WriteAccess(void)
+
+{
+
+    access_t expected_access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x7FFF5A8487D8,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access_t access;
+
+    memset(&(access), 0, sizeof(access));
+
+
+
+    Access_ParseLine("W 7fff5a8487d8 8\n", &access);
+
+
+
+    AssertEqual_access_t(expected_access, access, 75, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ReadAccess(void)
+
+{
+
+    access_t expected_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x7F81CE441B80 ,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access_t access;
+
+    memset(&(access), 0, sizeof(access));
+
+
+
+    Access_ParseLine("R 7f81ce441b80 8\n", &access);
+
+
+
+    AssertEqual_access_t(expected_access, access, 91, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_NewlineDoesntMatter(void)
+
+{
+
+    access_t expected_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x7F81CE441B80 ,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access_t access;
+
+    memset(&(access), 0, sizeof(access));
+
+
+
+    Access_ParseLine("R 7f81ce441b80 8", &access);
+
+
+
+    AssertEqual_access_t(expected_access, access, 107, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_NullPointerThrowsException(void)
+
+{
+
+    access_t dummy_access;
+
+    shouldCauseException(
+
+                        ((void *)0)
+
+                            ,
+
+                         &dummy_access,
+
+                         ARGUMENT_ERROR,
+
+                         "No exception on null line");
+
+    shouldCauseException("R 7f81ce441b80 8\n",
+
+                         
+
+                        ((void *)0)
+
+                            ,
+
+                         ARGUMENT_ERROR,
+
+                         "No exception on null access struct");
+
+}
+
+
+
+void test_InvalidOperationThrowsException(void)
+
+{
+
+    access_t dummy_access;
+
+    shouldCauseException("D 7f81ce441b80 8\n",
+
+                         &dummy_access,
+
+                         INVALID_OPERATION,
+
+                         "No exception on invalid operation");
+
+}
+
+
+
+void test_InvalidAccessSizeThrowsException(void)
+
+{
+
+    access_t dummy_access;
+
+    shouldCauseException("R 7681cef81b80 0\n",
+
+                         &dummy_access,
+
+                         INVALID_ACCESS_SIZE,
+
+                         "No exception on invalid access size");
+
+}
+
+
+
+void test_SyntaxErrorThrowsException(void)
+
+{
+
+    access_t dummy_access;
+
+    shouldCauseException("can't even handle all these syntax errors",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on invalid syntax");
+
+    shouldCauseException("R 948nothexffc 10",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on invalid syntax");
+
+    shouldCauseException("R 7fff5a8487d8 woooord",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on invalid syntax");
+
+}
+
+
+
+void test_OutOfRangeFieldsThrowException(void)
+
+{
+
+    access_t dummy_access;
+
+    shouldCauseException("R 1ffff880012345678 4",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on 17-digit address");
+
+    shouldCauseException("R 7fff5a8487d8 4294967296",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on 33-bit size");
+
+    shouldCauseException("R -7fff5a8487d8 4",
+
+                         &dummy_access,
+
+                         SYNTAX_ERROR,
+
+                         "No exception on signed address");
+
+}
+
+
+
+void test_LeadingZerosDontCountTowardAddressWidth(void)
+
+{
+
+    access_t expected_access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xFFFF880012345678,
+
+        .n_bytes = 
+
+                     (4294967295U)
+
+                               ,
+
+    };
+
+
+
+    access_t access;
+
+    memset(&(access), 0, sizeof(access));
+
+
+
+    Access_ParseLine("W 0x0000ffff880012345678 4294967295\n", &access);
+
+
+
+    AssertEqual_access_t(expected_access, access, 188, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_Access_ParseBuffer_should_ParseEveryCompleteLine(void)
+
+{
+
+    const char buffer[] = "I 7f81ce2206b0 3\n"
+
+                          "W 7fff5a8487d8 8\n"
+
+                          "R 7F81CE441B80 8\n";
+
+    access_t expected_accesses[] = {
+
+        { .type = TYPE_INSTR, .address = 0x7F81CE2206B0, .n_bytes = 3 },
+
+        { .type = TYPE_WRITE, .address = 0x7FFF5A8487D8, .n_bytes = 8 },
+
+        { .type = TYPE_READ, .address = 0x7F81CE441B80, .n_bytes = 8 },
+
+    };
+
+
+
+    access_t accesses[4];
+
+    uint32_t n_accesses;
+
+    uint64_t line_no = 1;
+
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), 
+
+                                                                  0
+
+                                                                       ,
+
+                                           accesses, 4, &n_accesses, &line_no);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((strlen(buffer))), (_U_SINT)(_UU32)((n_consumed)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(208), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(209), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((line_no)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(210), UNITY_DISPLAY_STYLE_UINT64);
+
+    uint32_t i;
+
+    for (i = 0; i < n_accesses; i++) {
+
+        AssertEqual_access_t(expected_accesses[i], accesses[i], 213, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_Access_ParseBuffer_should_LeavePartialLine_when_NotFinal(void)
+
+{
+
+    const char buffer[] = "I 7f81ce2206b0 3\nW 7fff5a84";
+
+
+
+    access_t accesses[4];
+
+    uint32_t n_accesses;
+
+    uint64_t line_no = 10;
+
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), 
+
+                                                                  0
+
+                                                                       ,
+
+                                           accesses, 4, &n_accesses, &line_no);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((strlen("I 7f81ce2206b0 3\n"))), (_U_SINT)(_UU32)((n_consumed)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(227), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(228), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((11)), (_U_SINT)((line_no)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(229), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Access_ParseBuffer_should_ParsePartialLine_when_Final(void)
+
+{
+
+    const char buffer[] = "I 7f81ce2206b0 3\nW 7fff5a8487d8 8";
+
+    access_t expected_access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x7FFF5A8487D8,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access_t accesses[4];
+
+    uint32_t n_accesses;
+
+    uint64_t line_no = 1;
+
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), 
+
+                                                                  1
+
+                                                                      ,
+
+                                           accesses, 4, &n_accesses, &line_no);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((strlen(buffer))), (_U_SINT)(_UU32)((n_consumed)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(247), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(248), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(expected_access, accesses[1], 249, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_Access_ParseBuffer_should_StopAtMaxAccesses(void)
+
+{
+
+    const char buffer[] = "I 10 4\nI 14 4\nI 18 4\n";
+
+
+
+    access_t accesses[2];
+
+    uint32_t n_accesses;
+
+    uint64_t line_no = 1;
+
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), 
+
+                                                                  1
+
+                                                                      ,
+
+                                           accesses, 2, &n_accesses, &line_no);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((strlen("I 10 4\nI 14 4\n"))), (_U_SINT)(_UU32)((n_consumed)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(262), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(263), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((line_no)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(264), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Access_ParseBuffer_should_ReportOffendingLine_when_LineIsInvalid(void)
+
+{
+
+    const char * buffers[] = {
+
+        "I 10 4\nI 14 4\nD 18 4\n",
+
+        "I 10 4\nI 14 4\nR 18 0\n",
+
+        "I 10 4\nI 14 4\n\n",
+
+        "I 10 4\nI 14 4\nR 7fff5a8487d8 woooord\n",
+
+    };
+
+    volatile unsigned int expected_e[] = {
+
+        INVALID_OPERATION,
+
+        INVALID_ACCESS_SIZE,
+
+        SYNTAX_ERROR,
+
+        SYNTAX_ERROR,
+
+    };
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(buffers)/sizeof((buffers)[0])); i++) {
+
+        access_t accesses[4];
+
+        uint32_t n_accesses;
+
+        uint64_t line_no = 5;
+
+
+
+        volatile unsigned int e = (0x5A5A5A5A);
+
+        { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+       _setjmp (
+
+       NewFrame
+
+       ) 
+
+       == 0) { if (1) {
+
+            Access_ParseBuffer(buffers[i], strlen(buffers[i]), 
+
+                                                              1
+
+                                                                  ,
+
+                               accesses, 4, &n_accesses, &line_no);
+
+        }
+
+        else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)(_US32)((expected_e[i])), (_U_SINT)(_US32)((e)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(295), UNITY_DISPLAY_STYLE_HEX32);
+
+        UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((line_no)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(296), UNITY_DISPLAY_STYLE_UINT64);
+
+    }
+
+}
+
+
+
+void test_Access_Align_should_NotModifyAccess_when_AccessIsAlreadyAligned(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x00000000,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access_t aligned_access;
+
+    Access_Align(&aligned_access, &access, 8);
+
+
+
+    access_t expected_access;
+
+    memcpy(&expected_access, &access, sizeof(access));
+
+
+
+    AssertEqual_access_t(expected_access, aligned_access, 314, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_Access_Align_should_ExpandToBlockSize_when_AccessIsSmallerThanABlock(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x00000000,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t aligned_access;
+
+    Access_Align(&aligned_access, &access, 16);
+
+
+
+    access_t expected_access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x00000000,
+
+        .n_bytes = 16,
+
+    };
+
+
+
+    AssertEqual_access_t(expected_access, aligned_access, 334, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_Access_Align_should_SetAddressToBlockBeginning_when_AddressIsUnaligned(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x00000004,
+
+        .n_bytes = 12,
+
+    };
+
+
+
+    access_t aligned_access;
+
+    Access_Align(&aligned_access, &access, 16);
+
+
+
+    access_t expected_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x00000000,
+
+        .n_bytes = 16,
+
+    };
+
+
+
+    AssertEqual_access_t(expected_access, aligned_access, 354, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_Access_Align_should_AccessMultipleBlocks_when_AccessSpansMultipleBlocks(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x00000004,
+
+        .n_bytes = 13,
+
+    };
+
+
+
+    access_t aligned_access;
+
+    Access_Align(&aligned_access, &access, 16);
+
+
+
+    access_t expected_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x00000000,
+
+        .n_bytes = 32,
+
+    };
+
+
+
+    AssertEqual_access_t(expected_access, aligned_access, 374, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+
+
+
+
+static void shouldCauseException(const char * line, access_t * access, volatile unsigned int expected_e, const char * message)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        Access_ParseLine(line, access);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((expected_e)), (_U_SINT)(_US32)((e)), ((message)), (_U_UINT)(387), UNITY_DISPLAY_STYLE_HEX32);
+
+}
@@ -0,0 +1,358 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "BinaryTrace.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static FILE * file;
+
+
+
+static const access_t accesses[] = {
+
+    { .type = TYPE_INSTR, .address = 0x7F81CE2206B0, .n_bytes = 3 },
+
+    { .type = TYPE_WRITE, .address = 0x7FFF5A8487D8, .n_bytes = 8 },
+
+    { .type = TYPE_READ, .address = 0xFFFFFFFFFFFFFFFC, .n_bytes = 4 },
+
+};
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    file = tmpfile();
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(49))));};
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    fclose(file);
+
+}
+
+
+
+void test_BinaryTrace_DecodeAccess_should_ReverseEncodeAccess(void)
+
+{
+
+    uint8_t record[(16)];
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(accesses)/sizeof((accesses)[0])); i++) {
+
+        access_t access;
+
+        memset(&(access), 0, sizeof(access));
+
+
+
+        BinaryTrace_EncodeAccess(record, &accesses[i]);
+
+        BinaryTrace_DecodeAccess(&access, record);
+
+
+
+        AssertEqual_access_t(accesses[i], access, 69, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_BinaryTrace_EncodeAccess_should_UseLittleEndianLayout(void)
+
+{
+
+    uint8_t expected_record[(16)] = {
+
+        0xD8, 0x87, 0x84, 0x5A, 0xFF, 0x7F, 0x00, 0x00,
+
+        0x08, 0x00, 0x00, 0x00,
+
+        'W', 0x00, 0x00, 0x00,
+
+    };
+
+    uint8_t record[(16)];
+
+
+
+    BinaryTrace_EncodeAccess(record, &accesses[1]);
+
+
+
+    UnityAssertEqualIntArray(( const void*)((expected_record)), ( const void*)((record)), (_UU32)(((16))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(84), UNITY_DISPLAY_STYLE_HEX8);
+
+}
+
+
+
+void test_BinaryTrace_DecodeAccess_should_ThrowException_when_TypeIsInvalid(void)
+
+{
+
+    uint8_t record[(16)];
+
+    access_t access;
+
+
+
+    BinaryTrace_EncodeAccess(record, &accesses[0]);
+
+    record[12] = 'D';
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BinaryTrace_DecodeAccess(&access, record);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((INVALID_OPERATION)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(101), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_BinaryTrace_ReadHeader_should_ReturnCountWrittenByWriteHeader(void)
+
+{
+
+    binary_trace_header_t header;
+
+
+
+    BinaryTrace_WriteHeader(file, 123456789012ull);
+
+    rewind(file);
+
+    BinaryTrace_ReadHeader(file, &header);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((1))), (_U_SINT)(_UU32)((header.version)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(112), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((16))), (_U_SINT)(_UU32)((header.record_size)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(113), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((123456789012ull)), (_U_SINT)((header.n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(114), UNITY_DISPLAY_STYLE_HEX64);
+
+}
+
+
+
+void test_BinaryTrace_ReadHeader_should_ThrowException_when_MagicIsWrong(void)
+
+{
+
+    binary_trace_header_t header;
+
+
+
+    fputs("I 7f81ce2206b0 3\nI 7f81ce2206b3 5\n", file);
+
+    rewind(file);
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BinaryTrace_ReadHeader(file, &header);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(130), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_BinaryTrace_Read_should_ReturnAccessesWrittenByWrite(void)
+
+{
+
+    access_t read_accesses[(sizeof(accesses)/sizeof((accesses)[0])) + 1];
+
+
+
+    BinaryTrace_WriteHeader(file, (sizeof(accesses)/sizeof((accesses)[0])));
+
+    BinaryTrace_Write(file, accesses, (sizeof(accesses)/sizeof((accesses)[0])));
+
+    rewind(file);
+
+
+
+    binary_trace_header_t header;
+
+    BinaryTrace_ReadHeader(file, &header);
+
+    uint32_t n_read = BinaryTrace_Read(file, read_accesses, (sizeof(read_accesses)/sizeof((read_accesses)[0])));
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((sizeof(accesses)/sizeof((accesses)[0])))), (_U_SINT)(_UU32)((n_read)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(145), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_read; i++) {
+
+        AssertEqual_access_t(accesses[i], read_accesses[i], 148, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((BinaryTrace_Read(file, read_accesses, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(150), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_BinaryTrace_Read_should_ThrowException_when_RecordIsTruncated(void)
+
+{
+
+    access_t read_accesses[(sizeof(accesses)/sizeof((accesses)[0]))];
+
+
+
+    BinaryTrace_Write(file, accesses, 1);
+
+    fputc(0, file);
+
+    rewind(file);
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BinaryTrace_Read(file, read_accesses, (sizeof(read_accesses)/sizeof((read_accesses)[0])));
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(167), UNITY_DISPLAY_STYLE_HEX32);
+
+}
@@ -0,0 +1,406 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static const uint32_t n_sets = 16;
+
+static const uint32_t block_size_bytes = 4;
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create(n_sets, 1, block_size_bytes, 0);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Contains_should_ReturnFalse_when_CacheDataIsEmpty(void)
+
+{
+
+    uint64_t address = 0x7ff04300;
+
+    if (!(CacheData_Contains(cache_data, address))) {} else {UnityFail( ((("Found block in empty cache set"))), (_U_UINT)((_U_UINT)(51)));};
+
+}
+
+
+
+void test_CacheData_Read_should_NotKickOutBlock_when_CacheDataIsEmpty(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff04304;
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(58), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(59), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Contains_should_ReturnTrue_when_BlockHasBeenInserted(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff04308;
+
+    CacheData_Read(cache_data, address, &result);
+
+
+
+    if ((CacheData_Contains(cache_data, address))) {} else {UnityFail( ((("Failed to find inserted block"))), (_U_UINT)((_U_UINT)(68)));};
+
+}
+
+
+
+void test_CacheData_Contains_should_ReturnFalse_when_DifferentBlockHasBeenInserted(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff0430c;
+
+    CacheData_Read(cache_data, address, &result);
+
+
+
+    if (!(CacheData_Contains(cache_data, address + block_size_bytes))) {} else {UnityFail( ((("Found wrong block"))), (_U_UINT)((_U_UINT)(77)));};
+
+    if (!(CacheData_Contains(cache_data, address - block_size_bytes))) {} else {UnityFail( ((("Found wrong block"))), (_U_UINT)((_U_UINT)(78)));};
+
+}
+
+
+
+void test_CacheData_Contains_should_ReportTrue_when_MultipleBlocksInDifferentSetsHaveBeenSaved(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff04310;
+
+    uint64_t address2 = address1 + block_size_bytes;
+
+    uint64_t address3 = address1 - block_size_bytes;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+    CacheData_Read(cache_data, address2, &result);
+
+    CacheData_Read(cache_data, address3, &result);
+
+
+
+    if ((CacheData_Contains(cache_data, address1))) {} else {UnityFail( ((("Failed to find inserted block"))), (_U_UINT)((_U_UINT)(92)));};
+
+    if ((CacheData_Contains(cache_data, address2))) {} else {UnityFail( ((("Failed to find inserted block"))), (_U_UINT)((_U_UINT)(93)));};
+
+    if ((CacheData_Contains(cache_data, address3))) {} else {UnityFail( ((("Failed to find inserted block"))), (_U_UINT)((_U_UINT)(94)));};
+
+}
+
+
+
+void test_CacheData_Read_should_NotKickout_when_TheSameBlockIsInserted(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff04328;
+
+
+
+    CacheData_Read(cache_data, address, &result);
+
+    CacheData_Write(cache_data, address, &result);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(105), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_KickOutOldBlock_when_TwoAddressesMappedToSameBlockAreInserted(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff04314;
+
+    uint64_t address2 = address1 + block_size_bytes * n_sets;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+    CacheData_Read(cache_data, address2, &result);
+
+
+
+    if (!(CacheData_Contains(cache_data, address1))) {} else {UnityFail( ((("Found block that should have been kicked out"))), (_U_UINT)((_U_UINT)(118)));};
+
+    if ((CacheData_Contains(cache_data, address2))) {} else {UnityFail( ((("Failed to find inserted block"))), (_U_UINT)((_U_UINT)(119)));};
+
+}
+
+
+
+void test_CacheData_Write_should_AddBlock_when_BlockIsntPresent(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff04318;
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, address, &result))), (("Write kicked out dirty from empty cache")), (_U_UINT)(127), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Write_should_NotDirtyKickout_when_WritingSameBlock(void)
+
+{
+
+    result_t result;
+
+    uint64_t address = 0x7ff0431c;
+
+
+
+    CacheData_Read(cache_data, address, &result);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, address, &result))), (("Write kicked out dirty from the same block")), (_U_UINT)(138), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(139), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Write_should_DirtyKickout_when_ReplacingBlock(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff0431c;
+
+    uint64_t address2 = address1 + block_size_bytes * n_sets;
+
+
+
+    CacheData_Write(cache_data, address1, &result);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((address1)), (_U_SINT)((CacheData_Write(cache_data, address2, &result))), (("Write didn't perform dirty kickout")), (_U_UINT)(150), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(151), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_KickOutDirtyBlock_when_BlockHasBeenWritten(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff04320;
+
+    uint64_t address2 = address1 + block_size_bytes * n_sets;
+
+
+
+    CacheData_Write(cache_data, address1, &result);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((address1)), (_U_SINT)((CacheData_Read(cache_data, address2, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(162), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(163), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Contains_should_IgnoreOffsetWithinBlock(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff04324;
+
+    uint64_t address2 = address1 + 1;
+
+    uint64_t address3 = address1 + 3;
+
+    uint64_t address4 = address1 + block_size_bytes - 1;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+
+
+    if ((CacheData_Contains(cache_data, address2))) {} else {UnityFail( ((("Offset within block should be ignored"))), (_U_UINT)((_U_UINT)(176)));};
+
+    if ((CacheData_Contains(cache_data, address3))) {} else {UnityFail( ((("Offset within block should be ignored"))), (_U_UINT)((_U_UINT)(177)));};
+
+    if ((CacheData_Contains(cache_data, address4))) {} else {UnityFail( ((("Offset within block should be ignored"))), (_U_UINT)((_U_UINT)(178)));};
+
+}
+
+
+
+void test_CacheData_Read_should_BeAbleToFillCache(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x7000000;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_sets; i++) {
+
+        uint64_t block_address = base_address + block_size_bytes * i;
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, block_address, &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(189), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(190), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+
+
+    uint64_t old_base_address = base_address;
+
+    uint64_t new_base_address = 0x5000000;
+
+    for (i = 0; i < n_sets; i++) {
+
+        uint64_t offset = block_size_bytes * i;
+
+        uint64_t new_block_address = new_base_address + offset;
+
+        uint64_t old_block_address = old_base_address + offset;
+
+        UnityAssertEqualNumber((_U_SINT)((old_block_address)), (_U_SINT)((CacheData_Read(cache_data, new_block_address, &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(199), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(200), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
@@ -0,0 +1,122 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static const uint32_t block_size_bytes = 32;
+
+static const uint32_t n_blocks = 8192 / 32;
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create(n_blocks, 1, block_size_bytes, 0);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_FillItUp(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x3213120;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_blocks; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, address, &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(56), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(57), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+void test_KickItAllBackOut(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x3213120;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_blocks; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        CacheData_Write(cache_data, address, &result);
+
+    }
+
+
+
+    for (i = 0; i < n_blocks; i++) {
+
+        uint64_t new_address = base_address + (i + n_blocks) * block_size_bytes;
+
+        uint64_t old_address = base_address + i * block_size_bytes;
+
+        UnityAssertEqualNumber((_U_SINT)((old_address)), (_U_SINT)((CacheData_Read(cache_data, new_address, &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(75), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(76), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
@@ -0,0 +1,208 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static const uint32_t n_sets = 1;
+
+static const uint32_t set_len = 8;
+
+static const uint32_t block_size_bytes = 4;
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create(n_sets, set_len, block_size_bytes, 0);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Read_should_StoreAllBlocks(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x71234200;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < set_len; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        CacheData_Read(cache_data, address, &result);
+
+    }
+
+
+
+    for (i = 0; i < set_len; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        if ((CacheData_Contains(cache_data, address))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(62)));};
+
+    }
+
+}
+
+
+
+void test_CacheData_Read_should_KickoutOldestBlock(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x71234200;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < set_len + 1; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        CacheData_Read(cache_data, address, &result);
+
+    }
+
+
+
+    if (!(CacheData_Contains(cache_data, base_address))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(77)));};
+
+
+
+    for (i = 1; i < set_len + 1; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        if ((CacheData_Contains(cache_data, address))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(81)));};
+
+    }
+
+}
+
+
+
+void test_CacheData_Read_should_KickoutOldestBlockDirty_when_BlockHasBeenWritten(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x71234200;
+
+
+
+    CacheData_Write(cache_data, base_address, &result);
+
+
+
+    uint32_t i;
+
+    for (i = 1; i < set_len; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        CacheData_Read(cache_data, address, &result);
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((base_address)), (_U_SINT)((CacheData_Read(cache_data, base_address + set_len * block_size_bytes, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(98), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(99), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Write_should_BringBlockToFrontOfLRU(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x71234200;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < set_len; i++) {
+
+        uint64_t address = base_address + i * block_size_bytes;
+
+        CacheData_Read(cache_data, address, &result);
+
+    }
+
+
+
+    CacheData_Write(cache_data, base_address, &result);
+
+
+
+    for (i = 0; i < set_len - 1; i++) {
+
+        uint64_t address = base_address + (i + set_len) * block_size_bytes;
+
+        CacheData_Read(cache_data, address, &result);
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)((base_address)), (_U_SINT)((CacheData_Read(cache_data, base_address + 2 * set_len * i * block_size_bytes, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(119), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(120), UNITY_DISPLAY_STYLE_INT);
+
+}
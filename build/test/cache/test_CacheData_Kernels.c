@@ -0,0 +1,206 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static void compare_with_generic(uint32_t set_len, uint32_t victim_len);
+
+
+
+
+
+
+
+
+
+static cache_data_t kernel_cache;
+
+static cache_data_t generic_cache;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    kernel_cache = 
+
+                   ((void *)0)
+
+                       ;
+
+    generic_cache = 
+
+                   ((void *)0)
+
+                       ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(kernel_cache);
+
+    CacheData_Destroy(generic_cache);
+
+}
+
+
+
+void test_CacheData_Kernel_should_MatchGeneric_when_DirectMapped(void)
+
+{
+
+    compare_with_generic(1, 8);
+
+}
+
+
+
+void test_CacheData_Kernel_should_MatchGeneric_when_DirectMappedWithoutVictimSet(void)
+
+{
+
+    compare_with_generic(1, 0);
+
+}
+
+
+
+void test_CacheData_Kernel_should_MatchGeneric_when_TwoWay(void)
+
+{
+
+    compare_with_generic(2, 8);
+
+}
+
+
+
+void test_CacheData_Kernel_should_MatchGeneric_when_FourWayWithoutVictimSet(void)
+
+{
+
+    compare_with_generic(4, 0);
+
+}
+
+
+
+void test_CacheData_Kernel_should_MatchGeneric_when_EightWay(void)
+
+{
+
+    compare_with_generic(8, 8);
+
+}
+
+
+
+
+
+
+
+static void compare_with_generic(uint32_t set_len, uint32_t victim_len)
+
+{
+
+    const uint32_t scale = (32) / (16);
+
+
+
+    kernel_cache = CacheData_Create((16), set_len, (32), victim_len);
+
+    generic_cache = CacheData_Create((16), set_len, (16), victim_len);
+
+    if ((((kernel_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(103))));};
+
+    if ((((generic_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(104))));};
+
+
+
+    uint32_t state = 1;
+
+    uint32_t i;
+
+    for (i = 0; i < (20000); i++) {
+
+        state = state * 1103515245 + 12345;
+
+        uint64_t block = (state >> 8) % ((16) * 24);
+
+        uint64_t offset = (state >> 4) % (32);
+
+        uint64_t address = 0x10000000 + block * (32) + offset;
+
+        
+
+       _Bool 
+
+            write = (state >> 28) & 1;
+
+
+
+        result_t kernel_result;
+
+        result_t generic_result;
+
+        uint64_t kernel_kickout;
+
+        uint64_t generic_kickout;
+
+        if (write) {
+
+            kernel_kickout = CacheData_Write(kernel_cache, address, &kernel_result);
+
+            generic_kickout = CacheData_Write(generic_cache, address / scale, &generic_result);
+
+        }
+
+        else {
+
+            kernel_kickout = CacheData_Read(kernel_cache, address, &kernel_result);
+
+            generic_kickout = CacheData_Read(generic_cache, address / scale, &generic_result);
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)((generic_result)), (_U_SINT)((kernel_result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+        UnityAssertEqualNumber((_U_SINT)((generic_kickout * scale)), (_U_SINT)((kernel_kickout)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(128), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+}
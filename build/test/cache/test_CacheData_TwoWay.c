@@ -0,0 +1,214 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static const uint32_t n_sets = 16;
+
+static const uint32_t set_len = 2;
+
+static const uint32_t block_size_bytes = 4;
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create(n_sets, set_len, block_size_bytes, 0);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Read_should_SaveTwoAddressesMappedToTheSameSet(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff38200;
+
+    uint64_t address2 = 0x7ff38300;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+    CacheData_Read(cache_data, address2, &result);
+
+
+
+    if ((CacheData_Contains(cache_data, address1))) {} else {UnityFail( ((("Failed to store first address"))), (_U_UINT)((_U_UINT)(59)));};
+
+    if ((CacheData_Contains(cache_data, address2))) {} else {UnityFail( ((("Failed to store second address"))), (_U_UINT)((_U_UINT)(60)));};
+
+}
+
+
+
+void test_CacheData_Read_should_KickOutOldestAddressFromSet(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff38200;
+
+    uint64_t address2 = 0x7ff38300;
+
+    uint64_t address3 = 0x7ff38400;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+    CacheData_Read(cache_data, address2, &result);
+
+    CacheData_Read(cache_data, address3, &result);
+
+
+
+    if (!(CacheData_Contains(cache_data, address1))) {} else {UnityFail( ((("Failed to kick out first address"))), (_U_UINT)((_U_UINT)(74)));};
+
+    if ((CacheData_Contains(cache_data, address2))) {} else {UnityFail( ((("Failed to store second address"))), (_U_UINT)((_U_UINT)(75)));};
+
+    if ((CacheData_Contains(cache_data, address3))) {} else {UnityFail( ((("Failed to store second address"))), (_U_UINT)((_U_UINT)(76)));};
+
+}
+
+
+
+void test_CacheData_Write_should_MoveBlockToFrontOfLRU(void)
+
+{
+
+    result_t result;
+
+    uint64_t address1 = 0x7ff38200;
+
+    uint64_t address2 = 0x7ff38300;
+
+    uint64_t address3 = 0x7ff38400;
+
+
+
+    CacheData_Read(cache_data, address1, &result);
+
+    CacheData_Read(cache_data, address2, &result);
+
+
+
+    CacheData_Write(cache_data, address1, &result);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address3, &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(90), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(91), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_BeAbleToFillCache(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x7000000;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_sets; i++) {
+
+        uint32_t j;
+
+        for (j = 0; j < set_len; j++) {
+
+            uint64_t block_address = (base_address) +
+
+                                     (i * block_size_bytes) +
+
+                                     (j * block_size_bytes * n_sets);
+
+            UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, block_address, &result))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_HEX64);
+
+            UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(107), UNITY_DISPLAY_STYLE_INT);
+
+        }
+
+    }
+
+
+
+    uint64_t old_base_address = base_address;
+
+    uint64_t new_base_address = 0x5000000;
+
+    for (i = 0; i < n_sets; i++) {
+
+        uint64_t offset = i * block_size_bytes;
+
+        uint64_t new_block_address = new_base_address + offset;
+
+        uint64_t old_block_address = old_base_address + offset;
+
+        UnityAssertEqualNumber((_U_SINT)((old_block_address)), (_U_SINT)((CacheData_Read(cache_data, new_block_address, &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(117), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(118), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
@@ -0,0 +1,731 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "CacheData.h"
+#include "StackDistance.h"
+#include "unity.h"
+
+
+
+
+
+
+static void compare_with_caches(uint32_t associativity);
+
+
+
+
+
+
+
+
+
+
+
+
+
+static void run_and_compare(uint32_t n_caches, uint32_t hot_blocks);
+
+
+
+
+
+
+
+
+
+static stack_distance_t stack_distance;
+
+static cache_data_t caches[(8)];
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    stack_distance = 
+
+                    ((void *)0)
+
+                        ;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        caches[i] = 
+
+                   ((void *)0)
+
+                       ;
+
+    }
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    StackDistance_Destroy(stack_distance);
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        CacheData_Destroy(caches[i]);
+
+    }
+
+}
+
+
+
+void test_StackDistance_Create_should_ThrowException_when_ParameterIsOutOfRange(void)
+
+{
+
+    uint32_t const params[][3] = {
+
+        { 24, 1, (8) },
+
+        { (16), 0, (8) },
+
+        { (16), 1, 0 },
+
+        { (16), 1, (24) + 1 },
+
+    };
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(params)/sizeof((params)[0])); i++) {
+
+        volatile unsigned int e = (0x5A5A5A5A);
+
+        { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+       _setjmp (
+
+       NewFrame
+
+       ) 
+
+       == 0) { if (1) {
+
+            StackDistance_Create(params[i][0], params[i][1], params[i][2]);
+
+        }
+
+        else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(113), UNITY_DISPLAY_STYLE_HEX32);
+
+    }
+
+}
+
+
+
+void test_StackDistance_SizeBytes_should_DoubleFromOneSet(void)
+
+{
+
+    stack_distance = StackDistance_Create((16), 4, (8));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(120))));};
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((8))), (_U_SINT)(_UU32)((StackDistance_Caches(stack_distance))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(122), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((64)), (_U_SINT)((StackDistance_SizeBytes(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(123), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((64 << ((8) - 1))), (_U_SINT)((StackDistance_SizeBytes(stack_distance, (8) - 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(124), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_StackDistance_Access_should_CountRepeatsAsHits(void)
+
+{
+
+    stack_distance = StackDistance_Create((16), 1, (8));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(130))));};
+
+
+
+    StackDistance_Access(stack_distance, 0x1004, 3, 
+
+                                                   0
+
+                                                        );
+
+    StackDistance_Access(stack_distance, 0x100c, 1, 
+
+                                                   1
+
+                                                       );
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((StackDistance_Hits(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(137), UNITY_DISPLAY_STYLE_UINT64);
+
+        UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((StackDistance_Misses(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(138), UNITY_DISPLAY_STYLE_UINT64);
+
+    }
+
+}
+
+
+
+void test_StackDistance_Access_should_SeeConflicts_only_when_SetsAreShared(void)
+
+{
+
+    stack_distance = StackDistance_Create((16), 1, (8));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(145))));};
+
+
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < 5; i++) {
+
+        StackDistance_Access(stack_distance, 0x4000, 1, 
+
+                                                       0
+
+                                                            );
+
+        StackDistance_Access(stack_distance, 0x4000 + 2 * (16), 1, 
+
+                                                                              0
+
+                                                                                   );
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((StackDistance_Hits(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(154), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((10)), (_U_SINT)((StackDistance_Misses(stack_distance, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(155), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((StackDistance_Hits(stack_distance, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(156), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((8)), (_U_SINT)((StackDistance_Hits(stack_distance, 2))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(157), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((StackDistance_Misses(stack_distance, 2))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(158), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((9)), (_U_SINT)((StackDistance_Kickouts(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(159), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((StackDistance_Kickouts(stack_distance, 2))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(160), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_StackDistance_CreateAllWays_should_ThrowException_when_ParameterIsOutOfRange(void)
+
+{
+
+    uint32_t const params[][2] = {
+
+        { 24, 24 * 16 },
+
+        { (16), (16) / 2 },
+
+        { (16), 3 * (16) },
+
+        { (16), (16) << (24) },
+
+    };
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(params)/sizeof((params)[0])); i++) {
+
+        volatile unsigned int e = (0x5A5A5A5A);
+
+        { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+       _setjmp (
+
+       NewFrame
+
+       ) 
+
+       == 0) { if (1) {
+
+            StackDistance_CreateAllWays(params[i][0], params[i][1]);
+
+        }
+
+        else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(180), UNITY_DISPLAY_STYLE_HEX32);
+
+    }
+
+}
+
+
+
+void test_StackDistance_CreateAllWays_should_HalveWaysFromFullyAssociative(void)
+
+{
+
+    stack_distance = StackDistance_CreateAllWays((16), (128 * (16)));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(187))));};
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((8))), (_U_SINT)(_UU32)((StackDistance_Caches(stack_distance))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(189), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)((128 >> i)), (_U_SINT)(_UU32)((StackDistance_Ways(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(193), UNITY_DISPLAY_STYLE_UINT32);
+
+        UnityAssertEqualNumber((_U_SINT)(((128 * (16)))), (_U_SINT)((StackDistance_SizeBytes(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(194), UNITY_DISPLAY_STYLE_UINT64);
+
+    }
+
+}
+
+
+
+void test_StackDistance_Access_should_CountDirtyKickouts_only_when_Written(void)
+
+{
+
+    stack_distance = StackDistance_CreateAllWays((16), 2 * (16));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(201))));};
+
+
+
+
+
+
+
+
+
+    StackDistance_Access(stack_distance, 0x8000, 1, 
+
+                                                   1
+
+                                                       );
+
+    StackDistance_Access(stack_distance, 0x8000 + 2 * (16), 1, 
+
+                                                                          0
+
+                                                                               );
+
+    StackDistance_Access(stack_distance, 0x8000 + 1 * (16), 1, 
+
+                                                                          0
+
+                                                                               );
+
+    StackDistance_Access(stack_distance, 0x8000, 1, 
+
+                                                   0
+
+                                                        );
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((StackDistance_Kickouts(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(211), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((StackDistance_DirtyKickouts(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(212), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((StackDistance_Kickouts(stack_distance, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(213), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((StackDistance_DirtyKickouts(stack_distance, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(214), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((StackDistance_Misses(stack_distance, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(215), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((StackDistance_Misses(stack_distance, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(216), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_StackDistance_should_MatchCaches_when_DirectMapped(void)
+
+{
+
+    compare_with_caches(1);
+
+}
+
+
+
+void test_StackDistance_should_MatchCaches_when_FourWay(void)
+
+{
+
+    compare_with_caches(4);
+
+}
+
+
+
+void test_StackDistance_should_MatchCaches_when_HighlyAssociative(void)
+
+{
+
+    compare_with_caches(32);
+
+}
+
+
+
+void test_StackDistance_should_MatchCaches_when_EveryAssociativity(void)
+
+{
+
+    stack_distance = StackDistance_CreateAllWays((16), (128 * (16)));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(237))));};
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        caches[i] = CacheData_Create(1u << i, 128 >> i, (16), 0);
+
+        if ((((caches[i])) != 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(242))));};
+
+    }
+
+
+
+    run_and_compare((8), 160);
+
+}
+
+
+
+
+
+
+
+static void compare_with_caches(uint32_t associativity)
+
+{
+
+    stack_distance = StackDistance_Create((16), associativity, (8));
+
+    if ((((stack_distance)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(253))));};
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (8); i++) {
+
+        caches[i] = CacheData_Create(1u << i, associativity, (16), 0);
+
+        if ((((caches[i])) != 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(258))));};
+
+    }
+
+
+
+    run_and_compare((8), (3000) / 16);
+
+}
+
+
+
+static void run_and_compare(uint32_t n_caches, uint32_t hot_blocks)
+
+{
+
+    uint64_t hits[(8)] = { 0 };
+
+    uint64_t misses[(8)] = { 0 };
+
+    uint64_t kickouts[(8)] = { 0 };
+
+    uint64_t dirty_kickouts[(8)] = { 0 };
+
+
+
+
+
+    uint32_t state = 99;
+
+    uint32_t n;
+
+    for (n = 0; n < (200000); n++) {
+
+        state = state * 1103515245 + 12345;
+
+        uint32_t range = (state >> 30) == 0 ? (3000) : hot_blocks;
+
+        uint64_t address = 0x30000000 + ((state >> 8) % range) * (16) +
+
+                           (state >> 4) % (16);
+
+        
+
+       _Bool 
+
+            write = (state >> 29) & 1;
+
+
+
+        StackDistance_Access(stack_distance, address, 1, write);
+
+
+
+        uint32_t i;
+
+        for (i = 0; i < n_caches; i++) {
+
+            result_t result;
+
+            if (write) {
+
+                CacheData_Write(caches[i], address, &result);
+
+            }
+
+            else {
+
+                CacheData_Read(caches[i], address, &result);
+
+            }
+
+
+
+            if (result == RESULT_HIT) {
+
+                hits[i]++;
+
+            }
+
+            else {
+
+                misses[i]++;
+
+            }
+
+            if (result == RESULT_MISS_KICKOUT || result == RESULT_MISS_DIRTY_KICKOUT) {
+
+                kickouts[i]++;
+
+            }
+
+            if (result == RESULT_MISS_DIRTY_KICKOUT) {
+
+                dirty_kickouts[i]++;
+
+            }
+
+        }
+
+    }
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_caches; i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((hits[i])), (_U_SINT)((StackDistance_Hits(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(310), UNITY_DISPLAY_STYLE_UINT64);
+
+        UnityAssertEqualNumber((_U_SINT)((misses[i])), (_U_SINT)((StackDistance_Misses(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(311), UNITY_DISPLAY_STYLE_UINT64);
+
+        UnityAssertEqualNumber((_U_SINT)((kickouts[i])), (_U_SINT)((StackDistance_Kickouts(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(312), UNITY_DISPLAY_STYLE_UINT64);
+
+        UnityAssertEqualNumber((_U_SINT)((dirty_kickouts[i])), (_U_SINT)((StackDistance_DirtyKickouts(stack_distance, i))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(313), UNITY_DISPLAY_STYLE_UINT64);
+
+    }
+
+}
@@ -0,0 +1,454 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TraceReader.h"
+#include "GzipStream.h"
+#include "DeltaTrace.h"
+#include "BlockTrace.h"
+#include "BlockStream.h"
+#include "BinaryTrace.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "TraceCache.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static uint32_t read_trace(char const * path, access_t * accesses);
+
+
+
+
+
+static void remove_cache(void);
+
+
+
+
+
+
+
+
+
+static trace_cache_t cache;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    remove_cache();
+
+    cache = 
+
+           ((void *)0)
+
+               ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    TraceCache_Destroy(cache);
+
+    remove_cache();
+
+    remove("build/test/test_TraceCache.bin");
+
+}
+
+
+
+void test_TraceCache_Create_should_Record_when_TraceIsNotCached(void)
+
+{
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    if ((((cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(81))));};
+
+
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(83))));};
+
+    if ((TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(84)));};
+
+}
+
+
+
+void test_TraceCache_Create_should_NotRecord_when_NotAsked(void)
+
+{
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    0
+
+                                                         );
+
+    if ((((cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(90))));};
+
+
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(92))));};
+
+    if (!(TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(93)));};
+
+}
+
+
+
+void test_TraceCache_Commit_should_AddCopyMatchingTrace(void)
+
+{
+
+    access_t expected[(64)];
+
+    uint32_t n_expected = read_trace("traces/traces-short/tr1", expected);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    TraceCache_Record(cache, expected, n_expected);
+
+    if ((TraceCache_Commit(cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(103)));};
+
+    if ((((TraceCache_Path(cache))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(104))));};
+
+    TraceCache_Destroy(cache);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    if (!(TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(108)));};
+
+    if ((((TraceCache_Path(cache))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(109))));};
+
+
+
+    access_t actual[(64)];
+
+    uint32_t n_actual = read_trace(TraceCache_Path(cache), actual);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(113), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 116, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceCache_Create_should_Miss_when_TraceDiffers(void)
+
+{
+
+    access_t accesses[(64)];
+
+    uint32_t n_accesses = read_trace("traces/traces-short/tr1", accesses);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    TraceCache_Record(cache, accesses, n_accesses);
+
+    if ((TraceCache_Commit(cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(127)));};
+
+    TraceCache_Destroy(cache);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr2", 
+
+                                                     1
+
+                                                         );
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(131))));};
+
+    if ((TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(132)));};
+
+}
+
+
+
+void test_TraceCache_Destroy_should_DiscardCopy_when_NotCommitted(void)
+
+{
+
+    access_t accesses[(64)];
+
+    read_trace("traces/traces-short/tr1", accesses);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    TraceCache_Record(cache, accesses, 2);
+
+    TraceCache_Destroy(cache);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "traces/traces-short/tr1", 
+
+                                                    1
+
+                                                        );
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(145))));};
+
+    if ((TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(146)));};
+
+}
+
+
+
+void test_TraceCache_Create_should_NotRecord_when_TraceIsBinary(void)
+
+{
+
+    FILE * file = fopen("build/test/test_TraceCache.bin", "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(152))));};
+
+    BinaryTrace_WriteHeader(file, 0);
+
+    fclose(file);
+
+
+
+    cache = TraceCache_Create("build/test/test_TraceCache", "build/test/test_TraceCache.bin", 
+
+                                                      1
+
+                                                          );
+
+    if ((((cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(157))));};
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(158))));};
+
+    if (!(TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(159)));};
+
+    if (!(TraceCache_Commit(cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(160)));};
+
+}
+
+
+
+void test_TraceCache_Create_should_NotRecord_when_DirectoryCannotBeCreated(void)
+
+{
+
+    cache = TraceCache_Create("build/test/test_TraceCache" "/missing/cache", "traces/traces-short/tr1", 
+
+                                                                     1
+
+                                                                         );
+
+    if ((((cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(166))));};
+
+    if ((((TraceCache_Path(cache))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(167))));};
+
+    if (!(TraceCache_Recording(cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(168)));};
+
+}
+
+
+
+
+
+
+
+static uint32_t read_trace(char const * path, access_t * accesses)
+
+{
+
+    trace_reader_t reader = TraceReader_Create(path, 
+
+                                                    0
+
+                                                         );
+
+    if ((((reader)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(176))));};
+
+    uint32_t n_accesses = TraceReader_Read(reader, accesses, (64));
+
+    if ((n_accesses < (64))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(178)));};
+
+    TraceReader_Destroy(reader);
+
+
+
+    return n_accesses;
+
+}
+
+
+
+static void remove_cache(void)
+
+{
+
+    DIR * dir = opendir("build/test/test_TraceCache");
+
+    if (dir == 
+
+              ((void *)0)
+
+                  ) {
+
+        return;
+
+    }
+
+
+
+    struct dirent * entry;
+
+    while ((entry = readdir(dir)) != 
+
+                                    ((void *)0)
+
+                                        ) {
+
+        char path[512];
+
+        snprintf(path, sizeof(path), "%s/%s", "build/test/test_TraceCache", entry->d_name);
+
+        if (entry->d_name[0] != '.') {
+
+            unlink(path);
+
+        }
+
+    }
+
+    closedir(dir);
+
+    rmdir("build/test/test_TraceCache");
+
+}
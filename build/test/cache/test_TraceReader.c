@@ -0,0 +1,1565 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "GzipStream.h"
+#include "DeltaTrace.h"
+#include "BlockTrace.h"
+#include "BlockStream.h"
+#include "BinaryTrace.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "TraceReader.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static uint32_t read_reference(char const * path, access_t * accesses, uint32_t max_accesses);
+
+
+
+
+
+static void write_binary(char const * path, access_t const * accesses,
+
+                         uint32_t n_accesses, uint64_t header_count);
+
+
+
+
+
+
+
+
+
+
+
+
+
+static void write_gzip(char const * path, char const * gz_path, 
+
+                                                               _Bool 
+
+                                                                    truncate);
+
+
+
+
+
+static void write_blocks(char const * path, access_t const * accesses, uint32_t n_accesses);
+
+
+
+
+
+
+
+
+
+
+
+static void write_delta(char const * path, access_t const * accesses, uint32_t n_accesses,
+
+                        
+
+                       _Bool 
+
+                            truncate);
+
+
+
+
+
+
+
+
+
+static trace_reader_t reader;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    reader = 
+
+            ((void *)0)
+
+                ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    TraceReader_Destroy(reader);
+
+    remove("build/test/test_TraceReader.bin");
+
+    remove("build/test/test_TraceReader.gz");
+
+    remove("build/test/test_TraceReader.blk");
+
+    remove("build/test/test_TraceReader.dlt");
+
+}
+
+
+
+void test_TraceReader_Read_should_MatchParseLine_when_ReadingTextFile(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(109), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 112, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((TraceReader_Read(reader, actual, 32))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(114), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_TraceReader_Read_should_ReturnFullBatches_until_TraceEnds(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+
+
+    access_t actual[3];
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+
+
+    uint32_t n_total = 0;
+
+    uint32_t n_read;
+
+    while ((n_read = TraceReader_Read(reader, actual, 3)) > 0) {
+
+        uint32_t i;
+
+        for (i = 0; i < n_read; i++) {
+
+            AssertEqual_access_t(expected[n_total + i], actual[i], 130, 
+
+           ((void *)0)
+
+           );
+
+        }
+
+        n_total += n_read;
+
+        if (n_total < n_expected) {
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((n_read)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(134), UNITY_DISPLAY_STYLE_UINT32);
+
+        }
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_total)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(137), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_TraceReader_Read_should_PointToBadTraceLine(void)
+
+{
+
+    access_t accesses[8];
+
+
+
+    reader = TraceReader_Create("test/support/trace_with_error_line_3", 
+
+                                               0
+
+                                                    );
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        TraceReader_Read(reader, accesses, 8);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((SYNTAX_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(152), UNITY_DISPLAY_STYLE_HEX32);
+
+    UnityAssertEqualString((const char*)(("test/support/trace_with_error_line_3")), (const char*)((exception_file)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(153));
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((exception_line)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(154), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_TraceReader_Create_should_ThrowException_when_FileDoesNotExist(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        reader = TraceReader_Create("doesnt/exist/at/all", 
+
+                                                          0
+
+                                                               );
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(165), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_TraceReader_Read_should_MatchText_when_ReadingBinaryFile(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_binary("build/test/test_TraceReader.bin", expected, n_expected, n_expected);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.bin", 
+
+                                             1
+
+                                                 );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(178), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 181, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_Read_should_ThrowException_when_BinaryTraceIsShort(void)
+
+{
+
+    access_t accesses[32];
+
+    uint32_t n_accesses = read_reference("traces/traces-short/tr1", accesses, 32);
+
+    write_binary("build/test/test_TraceReader.bin", accesses, n_accesses, n_accesses + 1);
+
+
+
+    reader = TraceReader_Create("build/test/test_TraceReader.bin", 
+
+                                             1
+
+                                                 );
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        TraceReader_Read(reader, accesses, 32);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(199), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_TraceReader_Create_should_ThrowException_when_BinaryHeaderIsBad(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                               1
+
+                                                   );
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(210), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_TraceReader_Read_should_MatchText_when_ReadingGzipFile(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_gzip("traces/traces-short/tr1", "build/test/test_TraceReader.gz", 
+
+                                      0
+
+                                           );
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.gz", 
+
+                                           0
+
+                                                );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(223), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 226, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_Read_should_ThrowException_when_GzipFileIsTruncated(void)
+
+{
+
+    access_t accesses[32];
+
+    write_gzip("traces/traces-short/tr1", "build/test/test_TraceReader.gz", 
+
+                                      1
+
+                                          );
+
+
+
+    reader = TraceReader_Create("build/test/test_TraceReader.gz", 
+
+                                           0
+
+                                                );
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        TraceReader_Read(reader, accesses, 32);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(243), UNITY_DISPLAY_STYLE_HEX32);
+
+    UnityAssertEqualString((const char*)(("build/test/test_TraceReader.gz")), (const char*)((exception_file)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(244));
+
+}
+
+
+
+void test_TraceReader_Read_should_MatchText_when_ReadingBlockTrace(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_blocks("build/test/test_TraceReader.blk", expected, n_expected);
+
+
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.blk", 
+
+                                            0
+
+                                                 );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(258), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 261, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_Skip_should_StartMidBlock_when_ReadingBlockTrace(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_blocks("build/test/test_TraceReader.blk", expected, n_expected);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.blk", 
+
+                                            0
+
+                                                 );
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((TraceReader_Skip(reader, 4))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(273), UNITY_DISPLAY_STYLE_UINT64);
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected - 4)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(276), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[4 + i], actual[i], 279, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_Skip_should_StopAtEnd_when_SkippingPastEnd(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_blocks("build/test/test_TraceReader.blk", expected, n_expected);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.blk", 
+
+                                            0
+
+                                                 );
+
+    UnityAssertEqualNumber((_U_SINT)((n_expected)), (_U_SINT)((TraceReader_Skip(reader, 1000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(291), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((TraceReader_Read(reader, actual, 32))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(292), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    TraceReader_Destroy(reader);
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    UnityAssertEqualNumber((_U_SINT)((n_expected)), (_U_SINT)((TraceReader_Skip(reader, 1000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(296), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((TraceReader_Read(reader, actual, 32))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(297), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_TraceReader_Skip_should_DiscardAccesses_when_ReadingText(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((TraceReader_Skip(reader, 7))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(307), UNITY_DISPLAY_STYLE_UINT64);
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected - 7)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(310), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(expected[7], actual[0], 311, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_TraceReader_Seek_should_MoveToOffset_when_ReadingText(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((4)), (_U_SINT)(_UU32)((TraceReader_Read(reader, actual, 4))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(322), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint64_t offset = TraceReader_Offset(reader);
+
+    TraceReader_Destroy(reader);
+
+
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    TraceReader_Seek(reader, offset, 4);
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected - 4)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(330), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(expected[4], actual[0], 331, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_TraceReader_Seek_should_MoveToOffset_when_ReadingGzipFile(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_gzip("traces/traces-short/tr1", "build/test/test_TraceReader.gz", 
+
+                                      0
+
+                                           );
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.gz", 
+
+                                           0
+
+                                                );
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((6)), (_U_SINT)(_UU32)((TraceReader_Read(reader, actual, 6))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(342), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint64_t offset = TraceReader_Offset(reader);
+
+    TraceReader_Destroy(reader);
+
+
+
+    reader = TraceReader_Create("build/test/test_TraceReader.gz", 
+
+                                           0
+
+                                                );
+
+    TraceReader_Seek(reader, offset, 6);
+
+    UnityAssertEqualNumber((_U_SINT)((offset)), (_U_SINT)((TraceReader_Offset(reader))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(348), UNITY_DISPLAY_STYLE_UINT64);
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected - 6)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(351), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(expected[6], actual[0], 352, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_TraceReader_Seek_should_ThrowException_when_TraceIsBinary(void)
+
+{
+
+    access_t accesses[32];
+
+    uint32_t n_accesses = read_reference("traces/traces-short/tr1", accesses, 32);
+
+    write_binary("build/test/test_TraceReader.bin", accesses, n_accesses, n_accesses);
+
+
+
+    reader = TraceReader_Create("build/test/test_TraceReader.bin", 
+
+                                             1
+
+                                                 );
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        TraceReader_Seek(reader, 0, 0);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(369), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_TraceReader_Skip_should_StepOverRecords_when_ReadingBinaryFile(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_binary("build/test/test_TraceReader.bin", expected, n_expected, n_expected);
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.bin", 
+
+                                             1
+
+                                                 );
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((TraceReader_Skip(reader, 3))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(380), UNITY_DISPLAY_STYLE_UINT64);
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected - 3)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(383), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(expected[3], actual[0], 384, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_TraceReader_Read_should_MatchText_when_ReadingDeltaTrace(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_delta("build/test/test_TraceReader.dlt", expected, n_expected, 
+
+                                                  0
+
+                                                       );
+
+
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.dlt", 
+
+                                            0
+
+                                                 );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(398), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 401, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_ReadRuns_should_ExpandToText_when_ReadingDeltaTrace(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_delta("build/test/test_TraceReader.dlt", expected, n_expected, 
+
+                                                  0
+
+                                                       );
+
+
+
+
+
+    access_t actual[32];
+
+    reader = TraceReader_Create("build/test/test_TraceReader.dlt", 
+
+                                            0
+
+                                                 );
+
+    uint32_t n_actual = TraceReader_Read(reader, actual, 1);
+
+
+
+
+
+    uint32_t n_total = 0;
+
+    access_run_t runs[32];
+
+    uint32_t n_runs;
+
+    while ((n_runs = TraceReader_ReadRuns(reader, runs, 32)) > 0) {
+
+        uint32_t i;
+
+        for (i = 0; i < n_runs; i++) {
+
+            uint64_t address = runs[i].address;
+
+            uint32_t k;
+
+            for (k = 0; k < runs[i].n_accesses; k++) {
+
+                actual[n_actual].type = runs[i].type;
+
+                actual[n_actual].address = address;
+
+                actual[n_actual].n_bytes = runs[i].sizes[k];
+
+                address += runs[i].sizes[k];
+
+                n_actual++;
+
+            }
+
+            UnityAssertEqualNumber((_U_SINT)((runs[i].n_bytes)), (_U_SINT)((address - runs[i].address)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(432), UNITY_DISPLAY_STYLE_UINT64);
+
+        }
+
+        n_total += n_runs;
+
+    }
+
+
+
+
+
+    if ((n_total < n_expected - 1)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(438)));};
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(439), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[i], actual[i], 442, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceReader_ReadRuns_should_WrapEachAccess_when_ReadingText(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+
+
+    access_run_t runs[32];
+
+    reader = TraceReader_Create("traces/traces-short/tr1", 
+
+                                           0
+
+                                                );
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((n_expected)), (_U_SINT)(_UU32)((TraceReader_ReadRuns(reader, runs, 32))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(453), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_expected; i++) {
+
+        UnityAssertEqualNumber((_U_SINT)(_US8 )((expected[i].type)), (_U_SINT)(_US8 )((runs[i].type)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(457), UNITY_DISPLAY_STYLE_HEX8);
+
+        UnityAssertEqualNumber((_U_SINT)((expected[i].address)), (_U_SINT)((runs[i].address)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(458), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((expected[i].n_bytes)), (_U_SINT)((runs[i].n_bytes)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(459), UNITY_DISPLAY_STYLE_UINT64);
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((runs[i].n_accesses)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(460), UNITY_DISPLAY_STYLE_UINT32);
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)((expected[i].n_bytes)), (_U_SINT)(_UU32)((runs[i].sizes[0])), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(461), UNITY_DISPLAY_STYLE_UINT32);
+
+    }
+
+}
+
+
+
+void test_TraceReader_Read_should_ThrowException_when_DeltaTraceIsTruncated(void)
+
+{
+
+    access_t expected[32];
+
+    uint32_t n_expected = read_reference("traces/traces-short/tr1", expected, 32);
+
+    write_delta("build/test/test_TraceReader.dlt", expected, n_expected, 
+
+                                                  1
+
+                                                      );
+
+
+
+    access_t actual[32];
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        reader = TraceReader_Create("build/test/test_TraceReader.dlt", 
+
+                                                0
+
+                                                     );
+
+        TraceReader_Read(reader, actual, 32);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(479), UNITY_DISPLAY_STYLE_HEX32);
+
+    UnityAssertEqualString((const char*)(("build/test/test_TraceReader.dlt")), (const char*)((exception_file)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(480));
+
+}
+
+
+
+
+
+
+
+static uint32_t read_reference(char const * path, access_t * accesses, uint32_t max_accesses)
+
+{
+
+    FILE * file = fopen(path, "r");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(488))));};
+
+
+
+    uint32_t n_accesses = 0;
+
+    char line[128];
+
+    while (n_accesses < max_accesses && fgets(line, sizeof(line), file)) {
+
+        Access_ParseLine(line, &accesses[n_accesses]);
+
+        n_accesses++;
+
+    }
+
+
+
+    fclose(file);
+
+    return n_accesses;
+
+}
+
+
+
+static void write_binary(char const * path, access_t const * accesses,
+
+                         uint32_t n_accesses, uint64_t header_count)
+
+{
+
+    FILE * file = fopen(path, "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(505))));};
+
+
+
+    BinaryTrace_WriteHeader(file, header_count);
+
+    BinaryTrace_Write(file, accesses, n_accesses);
+
+
+
+    fclose(file);
+
+}
+
+
+
+static void write_gzip(char const * path, char const * gz_path, 
+
+                                                               _Bool 
+
+                                                                    truncate)
+
+{
+
+    char text[4096];
+
+    FILE * file = fopen(path, "r");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(517))));};
+
+    size_t length = fread(text, 1, sizeof(text), file);
+
+    fclose(file);
+
+
+
+    uint8_t compressed[4096];
+
+    z_stream z;
+
+    memset(&z, 0, sizeof(z));
+
+    UnityAssertEqualNumber((_U_SINT)((
+
+   0
+
+   )), (_U_SINT)((
+
+   deflateInit2_((
+
+   &z
+
+   ),((-1)),(8),(
+
+   15 + 16
+
+   ),(
+
+   8
+
+   ), (0), "1.2.13", (int)sizeof(z_stream))
+
+   )), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(524), UNITY_DISPLAY_STYLE_INT)
+
+                                                                         ;
+
+    z.next_in = (uint8_t *) text;
+
+    z.avail_in = length;
+
+    z.next_out = compressed;
+
+    z.avail_out = sizeof(compressed);
+
+    UnityAssertEqualNumber((_U_SINT)((
+
+   1
+
+   )), (_U_SINT)((deflate(&z, 
+
+   4
+
+   ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(530), UNITY_DISPLAY_STYLE_INT);
+
+    size_t n_compressed = z.total_out;
+
+    deflateEnd(&z);
+
+
+
+    if (truncate) {
+
+
+
+        n_compressed -= 4;
+
+    }
+
+
+
+    file = fopen(gz_path, "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(540))));};
+
+    UnityAssertEqualNumber((_U_SINT)((n_compressed)), (_U_SINT)((fwrite(compressed, 1, n_compressed, file))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(541), UNITY_DISPLAY_STYLE_INT);
+
+    fclose(file);
+
+}
+
+
+
+static void write_blocks(char const * path, access_t const * accesses, uint32_t n_accesses)
+
+{
+
+    FILE * file = fopen(path, "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(548))));};
+
+
+
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, (3));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(551))));};
+
+    BlockTrace_Write(writer, accesses, n_accesses);
+
+    BlockTrace_Finish(writer);
+
+    BlockTrace_DestroyWriter(writer);
+
+
+
+    fclose(file);
+
+}
+
+
+
+static void write_delta(char const * path, access_t const * accesses, uint32_t n_accesses,
+
+                        
+
+                       _Bool 
+
+                            truncate)
+
+{
+
+    FILE * file = fopen(path, "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(563))));};
+
+
+
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, (5));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(566))));};
+
+    DeltaTrace_Write(writer, accesses, n_accesses);
+
+    if (truncate) {
+
+
+
+        DeltaTrace_DestroyWriter(writer);
+
+        fclose(file);
+
+        return;
+
+    }
+
+    DeltaTrace_Finish(writer);
+
+    DeltaTrace_DestroyWriter(writer);
+
+
+
+    fclose(file);
+
+}
@@ -0,0 +1,1400 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_CacheData.h"
+
+static const char* CMockString_CacheData_AccessBatch = "CacheData_AccessBatch";
+static const char* CMockString_CacheData_Contains = "CacheData_Contains";
+static const char* CMockString_CacheData_Create = "CacheData_Create";
+static const char* CMockString_CacheData_Destroy = "CacheData_Destroy";
+static const char* CMockString_CacheData_Prefetch = "CacheData_Prefetch";
+static const char* CMockString_CacheData_PrefetchEnabled = "CacheData_PrefetchEnabled";
+static const char* CMockString_CacheData_Print = "CacheData_Print";
+static const char* CMockString_CacheData_Read = "CacheData_Read";
+static const char* CMockString_CacheData_Write = "CacheData_Write";
+static const char* CMockString_accesses = "accesses";
+static const char* CMockString_address = "address";
+static const char* CMockString_block_size_bytes = "block_size_bytes";
+static const char* CMockString_data = "data";
+static const char* CMockString_dirty_kickout_addresses = "dirty_kickout_addresses";
+static const char* CMockString_n_accesses = "n_accesses";
+static const char* CMockString_n_sets = "n_sets";
+static const char* CMockString_result = "result";
+static const char* CMockString_results = "results";
+static const char* CMockString_set_len = "set_len";
+static const char* CMockString_victim_cache_len_blocks = "victim_cache_len_blocks";
+
+typedef struct _CMOCK_CacheData_Create_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  cache_data_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_n_sets;
+  uint32_t Expected_set_len;
+  uint32_t Expected_block_size_bytes;
+  uint32_t Expected_victim_cache_len_blocks;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_n_sets;
+  int IgnoreArg_set_len;
+  int IgnoreArg_block_size_bytes;
+  int IgnoreArg_victim_cache_len_blocks;
+
+} CMOCK_CacheData_Create_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Destroy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_data_t Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_data;
+
+} CMOCK_CacheData_Destroy_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Contains_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  cache_data_t Expected_data;
+  uint64_t Expected_address;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_data;
+  int IgnoreArg_address;
+
+} CMOCK_CacheData_Contains_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Write_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  cache_data_t Expected_data;
+  uint64_t Expected_address;
+  result_t* Expected_result;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_result_Used;
+  result_t* ReturnThruPtr_result_Val;
+  int ReturnThruPtr_result_Size;
+  int IgnoreArg_data;
+  int IgnoreArg_address;
+  int IgnoreArg_result;
+
+} CMOCK_CacheData_Write_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Read_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  cache_data_t Expected_data;
+  uint64_t Expected_address;
+  result_t* Expected_result;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_result_Used;
+  result_t* ReturnThruPtr_result_Val;
+  int ReturnThruPtr_result_Size;
+  int IgnoreArg_data;
+  int IgnoreArg_address;
+  int IgnoreArg_result;
+
+} CMOCK_CacheData_Read_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Prefetch_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_data_t Expected_data;
+  uint64_t Expected_address;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_data;
+  int IgnoreArg_address;
+
+} CMOCK_CacheData_Prefetch_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  cache_data_t Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_data;
+
+} CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_AccessBatch_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_data_t Expected_data;
+  access_t const* Expected_accesses;
+  uint32_t Expected_n_accesses;
+  result_t* Expected_results;
+  uint64_t* Expected_dirty_kickout_addresses;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_results_Used;
+  result_t* ReturnThruPtr_results_Val;
+  int ReturnThruPtr_results_Size;
+  int ReturnThruPtr_dirty_kickout_addresses_Used;
+  uint64_t* ReturnThruPtr_dirty_kickout_addresses_Val;
+  int ReturnThruPtr_dirty_kickout_addresses_Size;
+  int IgnoreArg_data;
+  int IgnoreArg_accesses;
+  int IgnoreArg_n_accesses;
+  int IgnoreArg_results;
+  int IgnoreArg_dirty_kickout_addresses;
+
+} CMOCK_CacheData_AccessBatch_CALL_INSTANCE;
+
+typedef struct _CMOCK_CacheData_Print_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_data_t Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_data;
+
+} CMOCK_CacheData_Print_CALL_INSTANCE;
+
+static struct mock_CacheDataInstance
+{
+  int CacheData_Create_IgnoreBool;
+  cache_data_t CacheData_Create_FinalReturn;
+  CMOCK_CacheData_Create_CALLBACK CacheData_Create_CallbackFunctionPointer;
+  int CacheData_Create_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Create_CallInstance;
+  int CacheData_Destroy_IgnoreBool;
+  CMOCK_CacheData_Destroy_CALLBACK CacheData_Destroy_CallbackFunctionPointer;
+  int CacheData_Destroy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Destroy_CallInstance;
+  int CacheData_Contains_IgnoreBool;
+  _Bool CacheData_Contains_FinalReturn;
+  CMOCK_CacheData_Contains_CALLBACK CacheData_Contains_CallbackFunctionPointer;
+  int CacheData_Contains_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Contains_CallInstance;
+  int CacheData_Write_IgnoreBool;
+  uint64_t CacheData_Write_FinalReturn;
+  CMOCK_CacheData_Write_CALLBACK CacheData_Write_CallbackFunctionPointer;
+  int CacheData_Write_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Write_CallInstance;
+  int CacheData_Read_IgnoreBool;
+  uint64_t CacheData_Read_FinalReturn;
+  CMOCK_CacheData_Read_CALLBACK CacheData_Read_CallbackFunctionPointer;
+  int CacheData_Read_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Read_CallInstance;
+  int CacheData_Prefetch_IgnoreBool;
+  CMOCK_CacheData_Prefetch_CALLBACK CacheData_Prefetch_CallbackFunctionPointer;
+  int CacheData_Prefetch_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Prefetch_CallInstance;
+  int CacheData_PrefetchEnabled_IgnoreBool;
+  _Bool CacheData_PrefetchEnabled_FinalReturn;
+  CMOCK_CacheData_PrefetchEnabled_CALLBACK CacheData_PrefetchEnabled_CallbackFunctionPointer;
+  int CacheData_PrefetchEnabled_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_PrefetchEnabled_CallInstance;
+  int CacheData_AccessBatch_IgnoreBool;
+  CMOCK_CacheData_AccessBatch_CALLBACK CacheData_AccessBatch_CallbackFunctionPointer;
+  int CacheData_AccessBatch_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_AccessBatch_CallInstance;
+  int CacheData_Print_IgnoreBool;
+  CMOCK_CacheData_Print_CALLBACK CacheData_Print_CallbackFunctionPointer;
+  int CacheData_Print_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CacheData_Print_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_CacheData_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.CacheData_Create_IgnoreBool)
+    Mock.CacheData_Create_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Create);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Create_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Create_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Create_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Destroy_IgnoreBool)
+    Mock.CacheData_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Destroy);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Destroy_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Destroy_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Contains_IgnoreBool)
+    Mock.CacheData_Contains_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Contains);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Contains_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Contains_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Contains_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Write_IgnoreBool)
+    Mock.CacheData_Write_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Write);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Write_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Write_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Write_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Read_IgnoreBool)
+    Mock.CacheData_Read_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Read);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Read_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Read_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Read_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Prefetch_IgnoreBool)
+    Mock.CacheData_Prefetch_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Prefetch);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Prefetch_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Prefetch_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Prefetch_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_PrefetchEnabled_IgnoreBool)
+    Mock.CacheData_PrefetchEnabled_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_PrefetchEnabled);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_PrefetchEnabled_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_PrefetchEnabled_CallbackFunctionPointer != NULL)
+    Mock.CacheData_PrefetchEnabled_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_AccessBatch_IgnoreBool)
+    Mock.CacheData_AccessBatch_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_AccessBatch);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_AccessBatch_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_AccessBatch_CallbackFunctionPointer != NULL)
+    Mock.CacheData_AccessBatch_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.CacheData_Print_IgnoreBool)
+    Mock.CacheData_Print_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_CacheData_Print);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.CacheData_Print_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.CacheData_Print_CallbackFunctionPointer != NULL)
+    Mock.CacheData_Print_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_CacheData_Init(void)
+{
+  mock_CacheData_Destroy();
+}
+
+void mock_CacheData_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.CacheData_Create_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Create_CallbackCalls = 0;
+  Mock.CacheData_Destroy_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Destroy_CallbackCalls = 0;
+  Mock.CacheData_Contains_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Contains_CallbackCalls = 0;
+  Mock.CacheData_Write_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Write_CallbackCalls = 0;
+  Mock.CacheData_Read_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Read_CallbackCalls = 0;
+  Mock.CacheData_Prefetch_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Prefetch_CallbackCalls = 0;
+  Mock.CacheData_PrefetchEnabled_CallbackFunctionPointer = NULL;
+  Mock.CacheData_PrefetchEnabled_CallbackCalls = 0;
+  Mock.CacheData_AccessBatch_CallbackFunctionPointer = NULL;
+  Mock.CacheData_AccessBatch_CallbackCalls = 0;
+  Mock.CacheData_Print_CallbackFunctionPointer = NULL;
+  Mock.CacheData_Print_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+cache_data_t CacheData_Create(uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Create);
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Create_CallInstance);
+  Mock.CacheData_Create_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Create_CallInstance);
+  if (Mock.CacheData_Create_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CacheData_Create_FinalReturn;
+    memcpy(&Mock.CacheData_Create_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(cache_data_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.CacheData_Create_CallbackFunctionPointer != NULL)
+  {
+    return Mock.CacheData_Create_CallbackFunctionPointer(n_sets, set_len, block_size_bytes, victim_cache_len_blocks, Mock.CacheData_Create_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_n_sets)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Create,CMockString_n_sets);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_sets, n_sets, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_set_len)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Create,CMockString_set_len);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_set_len, set_len, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_block_size_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Create,CMockString_block_size_bytes);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_block_size_bytes, block_size_bytes, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_victim_cache_len_blocks)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Create,CMockString_victim_cache_len_blocks);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_victim_cache_len_blocks, victim_cache_len_blocks, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CacheData_Create(CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance, uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks)
+{
+  cmock_call_instance->Expected_n_sets = n_sets;
+  cmock_call_instance->IgnoreArg_n_sets = 0;
+  cmock_call_instance->Expected_set_len = set_len;
+  cmock_call_instance->IgnoreArg_set_len = 0;
+  cmock_call_instance->Expected_block_size_bytes = block_size_bytes;
+  cmock_call_instance->IgnoreArg_block_size_bytes = 0;
+  cmock_call_instance->Expected_victim_cache_len_blocks = victim_cache_len_blocks;
+  cmock_call_instance->IgnoreArg_victim_cache_len_blocks = 0;
+}
+
+void CacheData_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Create_CALL_INSTANCE));
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Create_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Create_CallInstance, cmock_guts_index);
+  Mock.CacheData_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CacheData_Create_IgnoreBool = (int)1;
+}
+
+void CacheData_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks, cache_data_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Create_CALL_INSTANCE));
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Create_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Create_CallInstance, cmock_guts_index);
+  Mock.CacheData_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Create(cmock_call_instance, n_sets, set_len, block_size_bytes, victim_cache_len_blocks);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(cache_data_t));
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Create_StubWithCallback(CMOCK_CacheData_Create_CALLBACK Callback)
+{
+  Mock.CacheData_Create_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Create_CALL_INSTANCE));
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Create_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Create_CallInstance, cmock_guts_index);
+  Mock.CacheData_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Create(cmock_call_instance, n_sets, set_len, block_size_bytes, victim_cache_len_blocks);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Create_CMockIgnoreArg_n_sets(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_sets = 1;
+}
+
+void CacheData_Create_CMockIgnoreArg_set_len(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_set_len = 1;
+}
+
+void CacheData_Create_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_block_size_bytes = 1;
+}
+
+void CacheData_Create_CMockIgnoreArg_victim_cache_len_blocks(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_victim_cache_len_blocks = 1;
+}
+
+void CacheData_Destroy(cache_data_t data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Destroy);
+  CMOCK_CacheData_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Destroy_CallInstance);
+  Mock.CacheData_Destroy_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Destroy_CallInstance);
+  if (Mock.CacheData_Destroy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.CacheData_Destroy_CallbackFunctionPointer != NULL)
+  {
+    Mock.CacheData_Destroy_CallbackFunctionPointer(data, Mock.CacheData_Destroy_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Destroy,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_CacheData_Destroy(CMOCK_CacheData_Destroy_CALL_INSTANCE* cmock_call_instance, cache_data_t data)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void CacheData_Destroy_CMockIgnore(void)
+{
+  Mock.CacheData_Destroy_IgnoreBool = (int)1;
+}
+
+void CacheData_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Destroy_CALL_INSTANCE));
+  CMOCK_CacheData_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Destroy_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Destroy_CallInstance, cmock_guts_index);
+  Mock.CacheData_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Destroy(cmock_call_instance, data);
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Destroy_StubWithCallback(CMOCK_CacheData_Destroy_CALLBACK Callback)
+{
+  Mock.CacheData_Destroy_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Destroy_CALL_INSTANCE));
+  CMOCK_CacheData_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Destroy_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Destroy_CallInstance, cmock_guts_index);
+  Mock.CacheData_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Destroy(cmock_call_instance, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Destroy_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Destroy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+_Bool CacheData_Contains(cache_data_t data, uint64_t address)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Contains);
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Contains_CallInstance);
+  Mock.CacheData_Contains_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Contains_CallInstance);
+  if (Mock.CacheData_Contains_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CacheData_Contains_FinalReturn;
+    memcpy(&Mock.CacheData_Contains_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(_Bool));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.CacheData_Contains_CallbackFunctionPointer != NULL)
+  {
+    return Mock.CacheData_Contains_CallbackFunctionPointer(data, address, Mock.CacheData_Contains_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Contains,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Contains,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CacheData_Contains(CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance, cache_data_t data, uint64_t address)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+}
+
+void CacheData_Contains_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Contains_CALL_INSTANCE));
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Contains_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Contains_CallInstance, cmock_guts_index);
+  Mock.CacheData_Contains_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CacheData_Contains_IgnoreBool = (int)1;
+}
+
+void CacheData_Contains_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Contains_CALL_INSTANCE));
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Contains_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Contains_CallInstance, cmock_guts_index);
+  Mock.CacheData_Contains_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Contains(cmock_call_instance, data, address);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(_Bool));
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Contains_StubWithCallback(CMOCK_CacheData_Contains_CALLBACK Callback)
+{
+  Mock.CacheData_Contains_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Contains_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Contains_CALL_INSTANCE));
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Contains_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Contains_CallInstance, cmock_guts_index);
+  Mock.CacheData_Contains_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Contains(cmock_call_instance, data, address);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Contains_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Contains_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_Contains_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Contains_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Contains_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Contains_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+uint64_t CacheData_Write(cache_data_t data, uint64_t address, result_t* result)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Write);
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Write_CallInstance);
+  Mock.CacheData_Write_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Write_CallInstance);
+  if (Mock.CacheData_Write_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CacheData_Write_FinalReturn;
+    memcpy(&Mock.CacheData_Write_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.CacheData_Write_CallbackFunctionPointer != NULL)
+  {
+    return Mock.CacheData_Write_CallbackFunctionPointer(data, address, result, Mock.CacheData_Write_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Write,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Write,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_result)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Write,CMockString_result);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_result), (void*)(result), sizeof(result_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_result_Used)
+  {
+    memcpy(result, cmock_call_instance->ReturnThruPtr_result_Val,
+      cmock_call_instance->ReturnThruPtr_result_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CacheData_Write(CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance, cache_data_t data, uint64_t address, result_t* result)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+  cmock_call_instance->Expected_result = result;
+  cmock_call_instance->IgnoreArg_result = 0;
+  cmock_call_instance->ReturnThruPtr_result_Used = 0;
+}
+
+void CacheData_Write_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Write_CALL_INSTANCE));
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Write_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Write_CallInstance, cmock_guts_index);
+  Mock.CacheData_Write_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CacheData_Write_IgnoreBool = (int)1;
+}
+
+void CacheData_Write_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Write_CALL_INSTANCE));
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Write_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Write_CallInstance, cmock_guts_index);
+  Mock.CacheData_Write_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Write(cmock_call_instance, data, address, result);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Write_StubWithCallback(CMOCK_CacheData_Write_CALLBACK Callback)
+{
+  Mock.CacheData_Write_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Write_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Write_CALL_INSTANCE));
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Write_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Write_CallInstance, cmock_guts_index);
+  Mock.CacheData_Write_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Write(cmock_call_instance, data, address, result);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Write_CMockReturnMemThruPtr_result(UNITY_LINE_TYPE cmock_line, result_t* result, int cmock_size)
+{
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Write_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_result_Used = 1;
+  cmock_call_instance->ReturnThruPtr_result_Val = result;
+  cmock_call_instance->ReturnThruPtr_result_Size = cmock_size;
+}
+
+void CacheData_Write_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Write_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_Write_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Write_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+void CacheData_Write_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Write_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_result = 1;
+}
+
+uint64_t CacheData_Read(cache_data_t data, uint64_t address, result_t* result)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Read);
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Read_CallInstance);
+  Mock.CacheData_Read_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Read_CallInstance);
+  if (Mock.CacheData_Read_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CacheData_Read_FinalReturn;
+    memcpy(&Mock.CacheData_Read_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.CacheData_Read_CallbackFunctionPointer != NULL)
+  {
+    return Mock.CacheData_Read_CallbackFunctionPointer(data, address, result, Mock.CacheData_Read_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Read,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Read,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_result)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Read,CMockString_result);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_result), (void*)(result), sizeof(result_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_result_Used)
+  {
+    memcpy(result, cmock_call_instance->ReturnThruPtr_result_Val,
+      cmock_call_instance->ReturnThruPtr_result_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CacheData_Read(CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance, cache_data_t data, uint64_t address, result_t* result)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+  cmock_call_instance->Expected_result = result;
+  cmock_call_instance->IgnoreArg_result = 0;
+  cmock_call_instance->ReturnThruPtr_result_Used = 0;
+}
+
+void CacheData_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Read_CALL_INSTANCE));
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Read_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Read_CallInstance, cmock_guts_index);
+  Mock.CacheData_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CacheData_Read_IgnoreBool = (int)1;
+}
+
+void CacheData_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Read_CALL_INSTANCE));
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Read_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Read_CallInstance, cmock_guts_index);
+  Mock.CacheData_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Read(cmock_call_instance, data, address, result);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Read_StubWithCallback(CMOCK_CacheData_Read_CALLBACK Callback)
+{
+  Mock.CacheData_Read_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Read_CALL_INSTANCE));
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Read_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Read_CallInstance, cmock_guts_index);
+  Mock.CacheData_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Read(cmock_call_instance, data, address, result);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Read_CMockReturnMemThruPtr_result(UNITY_LINE_TYPE cmock_line, result_t* result, int cmock_size)
+{
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_result_Used = 1;
+  cmock_call_instance->ReturnThruPtr_result_Val = result;
+  cmock_call_instance->ReturnThruPtr_result_Size = cmock_size;
+}
+
+void CacheData_Read_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_Read_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+void CacheData_Read_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_result = 1;
+}
+
+void CacheData_Prefetch(cache_data_t data, uint64_t address)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Prefetch);
+  CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Prefetch_CallInstance);
+  Mock.CacheData_Prefetch_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Prefetch_CallInstance);
+  if (Mock.CacheData_Prefetch_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.CacheData_Prefetch_CallbackFunctionPointer != NULL)
+  {
+    Mock.CacheData_Prefetch_CallbackFunctionPointer(data, address, Mock.CacheData_Prefetch_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Prefetch,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Prefetch,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_CacheData_Prefetch(CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance, cache_data_t data, uint64_t address)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+}
+
+void CacheData_Prefetch_CMockIgnore(void)
+{
+  Mock.CacheData_Prefetch_IgnoreBool = (int)1;
+}
+
+void CacheData_Prefetch_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Prefetch_CALL_INSTANCE));
+  CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Prefetch_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Prefetch_CallInstance, cmock_guts_index);
+  Mock.CacheData_Prefetch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Prefetch(cmock_call_instance, data, address);
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Prefetch_StubWithCallback(CMOCK_CacheData_Prefetch_CALLBACK Callback)
+{
+  Mock.CacheData_Prefetch_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Prefetch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Prefetch_CALL_INSTANCE));
+  CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Prefetch_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Prefetch_CallInstance, cmock_guts_index);
+  Mock.CacheData_Prefetch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Prefetch(cmock_call_instance, data, address);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Prefetch_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Prefetch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_Prefetch_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Prefetch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+_Bool CacheData_PrefetchEnabled(cache_data_t data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_PrefetchEnabled);
+  CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_PrefetchEnabled_CallInstance);
+  Mock.CacheData_PrefetchEnabled_CallInstance = CMock_Guts_MemNext(Mock.CacheData_PrefetchEnabled_CallInstance);
+  if (Mock.CacheData_PrefetchEnabled_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CacheData_PrefetchEnabled_FinalReturn;
+    memcpy(&Mock.CacheData_PrefetchEnabled_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(_Bool));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.CacheData_PrefetchEnabled_CallbackFunctionPointer != NULL)
+  {
+    return Mock.CacheData_PrefetchEnabled_CallbackFunctionPointer(data, Mock.CacheData_PrefetchEnabled_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_PrefetchEnabled,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CacheData_PrefetchEnabled(CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance, cache_data_t data)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void CacheData_PrefetchEnabled_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.CacheData_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.CacheData_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CacheData_PrefetchEnabled_IgnoreBool = (int)1;
+}
+
+void CacheData_PrefetchEnabled_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.CacheData_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.CacheData_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_PrefetchEnabled(cmock_call_instance, data);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(_Bool));
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_PrefetchEnabled_StubWithCallback(CMOCK_CacheData_PrefetchEnabled_CALLBACK Callback)
+{
+  Mock.CacheData_PrefetchEnabled_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_PrefetchEnabled_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.CacheData_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.CacheData_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_PrefetchEnabled(cmock_call_instance, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_PrefetchEnabled_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_PrefetchEnabled_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_AccessBatch(cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_AccessBatch);
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_AccessBatch_CallInstance);
+  Mock.CacheData_AccessBatch_CallInstance = CMock_Guts_MemNext(Mock.CacheData_AccessBatch_CallInstance);
+  if (Mock.CacheData_AccessBatch_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.CacheData_AccessBatch_CallbackFunctionPointer != NULL)
+  {
+    Mock.CacheData_AccessBatch_CallbackFunctionPointer(data, accesses, n_accesses, results, dirty_kickout_addresses, Mock.CacheData_AccessBatch_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_AccessBatch,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_accesses)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_AccessBatch,CMockString_accesses);
+    UNITY_TEST_ASSERT_EQUAL_access_t(*cmock_call_instance->Expected_accesses, *accesses, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_n_accesses)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_AccessBatch,CMockString_n_accesses);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_accesses, n_accesses, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_results)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_AccessBatch,CMockString_results);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_results), (void*)(results), sizeof(result_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dirty_kickout_addresses)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_AccessBatch,CMockString_dirty_kickout_addresses);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_dirty_kickout_addresses), (void*)(dirty_kickout_addresses), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_results_Used)
+  {
+    memcpy(results, cmock_call_instance->ReturnThruPtr_results_Val,
+      cmock_call_instance->ReturnThruPtr_results_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Used)
+  {
+    memcpy(dirty_kickout_addresses, cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Val,
+      cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_CacheData_AccessBatch(CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance, cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+  cmock_call_instance->Expected_accesses = (access_t const*)accesses;
+  cmock_call_instance->IgnoreArg_accesses = 0;
+  cmock_call_instance->Expected_n_accesses = n_accesses;
+  cmock_call_instance->IgnoreArg_n_accesses = 0;
+  cmock_call_instance->Expected_results = results;
+  cmock_call_instance->IgnoreArg_results = 0;
+  cmock_call_instance->ReturnThruPtr_results_Used = 0;
+  cmock_call_instance->Expected_dirty_kickout_addresses = dirty_kickout_addresses;
+  cmock_call_instance->IgnoreArg_dirty_kickout_addresses = 0;
+  cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Used = 0;
+}
+
+void CacheData_AccessBatch_CMockIgnore(void)
+{
+  Mock.CacheData_AccessBatch_IgnoreBool = (int)1;
+}
+
+void CacheData_AccessBatch_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_AccessBatch_CALL_INSTANCE));
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_AccessBatch_CallInstance = CMock_Guts_MemChain(Mock.CacheData_AccessBatch_CallInstance, cmock_guts_index);
+  Mock.CacheData_AccessBatch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_AccessBatch(cmock_call_instance, data, accesses, n_accesses, results, dirty_kickout_addresses);
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_AccessBatch_StubWithCallback(CMOCK_CacheData_AccessBatch_CALLBACK Callback)
+{
+  Mock.CacheData_AccessBatch_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_AccessBatch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_AccessBatch_CALL_INSTANCE));
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_AccessBatch_CallInstance = CMock_Guts_MemChain(Mock.CacheData_AccessBatch_CallInstance, cmock_guts_index);
+  Mock.CacheData_AccessBatch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_AccessBatch(cmock_call_instance, data, accesses, n_accesses, results, dirty_kickout_addresses);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_AccessBatch_CMockReturnMemThruPtr_results(UNITY_LINE_TYPE cmock_line, result_t* results, int cmock_size)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_results_Used = 1;
+  cmock_call_instance->ReturnThruPtr_results_Val = results;
+  cmock_call_instance->ReturnThruPtr_results_Size = cmock_size;
+}
+
+void CacheData_AccessBatch_CMockReturnMemThruPtr_dirty_kickout_addresses(UNITY_LINE_TYPE cmock_line, uint64_t* dirty_kickout_addresses, int cmock_size)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Used = 1;
+  cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Val = dirty_kickout_addresses;
+  cmock_call_instance->ReturnThruPtr_dirty_kickout_addresses_Size = cmock_size;
+}
+
+void CacheData_AccessBatch_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void CacheData_AccessBatch_CMockIgnoreArg_accesses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_accesses = 1;
+}
+
+void CacheData_AccessBatch_CMockIgnoreArg_n_accesses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_accesses = 1;
+}
+
+void CacheData_AccessBatch_CMockIgnoreArg_results(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_results = 1;
+}
+
+void CacheData_AccessBatch_CMockIgnoreArg_dirty_kickout_addresses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_AccessBatch_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_AccessBatch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_AccessBatch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dirty_kickout_addresses = 1;
+}
+
+void CacheData_Print(cache_data_t data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_CacheData_Print);
+  CMOCK_CacheData_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CacheData_Print_CallInstance);
+  Mock.CacheData_Print_CallInstance = CMock_Guts_MemNext(Mock.CacheData_Print_CallInstance);
+  if (Mock.CacheData_Print_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.CacheData_Print_CallbackFunctionPointer != NULL)
+  {
+    Mock.CacheData_Print_CallbackFunctionPointer(data, Mock.CacheData_Print_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_CacheData_Print,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_data), (void*)(&data), sizeof(cache_data_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_CacheData_Print(CMOCK_CacheData_Print_CALL_INSTANCE* cmock_call_instance, cache_data_t data)
+{
+  memcpy(&cmock_call_instance->Expected_data, &data, sizeof(cache_data_t));
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void CacheData_Print_CMockIgnore(void)
+{
+  Mock.CacheData_Print_IgnoreBool = (int)1;
+}
+
+void CacheData_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Print_CALL_INSTANCE));
+  CMOCK_CacheData_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Print_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Print_CallInstance, cmock_guts_index);
+  Mock.CacheData_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Print(cmock_call_instance, data);
+  UNITY_CLR_DETAILS();
+}
+
+void CacheData_Print_StubWithCallback(CMOCK_CacheData_Print_CALLBACK Callback)
+{
+  Mock.CacheData_Print_CallbackFunctionPointer = Callback;
+}
+
+void CacheData_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CacheData_Print_CALL_INSTANCE));
+  CMOCK_CacheData_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CacheData_Print_CallInstance = CMock_Guts_MemChain(Mock.CacheData_Print_CallInstance, cmock_guts_index);
+  Mock.CacheData_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CacheData_Print(cmock_call_instance, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CacheData_Print_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CacheData_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_CacheData_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CacheData_Print_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
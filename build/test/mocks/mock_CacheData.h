@@ -0,0 +1,158 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_CACHEDATA_H
+#define _MOCK_CACHEDATA_H
+
+#include "unity_Helper.h"
+#include "CacheData.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_CacheData_Init(void);
+void mock_CacheData_Destroy(void);
+void mock_CacheData_Verify(void);
+
+
+
+
+#define CacheData_Create_IgnoreAndReturn(cmock_retval) CacheData_Create_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CacheData_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t cmock_to_return);
+#define CacheData_Create_ExpectAndReturn(n_sets, set_len, block_size_bytes, victim_cache_len_blocks, cmock_retval) CacheData_Create_CMockExpectAndReturn(__LINE__, n_sets, set_len, block_size_bytes, victim_cache_len_blocks, cmock_retval)
+void CacheData_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks, cache_data_t cmock_to_return);
+typedef cache_data_t (* CMOCK_CacheData_Create_CALLBACK)(uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks, int cmock_num_calls);
+void CacheData_Create_StubWithCallback(CMOCK_CacheData_Create_CALLBACK Callback);
+#define CacheData_Create_ExpectAndThrow(n_sets, set_len, block_size_bytes, victim_cache_len_blocks, cmock_to_throw) CacheData_Create_CMockExpectAndThrow(__LINE__, n_sets, set_len, block_size_bytes, victim_cache_len_blocks, cmock_to_throw)
+void CacheData_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t n_sets, uint32_t set_len, uint32_t block_size_bytes, uint32_t victim_cache_len_blocks, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Create_IgnoreArg_n_sets() CacheData_Create_CMockIgnoreArg_n_sets(__LINE__)
+void CacheData_Create_CMockIgnoreArg_n_sets(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Create_IgnoreArg_set_len() CacheData_Create_CMockIgnoreArg_set_len(__LINE__)
+void CacheData_Create_CMockIgnoreArg_set_len(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Create_IgnoreArg_block_size_bytes() CacheData_Create_CMockIgnoreArg_block_size_bytes(__LINE__)
+void CacheData_Create_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Create_IgnoreArg_victim_cache_len_blocks() CacheData_Create_CMockIgnoreArg_victim_cache_len_blocks(__LINE__)
+void CacheData_Create_CMockIgnoreArg_victim_cache_len_blocks(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Destroy_Ignore() CacheData_Destroy_CMockIgnore()
+void CacheData_Destroy_CMockIgnore(void);
+#define CacheData_Destroy_Expect(data) CacheData_Destroy_CMockExpect(__LINE__, data)
+void CacheData_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data);
+typedef void (* CMOCK_CacheData_Destroy_CALLBACK)(cache_data_t data, int cmock_num_calls);
+void CacheData_Destroy_StubWithCallback(CMOCK_CacheData_Destroy_CALLBACK Callback);
+#define CacheData_Destroy_ExpectAndThrow(data, cmock_to_throw) CacheData_Destroy_CMockExpectAndThrow(__LINE__, data, cmock_to_throw)
+void CacheData_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Destroy_IgnoreArg_data() CacheData_Destroy_CMockIgnoreArg_data(__LINE__)
+void CacheData_Destroy_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Contains_IgnoreAndReturn(cmock_retval) CacheData_Contains_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CacheData_Contains_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define CacheData_Contains_ExpectAndReturn(data, address, cmock_retval) CacheData_Contains_CMockExpectAndReturn(__LINE__, data, address, cmock_retval)
+void CacheData_Contains_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_CacheData_Contains_CALLBACK)(cache_data_t data, uint64_t address, int cmock_num_calls);
+void CacheData_Contains_StubWithCallback(CMOCK_CacheData_Contains_CALLBACK Callback);
+#define CacheData_Contains_ExpectAndThrow(data, address, cmock_to_throw) CacheData_Contains_CMockExpectAndThrow(__LINE__, data, address, cmock_to_throw)
+void CacheData_Contains_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Contains_IgnoreArg_data() CacheData_Contains_CMockIgnoreArg_data(__LINE__)
+void CacheData_Contains_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Contains_IgnoreArg_address() CacheData_Contains_CMockIgnoreArg_address(__LINE__)
+void CacheData_Contains_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Write_IgnoreAndReturn(cmock_retval) CacheData_Write_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CacheData_Write_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define CacheData_Write_ExpectAndReturn(data, address, result, cmock_retval) CacheData_Write_CMockExpectAndReturn(__LINE__, data, address, result, cmock_retval)
+void CacheData_Write_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_CacheData_Write_CALLBACK)(cache_data_t data, uint64_t address, result_t* result, int cmock_num_calls);
+void CacheData_Write_StubWithCallback(CMOCK_CacheData_Write_CALLBACK Callback);
+#define CacheData_Write_ExpectAndThrow(data, address, result, cmock_to_throw) CacheData_Write_CMockExpectAndThrow(__LINE__, data, address, result, cmock_to_throw)
+void CacheData_Write_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Write_ReturnThruPtr_result(result) CacheData_Write_CMockReturnMemThruPtr_result(__LINE__, result, sizeof(*result))
+#define CacheData_Write_ReturnArrayThruPtr_result(result, cmock_len) CacheData_Write_CMockReturnMemThruPtr_result(__LINE__, result, (int)(cmock_len * (int)sizeof(*result)))
+#define CacheData_Write_ReturnMemThruPtr_result(result, cmock_size) CacheData_Write_CMockReturnMemThruPtr_result(__LINE__, result, cmock_size)
+void CacheData_Write_CMockReturnMemThruPtr_result(UNITY_LINE_TYPE cmock_line, result_t* result, int cmock_size);
+#define CacheData_Write_IgnoreArg_data() CacheData_Write_CMockIgnoreArg_data(__LINE__)
+void CacheData_Write_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Write_IgnoreArg_address() CacheData_Write_CMockIgnoreArg_address(__LINE__)
+void CacheData_Write_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Write_IgnoreArg_result() CacheData_Write_CMockIgnoreArg_result(__LINE__)
+void CacheData_Write_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Read_IgnoreAndReturn(cmock_retval) CacheData_Read_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CacheData_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define CacheData_Read_ExpectAndReturn(data, address, result, cmock_retval) CacheData_Read_CMockExpectAndReturn(__LINE__, data, address, result, cmock_retval)
+void CacheData_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_CacheData_Read_CALLBACK)(cache_data_t data, uint64_t address, result_t* result, int cmock_num_calls);
+void CacheData_Read_StubWithCallback(CMOCK_CacheData_Read_CALLBACK Callback);
+#define CacheData_Read_ExpectAndThrow(data, address, result, cmock_to_throw) CacheData_Read_CMockExpectAndThrow(__LINE__, data, address, result, cmock_to_throw)
+void CacheData_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, result_t* result, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Read_ReturnThruPtr_result(result) CacheData_Read_CMockReturnMemThruPtr_result(__LINE__, result, sizeof(*result))
+#define CacheData_Read_ReturnArrayThruPtr_result(result, cmock_len) CacheData_Read_CMockReturnMemThruPtr_result(__LINE__, result, (int)(cmock_len * (int)sizeof(*result)))
+#define CacheData_Read_ReturnMemThruPtr_result(result, cmock_size) CacheData_Read_CMockReturnMemThruPtr_result(__LINE__, result, cmock_size)
+void CacheData_Read_CMockReturnMemThruPtr_result(UNITY_LINE_TYPE cmock_line, result_t* result, int cmock_size);
+#define CacheData_Read_IgnoreArg_data() CacheData_Read_CMockIgnoreArg_data(__LINE__)
+void CacheData_Read_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Read_IgnoreArg_address() CacheData_Read_CMockIgnoreArg_address(__LINE__)
+void CacheData_Read_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Read_IgnoreArg_result() CacheData_Read_CMockIgnoreArg_result(__LINE__)
+void CacheData_Read_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Prefetch_Ignore() CacheData_Prefetch_CMockIgnore()
+void CacheData_Prefetch_CMockIgnore(void);
+#define CacheData_Prefetch_Expect(data, address) CacheData_Prefetch_CMockExpect(__LINE__, data, address)
+void CacheData_Prefetch_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address);
+typedef void (* CMOCK_CacheData_Prefetch_CALLBACK)(cache_data_t data, uint64_t address, int cmock_num_calls);
+void CacheData_Prefetch_StubWithCallback(CMOCK_CacheData_Prefetch_CALLBACK Callback);
+#define CacheData_Prefetch_ExpectAndThrow(data, address, cmock_to_throw) CacheData_Prefetch_CMockExpectAndThrow(__LINE__, data, address, cmock_to_throw)
+void CacheData_Prefetch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, uint64_t address, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Prefetch_IgnoreArg_data() CacheData_Prefetch_CMockIgnoreArg_data(__LINE__)
+void CacheData_Prefetch_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Prefetch_IgnoreArg_address() CacheData_Prefetch_CMockIgnoreArg_address(__LINE__)
+void CacheData_Prefetch_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define CacheData_PrefetchEnabled_IgnoreAndReturn(cmock_retval) CacheData_PrefetchEnabled_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CacheData_PrefetchEnabled_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define CacheData_PrefetchEnabled_ExpectAndReturn(data, cmock_retval) CacheData_PrefetchEnabled_CMockExpectAndReturn(__LINE__, data, cmock_retval)
+void CacheData_PrefetchEnabled_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, cache_data_t data, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_CacheData_PrefetchEnabled_CALLBACK)(cache_data_t data, int cmock_num_calls);
+void CacheData_PrefetchEnabled_StubWithCallback(CMOCK_CacheData_PrefetchEnabled_CALLBACK Callback);
+#define CacheData_PrefetchEnabled_ExpectAndThrow(data, cmock_to_throw) CacheData_PrefetchEnabled_CMockExpectAndThrow(__LINE__, data, cmock_to_throw)
+void CacheData_PrefetchEnabled_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw);
+#define CacheData_PrefetchEnabled_IgnoreArg_data() CacheData_PrefetchEnabled_CMockIgnoreArg_data(__LINE__)
+void CacheData_PrefetchEnabled_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_AccessBatch_Ignore() CacheData_AccessBatch_CMockIgnore()
+void CacheData_AccessBatch_CMockIgnore(void);
+#define CacheData_AccessBatch_Expect(data, accesses, n_accesses, results, dirty_kickout_addresses) CacheData_AccessBatch_CMockExpect(__LINE__, data, accesses, n_accesses, results, dirty_kickout_addresses)
+void CacheData_AccessBatch_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses);
+typedef void (* CMOCK_CacheData_AccessBatch_CALLBACK)(cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses, int cmock_num_calls);
+void CacheData_AccessBatch_StubWithCallback(CMOCK_CacheData_AccessBatch_CALLBACK Callback);
+#define CacheData_AccessBatch_ExpectAndThrow(data, accesses, n_accesses, results, dirty_kickout_addresses, cmock_to_throw) CacheData_AccessBatch_CMockExpectAndThrow(__LINE__, data, accesses, n_accesses, results, dirty_kickout_addresses, cmock_to_throw)
+void CacheData_AccessBatch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, access_t const* accesses, uint32_t n_accesses, result_t* results, uint64_t* dirty_kickout_addresses, CEXCEPTION_T cmock_to_throw);
+#define CacheData_AccessBatch_ReturnThruPtr_results(results) CacheData_AccessBatch_CMockReturnMemThruPtr_results(__LINE__, results, sizeof(*results))
+#define CacheData_AccessBatch_ReturnArrayThruPtr_results(results, cmock_len) CacheData_AccessBatch_CMockReturnMemThruPtr_results(__LINE__, results, (int)(cmock_len * (int)sizeof(*results)))
+#define CacheData_AccessBatch_ReturnMemThruPtr_results(results, cmock_size) CacheData_AccessBatch_CMockReturnMemThruPtr_results(__LINE__, results, cmock_size)
+void CacheData_AccessBatch_CMockReturnMemThruPtr_results(UNITY_LINE_TYPE cmock_line, result_t* results, int cmock_size);
+#define CacheData_AccessBatch_ReturnThruPtr_dirty_kickout_addresses(dirty_kickout_addresses) CacheData_AccessBatch_CMockReturnMemThruPtr_dirty_kickout_addresses(__LINE__, dirty_kickout_addresses, sizeof(*dirty_kickout_addresses))
+#define CacheData_AccessBatch_ReturnArrayThruPtr_dirty_kickout_addresses(dirty_kickout_addresses, cmock_len) CacheData_AccessBatch_CMockReturnMemThruPtr_dirty_kickout_addresses(__LINE__, dirty_kickout_addresses, (int)(cmock_len * (int)sizeof(*dirty_kickout_addresses)))
+#define CacheData_AccessBatch_ReturnMemThruPtr_dirty_kickout_addresses(dirty_kickout_addresses, cmock_size) CacheData_AccessBatch_CMockReturnMemThruPtr_dirty_kickout_addresses(__LINE__, dirty_kickout_addresses, cmock_size)
+void CacheData_AccessBatch_CMockReturnMemThruPtr_dirty_kickout_addresses(UNITY_LINE_TYPE cmock_line, uint64_t* dirty_kickout_addresses, int cmock_size);
+#define CacheData_AccessBatch_IgnoreArg_data() CacheData_AccessBatch_CMockIgnoreArg_data(__LINE__)
+void CacheData_AccessBatch_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define CacheData_AccessBatch_IgnoreArg_accesses() CacheData_AccessBatch_CMockIgnoreArg_accesses(__LINE__)
+void CacheData_AccessBatch_CMockIgnoreArg_accesses(UNITY_LINE_TYPE cmock_line);
+#define CacheData_AccessBatch_IgnoreArg_n_accesses() CacheData_AccessBatch_CMockIgnoreArg_n_accesses(__LINE__)
+void CacheData_AccessBatch_CMockIgnoreArg_n_accesses(UNITY_LINE_TYPE cmock_line);
+#define CacheData_AccessBatch_IgnoreArg_results() CacheData_AccessBatch_CMockIgnoreArg_results(__LINE__)
+void CacheData_AccessBatch_CMockIgnoreArg_results(UNITY_LINE_TYPE cmock_line);
+#define CacheData_AccessBatch_IgnoreArg_dirty_kickout_addresses() CacheData_AccessBatch_CMockIgnoreArg_dirty_kickout_addresses(__LINE__)
+void CacheData_AccessBatch_CMockIgnoreArg_dirty_kickout_addresses(UNITY_LINE_TYPE cmock_line);
+#define CacheData_Print_Ignore() CacheData_Print_CMockIgnore()
+void CacheData_Print_CMockIgnore(void);
+#define CacheData_Print_Expect(data) CacheData_Print_CMockExpect(__LINE__, data)
+void CacheData_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_data_t data);
+typedef void (* CMOCK_CacheData_Print_CALLBACK)(cache_data_t data, int cmock_num_calls);
+void CacheData_Print_StubWithCallback(CMOCK_CacheData_Print_CALLBACK Callback);
+#define CacheData_Print_ExpectAndThrow(data, cmock_to_throw) CacheData_Print_CMockExpectAndThrow(__LINE__, data, cmock_to_throw)
+void CacheData_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_data_t data, CEXCEPTION_T cmock_to_throw);
+#define CacheData_Print_IgnoreArg_data() CacheData_Print_CMockIgnoreArg_data(__LINE__)
+void CacheData_Print_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+
+#endif
@@ -0,0 +1,1090 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_L2Cache.h"
+
+static const char* CMockString_L2Cache_Access = "L2Cache_Access";
+static const char* CMockString_L2Cache_AttachCapture = "L2Cache_AttachCapture";
+static const char* CMockString_L2Cache_AttachStackDistance = "L2Cache_AttachStackDistance";
+static const char* CMockString_L2Cache_Create = "L2Cache_Create";
+static const char* CMockString_L2Cache_Destroy = "L2Cache_Destroy";
+static const char* CMockString_L2Cache_Prefetch = "L2Cache_Prefetch";
+static const char* CMockString_L2Cache_PrefetchEnabled = "L2Cache_PrefetchEnabled";
+static const char* CMockString_L2Cache_Print = "L2Cache_Print";
+static const char* CMockString_access = "access";
+static const char* CMockString_address = "address";
+static const char* CMockString_cache = "cache";
+static const char* CMockString_config = "config";
+static const char* CMockString_mem = "mem";
+static const char* CMockString_stack_distance = "stack_distance";
+static const char* CMockString_stats = "stats";
+static const char* CMockString_writer = "writer";
+
+typedef struct _CMOCK_L2Cache_Create_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  l2_cache_t ReturnVal;
+  int CallOrder;
+  main_mem_t Expected_mem;
+  cache_stats_t* Expected_stats;
+  cache_param_t const* Expected_config;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_stats_Used;
+  cache_stats_t* ReturnThruPtr_stats_Val;
+  int ReturnThruPtr_stats_Size;
+  int IgnoreArg_mem;
+  int IgnoreArg_stats;
+  int IgnoreArg_config;
+
+} CMOCK_L2Cache_Create_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_Destroy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+
+} CMOCK_L2Cache_Destroy_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_Access_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  access_t const* Expected_access;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+  int IgnoreArg_access;
+
+} CMOCK_L2Cache_Access_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_Prefetch_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  uint64_t Expected_address;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+  int IgnoreArg_address;
+
+} CMOCK_L2Cache_Prefetch_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+
+} CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  stack_distance_t Expected_stack_distance;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+  int IgnoreArg_stack_distance;
+
+} CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_AttachCapture_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  l2_stream_writer_t Expected_writer;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+  int IgnoreArg_writer;
+
+} CMOCK_L2Cache_AttachCapture_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Cache_Print_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_cache_t Expected_cache;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_cache;
+
+} CMOCK_L2Cache_Print_CALL_INSTANCE;
+
+static struct mock_L2CacheInstance
+{
+  int L2Cache_Create_IgnoreBool;
+  l2_cache_t L2Cache_Create_FinalReturn;
+  CMOCK_L2Cache_Create_CALLBACK L2Cache_Create_CallbackFunctionPointer;
+  int L2Cache_Create_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_Create_CallInstance;
+  int L2Cache_Destroy_IgnoreBool;
+  CMOCK_L2Cache_Destroy_CALLBACK L2Cache_Destroy_CallbackFunctionPointer;
+  int L2Cache_Destroy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_Destroy_CallInstance;
+  int L2Cache_Access_IgnoreBool;
+  uint32_t L2Cache_Access_FinalReturn;
+  CMOCK_L2Cache_Access_CALLBACK L2Cache_Access_CallbackFunctionPointer;
+  int L2Cache_Access_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_Access_CallInstance;
+  int L2Cache_Prefetch_IgnoreBool;
+  CMOCK_L2Cache_Prefetch_CALLBACK L2Cache_Prefetch_CallbackFunctionPointer;
+  int L2Cache_Prefetch_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_Prefetch_CallInstance;
+  int L2Cache_PrefetchEnabled_IgnoreBool;
+  _Bool L2Cache_PrefetchEnabled_FinalReturn;
+  CMOCK_L2Cache_PrefetchEnabled_CALLBACK L2Cache_PrefetchEnabled_CallbackFunctionPointer;
+  int L2Cache_PrefetchEnabled_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_PrefetchEnabled_CallInstance;
+  int L2Cache_AttachStackDistance_IgnoreBool;
+  CMOCK_L2Cache_AttachStackDistance_CALLBACK L2Cache_AttachStackDistance_CallbackFunctionPointer;
+  int L2Cache_AttachStackDistance_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_AttachStackDistance_CallInstance;
+  int L2Cache_AttachCapture_IgnoreBool;
+  CMOCK_L2Cache_AttachCapture_CALLBACK L2Cache_AttachCapture_CallbackFunctionPointer;
+  int L2Cache_AttachCapture_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_AttachCapture_CallInstance;
+  int L2Cache_Print_IgnoreBool;
+  CMOCK_L2Cache_Print_CALLBACK L2Cache_Print_CallbackFunctionPointer;
+  int L2Cache_Print_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Cache_Print_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_L2Cache_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.L2Cache_Create_IgnoreBool)
+    Mock.L2Cache_Create_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Create);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_Create_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_Create_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_Create_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_Destroy_IgnoreBool)
+    Mock.L2Cache_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Destroy);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_Destroy_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_Destroy_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_Access_IgnoreBool)
+    Mock.L2Cache_Access_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Access);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_Access_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_Access_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_Access_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_Prefetch_IgnoreBool)
+    Mock.L2Cache_Prefetch_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Prefetch);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_Prefetch_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_Prefetch_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_Prefetch_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_PrefetchEnabled_IgnoreBool)
+    Mock.L2Cache_PrefetchEnabled_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_PrefetchEnabled);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_PrefetchEnabled_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_PrefetchEnabled_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_PrefetchEnabled_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_AttachStackDistance_IgnoreBool)
+    Mock.L2Cache_AttachStackDistance_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_AttachStackDistance);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_AttachStackDistance_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_AttachStackDistance_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_AttachStackDistance_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_AttachCapture_IgnoreBool)
+    Mock.L2Cache_AttachCapture_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_AttachCapture);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_AttachCapture_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_AttachCapture_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_AttachCapture_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Cache_Print_IgnoreBool)
+    Mock.L2Cache_Print_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Print);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Cache_Print_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Cache_Print_CallbackFunctionPointer != NULL)
+    Mock.L2Cache_Print_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_L2Cache_Init(void)
+{
+  mock_L2Cache_Destroy();
+}
+
+void mock_L2Cache_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.L2Cache_Create_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_Create_CallbackCalls = 0;
+  Mock.L2Cache_Destroy_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_Destroy_CallbackCalls = 0;
+  Mock.L2Cache_Access_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_Access_CallbackCalls = 0;
+  Mock.L2Cache_Prefetch_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_Prefetch_CallbackCalls = 0;
+  Mock.L2Cache_PrefetchEnabled_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_PrefetchEnabled_CallbackCalls = 0;
+  Mock.L2Cache_AttachStackDistance_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_AttachStackDistance_CallbackCalls = 0;
+  Mock.L2Cache_AttachCapture_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_AttachCapture_CallbackCalls = 0;
+  Mock.L2Cache_Print_CallbackFunctionPointer = NULL;
+  Mock.L2Cache_Print_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+l2_cache_t L2Cache_Create(main_mem_t mem, cache_stats_t* stats, cache_param_t const* config)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Create);
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_Create_CallInstance);
+  Mock.L2Cache_Create_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_Create_CallInstance);
+  if (Mock.L2Cache_Create_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Cache_Create_FinalReturn;
+    memcpy(&Mock.L2Cache_Create_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(l2_cache_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Cache_Create_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Cache_Create_CallbackFunctionPointer(mem, stats, config, Mock.L2Cache_Create_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_mem)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Create,CMockString_mem);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_mem), (void*)(&mem), sizeof(main_mem_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Create,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(cache_stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_config)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Create,CMockString_config);
+    UNITY_TEST_ASSERT_EQUAL_cache_param_t(*cmock_call_instance->Expected_config, *config, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_stats_Used)
+  {
+    memcpy(stats, cmock_call_instance->ReturnThruPtr_stats_Val,
+      cmock_call_instance->ReturnThruPtr_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Cache_Create(CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance, main_mem_t mem, cache_stats_t* stats, cache_param_t const* config)
+{
+  memcpy(&cmock_call_instance->Expected_mem, &mem, sizeof(main_mem_t));
+  cmock_call_instance->IgnoreArg_mem = 0;
+  cmock_call_instance->Expected_stats = stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+  cmock_call_instance->ReturnThruPtr_stats_Used = 0;
+  cmock_call_instance->Expected_config = (cache_param_t const*)config;
+  cmock_call_instance->IgnoreArg_config = 0;
+}
+
+void L2Cache_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Create_CALL_INSTANCE));
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Create_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Create_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Cache_Create_IgnoreBool = (int)1;
+}
+
+void L2Cache_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t mem, cache_stats_t* stats, cache_param_t const* config, l2_cache_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Create_CALL_INSTANCE));
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Create_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Create_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Create(cmock_call_instance, mem, stats, config);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(l2_cache_t));
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_Create_StubWithCallback(CMOCK_L2Cache_Create_CALLBACK Callback)
+{
+  Mock.L2Cache_Create_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, cache_stats_t* stats, cache_param_t const* config, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Create_CALL_INSTANCE));
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Create_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Create_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Create(cmock_call_instance, mem, stats, config);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_Create_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* stats, int cmock_size)
+{
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_stats_Val = stats;
+  cmock_call_instance->ReturnThruPtr_stats_Size = cmock_size;
+}
+
+void L2Cache_Create_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_mem = 1;
+}
+
+void L2Cache_Create_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+void L2Cache_Create_CMockIgnoreArg_config(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_config = 1;
+}
+
+void L2Cache_Destroy(l2_cache_t cache)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Destroy);
+  CMOCK_L2Cache_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_Destroy_CallInstance);
+  Mock.L2Cache_Destroy_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_Destroy_CallInstance);
+  if (Mock.L2Cache_Destroy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Cache_Destroy_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Cache_Destroy_CallbackFunctionPointer(cache, Mock.L2Cache_Destroy_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Destroy,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Cache_Destroy(CMOCK_L2Cache_Destroy_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+}
+
+void L2Cache_Destroy_CMockIgnore(void)
+{
+  Mock.L2Cache_Destroy_IgnoreBool = (int)1;
+}
+
+void L2Cache_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Destroy_CALL_INSTANCE));
+  CMOCK_L2Cache_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Destroy_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Destroy_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Destroy(cmock_call_instance, cache);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_Destroy_StubWithCallback(CMOCK_L2Cache_Destroy_CALLBACK Callback)
+{
+  Mock.L2Cache_Destroy_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Destroy_CALL_INSTANCE));
+  CMOCK_L2Cache_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Destroy_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Destroy_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Destroy(cmock_call_instance, cache);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_Destroy_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Destroy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+uint32_t L2Cache_Access(l2_cache_t cache, access_t const* access)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Access);
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_Access_CallInstance);
+  Mock.L2Cache_Access_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_Access_CallInstance);
+  if (Mock.L2Cache_Access_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Cache_Access_FinalReturn;
+    Mock.L2Cache_Access_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Cache_Access_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Cache_Access_CallbackFunctionPointer(cache, access, Mock.L2Cache_Access_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Access,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_access)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Access,CMockString_access);
+    UNITY_TEST_ASSERT_EQUAL_access_t(*cmock_call_instance->Expected_access, *access, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Cache_Access(CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache, access_t const* access)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+  cmock_call_instance->Expected_access = (access_t const*)access;
+  cmock_call_instance->IgnoreArg_access = 0;
+}
+
+void L2Cache_Access_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Access_CALL_INSTANCE));
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Access_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Access_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Cache_Access_IgnoreBool = (int)1;
+}
+
+void L2Cache_Access_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, access_t const* access, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Access_CALL_INSTANCE));
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Access_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Access_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Access(cmock_call_instance, cache, access);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_Access_StubWithCallback(CMOCK_L2Cache_Access_CALLBACK Callback)
+{
+  Mock.L2Cache_Access_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, access_t const* access, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Access_CALL_INSTANCE));
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Access_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Access_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Access(cmock_call_instance, cache, access);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_Access_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+void L2Cache_Access_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_access = 1;
+}
+
+void L2Cache_Prefetch(l2_cache_t cache, uint64_t address)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Prefetch);
+  CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_Prefetch_CallInstance);
+  Mock.L2Cache_Prefetch_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_Prefetch_CallInstance);
+  if (Mock.L2Cache_Prefetch_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Cache_Prefetch_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Cache_Prefetch_CallbackFunctionPointer(cache, address, Mock.L2Cache_Prefetch_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Prefetch,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Prefetch,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Cache_Prefetch(CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache, uint64_t address)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+}
+
+void L2Cache_Prefetch_CMockIgnore(void)
+{
+  Mock.L2Cache_Prefetch_IgnoreBool = (int)1;
+}
+
+void L2Cache_Prefetch_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, uint64_t address)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Prefetch_CALL_INSTANCE));
+  CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Prefetch_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Prefetch_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Prefetch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Prefetch(cmock_call_instance, cache, address);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_Prefetch_StubWithCallback(CMOCK_L2Cache_Prefetch_CALLBACK Callback)
+{
+  Mock.L2Cache_Prefetch_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_Prefetch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, uint64_t address, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Prefetch_CALL_INSTANCE));
+  CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Prefetch_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Prefetch_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Prefetch_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Prefetch(cmock_call_instance, cache, address);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_Prefetch_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Prefetch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+void L2Cache_Prefetch_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Prefetch_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Prefetch_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Prefetch_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+_Bool L2Cache_PrefetchEnabled(l2_cache_t cache)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_PrefetchEnabled);
+  CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_PrefetchEnabled_CallInstance);
+  Mock.L2Cache_PrefetchEnabled_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_PrefetchEnabled_CallInstance);
+  if (Mock.L2Cache_PrefetchEnabled_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Cache_PrefetchEnabled_FinalReturn;
+    memcpy(&Mock.L2Cache_PrefetchEnabled_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(_Bool));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Cache_PrefetchEnabled_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Cache_PrefetchEnabled_CallbackFunctionPointer(cache, Mock.L2Cache_PrefetchEnabled_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_PrefetchEnabled,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Cache_PrefetchEnabled(CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+}
+
+void L2Cache_PrefetchEnabled_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.L2Cache_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Cache_PrefetchEnabled_IgnoreBool = (int)1;
+}
+
+void L2Cache_PrefetchEnabled_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.L2Cache_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_PrefetchEnabled(cmock_call_instance, cache);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(_Bool));
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_PrefetchEnabled_StubWithCallback(CMOCK_L2Cache_PrefetchEnabled_CALLBACK Callback)
+{
+  Mock.L2Cache_PrefetchEnabled_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_PrefetchEnabled_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE));
+  CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_PrefetchEnabled_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_PrefetchEnabled_CallInstance, cmock_guts_index);
+  Mock.L2Cache_PrefetchEnabled_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_PrefetchEnabled(cmock_call_instance, cache);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_PrefetchEnabled_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_PrefetchEnabled_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_PrefetchEnabled_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+void L2Cache_AttachStackDistance(l2_cache_t cache, stack_distance_t stack_distance)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_AttachStackDistance);
+  CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_AttachStackDistance_CallInstance);
+  Mock.L2Cache_AttachStackDistance_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_AttachStackDistance_CallInstance);
+  if (Mock.L2Cache_AttachStackDistance_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Cache_AttachStackDistance_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Cache_AttachStackDistance_CallbackFunctionPointer(cache, stack_distance, Mock.L2Cache_AttachStackDistance_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_AttachStackDistance,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_AttachStackDistance,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Cache_AttachStackDistance(CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache, stack_distance_t stack_distance)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+}
+
+void L2Cache_AttachStackDistance_CMockIgnore(void)
+{
+  Mock.L2Cache_AttachStackDistance_IgnoreBool = (int)1;
+}
+
+void L2Cache_AttachStackDistance_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, stack_distance_t stack_distance)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE));
+  CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_AttachStackDistance_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_AttachStackDistance_CallInstance, cmock_guts_index);
+  Mock.L2Cache_AttachStackDistance_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_AttachStackDistance(cmock_call_instance, cache, stack_distance);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_AttachStackDistance_StubWithCallback(CMOCK_L2Cache_AttachStackDistance_CALLBACK Callback)
+{
+  Mock.L2Cache_AttachStackDistance_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_AttachStackDistance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE));
+  CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_AttachStackDistance_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_AttachStackDistance_CallInstance, cmock_guts_index);
+  Mock.L2Cache_AttachStackDistance_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_AttachStackDistance(cmock_call_instance, cache, stack_distance);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_AttachStackDistance_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_AttachStackDistance_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+void L2Cache_AttachStackDistance_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachStackDistance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_AttachStackDistance_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void L2Cache_AttachCapture(l2_cache_t cache, l2_stream_writer_t writer)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_AttachCapture);
+  CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachCapture_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_AttachCapture_CallInstance);
+  Mock.L2Cache_AttachCapture_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_AttachCapture_CallInstance);
+  if (Mock.L2Cache_AttachCapture_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Cache_AttachCapture_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Cache_AttachCapture_CallbackFunctionPointer(cache, writer, Mock.L2Cache_AttachCapture_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_AttachCapture,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_writer)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_AttachCapture,CMockString_writer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_writer), (void*)(&writer), sizeof(l2_stream_writer_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Cache_AttachCapture(CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache, l2_stream_writer_t writer)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+  memcpy(&cmock_call_instance->Expected_writer, &writer, sizeof(l2_stream_writer_t));
+  cmock_call_instance->IgnoreArg_writer = 0;
+}
+
+void L2Cache_AttachCapture_CMockIgnore(void)
+{
+  Mock.L2Cache_AttachCapture_IgnoreBool = (int)1;
+}
+
+void L2Cache_AttachCapture_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, l2_stream_writer_t writer)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_AttachCapture_CALL_INSTANCE));
+  CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachCapture_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_AttachCapture_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_AttachCapture_CallInstance, cmock_guts_index);
+  Mock.L2Cache_AttachCapture_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_AttachCapture(cmock_call_instance, cache, writer);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_AttachCapture_StubWithCallback(CMOCK_L2Cache_AttachCapture_CALLBACK Callback)
+{
+  Mock.L2Cache_AttachCapture_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_AttachCapture_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, l2_stream_writer_t writer, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_AttachCapture_CALL_INSTANCE));
+  CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachCapture_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_AttachCapture_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_AttachCapture_CallInstance, cmock_guts_index);
+  Mock.L2Cache_AttachCapture_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_AttachCapture(cmock_call_instance, cache, writer);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_AttachCapture_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachCapture_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_AttachCapture_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
+void L2Cache_AttachCapture_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_AttachCapture_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_AttachCapture_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_AttachCapture_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_writer = 1;
+}
+
+void L2Cache_Print(l2_cache_t cache)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Cache_Print);
+  CMOCK_L2Cache_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Cache_Print_CallInstance);
+  Mock.L2Cache_Print_CallInstance = CMock_Guts_MemNext(Mock.L2Cache_Print_CallInstance);
+  if (Mock.L2Cache_Print_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Cache_Print_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Cache_Print_CallbackFunctionPointer(cache, Mock.L2Cache_Print_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Cache_Print,CMockString_cache);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cache), (void*)(&cache), sizeof(l2_cache_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Cache_Print(CMOCK_L2Cache_Print_CALL_INSTANCE* cmock_call_instance, l2_cache_t cache)
+{
+  memcpy(&cmock_call_instance->Expected_cache, &cache, sizeof(l2_cache_t));
+  cmock_call_instance->IgnoreArg_cache = 0;
+}
+
+void L2Cache_Print_CMockIgnore(void)
+{
+  Mock.L2Cache_Print_IgnoreBool = (int)1;
+}
+
+void L2Cache_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Print_CALL_INSTANCE));
+  CMOCK_L2Cache_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Print_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Print_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Print(cmock_call_instance, cache);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Cache_Print_StubWithCallback(CMOCK_L2Cache_Print_CALLBACK Callback)
+{
+  Mock.L2Cache_Print_CallbackFunctionPointer = Callback;
+}
+
+void L2Cache_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Cache_Print_CALL_INSTANCE));
+  CMOCK_L2Cache_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Cache_Print_CallInstance = CMock_Guts_MemChain(Mock.L2Cache_Print_CallInstance, cmock_guts_index);
+  Mock.L2Cache_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Cache_Print(cmock_call_instance, cache);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Cache_Print_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Cache_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Cache_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Cache_Print_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache = 1;
+}
+
@@ -0,0 +1,122 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_L2CACHE_H
+#define _MOCK_L2CACHE_H
+
+#include "unity_Helper.h"
+#include "L2Cache.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_L2Cache_Init(void);
+void mock_L2Cache_Destroy(void);
+void mock_L2Cache_Verify(void);
+
+
+
+
+#define L2Cache_Create_IgnoreAndReturn(cmock_retval) L2Cache_Create_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Cache_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cmock_to_return);
+#define L2Cache_Create_ExpectAndReturn(mem, stats, config, cmock_retval) L2Cache_Create_CMockExpectAndReturn(__LINE__, mem, stats, config, cmock_retval)
+void L2Cache_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t mem, cache_stats_t* stats, cache_param_t const* config, l2_cache_t cmock_to_return);
+typedef l2_cache_t (* CMOCK_L2Cache_Create_CALLBACK)(main_mem_t mem, cache_stats_t* stats, cache_param_t const* config, int cmock_num_calls);
+void L2Cache_Create_StubWithCallback(CMOCK_L2Cache_Create_CALLBACK Callback);
+#define L2Cache_Create_ExpectAndThrow(mem, stats, config, cmock_to_throw) L2Cache_Create_CMockExpectAndThrow(__LINE__, mem, stats, config, cmock_to_throw)
+void L2Cache_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, cache_stats_t* stats, cache_param_t const* config, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_Create_ReturnThruPtr_stats(stats) L2Cache_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, sizeof(*stats))
+#define L2Cache_Create_ReturnArrayThruPtr_stats(stats, cmock_len) L2Cache_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, (int)(cmock_len * (int)sizeof(*stats)))
+#define L2Cache_Create_ReturnMemThruPtr_stats(stats, cmock_size) L2Cache_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, cmock_size)
+void L2Cache_Create_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* stats, int cmock_size);
+#define L2Cache_Create_IgnoreArg_mem() L2Cache_Create_CMockIgnoreArg_mem(__LINE__)
+void L2Cache_Create_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Create_IgnoreArg_stats() L2Cache_Create_CMockIgnoreArg_stats(__LINE__)
+void L2Cache_Create_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Create_IgnoreArg_config() L2Cache_Create_CMockIgnoreArg_config(__LINE__)
+void L2Cache_Create_CMockIgnoreArg_config(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Destroy_Ignore() L2Cache_Destroy_CMockIgnore()
+void L2Cache_Destroy_CMockIgnore(void);
+#define L2Cache_Destroy_Expect(cache) L2Cache_Destroy_CMockExpect(__LINE__, cache)
+void L2Cache_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache);
+typedef void (* CMOCK_L2Cache_Destroy_CALLBACK)(l2_cache_t cache, int cmock_num_calls);
+void L2Cache_Destroy_StubWithCallback(CMOCK_L2Cache_Destroy_CALLBACK Callback);
+#define L2Cache_Destroy_ExpectAndThrow(cache, cmock_to_throw) L2Cache_Destroy_CMockExpectAndThrow(__LINE__, cache, cmock_to_throw)
+void L2Cache_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_Destroy_IgnoreArg_cache() L2Cache_Destroy_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_Destroy_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Access_IgnoreAndReturn(cmock_retval) L2Cache_Access_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Cache_Access_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define L2Cache_Access_ExpectAndReturn(cache, access, cmock_retval) L2Cache_Access_CMockExpectAndReturn(__LINE__, cache, access, cmock_retval)
+void L2Cache_Access_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, access_t const* access, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_L2Cache_Access_CALLBACK)(l2_cache_t cache, access_t const* access, int cmock_num_calls);
+void L2Cache_Access_StubWithCallback(CMOCK_L2Cache_Access_CALLBACK Callback);
+#define L2Cache_Access_ExpectAndThrow(cache, access, cmock_to_throw) L2Cache_Access_CMockExpectAndThrow(__LINE__, cache, access, cmock_to_throw)
+void L2Cache_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, access_t const* access, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_Access_IgnoreArg_cache() L2Cache_Access_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_Access_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Access_IgnoreArg_access() L2Cache_Access_CMockIgnoreArg_access(__LINE__)
+void L2Cache_Access_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Prefetch_Ignore() L2Cache_Prefetch_CMockIgnore()
+void L2Cache_Prefetch_CMockIgnore(void);
+#define L2Cache_Prefetch_Expect(cache, address) L2Cache_Prefetch_CMockExpect(__LINE__, cache, address)
+void L2Cache_Prefetch_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, uint64_t address);
+typedef void (* CMOCK_L2Cache_Prefetch_CALLBACK)(l2_cache_t cache, uint64_t address, int cmock_num_calls);
+void L2Cache_Prefetch_StubWithCallback(CMOCK_L2Cache_Prefetch_CALLBACK Callback);
+#define L2Cache_Prefetch_ExpectAndThrow(cache, address, cmock_to_throw) L2Cache_Prefetch_CMockExpectAndThrow(__LINE__, cache, address, cmock_to_throw)
+void L2Cache_Prefetch_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, uint64_t address, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_Prefetch_IgnoreArg_cache() L2Cache_Prefetch_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_Prefetch_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Prefetch_IgnoreArg_address() L2Cache_Prefetch_CMockIgnoreArg_address(__LINE__)
+void L2Cache_Prefetch_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_PrefetchEnabled_IgnoreAndReturn(cmock_retval) L2Cache_PrefetchEnabled_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Cache_PrefetchEnabled_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define L2Cache_PrefetchEnabled_ExpectAndReturn(cache, cmock_retval) L2Cache_PrefetchEnabled_CMockExpectAndReturn(__LINE__, cache, cmock_retval)
+void L2Cache_PrefetchEnabled_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_L2Cache_PrefetchEnabled_CALLBACK)(l2_cache_t cache, int cmock_num_calls);
+void L2Cache_PrefetchEnabled_StubWithCallback(CMOCK_L2Cache_PrefetchEnabled_CALLBACK Callback);
+#define L2Cache_PrefetchEnabled_ExpectAndThrow(cache, cmock_to_throw) L2Cache_PrefetchEnabled_CMockExpectAndThrow(__LINE__, cache, cmock_to_throw)
+void L2Cache_PrefetchEnabled_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_PrefetchEnabled_IgnoreArg_cache() L2Cache_PrefetchEnabled_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_PrefetchEnabled_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_AttachStackDistance_Ignore() L2Cache_AttachStackDistance_CMockIgnore()
+void L2Cache_AttachStackDistance_CMockIgnore(void);
+#define L2Cache_AttachStackDistance_Expect(cache, stack_distance) L2Cache_AttachStackDistance_CMockExpect(__LINE__, cache, stack_distance)
+void L2Cache_AttachStackDistance_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, stack_distance_t stack_distance);
+typedef void (* CMOCK_L2Cache_AttachStackDistance_CALLBACK)(l2_cache_t cache, stack_distance_t stack_distance, int cmock_num_calls);
+void L2Cache_AttachStackDistance_StubWithCallback(CMOCK_L2Cache_AttachStackDistance_CALLBACK Callback);
+#define L2Cache_AttachStackDistance_ExpectAndThrow(cache, stack_distance, cmock_to_throw) L2Cache_AttachStackDistance_CMockExpectAndThrow(__LINE__, cache, stack_distance, cmock_to_throw)
+void L2Cache_AttachStackDistance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_AttachStackDistance_IgnoreArg_cache() L2Cache_AttachStackDistance_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_AttachStackDistance_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_AttachStackDistance_IgnoreArg_stack_distance() L2Cache_AttachStackDistance_CMockIgnoreArg_stack_distance(__LINE__)
+void L2Cache_AttachStackDistance_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_AttachCapture_Ignore() L2Cache_AttachCapture_CMockIgnore()
+void L2Cache_AttachCapture_CMockIgnore(void);
+#define L2Cache_AttachCapture_Expect(cache, writer) L2Cache_AttachCapture_CMockExpect(__LINE__, cache, writer)
+void L2Cache_AttachCapture_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, l2_stream_writer_t writer);
+typedef void (* CMOCK_L2Cache_AttachCapture_CALLBACK)(l2_cache_t cache, l2_stream_writer_t writer, int cmock_num_calls);
+void L2Cache_AttachCapture_StubWithCallback(CMOCK_L2Cache_AttachCapture_CALLBACK Callback);
+#define L2Cache_AttachCapture_ExpectAndThrow(cache, writer, cmock_to_throw) L2Cache_AttachCapture_CMockExpectAndThrow(__LINE__, cache, writer, cmock_to_throw)
+void L2Cache_AttachCapture_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, l2_stream_writer_t writer, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_AttachCapture_IgnoreArg_cache() L2Cache_AttachCapture_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_AttachCapture_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_AttachCapture_IgnoreArg_writer() L2Cache_AttachCapture_CMockIgnoreArg_writer(__LINE__)
+void L2Cache_AttachCapture_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line);
+#define L2Cache_Print_Ignore() L2Cache_Print_CMockIgnore()
+void L2Cache_Print_CMockIgnore(void);
+#define L2Cache_Print_Expect(cache) L2Cache_Print_CMockExpect(__LINE__, cache)
+void L2Cache_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_cache_t cache);
+typedef void (* CMOCK_L2Cache_Print_CALLBACK)(l2_cache_t cache, int cmock_num_calls);
+void L2Cache_Print_StubWithCallback(CMOCK_L2Cache_Print_CALLBACK Callback);
+#define L2Cache_Print_ExpectAndThrow(cache, cmock_to_throw) L2Cache_Print_CMockExpectAndThrow(__LINE__, cache, cmock_to_throw)
+void L2Cache_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_cache_t cache, CEXCEPTION_T cmock_to_throw);
+#define L2Cache_Print_IgnoreArg_cache() L2Cache_Print_CMockIgnoreArg_cache(__LINE__)
+void L2Cache_Print_CMockIgnoreArg_cache(UNITY_LINE_TYPE cmock_line);
+
+#endif
@@ -0,0 +1,1417 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_L2Stream.h"
+
+static const char* CMockString_L2Stream_Config = "L2Stream_Config";
+static const char* CMockString_L2Stream_CreateReader = "L2Stream_CreateReader";
+static const char* CMockString_L2Stream_CreateWriter = "L2Stream_CreateWriter";
+static const char* CMockString_L2Stream_DestroyReader = "L2Stream_DestroyReader";
+static const char* CMockString_L2Stream_DestroyWriter = "L2Stream_DestroyWriter";
+static const char* CMockString_L2Stream_Finish = "L2Stream_Finish";
+static const char* CMockString_L2Stream_Read = "L2Stream_Read";
+static const char* CMockString_L2Stream_ReadStats = "L2Stream_ReadStats";
+static const char* CMockString_L2Stream_Record = "L2Stream_Record";
+static const char* CMockString_L2Stream_SetOrigin = "L2Stream_SetOrigin";
+static const char* CMockString_access = "access";
+static const char* CMockString_accesses = "accesses";
+static const char* CMockString_cycles = "cycles";
+static const char* CMockString_l1_config = "l1_config";
+static const char* CMockString_max_accesses = "max_accesses";
+static const char* CMockString_origins = "origins";
+static const char* CMockString_path = "path";
+static const char* CMockString_reader = "reader";
+static const char* CMockString_stats = "stats";
+static const char* CMockString_type = "type";
+static const char* CMockString_writer = "writer";
+
+typedef struct _CMOCK_L2Stream_CreateWriter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  l2_stream_writer_t ReturnVal;
+  int CallOrder;
+  char const* Expected_path;
+  cache_param_t const* Expected_l1_config;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_path;
+  int IgnoreArg_l1_config;
+
+} CMOCK_L2Stream_CreateWriter_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_writer_t Expected_writer;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_writer;
+
+} CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_SetOrigin_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_writer_t Expected_writer;
+  uint8_t Expected_type;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_writer;
+  int IgnoreArg_type;
+
+} CMOCK_L2Stream_SetOrigin_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_Record_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_writer_t Expected_writer;
+  access_t const* Expected_access;
+  uint32_t Expected_cycles;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_writer;
+  int IgnoreArg_access;
+  int IgnoreArg_cycles;
+
+} CMOCK_L2Stream_Record_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_Finish_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_writer_t Expected_writer;
+  stats_t const* Expected_stats;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_writer;
+  int IgnoreArg_stats;
+
+} CMOCK_L2Stream_Finish_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_CreateReader_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  l2_stream_reader_t ReturnVal;
+  int CallOrder;
+  char const* Expected_path;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_path;
+
+} CMOCK_L2Stream_CreateReader_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_DestroyReader_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_reader_t Expected_reader;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_reader;
+
+} CMOCK_L2Stream_DestroyReader_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_Config_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  cache_param_t const* ReturnVal;
+  int CallOrder;
+  l2_stream_reader_t Expected_reader;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_reader;
+
+} CMOCK_L2Stream_Config_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_ReadStats_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  l2_stream_reader_t Expected_reader;
+  stats_t* Expected_stats;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_stats_Used;
+  stats_t* ReturnThruPtr_stats_Val;
+  int ReturnThruPtr_stats_Size;
+  int IgnoreArg_reader;
+  int IgnoreArg_stats;
+
+} CMOCK_L2Stream_ReadStats_CALL_INSTANCE;
+
+typedef struct _CMOCK_L2Stream_Read_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  l2_stream_reader_t Expected_reader;
+  access_t* Expected_accesses;
+  uint8_t* Expected_origins;
+  uint32_t Expected_max_accesses;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_accesses_Used;
+  access_t* ReturnThruPtr_accesses_Val;
+  int ReturnThruPtr_accesses_Size;
+  int ReturnThruPtr_origins_Used;
+  uint8_t* ReturnThruPtr_origins_Val;
+  int ReturnThruPtr_origins_Size;
+  int IgnoreArg_reader;
+  int IgnoreArg_accesses;
+  int IgnoreArg_origins;
+  int IgnoreArg_max_accesses;
+
+} CMOCK_L2Stream_Read_CALL_INSTANCE;
+
+static struct mock_L2StreamInstance
+{
+  int L2Stream_CreateWriter_IgnoreBool;
+  l2_stream_writer_t L2Stream_CreateWriter_FinalReturn;
+  CMOCK_L2Stream_CreateWriter_CALLBACK L2Stream_CreateWriter_CallbackFunctionPointer;
+  int L2Stream_CreateWriter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_CreateWriter_CallInstance;
+  int L2Stream_DestroyWriter_IgnoreBool;
+  CMOCK_L2Stream_DestroyWriter_CALLBACK L2Stream_DestroyWriter_CallbackFunctionPointer;
+  int L2Stream_DestroyWriter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_DestroyWriter_CallInstance;
+  int L2Stream_SetOrigin_IgnoreBool;
+  CMOCK_L2Stream_SetOrigin_CALLBACK L2Stream_SetOrigin_CallbackFunctionPointer;
+  int L2Stream_SetOrigin_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_SetOrigin_CallInstance;
+  int L2Stream_Record_IgnoreBool;
+  CMOCK_L2Stream_Record_CALLBACK L2Stream_Record_CallbackFunctionPointer;
+  int L2Stream_Record_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_Record_CallInstance;
+  int L2Stream_Finish_IgnoreBool;
+  CMOCK_L2Stream_Finish_CALLBACK L2Stream_Finish_CallbackFunctionPointer;
+  int L2Stream_Finish_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_Finish_CallInstance;
+  int L2Stream_CreateReader_IgnoreBool;
+  l2_stream_reader_t L2Stream_CreateReader_FinalReturn;
+  CMOCK_L2Stream_CreateReader_CALLBACK L2Stream_CreateReader_CallbackFunctionPointer;
+  int L2Stream_CreateReader_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_CreateReader_CallInstance;
+  int L2Stream_DestroyReader_IgnoreBool;
+  CMOCK_L2Stream_DestroyReader_CALLBACK L2Stream_DestroyReader_CallbackFunctionPointer;
+  int L2Stream_DestroyReader_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_DestroyReader_CallInstance;
+  int L2Stream_Config_IgnoreBool;
+  cache_param_t const* L2Stream_Config_FinalReturn;
+  CMOCK_L2Stream_Config_CALLBACK L2Stream_Config_CallbackFunctionPointer;
+  int L2Stream_Config_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_Config_CallInstance;
+  int L2Stream_ReadStats_IgnoreBool;
+  CMOCK_L2Stream_ReadStats_CALLBACK L2Stream_ReadStats_CallbackFunctionPointer;
+  int L2Stream_ReadStats_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_ReadStats_CallInstance;
+  int L2Stream_Read_IgnoreBool;
+  uint32_t L2Stream_Read_FinalReturn;
+  CMOCK_L2Stream_Read_CALLBACK L2Stream_Read_CallbackFunctionPointer;
+  int L2Stream_Read_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE L2Stream_Read_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_L2Stream_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.L2Stream_CreateWriter_IgnoreBool)
+    Mock.L2Stream_CreateWriter_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_CreateWriter);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_CreateWriter_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_CreateWriter_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_CreateWriter_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_DestroyWriter_IgnoreBool)
+    Mock.L2Stream_DestroyWriter_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_DestroyWriter);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_DestroyWriter_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_DestroyWriter_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_DestroyWriter_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_SetOrigin_IgnoreBool)
+    Mock.L2Stream_SetOrigin_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_SetOrigin);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_SetOrigin_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_SetOrigin_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_SetOrigin_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_Record_IgnoreBool)
+    Mock.L2Stream_Record_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Record);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_Record_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_Record_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_Record_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_Finish_IgnoreBool)
+    Mock.L2Stream_Finish_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Finish);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_Finish_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_Finish_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_Finish_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_CreateReader_IgnoreBool)
+    Mock.L2Stream_CreateReader_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_CreateReader);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_CreateReader_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_CreateReader_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_CreateReader_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_DestroyReader_IgnoreBool)
+    Mock.L2Stream_DestroyReader_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_DestroyReader);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_DestroyReader_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_DestroyReader_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_DestroyReader_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_Config_IgnoreBool)
+    Mock.L2Stream_Config_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Config);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_Config_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_Config_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_Config_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_ReadStats_IgnoreBool)
+    Mock.L2Stream_ReadStats_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_ReadStats);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_ReadStats_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_ReadStats_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_ReadStats_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.L2Stream_Read_IgnoreBool)
+    Mock.L2Stream_Read_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Read);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.L2Stream_Read_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.L2Stream_Read_CallbackFunctionPointer != NULL)
+    Mock.L2Stream_Read_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_L2Stream_Init(void)
+{
+  mock_L2Stream_Destroy();
+}
+
+void mock_L2Stream_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.L2Stream_CreateWriter_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_CreateWriter_CallbackCalls = 0;
+  Mock.L2Stream_DestroyWriter_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_DestroyWriter_CallbackCalls = 0;
+  Mock.L2Stream_SetOrigin_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_SetOrigin_CallbackCalls = 0;
+  Mock.L2Stream_Record_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_Record_CallbackCalls = 0;
+  Mock.L2Stream_Finish_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_Finish_CallbackCalls = 0;
+  Mock.L2Stream_CreateReader_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_CreateReader_CallbackCalls = 0;
+  Mock.L2Stream_DestroyReader_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_DestroyReader_CallbackCalls = 0;
+  Mock.L2Stream_Config_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_Config_CallbackCalls = 0;
+  Mock.L2Stream_ReadStats_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_ReadStats_CallbackCalls = 0;
+  Mock.L2Stream_Read_CallbackFunctionPointer = NULL;
+  Mock.L2Stream_Read_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+l2_stream_writer_t L2Stream_CreateWriter(char const* path, cache_param_t const* l1_config)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_CreateWriter);
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_CreateWriter_CallInstance);
+  Mock.L2Stream_CreateWriter_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_CreateWriter_CallInstance);
+  if (Mock.L2Stream_CreateWriter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Stream_CreateWriter_FinalReturn;
+    memcpy(&Mock.L2Stream_CreateWriter_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(l2_stream_writer_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Stream_CreateWriter_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Stream_CreateWriter_CallbackFunctionPointer(path, l1_config, Mock.L2Stream_CreateWriter_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_path)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_CreateWriter,CMockString_path);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_path, path, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_l1_config)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_CreateWriter,CMockString_l1_config);
+    UNITY_TEST_ASSERT_EQUAL_cache_param_t(*cmock_call_instance->Expected_l1_config, *l1_config, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Stream_CreateWriter(CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance, char const* path, cache_param_t const* l1_config)
+{
+  memcpy(&cmock_call_instance->Expected_path, &path, sizeof(char const*));
+  cmock_call_instance->IgnoreArg_path = 0;
+  cmock_call_instance->Expected_l1_config = (cache_param_t const*)l1_config;
+  cmock_call_instance->IgnoreArg_l1_config = 0;
+}
+
+void L2Stream_CreateWriter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateWriter_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateWriter_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateWriter_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateWriter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Stream_CreateWriter_IgnoreBool = (int)1;
+}
+
+void L2Stream_CreateWriter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char const* path, cache_param_t const* l1_config, l2_stream_writer_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateWriter_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateWriter_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateWriter_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateWriter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_CreateWriter(cmock_call_instance, path, l1_config);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(l2_stream_writer_t));
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_CreateWriter_StubWithCallback(CMOCK_L2Stream_CreateWriter_CALLBACK Callback)
+{
+  Mock.L2Stream_CreateWriter_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_CreateWriter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, char const* path, cache_param_t const* l1_config, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateWriter_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateWriter_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateWriter_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateWriter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_CreateWriter(cmock_call_instance, path, l1_config);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_CreateWriter_CMockIgnoreArg_path(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_CreateWriter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_path = 1;
+}
+
+void L2Stream_CreateWriter_CMockIgnoreArg_l1_config(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_CreateWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_CreateWriter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_l1_config = 1;
+}
+
+void L2Stream_DestroyWriter(l2_stream_writer_t writer)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_DestroyWriter);
+  CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_DestroyWriter_CallInstance);
+  Mock.L2Stream_DestroyWriter_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_DestroyWriter_CallInstance);
+  if (Mock.L2Stream_DestroyWriter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_DestroyWriter_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_DestroyWriter_CallbackFunctionPointer(writer, Mock.L2Stream_DestroyWriter_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_writer)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_DestroyWriter,CMockString_writer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_writer), (void*)(&writer), sizeof(l2_stream_writer_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_DestroyWriter(CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE* cmock_call_instance, l2_stream_writer_t writer)
+{
+  memcpy(&cmock_call_instance->Expected_writer, &writer, sizeof(l2_stream_writer_t));
+  cmock_call_instance->IgnoreArg_writer = 0;
+}
+
+void L2Stream_DestroyWriter_CMockIgnore(void)
+{
+  Mock.L2Stream_DestroyWriter_IgnoreBool = (int)1;
+}
+
+void L2Stream_DestroyWriter_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE));
+  CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_DestroyWriter_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_DestroyWriter_CallInstance, cmock_guts_index);
+  Mock.L2Stream_DestroyWriter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_DestroyWriter(cmock_call_instance, writer);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_DestroyWriter_StubWithCallback(CMOCK_L2Stream_DestroyWriter_CALLBACK Callback)
+{
+  Mock.L2Stream_DestroyWriter_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_DestroyWriter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE));
+  CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_DestroyWriter_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_DestroyWriter_CallInstance, cmock_guts_index);
+  Mock.L2Stream_DestroyWriter_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_DestroyWriter(cmock_call_instance, writer);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_DestroyWriter_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyWriter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_DestroyWriter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_writer = 1;
+}
+
+void L2Stream_SetOrigin(l2_stream_writer_t writer, uint8_t type)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_SetOrigin);
+  CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_SetOrigin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_SetOrigin_CallInstance);
+  Mock.L2Stream_SetOrigin_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_SetOrigin_CallInstance);
+  if (Mock.L2Stream_SetOrigin_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_SetOrigin_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_SetOrigin_CallbackFunctionPointer(writer, type, Mock.L2Stream_SetOrigin_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_writer)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_SetOrigin,CMockString_writer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_writer), (void*)(&writer), sizeof(l2_stream_writer_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_type)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_SetOrigin,CMockString_type);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_type, type, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_SetOrigin(CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance, l2_stream_writer_t writer, uint8_t type)
+{
+  memcpy(&cmock_call_instance->Expected_writer, &writer, sizeof(l2_stream_writer_t));
+  cmock_call_instance->IgnoreArg_writer = 0;
+  cmock_call_instance->Expected_type = type;
+  cmock_call_instance->IgnoreArg_type = 0;
+}
+
+void L2Stream_SetOrigin_CMockIgnore(void)
+{
+  Mock.L2Stream_SetOrigin_IgnoreBool = (int)1;
+}
+
+void L2Stream_SetOrigin_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, uint8_t type)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_SetOrigin_CALL_INSTANCE));
+  CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_SetOrigin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_SetOrigin_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_SetOrigin_CallInstance, cmock_guts_index);
+  Mock.L2Stream_SetOrigin_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_SetOrigin(cmock_call_instance, writer, type);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_SetOrigin_StubWithCallback(CMOCK_L2Stream_SetOrigin_CALLBACK Callback)
+{
+  Mock.L2Stream_SetOrigin_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_SetOrigin_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, uint8_t type, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_SetOrigin_CALL_INSTANCE));
+  CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_SetOrigin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_SetOrigin_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_SetOrigin_CallInstance, cmock_guts_index);
+  Mock.L2Stream_SetOrigin_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_SetOrigin(cmock_call_instance, writer, type);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_SetOrigin_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_SetOrigin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_SetOrigin_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_writer = 1;
+}
+
+void L2Stream_SetOrigin_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_SetOrigin_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_SetOrigin_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_SetOrigin_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_type = 1;
+}
+
+void L2Stream_Record(l2_stream_writer_t writer, access_t const* access, uint32_t cycles)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Record);
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_Record_CallInstance);
+  Mock.L2Stream_Record_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_Record_CallInstance);
+  if (Mock.L2Stream_Record_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_Record_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_Record_CallbackFunctionPointer(writer, access, cycles, Mock.L2Stream_Record_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_writer)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Record,CMockString_writer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_writer), (void*)(&writer), sizeof(l2_stream_writer_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_access)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Record,CMockString_access);
+    UNITY_TEST_ASSERT_EQUAL_access_t(*cmock_call_instance->Expected_access, *access, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_cycles)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Record,CMockString_cycles);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_cycles, cycles, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_Record(CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance, l2_stream_writer_t writer, access_t const* access, uint32_t cycles)
+{
+  memcpy(&cmock_call_instance->Expected_writer, &writer, sizeof(l2_stream_writer_t));
+  cmock_call_instance->IgnoreArg_writer = 0;
+  cmock_call_instance->Expected_access = (access_t const*)access;
+  cmock_call_instance->IgnoreArg_access = 0;
+  cmock_call_instance->Expected_cycles = cycles;
+  cmock_call_instance->IgnoreArg_cycles = 0;
+}
+
+void L2Stream_Record_CMockIgnore(void)
+{
+  Mock.L2Stream_Record_IgnoreBool = (int)1;
+}
+
+void L2Stream_Record_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, access_t const* access, uint32_t cycles)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Record_CALL_INSTANCE));
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Record_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Record_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Record_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Record(cmock_call_instance, writer, access, cycles);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_Record_StubWithCallback(CMOCK_L2Stream_Record_CALLBACK Callback)
+{
+  Mock.L2Stream_Record_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_Record_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, access_t const* access, uint32_t cycles, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Record_CALL_INSTANCE));
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Record_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Record_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Record_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Record(cmock_call_instance, writer, access, cycles);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_Record_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Record_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_writer = 1;
+}
+
+void L2Stream_Record_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Record_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_access = 1;
+}
+
+void L2Stream_Record_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Record_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Record_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Record_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cycles = 1;
+}
+
+void L2Stream_Finish(l2_stream_writer_t writer, stats_t const* stats)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Finish);
+  CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Finish_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_Finish_CallInstance);
+  Mock.L2Stream_Finish_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_Finish_CallInstance);
+  if (Mock.L2Stream_Finish_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_Finish_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_Finish_CallbackFunctionPointer(writer, stats, Mock.L2Stream_Finish_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_writer)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Finish,CMockString_writer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_writer), (void*)(&writer), sizeof(l2_stream_writer_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Finish,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t const), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_Finish(CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance, l2_stream_writer_t writer, stats_t const* stats)
+{
+  memcpy(&cmock_call_instance->Expected_writer, &writer, sizeof(l2_stream_writer_t));
+  cmock_call_instance->IgnoreArg_writer = 0;
+  cmock_call_instance->Expected_stats = (stats_t const*)stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+}
+
+void L2Stream_Finish_CMockIgnore(void)
+{
+  Mock.L2Stream_Finish_IgnoreBool = (int)1;
+}
+
+void L2Stream_Finish_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, stats_t const* stats)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Finish_CALL_INSTANCE));
+  CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Finish_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Finish_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Finish_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Finish_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Finish(cmock_call_instance, writer, stats);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_Finish_StubWithCallback(CMOCK_L2Stream_Finish_CALLBACK Callback)
+{
+  Mock.L2Stream_Finish_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_Finish_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, stats_t const* stats, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Finish_CALL_INSTANCE));
+  CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Finish_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Finish_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Finish_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Finish_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Finish(cmock_call_instance, writer, stats);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_Finish_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Finish_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Finish_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_writer = 1;
+}
+
+void L2Stream_Finish_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Finish_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Finish_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Finish_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+l2_stream_reader_t L2Stream_CreateReader(char const* path)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_CreateReader);
+  CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_CreateReader_CallInstance);
+  Mock.L2Stream_CreateReader_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_CreateReader_CallInstance);
+  if (Mock.L2Stream_CreateReader_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Stream_CreateReader_FinalReturn;
+    memcpy(&Mock.L2Stream_CreateReader_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(l2_stream_reader_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Stream_CreateReader_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Stream_CreateReader_CallbackFunctionPointer(path, Mock.L2Stream_CreateReader_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_path)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_CreateReader,CMockString_path);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_path, path, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Stream_CreateReader(CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance, char const* path)
+{
+  memcpy(&cmock_call_instance->Expected_path, &path, sizeof(char const*));
+  cmock_call_instance->IgnoreArg_path = 0;
+}
+
+void L2Stream_CreateReader_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateReader_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateReader_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateReader_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateReader_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Stream_CreateReader_IgnoreBool = (int)1;
+}
+
+void L2Stream_CreateReader_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char const* path, l2_stream_reader_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateReader_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateReader_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateReader_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateReader_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_CreateReader(cmock_call_instance, path);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(l2_stream_reader_t));
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_CreateReader_StubWithCallback(CMOCK_L2Stream_CreateReader_CALLBACK Callback)
+{
+  Mock.L2Stream_CreateReader_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_CreateReader_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, char const* path, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_CreateReader_CALL_INSTANCE));
+  CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_CreateReader_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_CreateReader_CallInstance, cmock_guts_index);
+  Mock.L2Stream_CreateReader_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_CreateReader(cmock_call_instance, path);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_CreateReader_CMockIgnoreArg_path(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_CreateReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_CreateReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_CreateReader_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_path = 1;
+}
+
+void L2Stream_DestroyReader(l2_stream_reader_t reader)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_DestroyReader);
+  CMOCK_L2Stream_DestroyReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_DestroyReader_CallInstance);
+  Mock.L2Stream_DestroyReader_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_DestroyReader_CallInstance);
+  if (Mock.L2Stream_DestroyReader_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_DestroyReader_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_DestroyReader_CallbackFunctionPointer(reader, Mock.L2Stream_DestroyReader_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_reader)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_DestroyReader,CMockString_reader);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_reader), (void*)(&reader), sizeof(l2_stream_reader_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_DestroyReader(CMOCK_L2Stream_DestroyReader_CALL_INSTANCE* cmock_call_instance, l2_stream_reader_t reader)
+{
+  memcpy(&cmock_call_instance->Expected_reader, &reader, sizeof(l2_stream_reader_t));
+  cmock_call_instance->IgnoreArg_reader = 0;
+}
+
+void L2Stream_DestroyReader_CMockIgnore(void)
+{
+  Mock.L2Stream_DestroyReader_IgnoreBool = (int)1;
+}
+
+void L2Stream_DestroyReader_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_DestroyReader_CALL_INSTANCE));
+  CMOCK_L2Stream_DestroyReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_DestroyReader_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_DestroyReader_CallInstance, cmock_guts_index);
+  Mock.L2Stream_DestroyReader_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_DestroyReader(cmock_call_instance, reader);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_DestroyReader_StubWithCallback(CMOCK_L2Stream_DestroyReader_CALLBACK Callback)
+{
+  Mock.L2Stream_DestroyReader_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_DestroyReader_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_DestroyReader_CALL_INSTANCE));
+  CMOCK_L2Stream_DestroyReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_DestroyReader_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_DestroyReader_CallInstance, cmock_guts_index);
+  Mock.L2Stream_DestroyReader_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_DestroyReader(cmock_call_instance, reader);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_DestroyReader_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_DestroyReader_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_DestroyReader_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_DestroyReader_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_reader = 1;
+}
+
+cache_param_t const* L2Stream_Config(l2_stream_reader_t reader)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Config);
+  CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Config_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_Config_CallInstance);
+  Mock.L2Stream_Config_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_Config_CallInstance);
+  if (Mock.L2Stream_Config_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Stream_Config_FinalReturn;
+    Mock.L2Stream_Config_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Stream_Config_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Stream_Config_CallbackFunctionPointer(reader, Mock.L2Stream_Config_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_reader)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Config,CMockString_reader);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_reader), (void*)(&reader), sizeof(l2_stream_reader_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Stream_Config(CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance, l2_stream_reader_t reader)
+{
+  memcpy(&cmock_call_instance->Expected_reader, &reader, sizeof(l2_stream_reader_t));
+  cmock_call_instance->IgnoreArg_reader = 0;
+}
+
+void L2Stream_Config_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, cache_param_t const* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Config_CALL_INSTANCE));
+  CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Config_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Config_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Config_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Config_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Stream_Config_IgnoreBool = (int)1;
+}
+
+void L2Stream_Config_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, cache_param_t const* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Config_CALL_INSTANCE));
+  CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Config_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Config_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Config_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Config_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Config(cmock_call_instance, reader);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_Config_StubWithCallback(CMOCK_L2Stream_Config_CALLBACK Callback)
+{
+  Mock.L2Stream_Config_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_Config_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Config_CALL_INSTANCE));
+  CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Config_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Config_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Config_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Config_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Config(cmock_call_instance, reader);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_Config_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Config_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Config_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Config_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_reader = 1;
+}
+
+void L2Stream_ReadStats(l2_stream_reader_t reader, stats_t* stats)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_ReadStats);
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_ReadStats_CallInstance);
+  Mock.L2Stream_ReadStats_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_ReadStats_CallInstance);
+  if (Mock.L2Stream_ReadStats_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.L2Stream_ReadStats_CallbackFunctionPointer != NULL)
+  {
+    Mock.L2Stream_ReadStats_CallbackFunctionPointer(reader, stats, Mock.L2Stream_ReadStats_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_reader)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_ReadStats,CMockString_reader);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_reader), (void*)(&reader), sizeof(l2_stream_reader_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_ReadStats,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_stats_Used)
+  {
+    memcpy(stats, cmock_call_instance->ReturnThruPtr_stats_Val,
+      cmock_call_instance->ReturnThruPtr_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_L2Stream_ReadStats(CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance, l2_stream_reader_t reader, stats_t* stats)
+{
+  memcpy(&cmock_call_instance->Expected_reader, &reader, sizeof(l2_stream_reader_t));
+  cmock_call_instance->IgnoreArg_reader = 0;
+  cmock_call_instance->Expected_stats = stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+  cmock_call_instance->ReturnThruPtr_stats_Used = 0;
+}
+
+void L2Stream_ReadStats_CMockIgnore(void)
+{
+  Mock.L2Stream_ReadStats_IgnoreBool = (int)1;
+}
+
+void L2Stream_ReadStats_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, stats_t* stats)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_ReadStats_CALL_INSTANCE));
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_ReadStats_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_ReadStats_CallInstance, cmock_guts_index);
+  Mock.L2Stream_ReadStats_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_ReadStats(cmock_call_instance, reader, stats);
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_ReadStats_StubWithCallback(CMOCK_L2Stream_ReadStats_CALLBACK Callback)
+{
+  Mock.L2Stream_ReadStats_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_ReadStats_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, stats_t* stats, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_ReadStats_CALL_INSTANCE));
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_ReadStats_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_ReadStats_CallInstance, cmock_guts_index);
+  Mock.L2Stream_ReadStats_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_ReadStats(cmock_call_instance, reader, stats);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_ReadStats_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size)
+{
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_ReadStats_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_stats_Val = stats;
+  cmock_call_instance->ReturnThruPtr_stats_Size = cmock_size;
+}
+
+void L2Stream_ReadStats_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_ReadStats_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_reader = 1;
+}
+
+void L2Stream_ReadStats_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_ReadStats_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_ReadStats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_ReadStats_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+uint32_t L2Stream_Read(l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_L2Stream_Read);
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.L2Stream_Read_CallInstance);
+  Mock.L2Stream_Read_CallInstance = CMock_Guts_MemNext(Mock.L2Stream_Read_CallInstance);
+  if (Mock.L2Stream_Read_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.L2Stream_Read_FinalReturn;
+    Mock.L2Stream_Read_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.L2Stream_Read_CallbackFunctionPointer != NULL)
+  {
+    return Mock.L2Stream_Read_CallbackFunctionPointer(reader, accesses, origins, max_accesses, Mock.L2Stream_Read_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_reader)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Read,CMockString_reader);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_reader), (void*)(&reader), sizeof(l2_stream_reader_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_accesses)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Read,CMockString_accesses);
+    UNITY_TEST_ASSERT_EQUAL_access_t(*cmock_call_instance->Expected_accesses, *accesses, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_origins)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Read,CMockString_origins);
+    if (cmock_call_instance->Expected_origins == NULL)
+      { UNITY_TEST_ASSERT_NULL(origins, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_origins, origins, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_max_accesses)
+  {
+    UNITY_SET_DETAILS(CMockString_L2Stream_Read,CMockString_max_accesses);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_max_accesses, max_accesses, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_accesses_Used)
+  {
+    memcpy(accesses, cmock_call_instance->ReturnThruPtr_accesses_Val,
+      cmock_call_instance->ReturnThruPtr_accesses_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_origins_Used)
+  {
+    memcpy(origins, cmock_call_instance->ReturnThruPtr_origins_Val,
+      cmock_call_instance->ReturnThruPtr_origins_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_L2Stream_Read(CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance, l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses)
+{
+  memcpy(&cmock_call_instance->Expected_reader, &reader, sizeof(l2_stream_reader_t));
+  cmock_call_instance->IgnoreArg_reader = 0;
+  cmock_call_instance->Expected_accesses = accesses;
+  cmock_call_instance->IgnoreArg_accesses = 0;
+  cmock_call_instance->ReturnThruPtr_accesses_Used = 0;
+  cmock_call_instance->Expected_origins = origins;
+  cmock_call_instance->IgnoreArg_origins = 0;
+  cmock_call_instance->ReturnThruPtr_origins_Used = 0;
+  cmock_call_instance->Expected_max_accesses = max_accesses;
+  cmock_call_instance->IgnoreArg_max_accesses = 0;
+}
+
+void L2Stream_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Read_CALL_INSTANCE));
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Read_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Read_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.L2Stream_Read_IgnoreBool = (int)1;
+}
+
+void L2Stream_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Read_CALL_INSTANCE));
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Read_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Read_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Read(cmock_call_instance, reader, accesses, origins, max_accesses);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void L2Stream_Read_StubWithCallback(CMOCK_L2Stream_Read_CALLBACK Callback)
+{
+  Mock.L2Stream_Read_CallbackFunctionPointer = Callback;
+}
+
+void L2Stream_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_L2Stream_Read_CALL_INSTANCE));
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.L2Stream_Read_CallInstance = CMock_Guts_MemChain(Mock.L2Stream_Read_CallInstance, cmock_guts_index);
+  Mock.L2Stream_Read_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_L2Stream_Read(cmock_call_instance, reader, accesses, origins, max_accesses);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void L2Stream_Read_CMockReturnMemThruPtr_accesses(UNITY_LINE_TYPE cmock_line, access_t* accesses, int cmock_size)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_accesses_Used = 1;
+  cmock_call_instance->ReturnThruPtr_accesses_Val = accesses;
+  cmock_call_instance->ReturnThruPtr_accesses_Size = cmock_size;
+}
+
+void L2Stream_Read_CMockReturnMemThruPtr_origins(UNITY_LINE_TYPE cmock_line, uint8_t* origins, int cmock_size)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_origins_Used = 1;
+  cmock_call_instance->ReturnThruPtr_origins_Val = origins;
+  cmock_call_instance->ReturnThruPtr_origins_Size = cmock_size;
+}
+
+void L2Stream_Read_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_reader = 1;
+}
+
+void L2Stream_Read_CMockIgnoreArg_accesses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_accesses = 1;
+}
+
+void L2Stream_Read_CMockIgnoreArg_origins(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_origins = 1;
+}
+
+void L2Stream_Read_CMockIgnoreArg_max_accesses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_L2Stream_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_L2Stream_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.L2Stream_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_max_accesses = 1;
+}
+
@@ -0,0 +1,156 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_L2STREAM_H
+#define _MOCK_L2STREAM_H
+
+#include "unity_Helper.h"
+#include "L2Stream.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_L2Stream_Init(void);
+void mock_L2Stream_Destroy(void);
+void mock_L2Stream_Verify(void);
+
+
+
+
+#define L2Stream_CreateWriter_IgnoreAndReturn(cmock_retval) L2Stream_CreateWriter_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Stream_CreateWriter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t cmock_to_return);
+#define L2Stream_CreateWriter_ExpectAndReturn(path, l1_config, cmock_retval) L2Stream_CreateWriter_CMockExpectAndReturn(__LINE__, path, l1_config, cmock_retval)
+void L2Stream_CreateWriter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char const* path, cache_param_t const* l1_config, l2_stream_writer_t cmock_to_return);
+typedef l2_stream_writer_t (* CMOCK_L2Stream_CreateWriter_CALLBACK)(char const* path, cache_param_t const* l1_config, int cmock_num_calls);
+void L2Stream_CreateWriter_StubWithCallback(CMOCK_L2Stream_CreateWriter_CALLBACK Callback);
+#define L2Stream_CreateWriter_ExpectAndThrow(path, l1_config, cmock_to_throw) L2Stream_CreateWriter_CMockExpectAndThrow(__LINE__, path, l1_config, cmock_to_throw)
+void L2Stream_CreateWriter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, char const* path, cache_param_t const* l1_config, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_CreateWriter_IgnoreArg_path() L2Stream_CreateWriter_CMockIgnoreArg_path(__LINE__)
+void L2Stream_CreateWriter_CMockIgnoreArg_path(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_CreateWriter_IgnoreArg_l1_config() L2Stream_CreateWriter_CMockIgnoreArg_l1_config(__LINE__)
+void L2Stream_CreateWriter_CMockIgnoreArg_l1_config(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_DestroyWriter_Ignore() L2Stream_DestroyWriter_CMockIgnore()
+void L2Stream_DestroyWriter_CMockIgnore(void);
+#define L2Stream_DestroyWriter_Expect(writer) L2Stream_DestroyWriter_CMockExpect(__LINE__, writer)
+void L2Stream_DestroyWriter_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer);
+typedef void (* CMOCK_L2Stream_DestroyWriter_CALLBACK)(l2_stream_writer_t writer, int cmock_num_calls);
+void L2Stream_DestroyWriter_StubWithCallback(CMOCK_L2Stream_DestroyWriter_CALLBACK Callback);
+#define L2Stream_DestroyWriter_ExpectAndThrow(writer, cmock_to_throw) L2Stream_DestroyWriter_CMockExpectAndThrow(__LINE__, writer, cmock_to_throw)
+void L2Stream_DestroyWriter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_DestroyWriter_IgnoreArg_writer() L2Stream_DestroyWriter_CMockIgnoreArg_writer(__LINE__)
+void L2Stream_DestroyWriter_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_SetOrigin_Ignore() L2Stream_SetOrigin_CMockIgnore()
+void L2Stream_SetOrigin_CMockIgnore(void);
+#define L2Stream_SetOrigin_Expect(writer, type) L2Stream_SetOrigin_CMockExpect(__LINE__, writer, type)
+void L2Stream_SetOrigin_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, uint8_t type);
+typedef void (* CMOCK_L2Stream_SetOrigin_CALLBACK)(l2_stream_writer_t writer, uint8_t type, int cmock_num_calls);
+void L2Stream_SetOrigin_StubWithCallback(CMOCK_L2Stream_SetOrigin_CALLBACK Callback);
+#define L2Stream_SetOrigin_ExpectAndThrow(writer, type, cmock_to_throw) L2Stream_SetOrigin_CMockExpectAndThrow(__LINE__, writer, type, cmock_to_throw)
+void L2Stream_SetOrigin_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, uint8_t type, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_SetOrigin_IgnoreArg_writer() L2Stream_SetOrigin_CMockIgnoreArg_writer(__LINE__)
+void L2Stream_SetOrigin_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_SetOrigin_IgnoreArg_type() L2Stream_SetOrigin_CMockIgnoreArg_type(__LINE__)
+void L2Stream_SetOrigin_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Record_Ignore() L2Stream_Record_CMockIgnore()
+void L2Stream_Record_CMockIgnore(void);
+#define L2Stream_Record_Expect(writer, access, cycles) L2Stream_Record_CMockExpect(__LINE__, writer, access, cycles)
+void L2Stream_Record_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, access_t const* access, uint32_t cycles);
+typedef void (* CMOCK_L2Stream_Record_CALLBACK)(l2_stream_writer_t writer, access_t const* access, uint32_t cycles, int cmock_num_calls);
+void L2Stream_Record_StubWithCallback(CMOCK_L2Stream_Record_CALLBACK Callback);
+#define L2Stream_Record_ExpectAndThrow(writer, access, cycles, cmock_to_throw) L2Stream_Record_CMockExpectAndThrow(__LINE__, writer, access, cycles, cmock_to_throw)
+void L2Stream_Record_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, access_t const* access, uint32_t cycles, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_Record_IgnoreArg_writer() L2Stream_Record_CMockIgnoreArg_writer(__LINE__)
+void L2Stream_Record_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Record_IgnoreArg_access() L2Stream_Record_CMockIgnoreArg_access(__LINE__)
+void L2Stream_Record_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Record_IgnoreArg_cycles() L2Stream_Record_CMockIgnoreArg_cycles(__LINE__)
+void L2Stream_Record_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Finish_Ignore() L2Stream_Finish_CMockIgnore()
+void L2Stream_Finish_CMockIgnore(void);
+#define L2Stream_Finish_Expect(writer, stats) L2Stream_Finish_CMockExpect(__LINE__, writer, stats)
+void L2Stream_Finish_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, stats_t const* stats);
+typedef void (* CMOCK_L2Stream_Finish_CALLBACK)(l2_stream_writer_t writer, stats_t const* stats, int cmock_num_calls);
+void L2Stream_Finish_StubWithCallback(CMOCK_L2Stream_Finish_CALLBACK Callback);
+#define L2Stream_Finish_ExpectAndThrow(writer, stats, cmock_to_throw) L2Stream_Finish_CMockExpectAndThrow(__LINE__, writer, stats, cmock_to_throw)
+void L2Stream_Finish_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_writer_t writer, stats_t const* stats, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_Finish_IgnoreArg_writer() L2Stream_Finish_CMockIgnoreArg_writer(__LINE__)
+void L2Stream_Finish_CMockIgnoreArg_writer(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Finish_IgnoreArg_stats() L2Stream_Finish_CMockIgnoreArg_stats(__LINE__)
+void L2Stream_Finish_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_CreateReader_IgnoreAndReturn(cmock_retval) L2Stream_CreateReader_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Stream_CreateReader_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t cmock_to_return);
+#define L2Stream_CreateReader_ExpectAndReturn(path, cmock_retval) L2Stream_CreateReader_CMockExpectAndReturn(__LINE__, path, cmock_retval)
+void L2Stream_CreateReader_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, char const* path, l2_stream_reader_t cmock_to_return);
+typedef l2_stream_reader_t (* CMOCK_L2Stream_CreateReader_CALLBACK)(char const* path, int cmock_num_calls);
+void L2Stream_CreateReader_StubWithCallback(CMOCK_L2Stream_CreateReader_CALLBACK Callback);
+#define L2Stream_CreateReader_ExpectAndThrow(path, cmock_to_throw) L2Stream_CreateReader_CMockExpectAndThrow(__LINE__, path, cmock_to_throw)
+void L2Stream_CreateReader_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, char const* path, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_CreateReader_IgnoreArg_path() L2Stream_CreateReader_CMockIgnoreArg_path(__LINE__)
+void L2Stream_CreateReader_CMockIgnoreArg_path(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_DestroyReader_Ignore() L2Stream_DestroyReader_CMockIgnore()
+void L2Stream_DestroyReader_CMockIgnore(void);
+#define L2Stream_DestroyReader_Expect(reader) L2Stream_DestroyReader_CMockExpect(__LINE__, reader)
+void L2Stream_DestroyReader_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader);
+typedef void (* CMOCK_L2Stream_DestroyReader_CALLBACK)(l2_stream_reader_t reader, int cmock_num_calls);
+void L2Stream_DestroyReader_StubWithCallback(CMOCK_L2Stream_DestroyReader_CALLBACK Callback);
+#define L2Stream_DestroyReader_ExpectAndThrow(reader, cmock_to_throw) L2Stream_DestroyReader_CMockExpectAndThrow(__LINE__, reader, cmock_to_throw)
+void L2Stream_DestroyReader_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_DestroyReader_IgnoreArg_reader() L2Stream_DestroyReader_CMockIgnoreArg_reader(__LINE__)
+void L2Stream_DestroyReader_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Config_IgnoreAndReturn(cmock_retval) L2Stream_Config_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Stream_Config_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, cache_param_t const* cmock_to_return);
+#define L2Stream_Config_ExpectAndReturn(reader, cmock_retval) L2Stream_Config_CMockExpectAndReturn(__LINE__, reader, cmock_retval)
+void L2Stream_Config_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, cache_param_t const* cmock_to_return);
+typedef cache_param_t const* (* CMOCK_L2Stream_Config_CALLBACK)(l2_stream_reader_t reader, int cmock_num_calls);
+void L2Stream_Config_StubWithCallback(CMOCK_L2Stream_Config_CALLBACK Callback);
+#define L2Stream_Config_ExpectAndThrow(reader, cmock_to_throw) L2Stream_Config_CMockExpectAndThrow(__LINE__, reader, cmock_to_throw)
+void L2Stream_Config_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_Config_IgnoreArg_reader() L2Stream_Config_CMockIgnoreArg_reader(__LINE__)
+void L2Stream_Config_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_ReadStats_Ignore() L2Stream_ReadStats_CMockIgnore()
+void L2Stream_ReadStats_CMockIgnore(void);
+#define L2Stream_ReadStats_Expect(reader, stats) L2Stream_ReadStats_CMockExpect(__LINE__, reader, stats)
+void L2Stream_ReadStats_CMockExpect(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, stats_t* stats);
+typedef void (* CMOCK_L2Stream_ReadStats_CALLBACK)(l2_stream_reader_t reader, stats_t* stats, int cmock_num_calls);
+void L2Stream_ReadStats_StubWithCallback(CMOCK_L2Stream_ReadStats_CALLBACK Callback);
+#define L2Stream_ReadStats_ExpectAndThrow(reader, stats, cmock_to_throw) L2Stream_ReadStats_CMockExpectAndThrow(__LINE__, reader, stats, cmock_to_throw)
+void L2Stream_ReadStats_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, stats_t* stats, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_ReadStats_ReturnThruPtr_stats(stats) L2Stream_ReadStats_CMockReturnMemThruPtr_stats(__LINE__, stats, sizeof(*stats))
+#define L2Stream_ReadStats_ReturnArrayThruPtr_stats(stats, cmock_len) L2Stream_ReadStats_CMockReturnMemThruPtr_stats(__LINE__, stats, (int)(cmock_len * (int)sizeof(*stats)))
+#define L2Stream_ReadStats_ReturnMemThruPtr_stats(stats, cmock_size) L2Stream_ReadStats_CMockReturnMemThruPtr_stats(__LINE__, stats, cmock_size)
+void L2Stream_ReadStats_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size);
+#define L2Stream_ReadStats_IgnoreArg_reader() L2Stream_ReadStats_CMockIgnoreArg_reader(__LINE__)
+void L2Stream_ReadStats_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_ReadStats_IgnoreArg_stats() L2Stream_ReadStats_CMockIgnoreArg_stats(__LINE__)
+void L2Stream_ReadStats_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Read_IgnoreAndReturn(cmock_retval) L2Stream_Read_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void L2Stream_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define L2Stream_Read_ExpectAndReturn(reader, accesses, origins, max_accesses, cmock_retval) L2Stream_Read_CMockExpectAndReturn(__LINE__, reader, accesses, origins, max_accesses, cmock_retval)
+void L2Stream_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_L2Stream_Read_CALLBACK)(l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses, int cmock_num_calls);
+void L2Stream_Read_StubWithCallback(CMOCK_L2Stream_Read_CALLBACK Callback);
+#define L2Stream_Read_ExpectAndThrow(reader, accesses, origins, max_accesses, cmock_to_throw) L2Stream_Read_CMockExpectAndThrow(__LINE__, reader, accesses, origins, max_accesses, cmock_to_throw)
+void L2Stream_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, l2_stream_reader_t reader, access_t* accesses, uint8_t* origins, uint32_t max_accesses, CEXCEPTION_T cmock_to_throw);
+#define L2Stream_Read_ReturnThruPtr_accesses(accesses) L2Stream_Read_CMockReturnMemThruPtr_accesses(__LINE__, accesses, sizeof(*accesses))
+#define L2Stream_Read_ReturnArrayThruPtr_accesses(accesses, cmock_len) L2Stream_Read_CMockReturnMemThruPtr_accesses(__LINE__, accesses, (int)(cmock_len * (int)sizeof(*accesses)))
+#define L2Stream_Read_ReturnMemThruPtr_accesses(accesses, cmock_size) L2Stream_Read_CMockReturnMemThruPtr_accesses(__LINE__, accesses, cmock_size)
+void L2Stream_Read_CMockReturnMemThruPtr_accesses(UNITY_LINE_TYPE cmock_line, access_t* accesses, int cmock_size);
+#define L2Stream_Read_ReturnThruPtr_origins(origins) L2Stream_Read_CMockReturnMemThruPtr_origins(__LINE__, origins, sizeof(*origins))
+#define L2Stream_Read_ReturnArrayThruPtr_origins(origins, cmock_len) L2Stream_Read_CMockReturnMemThruPtr_origins(__LINE__, origins, (int)(cmock_len * (int)sizeof(*origins)))
+#define L2Stream_Read_ReturnMemThruPtr_origins(origins, cmock_size) L2Stream_Read_CMockReturnMemThruPtr_origins(__LINE__, origins, cmock_size)
+void L2Stream_Read_CMockReturnMemThruPtr_origins(UNITY_LINE_TYPE cmock_line, uint8_t* origins, int cmock_size);
+#define L2Stream_Read_IgnoreArg_reader() L2Stream_Read_CMockIgnoreArg_reader(__LINE__)
+void L2Stream_Read_CMockIgnoreArg_reader(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Read_IgnoreArg_accesses() L2Stream_Read_CMockIgnoreArg_accesses(__LINE__)
+void L2Stream_Read_CMockIgnoreArg_accesses(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Read_IgnoreArg_origins() L2Stream_Read_CMockIgnoreArg_origins(__LINE__)
+void L2Stream_Read_CMockIgnoreArg_origins(UNITY_LINE_TYPE cmock_line);
+#define L2Stream_Read_IgnoreArg_max_accesses() L2Stream_Read_CMockIgnoreArg_max_accesses(__LINE__)
+void L2Stream_Read_CMockIgnoreArg_max_accesses(UNITY_LINE_TYPE cmock_line);
+
+#endif
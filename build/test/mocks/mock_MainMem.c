@@ -0,0 +1,417 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_MainMem.h"
+
+static const char* CMockString_MainMem_Access = "MainMem_Access";
+static const char* CMockString_MainMem_Create = "MainMem_Create";
+static const char* CMockString_MainMem_Destroy = "MainMem_Destroy";
+static const char* CMockString_access = "access";
+static const char* CMockString_config = "config";
+static const char* CMockString_mem = "mem";
+
+typedef struct _CMOCK_MainMem_Create_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  main_mem_t ReturnVal;
+  int CallOrder;
+  memory_param_t const* Expected_config;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_config;
+
+} CMOCK_MainMem_Create_CALL_INSTANCE;
+
+typedef struct _CMOCK_MainMem_Destroy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  main_mem_t Expected_mem;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_mem;
+
+} CMOCK_MainMem_Destroy_CALL_INSTANCE;
+
+typedef struct _CMOCK_MainMem_Access_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  main_mem_t Expected_mem;
+  access_t const* Expected_access;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_mem;
+  int IgnoreArg_access;
+
+} CMOCK_MainMem_Access_CALL_INSTANCE;
+
+static struct mock_MainMemInstance
+{
+  int MainMem_Create_IgnoreBool;
+  main_mem_t MainMem_Create_FinalReturn;
+  CMOCK_MainMem_Create_CALLBACK MainMem_Create_CallbackFunctionPointer;
+  int MainMem_Create_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MainMem_Create_CallInstance;
+  int MainMem_Destroy_IgnoreBool;
+  CMOCK_MainMem_Destroy_CALLBACK MainMem_Destroy_CallbackFunctionPointer;
+  int MainMem_Destroy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MainMem_Destroy_CallInstance;
+  int MainMem_Access_IgnoreBool;
+  uint32_t MainMem_Access_FinalReturn;
+  CMOCK_MainMem_Access_CALLBACK MainMem_Access_CallbackFunctionPointer;
+  int MainMem_Access_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MainMem_Access_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_MainMem_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.MainMem_Create_IgnoreBool)
+    Mock.MainMem_Create_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_MainMem_Create);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.MainMem_Create_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.MainMem_Create_CallbackFunctionPointer != NULL)
+    Mock.MainMem_Create_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.MainMem_Destroy_IgnoreBool)
+    Mock.MainMem_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_MainMem_Destroy);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.MainMem_Destroy_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.MainMem_Destroy_CallbackFunctionPointer != NULL)
+    Mock.MainMem_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.MainMem_Access_IgnoreBool)
+    Mock.MainMem_Access_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_MainMem_Access);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.MainMem_Access_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.MainMem_Access_CallbackFunctionPointer != NULL)
+    Mock.MainMem_Access_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_MainMem_Init(void)
+{
+  mock_MainMem_Destroy();
+}
+
+void mock_MainMem_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.MainMem_Create_CallbackFunctionPointer = NULL;
+  Mock.MainMem_Create_CallbackCalls = 0;
+  Mock.MainMem_Destroy_CallbackFunctionPointer = NULL;
+  Mock.MainMem_Destroy_CallbackCalls = 0;
+  Mock.MainMem_Access_CallbackFunctionPointer = NULL;
+  Mock.MainMem_Access_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+main_mem_t MainMem_Create(memory_param_t const* config)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_MainMem_Create);
+  CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MainMem_Create_CallInstance);
+  Mock.MainMem_Create_CallInstance = CMock_Guts_MemNext(Mock.MainMem_Create_CallInstance);
+  if (Mock.MainMem_Create_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MainMem_Create_FinalReturn;
+    memcpy(&Mock.MainMem_Create_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(main_mem_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.MainMem_Create_CallbackFunctionPointer != NULL)
+  {
+    return Mock.MainMem_Create_CallbackFunctionPointer(config, Mock.MainMem_Create_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_config)
+  {
+    UNITY_SET_DETAILS(CMockString_MainMem_Create,CMockString_config);
+    UNITY_TEST_ASSERT_EQUAL_memory_param_t(*cmock_call_instance->Expected_config, *config, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MainMem_Create(CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance, memory_param_t const* config)
+{
+  cmock_call_instance->Expected_config = (memory_param_t const*)config;
+  cmock_call_instance->IgnoreArg_config = 0;
+}
+
+void MainMem_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Create_CALL_INSTANCE));
+  CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Create_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Create_CallInstance, cmock_guts_index);
+  Mock.MainMem_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MainMem_Create_IgnoreBool = (int)1;
+}
+
+void MainMem_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, memory_param_t const* config, main_mem_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Create_CALL_INSTANCE));
+  CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Create_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Create_CallInstance, cmock_guts_index);
+  Mock.MainMem_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Create(cmock_call_instance, config);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(main_mem_t));
+  UNITY_CLR_DETAILS();
+}
+
+void MainMem_Create_StubWithCallback(CMOCK_MainMem_Create_CALLBACK Callback)
+{
+  Mock.MainMem_Create_CallbackFunctionPointer = Callback;
+}
+
+void MainMem_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, memory_param_t const* config, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Create_CALL_INSTANCE));
+  CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Create_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Create_CallInstance, cmock_guts_index);
+  Mock.MainMem_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Create(cmock_call_instance, config);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MainMem_Create_CMockIgnoreArg_config(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MainMem_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MainMem_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_config = 1;
+}
+
+void MainMem_Destroy(main_mem_t mem)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_MainMem_Destroy);
+  CMOCK_MainMem_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MainMem_Destroy_CallInstance);
+  Mock.MainMem_Destroy_CallInstance = CMock_Guts_MemNext(Mock.MainMem_Destroy_CallInstance);
+  if (Mock.MainMem_Destroy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.MainMem_Destroy_CallbackFunctionPointer != NULL)
+  {
+    Mock.MainMem_Destroy_CallbackFunctionPointer(mem, Mock.MainMem_Destroy_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_mem)
+  {
+    UNITY_SET_DETAILS(CMockString_MainMem_Destroy,CMockString_mem);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_mem), (void*)(&mem), sizeof(main_mem_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_MainMem_Destroy(CMOCK_MainMem_Destroy_CALL_INSTANCE* cmock_call_instance, main_mem_t mem)
+{
+  memcpy(&cmock_call_instance->Expected_mem, &mem, sizeof(main_mem_t));
+  cmock_call_instance->IgnoreArg_mem = 0;
+}
+
+void MainMem_Destroy_CMockIgnore(void)
+{
+  Mock.MainMem_Destroy_IgnoreBool = (int)1;
+}
+
+void MainMem_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, main_mem_t mem)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Destroy_CALL_INSTANCE));
+  CMOCK_MainMem_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Destroy_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Destroy_CallInstance, cmock_guts_index);
+  Mock.MainMem_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Destroy(cmock_call_instance, mem);
+  UNITY_CLR_DETAILS();
+}
+
+void MainMem_Destroy_StubWithCallback(CMOCK_MainMem_Destroy_CALLBACK Callback)
+{
+  Mock.MainMem_Destroy_CallbackFunctionPointer = Callback;
+}
+
+void MainMem_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Destroy_CALL_INSTANCE));
+  CMOCK_MainMem_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Destroy_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Destroy_CallInstance, cmock_guts_index);
+  Mock.MainMem_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Destroy(cmock_call_instance, mem);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MainMem_Destroy_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MainMem_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MainMem_Destroy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_mem = 1;
+}
+
+uint32_t MainMem_Access(main_mem_t mem, access_t const* access)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_MainMem_Access);
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MainMem_Access_CallInstance);
+  Mock.MainMem_Access_CallInstance = CMock_Guts_MemNext(Mock.MainMem_Access_CallInstance);
+  if (Mock.MainMem_Access_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MainMem_Access_FinalReturn;
+    Mock.MainMem_Access_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.MainMem_Access_CallbackFunctionPointer != NULL)
+  {
+    return Mock.MainMem_Access_CallbackFunctionPointer(mem, access, Mock.MainMem_Access_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_mem)
+  {
+    UNITY_SET_DETAILS(CMockString_MainMem_Access,CMockString_mem);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_mem), (void*)(&mem), sizeof(main_mem_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_access)
+  {
+    UNITY_SET_DETAILS(CMockString_MainMem_Access,CMockString_access);
+    UNITY_TEST_ASSERT_EQUAL_access_t(*cmock_call_instance->Expected_access, *access, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MainMem_Access(CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance, main_mem_t mem, access_t const* access)
+{
+  memcpy(&cmock_call_instance->Expected_mem, &mem, sizeof(main_mem_t));
+  cmock_call_instance->IgnoreArg_mem = 0;
+  cmock_call_instance->Expected_access = (access_t const*)access;
+  cmock_call_instance->IgnoreArg_access = 0;
+}
+
+void MainMem_Access_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Access_CALL_INSTANCE));
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Access_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Access_CallInstance, cmock_guts_index);
+  Mock.MainMem_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MainMem_Access_IgnoreBool = (int)1;
+}
+
+void MainMem_Access_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t mem, access_t const* access, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Access_CALL_INSTANCE));
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Access_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Access_CallInstance, cmock_guts_index);
+  Mock.MainMem_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Access(cmock_call_instance, mem, access);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void MainMem_Access_StubWithCallback(CMOCK_MainMem_Access_CALLBACK Callback)
+{
+  Mock.MainMem_Access_CallbackFunctionPointer = Callback;
+}
+
+void MainMem_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, access_t const* access, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MainMem_Access_CALL_INSTANCE));
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MainMem_Access_CallInstance = CMock_Guts_MemChain(Mock.MainMem_Access_CallInstance, cmock_guts_index);
+  Mock.MainMem_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MainMem_Access(cmock_call_instance, mem, access);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MainMem_Access_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MainMem_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_mem = 1;
+}
+
+void MainMem_Access_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MainMem_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_MainMem_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MainMem_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_access = 1;
+}
+
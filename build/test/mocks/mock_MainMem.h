@@ -0,0 +1,58 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_MAINMEM_H
+#define _MOCK_MAINMEM_H
+
+#include "unity_Helper.h"
+#include "MainMem.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_MainMem_Init(void);
+void mock_MainMem_Destroy(void);
+void mock_MainMem_Verify(void);
+
+
+
+
+#define MainMem_Create_IgnoreAndReturn(cmock_retval) MainMem_Create_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MainMem_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t cmock_to_return);
+#define MainMem_Create_ExpectAndReturn(config, cmock_retval) MainMem_Create_CMockExpectAndReturn(__LINE__, config, cmock_retval)
+void MainMem_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, memory_param_t const* config, main_mem_t cmock_to_return);
+typedef main_mem_t (* CMOCK_MainMem_Create_CALLBACK)(memory_param_t const* config, int cmock_num_calls);
+void MainMem_Create_StubWithCallback(CMOCK_MainMem_Create_CALLBACK Callback);
+#define MainMem_Create_ExpectAndThrow(config, cmock_to_throw) MainMem_Create_CMockExpectAndThrow(__LINE__, config, cmock_to_throw)
+void MainMem_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, memory_param_t const* config, CEXCEPTION_T cmock_to_throw);
+#define MainMem_Create_IgnoreArg_config() MainMem_Create_CMockIgnoreArg_config(__LINE__)
+void MainMem_Create_CMockIgnoreArg_config(UNITY_LINE_TYPE cmock_line);
+#define MainMem_Destroy_Ignore() MainMem_Destroy_CMockIgnore()
+void MainMem_Destroy_CMockIgnore(void);
+#define MainMem_Destroy_Expect(mem) MainMem_Destroy_CMockExpect(__LINE__, mem)
+void MainMem_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, main_mem_t mem);
+typedef void (* CMOCK_MainMem_Destroy_CALLBACK)(main_mem_t mem, int cmock_num_calls);
+void MainMem_Destroy_StubWithCallback(CMOCK_MainMem_Destroy_CALLBACK Callback);
+#define MainMem_Destroy_ExpectAndThrow(mem, cmock_to_throw) MainMem_Destroy_CMockExpectAndThrow(__LINE__, mem, cmock_to_throw)
+void MainMem_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, CEXCEPTION_T cmock_to_throw);
+#define MainMem_Destroy_IgnoreArg_mem() MainMem_Destroy_CMockIgnoreArg_mem(__LINE__)
+void MainMem_Destroy_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line);
+#define MainMem_Access_IgnoreAndReturn(cmock_retval) MainMem_Access_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MainMem_Access_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MainMem_Access_ExpectAndReturn(mem, access, cmock_retval) MainMem_Access_CMockExpectAndReturn(__LINE__, mem, access, cmock_retval)
+void MainMem_Access_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, main_mem_t mem, access_t const* access, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MainMem_Access_CALLBACK)(main_mem_t mem, access_t const* access, int cmock_num_calls);
+void MainMem_Access_StubWithCallback(CMOCK_MainMem_Access_CALLBACK Callback);
+#define MainMem_Access_ExpectAndThrow(mem, access, cmock_to_throw) MainMem_Access_CMockExpectAndThrow(__LINE__, mem, access, cmock_to_throw)
+void MainMem_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, main_mem_t mem, access_t const* access, CEXCEPTION_T cmock_to_throw);
+#define MainMem_Access_IgnoreArg_mem() MainMem_Access_CMockIgnoreArg_mem(__LINE__)
+void MainMem_Access_CMockIgnoreArg_mem(UNITY_LINE_TYPE cmock_line);
+#define MainMem_Access_IgnoreArg_access() MainMem_Access_CMockIgnoreArg_access(__LINE__)
+void MainMem_Access_CMockIgnoreArg_access(UNITY_LINE_TYPE cmock_line);
+
+#endif
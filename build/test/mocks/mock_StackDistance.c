@@ -0,0 +1,1720 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_StackDistance.h"
+
+static const char* CMockString_StackDistance_Access = "StackDistance_Access";
+static const char* CMockString_StackDistance_Caches = "StackDistance_Caches";
+static const char* CMockString_StackDistance_Create = "StackDistance_Create";
+static const char* CMockString_StackDistance_CreateAllWays = "StackDistance_CreateAllWays";
+static const char* CMockString_StackDistance_Destroy = "StackDistance_Destroy";
+static const char* CMockString_StackDistance_DirtyKickouts = "StackDistance_DirtyKickouts";
+static const char* CMockString_StackDistance_Hits = "StackDistance_Hits";
+static const char* CMockString_StackDistance_Kickouts = "StackDistance_Kickouts";
+static const char* CMockString_StackDistance_Misses = "StackDistance_Misses";
+static const char* CMockString_StackDistance_Print = "StackDistance_Print";
+static const char* CMockString_StackDistance_SizeBytes = "StackDistance_SizeBytes";
+static const char* CMockString_StackDistance_Ways = "StackDistance_Ways";
+static const char* CMockString_address = "address";
+static const char* CMockString_associativity = "associativity";
+static const char* CMockString_block_size_bytes = "block_size_bytes";
+static const char* CMockString_cache_size_bytes = "cache_size_bytes";
+static const char* CMockString_i = "i";
+static const char* CMockString_n_accesses = "n_accesses";
+static const char* CMockString_n_caches = "n_caches";
+static const char* CMockString_name = "name";
+static const char* CMockString_stack_distance = "stack_distance";
+static const char* CMockString_write = "write";
+
+typedef struct _CMOCK_StackDistance_Create_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  stack_distance_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_block_size_bytes;
+  uint32_t Expected_associativity;
+  uint32_t Expected_n_caches;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_block_size_bytes;
+  int IgnoreArg_associativity;
+  int IgnoreArg_n_caches;
+
+} CMOCK_StackDistance_Create_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  stack_distance_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_block_size_bytes;
+  uint32_t Expected_cache_size_bytes;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_block_size_bytes;
+  int IgnoreArg_cache_size_bytes;
+
+} CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Destroy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+
+} CMOCK_StackDistance_Destroy_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Access_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint64_t Expected_address;
+  uint32_t Expected_n_accesses;
+  _Bool Expected_write;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_address;
+  int IgnoreArg_n_accesses;
+  int IgnoreArg_write;
+
+} CMOCK_StackDistance_Access_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Caches_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+
+} CMOCK_StackDistance_Caches_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_SizeBytes_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_SizeBytes_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Ways_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_Ways_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Hits_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_Hits_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Misses_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_Misses_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Kickouts_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_Kickouts_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  uint32_t Expected_i;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_i;
+
+} CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE;
+
+typedef struct _CMOCK_StackDistance_Print_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stack_distance_t Expected_stack_distance;
+  char const* Expected_name;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stack_distance;
+  int IgnoreArg_name;
+
+} CMOCK_StackDistance_Print_CALL_INSTANCE;
+
+static struct mock_StackDistanceInstance
+{
+  int StackDistance_Create_IgnoreBool;
+  stack_distance_t StackDistance_Create_FinalReturn;
+  CMOCK_StackDistance_Create_CALLBACK StackDistance_Create_CallbackFunctionPointer;
+  int StackDistance_Create_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Create_CallInstance;
+  int StackDistance_CreateAllWays_IgnoreBool;
+  stack_distance_t StackDistance_CreateAllWays_FinalReturn;
+  CMOCK_StackDistance_CreateAllWays_CALLBACK StackDistance_CreateAllWays_CallbackFunctionPointer;
+  int StackDistance_CreateAllWays_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_CreateAllWays_CallInstance;
+  int StackDistance_Destroy_IgnoreBool;
+  CMOCK_StackDistance_Destroy_CALLBACK StackDistance_Destroy_CallbackFunctionPointer;
+  int StackDistance_Destroy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Destroy_CallInstance;
+  int StackDistance_Access_IgnoreBool;
+  CMOCK_StackDistance_Access_CALLBACK StackDistance_Access_CallbackFunctionPointer;
+  int StackDistance_Access_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Access_CallInstance;
+  int StackDistance_Caches_IgnoreBool;
+  uint32_t StackDistance_Caches_FinalReturn;
+  CMOCK_StackDistance_Caches_CALLBACK StackDistance_Caches_CallbackFunctionPointer;
+  int StackDistance_Caches_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Caches_CallInstance;
+  int StackDistance_SizeBytes_IgnoreBool;
+  uint64_t StackDistance_SizeBytes_FinalReturn;
+  CMOCK_StackDistance_SizeBytes_CALLBACK StackDistance_SizeBytes_CallbackFunctionPointer;
+  int StackDistance_SizeBytes_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_SizeBytes_CallInstance;
+  int StackDistance_Ways_IgnoreBool;
+  uint32_t StackDistance_Ways_FinalReturn;
+  CMOCK_StackDistance_Ways_CALLBACK StackDistance_Ways_CallbackFunctionPointer;
+  int StackDistance_Ways_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Ways_CallInstance;
+  int StackDistance_Hits_IgnoreBool;
+  uint64_t StackDistance_Hits_FinalReturn;
+  CMOCK_StackDistance_Hits_CALLBACK StackDistance_Hits_CallbackFunctionPointer;
+  int StackDistance_Hits_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Hits_CallInstance;
+  int StackDistance_Misses_IgnoreBool;
+  uint64_t StackDistance_Misses_FinalReturn;
+  CMOCK_StackDistance_Misses_CALLBACK StackDistance_Misses_CallbackFunctionPointer;
+  int StackDistance_Misses_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Misses_CallInstance;
+  int StackDistance_Kickouts_IgnoreBool;
+  uint64_t StackDistance_Kickouts_FinalReturn;
+  CMOCK_StackDistance_Kickouts_CALLBACK StackDistance_Kickouts_CallbackFunctionPointer;
+  int StackDistance_Kickouts_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Kickouts_CallInstance;
+  int StackDistance_DirtyKickouts_IgnoreBool;
+  uint64_t StackDistance_DirtyKickouts_FinalReturn;
+  CMOCK_StackDistance_DirtyKickouts_CALLBACK StackDistance_DirtyKickouts_CallbackFunctionPointer;
+  int StackDistance_DirtyKickouts_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_DirtyKickouts_CallInstance;
+  int StackDistance_Print_IgnoreBool;
+  CMOCK_StackDistance_Print_CALLBACK StackDistance_Print_CallbackFunctionPointer;
+  int StackDistance_Print_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE StackDistance_Print_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_StackDistance_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.StackDistance_Create_IgnoreBool)
+    Mock.StackDistance_Create_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Create);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Create_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Create_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Create_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_CreateAllWays_IgnoreBool)
+    Mock.StackDistance_CreateAllWays_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_CreateAllWays);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_CreateAllWays_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_CreateAllWays_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_CreateAllWays_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Destroy_IgnoreBool)
+    Mock.StackDistance_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Destroy);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Destroy_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Destroy_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Destroy_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Access_IgnoreBool)
+    Mock.StackDistance_Access_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Access);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Access_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Access_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Access_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Caches_IgnoreBool)
+    Mock.StackDistance_Caches_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Caches);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Caches_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Caches_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Caches_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_SizeBytes_IgnoreBool)
+    Mock.StackDistance_SizeBytes_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_SizeBytes);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_SizeBytes_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_SizeBytes_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_SizeBytes_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Ways_IgnoreBool)
+    Mock.StackDistance_Ways_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Ways);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Ways_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Ways_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Ways_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Hits_IgnoreBool)
+    Mock.StackDistance_Hits_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Hits);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Hits_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Hits_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Hits_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Misses_IgnoreBool)
+    Mock.StackDistance_Misses_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Misses);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Misses_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Misses_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Misses_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Kickouts_IgnoreBool)
+    Mock.StackDistance_Kickouts_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Kickouts);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Kickouts_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Kickouts_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Kickouts_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_DirtyKickouts_IgnoreBool)
+    Mock.StackDistance_DirtyKickouts_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_DirtyKickouts);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_DirtyKickouts_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_DirtyKickouts_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_DirtyKickouts_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.StackDistance_Print_IgnoreBool)
+    Mock.StackDistance_Print_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Print);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.StackDistance_Print_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.StackDistance_Print_CallbackFunctionPointer != NULL)
+    Mock.StackDistance_Print_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_StackDistance_Init(void)
+{
+  mock_StackDistance_Destroy();
+}
+
+void mock_StackDistance_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.StackDistance_Create_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Create_CallbackCalls = 0;
+  Mock.StackDistance_CreateAllWays_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_CreateAllWays_CallbackCalls = 0;
+  Mock.StackDistance_Destroy_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Destroy_CallbackCalls = 0;
+  Mock.StackDistance_Access_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Access_CallbackCalls = 0;
+  Mock.StackDistance_Caches_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Caches_CallbackCalls = 0;
+  Mock.StackDistance_SizeBytes_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_SizeBytes_CallbackCalls = 0;
+  Mock.StackDistance_Ways_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Ways_CallbackCalls = 0;
+  Mock.StackDistance_Hits_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Hits_CallbackCalls = 0;
+  Mock.StackDistance_Misses_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Misses_CallbackCalls = 0;
+  Mock.StackDistance_Kickouts_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Kickouts_CallbackCalls = 0;
+  Mock.StackDistance_DirtyKickouts_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_DirtyKickouts_CallbackCalls = 0;
+  Mock.StackDistance_Print_CallbackFunctionPointer = NULL;
+  Mock.StackDistance_Print_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+stack_distance_t StackDistance_Create(uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Create);
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Create_CallInstance);
+  Mock.StackDistance_Create_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Create_CallInstance);
+  if (Mock.StackDistance_Create_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Create_FinalReturn;
+    memcpy(&Mock.StackDistance_Create_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(stack_distance_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Create_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Create_CallbackFunctionPointer(block_size_bytes, associativity, n_caches, Mock.StackDistance_Create_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_block_size_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Create,CMockString_block_size_bytes);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_block_size_bytes, block_size_bytes, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_associativity)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Create,CMockString_associativity);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_associativity, associativity, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_n_caches)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Create,CMockString_n_caches);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_caches, n_caches, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Create(CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance, uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches)
+{
+  cmock_call_instance->Expected_block_size_bytes = block_size_bytes;
+  cmock_call_instance->IgnoreArg_block_size_bytes = 0;
+  cmock_call_instance->Expected_associativity = associativity;
+  cmock_call_instance->IgnoreArg_associativity = 0;
+  cmock_call_instance->Expected_n_caches = n_caches;
+  cmock_call_instance->IgnoreArg_n_caches = 0;
+}
+
+void StackDistance_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Create_CALL_INSTANCE));
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Create_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Create_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Create_IgnoreBool = (int)1;
+}
+
+void StackDistance_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches, stack_distance_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Create_CALL_INSTANCE));
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Create_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Create_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Create(cmock_call_instance, block_size_bytes, associativity, n_caches);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(stack_distance_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Create_StubWithCallback(CMOCK_StackDistance_Create_CALLBACK Callback)
+{
+  Mock.StackDistance_Create_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Create_CALL_INSTANCE));
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Create_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Create_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Create(cmock_call_instance, block_size_bytes, associativity, n_caches);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Create_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_block_size_bytes = 1;
+}
+
+void StackDistance_Create_CMockIgnoreArg_associativity(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_associativity = 1;
+}
+
+void StackDistance_Create_CMockIgnoreArg_n_caches(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_caches = 1;
+}
+
+stack_distance_t StackDistance_CreateAllWays(uint32_t block_size_bytes, uint32_t cache_size_bytes)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_CreateAllWays);
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_CreateAllWays_CallInstance);
+  Mock.StackDistance_CreateAllWays_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_CreateAllWays_CallInstance);
+  if (Mock.StackDistance_CreateAllWays_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_CreateAllWays_FinalReturn;
+    memcpy(&Mock.StackDistance_CreateAllWays_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(stack_distance_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_CreateAllWays_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_CreateAllWays_CallbackFunctionPointer(block_size_bytes, cache_size_bytes, Mock.StackDistance_CreateAllWays_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_block_size_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_CreateAllWays,CMockString_block_size_bytes);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_block_size_bytes, block_size_bytes, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_cache_size_bytes)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_CreateAllWays,CMockString_cache_size_bytes);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_cache_size_bytes, cache_size_bytes, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_CreateAllWays(CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance, uint32_t block_size_bytes, uint32_t cache_size_bytes)
+{
+  cmock_call_instance->Expected_block_size_bytes = block_size_bytes;
+  cmock_call_instance->IgnoreArg_block_size_bytes = 0;
+  cmock_call_instance->Expected_cache_size_bytes = cache_size_bytes;
+  cmock_call_instance->IgnoreArg_cache_size_bytes = 0;
+}
+
+void StackDistance_CreateAllWays_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE));
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_CreateAllWays_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_CreateAllWays_CallInstance, cmock_guts_index);
+  Mock.StackDistance_CreateAllWays_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_CreateAllWays_IgnoreBool = (int)1;
+}
+
+void StackDistance_CreateAllWays_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t cache_size_bytes, stack_distance_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE));
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_CreateAllWays_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_CreateAllWays_CallInstance, cmock_guts_index);
+  Mock.StackDistance_CreateAllWays_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_CreateAllWays(cmock_call_instance, block_size_bytes, cache_size_bytes);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(stack_distance_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_CreateAllWays_StubWithCallback(CMOCK_StackDistance_CreateAllWays_CALLBACK Callback)
+{
+  Mock.StackDistance_CreateAllWays_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_CreateAllWays_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t cache_size_bytes, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE));
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_CreateAllWays_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_CreateAllWays_CallInstance, cmock_guts_index);
+  Mock.StackDistance_CreateAllWays_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_CreateAllWays(cmock_call_instance, block_size_bytes, cache_size_bytes);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_CreateAllWays_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_CreateAllWays_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_block_size_bytes = 1;
+}
+
+void StackDistance_CreateAllWays_CMockIgnoreArg_cache_size_bytes(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_CreateAllWays_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_CreateAllWays_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache_size_bytes = 1;
+}
+
+void StackDistance_Destroy(stack_distance_t stack_distance)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Destroy);
+  CMOCK_StackDistance_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Destroy_CallInstance);
+  Mock.StackDistance_Destroy_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Destroy_CallInstance);
+  if (Mock.StackDistance_Destroy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.StackDistance_Destroy_CallbackFunctionPointer != NULL)
+  {
+    Mock.StackDistance_Destroy_CallbackFunctionPointer(stack_distance, Mock.StackDistance_Destroy_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Destroy,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_StackDistance_Destroy(CMOCK_StackDistance_Destroy_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+}
+
+void StackDistance_Destroy_CMockIgnore(void)
+{
+  Mock.StackDistance_Destroy_IgnoreBool = (int)1;
+}
+
+void StackDistance_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Destroy_CALL_INSTANCE));
+  CMOCK_StackDistance_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Destroy_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Destroy_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Destroy(cmock_call_instance, stack_distance);
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Destroy_StubWithCallback(CMOCK_StackDistance_Destroy_CALLBACK Callback)
+{
+  Mock.StackDistance_Destroy_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Destroy_CALL_INSTANCE));
+  CMOCK_StackDistance_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Destroy_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Destroy_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Destroy_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Destroy(cmock_call_instance, stack_distance);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Destroy_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Destroy_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Destroy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Destroy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Access(stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Access);
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Access_CallInstance);
+  Mock.StackDistance_Access_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Access_CallInstance);
+  if (Mock.StackDistance_Access_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.StackDistance_Access_CallbackFunctionPointer != NULL)
+  {
+    Mock.StackDistance_Access_CallbackFunctionPointer(stack_distance, address, n_accesses, write, Mock.StackDistance_Access_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Access,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_address)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Access,CMockString_address);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_address), (void*)(&address), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_n_accesses)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Access,CMockString_n_accesses);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_accesses, n_accesses, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_write)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Access,CMockString_write);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_write), (void*)(&write), sizeof(_Bool), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_StackDistance_Access(CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  memcpy(&cmock_call_instance->Expected_address, &address, sizeof(uint64_t));
+  cmock_call_instance->IgnoreArg_address = 0;
+  cmock_call_instance->Expected_n_accesses = n_accesses;
+  cmock_call_instance->IgnoreArg_n_accesses = 0;
+  memcpy(&cmock_call_instance->Expected_write, &write, sizeof(_Bool));
+  cmock_call_instance->IgnoreArg_write = 0;
+}
+
+void StackDistance_Access_CMockIgnore(void)
+{
+  Mock.StackDistance_Access_IgnoreBool = (int)1;
+}
+
+void StackDistance_Access_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Access_CALL_INSTANCE));
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Access_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Access_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Access(cmock_call_instance, stack_distance, address, n_accesses, write);
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Access_StubWithCallback(CMOCK_StackDistance_Access_CALLBACK Callback)
+{
+  Mock.StackDistance_Access_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Access_CALL_INSTANCE));
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Access_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Access_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Access_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Access(cmock_call_instance, stack_distance, address, n_accesses, write);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Access_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Access_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_address = 1;
+}
+
+void StackDistance_Access_CMockIgnoreArg_n_accesses(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_accesses = 1;
+}
+
+void StackDistance_Access_CMockIgnoreArg_write(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Access_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Access_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Access_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_write = 1;
+}
+
+uint32_t StackDistance_Caches(stack_distance_t stack_distance)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Caches);
+  CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Caches_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Caches_CallInstance);
+  Mock.StackDistance_Caches_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Caches_CallInstance);
+  if (Mock.StackDistance_Caches_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Caches_FinalReturn;
+    Mock.StackDistance_Caches_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Caches_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Caches_CallbackFunctionPointer(stack_distance, Mock.StackDistance_Caches_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Caches,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Caches(CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+}
+
+void StackDistance_Caches_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Caches_CALL_INSTANCE));
+  CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Caches_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Caches_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Caches_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Caches_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Caches_IgnoreBool = (int)1;
+}
+
+void StackDistance_Caches_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Caches_CALL_INSTANCE));
+  CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Caches_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Caches_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Caches_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Caches_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Caches(cmock_call_instance, stack_distance);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Caches_StubWithCallback(CMOCK_StackDistance_Caches_CALLBACK Callback)
+{
+  Mock.StackDistance_Caches_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Caches_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Caches_CALL_INSTANCE));
+  CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Caches_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Caches_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Caches_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Caches_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Caches(cmock_call_instance, stack_distance);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Caches_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Caches_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Caches_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Caches_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+uint64_t StackDistance_SizeBytes(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_SizeBytes);
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_SizeBytes_CallInstance);
+  Mock.StackDistance_SizeBytes_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_SizeBytes_CallInstance);
+  if (Mock.StackDistance_SizeBytes_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_SizeBytes_FinalReturn;
+    memcpy(&Mock.StackDistance_SizeBytes_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_SizeBytes_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_SizeBytes_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_SizeBytes_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_SizeBytes,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_SizeBytes,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_SizeBytes(CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_SizeBytes_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_SizeBytes_CALL_INSTANCE));
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_SizeBytes_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_SizeBytes_CallInstance, cmock_guts_index);
+  Mock.StackDistance_SizeBytes_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_SizeBytes_IgnoreBool = (int)1;
+}
+
+void StackDistance_SizeBytes_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_SizeBytes_CALL_INSTANCE));
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_SizeBytes_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_SizeBytes_CallInstance, cmock_guts_index);
+  Mock.StackDistance_SizeBytes_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_SizeBytes(cmock_call_instance, stack_distance, i);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_SizeBytes_StubWithCallback(CMOCK_StackDistance_SizeBytes_CALLBACK Callback)
+{
+  Mock.StackDistance_SizeBytes_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_SizeBytes_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_SizeBytes_CALL_INSTANCE));
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_SizeBytes_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_SizeBytes_CallInstance, cmock_guts_index);
+  Mock.StackDistance_SizeBytes_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_SizeBytes(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_SizeBytes_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_SizeBytes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_SizeBytes_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_SizeBytes_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_SizeBytes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_SizeBytes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+uint32_t StackDistance_Ways(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Ways);
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Ways_CallInstance);
+  Mock.StackDistance_Ways_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Ways_CallInstance);
+  if (Mock.StackDistance_Ways_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Ways_FinalReturn;
+    Mock.StackDistance_Ways_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Ways_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Ways_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_Ways_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Ways,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Ways,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Ways(CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_Ways_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Ways_CALL_INSTANCE));
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Ways_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Ways_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Ways_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Ways_IgnoreBool = (int)1;
+}
+
+void StackDistance_Ways_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Ways_CALL_INSTANCE));
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Ways_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Ways_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Ways_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Ways(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Ways_StubWithCallback(CMOCK_StackDistance_Ways_CALLBACK Callback)
+{
+  Mock.StackDistance_Ways_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Ways_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Ways_CALL_INSTANCE));
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Ways_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Ways_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Ways_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Ways(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Ways_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Ways_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Ways_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Ways_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Ways_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Ways_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+uint64_t StackDistance_Hits(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Hits);
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Hits_CallInstance);
+  Mock.StackDistance_Hits_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Hits_CallInstance);
+  if (Mock.StackDistance_Hits_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Hits_FinalReturn;
+    memcpy(&Mock.StackDistance_Hits_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Hits_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Hits_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_Hits_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Hits,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Hits,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Hits(CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_Hits_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Hits_CALL_INSTANCE));
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Hits_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Hits_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Hits_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Hits_IgnoreBool = (int)1;
+}
+
+void StackDistance_Hits_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Hits_CALL_INSTANCE));
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Hits_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Hits_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Hits_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Hits(cmock_call_instance, stack_distance, i);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Hits_StubWithCallback(CMOCK_StackDistance_Hits_CALLBACK Callback)
+{
+  Mock.StackDistance_Hits_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Hits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Hits_CALL_INSTANCE));
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Hits_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Hits_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Hits_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Hits(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Hits_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Hits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Hits_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Hits_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Hits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Hits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+uint64_t StackDistance_Misses(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Misses);
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Misses_CallInstance);
+  Mock.StackDistance_Misses_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Misses_CallInstance);
+  if (Mock.StackDistance_Misses_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Misses_FinalReturn;
+    memcpy(&Mock.StackDistance_Misses_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Misses_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Misses_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_Misses_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Misses,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Misses,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Misses(CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_Misses_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Misses_CALL_INSTANCE));
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Misses_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Misses_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Misses_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Misses_IgnoreBool = (int)1;
+}
+
+void StackDistance_Misses_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Misses_CALL_INSTANCE));
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Misses_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Misses_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Misses_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Misses(cmock_call_instance, stack_distance, i);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Misses_StubWithCallback(CMOCK_StackDistance_Misses_CALLBACK Callback)
+{
+  Mock.StackDistance_Misses_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Misses_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Misses_CALL_INSTANCE));
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Misses_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Misses_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Misses_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Misses(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Misses_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Misses_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Misses_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Misses_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Misses_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Misses_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+uint64_t StackDistance_Kickouts(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Kickouts);
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Kickouts_CallInstance);
+  Mock.StackDistance_Kickouts_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Kickouts_CallInstance);
+  if (Mock.StackDistance_Kickouts_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_Kickouts_FinalReturn;
+    memcpy(&Mock.StackDistance_Kickouts_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_Kickouts_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_Kickouts_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_Kickouts_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Kickouts,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Kickouts,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_Kickouts(CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_Kickouts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Kickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Kickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Kickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Kickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_Kickouts_IgnoreBool = (int)1;
+}
+
+void StackDistance_Kickouts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Kickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Kickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Kickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Kickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Kickouts(cmock_call_instance, stack_distance, i);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Kickouts_StubWithCallback(CMOCK_StackDistance_Kickouts_CALLBACK Callback)
+{
+  Mock.StackDistance_Kickouts_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Kickouts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Kickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Kickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Kickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Kickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Kickouts(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Kickouts_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Kickouts_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Kickouts_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Kickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Kickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Kickouts_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+uint64_t StackDistance_DirtyKickouts(stack_distance_t stack_distance, uint32_t i)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_DirtyKickouts);
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_DirtyKickouts_CallInstance);
+  Mock.StackDistance_DirtyKickouts_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_DirtyKickouts_CallInstance);
+  if (Mock.StackDistance_DirtyKickouts_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.StackDistance_DirtyKickouts_FinalReturn;
+    memcpy(&Mock.StackDistance_DirtyKickouts_FinalReturn, &cmock_call_instance->ReturnVal, sizeof(uint64_t));
+    return cmock_call_instance->ReturnVal;
+  }
+  if (Mock.StackDistance_DirtyKickouts_CallbackFunctionPointer != NULL)
+  {
+    return Mock.StackDistance_DirtyKickouts_CallbackFunctionPointer(stack_distance, i, Mock.StackDistance_DirtyKickouts_CallbackCalls++);
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_DirtyKickouts,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_i)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_DirtyKickouts,CMockString_i);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_i, i, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_StackDistance_DirtyKickouts(CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, uint32_t i)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  cmock_call_instance->Expected_i = i;
+  cmock_call_instance->IgnoreArg_i = 0;
+}
+
+void StackDistance_DirtyKickouts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_DirtyKickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_DirtyKickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_DirtyKickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.StackDistance_DirtyKickouts_IgnoreBool = (int)1;
+}
+
+void StackDistance_DirtyKickouts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_DirtyKickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_DirtyKickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_DirtyKickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_DirtyKickouts(cmock_call_instance, stack_distance, i);
+  memcpy(&cmock_call_instance->ReturnVal, &cmock_to_return, sizeof(uint64_t));
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_DirtyKickouts_StubWithCallback(CMOCK_StackDistance_DirtyKickouts_CALLBACK Callback)
+{
+  Mock.StackDistance_DirtyKickouts_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_DirtyKickouts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE));
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_DirtyKickouts_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_DirtyKickouts_CallInstance, cmock_guts_index);
+  Mock.StackDistance_DirtyKickouts_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_DirtyKickouts(cmock_call_instance, stack_distance, i);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_DirtyKickouts_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_DirtyKickouts_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_DirtyKickouts_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_DirtyKickouts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_DirtyKickouts_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_i = 1;
+}
+
+void StackDistance_Print(stack_distance_t stack_distance, char const* name)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_StackDistance_Print);
+  CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.StackDistance_Print_CallInstance);
+  Mock.StackDistance_Print_CallInstance = CMock_Guts_MemNext(Mock.StackDistance_Print_CallInstance);
+  if (Mock.StackDistance_Print_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.StackDistance_Print_CallbackFunctionPointer != NULL)
+  {
+    Mock.StackDistance_Print_CallbackFunctionPointer(stack_distance, name, Mock.StackDistance_Print_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stack_distance)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Print,CMockString_stack_distance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stack_distance), (void*)(&stack_distance), sizeof(stack_distance_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_name)
+  {
+    UNITY_SET_DETAILS(CMockString_StackDistance_Print,CMockString_name);
+    UNITY_TEST_ASSERT_EQUAL_STRING(cmock_call_instance->Expected_name, name, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_StackDistance_Print(CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance, stack_distance_t stack_distance, char const* name)
+{
+  memcpy(&cmock_call_instance->Expected_stack_distance, &stack_distance, sizeof(stack_distance_t));
+  cmock_call_instance->IgnoreArg_stack_distance = 0;
+  memcpy(&cmock_call_instance->Expected_name, &name, sizeof(char const*));
+  cmock_call_instance->IgnoreArg_name = 0;
+}
+
+void StackDistance_Print_CMockIgnore(void)
+{
+  Mock.StackDistance_Print_IgnoreBool = (int)1;
+}
+
+void StackDistance_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, char const* name)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Print_CALL_INSTANCE));
+  CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Print_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Print_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Print(cmock_call_instance, stack_distance, name);
+  UNITY_CLR_DETAILS();
+}
+
+void StackDistance_Print_StubWithCallback(CMOCK_StackDistance_Print_CALLBACK Callback)
+{
+  Mock.StackDistance_Print_CallbackFunctionPointer = Callback;
+}
+
+void StackDistance_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, char const* name, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_StackDistance_Print_CALL_INSTANCE));
+  CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.StackDistance_Print_CallInstance = CMock_Guts_MemChain(Mock.StackDistance_Print_CallInstance, cmock_guts_index);
+  Mock.StackDistance_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_StackDistance_Print(cmock_call_instance, stack_distance, name);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void StackDistance_Print_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Print_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stack_distance = 1;
+}
+
+void StackDistance_Print_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_StackDistance_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_StackDistance_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.StackDistance_Print_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_name = 1;
+}
+
@@ -0,0 +1,172 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_STACKDISTANCE_H
+#define _MOCK_STACKDISTANCE_H
+
+#include "unity_Helper.h"
+#include "StackDistance.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_StackDistance_Init(void);
+void mock_StackDistance_Destroy(void);
+void mock_StackDistance_Verify(void);
+
+
+
+
+#define StackDistance_Create_IgnoreAndReturn(cmock_retval) StackDistance_Create_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Create_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t cmock_to_return);
+#define StackDistance_Create_ExpectAndReturn(block_size_bytes, associativity, n_caches, cmock_retval) StackDistance_Create_CMockExpectAndReturn(__LINE__, block_size_bytes, associativity, n_caches, cmock_retval)
+void StackDistance_Create_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches, stack_distance_t cmock_to_return);
+typedef stack_distance_t (* CMOCK_StackDistance_Create_CALLBACK)(uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches, int cmock_num_calls);
+void StackDistance_Create_StubWithCallback(CMOCK_StackDistance_Create_CALLBACK Callback);
+#define StackDistance_Create_ExpectAndThrow(block_size_bytes, associativity, n_caches, cmock_to_throw) StackDistance_Create_CMockExpectAndThrow(__LINE__, block_size_bytes, associativity, n_caches, cmock_to_throw)
+void StackDistance_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t associativity, uint32_t n_caches, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Create_IgnoreArg_block_size_bytes() StackDistance_Create_CMockIgnoreArg_block_size_bytes(__LINE__)
+void StackDistance_Create_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Create_IgnoreArg_associativity() StackDistance_Create_CMockIgnoreArg_associativity(__LINE__)
+void StackDistance_Create_CMockIgnoreArg_associativity(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Create_IgnoreArg_n_caches() StackDistance_Create_CMockIgnoreArg_n_caches(__LINE__)
+void StackDistance_Create_CMockIgnoreArg_n_caches(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_CreateAllWays_IgnoreAndReturn(cmock_retval) StackDistance_CreateAllWays_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_CreateAllWays_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t cmock_to_return);
+#define StackDistance_CreateAllWays_ExpectAndReturn(block_size_bytes, cache_size_bytes, cmock_retval) StackDistance_CreateAllWays_CMockExpectAndReturn(__LINE__, block_size_bytes, cache_size_bytes, cmock_retval)
+void StackDistance_CreateAllWays_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t cache_size_bytes, stack_distance_t cmock_to_return);
+typedef stack_distance_t (* CMOCK_StackDistance_CreateAllWays_CALLBACK)(uint32_t block_size_bytes, uint32_t cache_size_bytes, int cmock_num_calls);
+void StackDistance_CreateAllWays_StubWithCallback(CMOCK_StackDistance_CreateAllWays_CALLBACK Callback);
+#define StackDistance_CreateAllWays_ExpectAndThrow(block_size_bytes, cache_size_bytes, cmock_to_throw) StackDistance_CreateAllWays_CMockExpectAndThrow(__LINE__, block_size_bytes, cache_size_bytes, cmock_to_throw)
+void StackDistance_CreateAllWays_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t block_size_bytes, uint32_t cache_size_bytes, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_CreateAllWays_IgnoreArg_block_size_bytes() StackDistance_CreateAllWays_CMockIgnoreArg_block_size_bytes(__LINE__)
+void StackDistance_CreateAllWays_CMockIgnoreArg_block_size_bytes(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_CreateAllWays_IgnoreArg_cache_size_bytes() StackDistance_CreateAllWays_CMockIgnoreArg_cache_size_bytes(__LINE__)
+void StackDistance_CreateAllWays_CMockIgnoreArg_cache_size_bytes(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Destroy_Ignore() StackDistance_Destroy_CMockIgnore()
+void StackDistance_Destroy_CMockIgnore(void);
+#define StackDistance_Destroy_Expect(stack_distance) StackDistance_Destroy_CMockExpect(__LINE__, stack_distance)
+void StackDistance_Destroy_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance);
+typedef void (* CMOCK_StackDistance_Destroy_CALLBACK)(stack_distance_t stack_distance, int cmock_num_calls);
+void StackDistance_Destroy_StubWithCallback(CMOCK_StackDistance_Destroy_CALLBACK Callback);
+#define StackDistance_Destroy_ExpectAndThrow(stack_distance, cmock_to_throw) StackDistance_Destroy_CMockExpectAndThrow(__LINE__, stack_distance, cmock_to_throw)
+void StackDistance_Destroy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Destroy_IgnoreArg_stack_distance() StackDistance_Destroy_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Destroy_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Access_Ignore() StackDistance_Access_CMockIgnore()
+void StackDistance_Access_CMockIgnore(void);
+#define StackDistance_Access_Expect(stack_distance, address, n_accesses, write) StackDistance_Access_CMockExpect(__LINE__, stack_distance, address, n_accesses, write)
+void StackDistance_Access_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write);
+typedef void (* CMOCK_StackDistance_Access_CALLBACK)(stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write, int cmock_num_calls);
+void StackDistance_Access_StubWithCallback(CMOCK_StackDistance_Access_CALLBACK Callback);
+#define StackDistance_Access_ExpectAndThrow(stack_distance, address, n_accesses, write, cmock_to_throw) StackDistance_Access_CMockExpectAndThrow(__LINE__, stack_distance, address, n_accesses, write, cmock_to_throw)
+void StackDistance_Access_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint64_t address, uint32_t n_accesses, _Bool write, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Access_IgnoreArg_stack_distance() StackDistance_Access_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Access_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Access_IgnoreArg_address() StackDistance_Access_CMockIgnoreArg_address(__LINE__)
+void StackDistance_Access_CMockIgnoreArg_address(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Access_IgnoreArg_n_accesses() StackDistance_Access_CMockIgnoreArg_n_accesses(__LINE__)
+void StackDistance_Access_CMockIgnoreArg_n_accesses(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Access_IgnoreArg_write() StackDistance_Access_CMockIgnoreArg_write(__LINE__)
+void StackDistance_Access_CMockIgnoreArg_write(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Caches_IgnoreAndReturn(cmock_retval) StackDistance_Caches_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Caches_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define StackDistance_Caches_ExpectAndReturn(stack_distance, cmock_retval) StackDistance_Caches_CMockExpectAndReturn(__LINE__, stack_distance, cmock_retval)
+void StackDistance_Caches_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_StackDistance_Caches_CALLBACK)(stack_distance_t stack_distance, int cmock_num_calls);
+void StackDistance_Caches_StubWithCallback(CMOCK_StackDistance_Caches_CALLBACK Callback);
+#define StackDistance_Caches_ExpectAndThrow(stack_distance, cmock_to_throw) StackDistance_Caches_CMockExpectAndThrow(__LINE__, stack_distance, cmock_to_throw)
+void StackDistance_Caches_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Caches_IgnoreArg_stack_distance() StackDistance_Caches_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Caches_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_SizeBytes_IgnoreAndReturn(cmock_retval) StackDistance_SizeBytes_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_SizeBytes_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define StackDistance_SizeBytes_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_SizeBytes_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_SizeBytes_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_StackDistance_SizeBytes_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_SizeBytes_StubWithCallback(CMOCK_StackDistance_SizeBytes_CALLBACK Callback);
+#define StackDistance_SizeBytes_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_SizeBytes_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_SizeBytes_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_SizeBytes_IgnoreArg_stack_distance() StackDistance_SizeBytes_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_SizeBytes_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_SizeBytes_IgnoreArg_i() StackDistance_SizeBytes_CMockIgnoreArg_i(__LINE__)
+void StackDistance_SizeBytes_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Ways_IgnoreAndReturn(cmock_retval) StackDistance_Ways_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Ways_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define StackDistance_Ways_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_Ways_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_Ways_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_StackDistance_Ways_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_Ways_StubWithCallback(CMOCK_StackDistance_Ways_CALLBACK Callback);
+#define StackDistance_Ways_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_Ways_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_Ways_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Ways_IgnoreArg_stack_distance() StackDistance_Ways_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Ways_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Ways_IgnoreArg_i() StackDistance_Ways_CMockIgnoreArg_i(__LINE__)
+void StackDistance_Ways_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Hits_IgnoreAndReturn(cmock_retval) StackDistance_Hits_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Hits_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define StackDistance_Hits_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_Hits_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_Hits_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_StackDistance_Hits_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_Hits_StubWithCallback(CMOCK_StackDistance_Hits_CALLBACK Callback);
+#define StackDistance_Hits_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_Hits_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_Hits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Hits_IgnoreArg_stack_distance() StackDistance_Hits_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Hits_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Hits_IgnoreArg_i() StackDistance_Hits_CMockIgnoreArg_i(__LINE__)
+void StackDistance_Hits_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Misses_IgnoreAndReturn(cmock_retval) StackDistance_Misses_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Misses_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define StackDistance_Misses_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_Misses_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_Misses_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_StackDistance_Misses_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_Misses_StubWithCallback(CMOCK_StackDistance_Misses_CALLBACK Callback);
+#define StackDistance_Misses_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_Misses_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_Misses_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Misses_IgnoreArg_stack_distance() StackDistance_Misses_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Misses_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Misses_IgnoreArg_i() StackDistance_Misses_CMockIgnoreArg_i(__LINE__)
+void StackDistance_Misses_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Kickouts_IgnoreAndReturn(cmock_retval) StackDistance_Kickouts_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_Kickouts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define StackDistance_Kickouts_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_Kickouts_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_Kickouts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_StackDistance_Kickouts_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_Kickouts_StubWithCallback(CMOCK_StackDistance_Kickouts_CALLBACK Callback);
+#define StackDistance_Kickouts_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_Kickouts_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_Kickouts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Kickouts_IgnoreArg_stack_distance() StackDistance_Kickouts_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Kickouts_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Kickouts_IgnoreArg_i() StackDistance_Kickouts_CMockIgnoreArg_i(__LINE__)
+void StackDistance_Kickouts_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_DirtyKickouts_IgnoreAndReturn(cmock_retval) StackDistance_DirtyKickouts_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void StackDistance_DirtyKickouts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define StackDistance_DirtyKickouts_ExpectAndReturn(stack_distance, i, cmock_retval) StackDistance_DirtyKickouts_CMockExpectAndReturn(__LINE__, stack_distance, i, cmock_retval)
+void StackDistance_DirtyKickouts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_StackDistance_DirtyKickouts_CALLBACK)(stack_distance_t stack_distance, uint32_t i, int cmock_num_calls);
+void StackDistance_DirtyKickouts_StubWithCallback(CMOCK_StackDistance_DirtyKickouts_CALLBACK Callback);
+#define StackDistance_DirtyKickouts_ExpectAndThrow(stack_distance, i, cmock_to_throw) StackDistance_DirtyKickouts_CMockExpectAndThrow(__LINE__, stack_distance, i, cmock_to_throw)
+void StackDistance_DirtyKickouts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, uint32_t i, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_DirtyKickouts_IgnoreArg_stack_distance() StackDistance_DirtyKickouts_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_DirtyKickouts_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_DirtyKickouts_IgnoreArg_i() StackDistance_DirtyKickouts_CMockIgnoreArg_i(__LINE__)
+void StackDistance_DirtyKickouts_CMockIgnoreArg_i(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Print_Ignore() StackDistance_Print_CMockIgnore()
+void StackDistance_Print_CMockIgnore(void);
+#define StackDistance_Print_Expect(stack_distance, name) StackDistance_Print_CMockExpect(__LINE__, stack_distance, name)
+void StackDistance_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, char const* name);
+typedef void (* CMOCK_StackDistance_Print_CALLBACK)(stack_distance_t stack_distance, char const* name, int cmock_num_calls);
+void StackDistance_Print_StubWithCallback(CMOCK_StackDistance_Print_CALLBACK Callback);
+#define StackDistance_Print_ExpectAndThrow(stack_distance, name, cmock_to_throw) StackDistance_Print_CMockExpectAndThrow(__LINE__, stack_distance, name, cmock_to_throw)
+void StackDistance_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stack_distance_t stack_distance, char const* name, CEXCEPTION_T cmock_to_throw);
+#define StackDistance_Print_IgnoreArg_stack_distance() StackDistance_Print_CMockIgnoreArg_stack_distance(__LINE__)
+void StackDistance_Print_CMockIgnoreArg_stack_distance(UNITY_LINE_TYPE cmock_line);
+#define StackDistance_Print_IgnoreArg_name() StackDistance_Print_CMockIgnoreArg_name(__LINE__)
+void StackDistance_Print_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line);
+
+#endif
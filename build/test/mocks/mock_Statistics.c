@@ -0,0 +1,910 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "unity.h"
+#include "cmock.h"
+#include "mock_Statistics.h"
+
+static const char* CMockString_Statistics_Create = "Statistics_Create";
+static const char* CMockString_Statistics_Print = "Statistics_Print";
+static const char* CMockString_Statistics_RecordAccess = "Statistics_RecordAccess";
+static const char* CMockString_Statistics_RecordCacheAccess = "Statistics_RecordCacheAccess";
+static const char* CMockString_Statistics_RecordCacheHits = "Statistics_RecordCacheHits";
+static const char* CMockString_Statistics_RecordCycles = "Statistics_RecordCycles";
+static const char* CMockString_cache_stats = "cache_stats";
+static const char* CMockString_cycles = "cycles";
+static const char* CMockString_n_aligned = "n_aligned";
+static const char* CMockString_n_hits = "n_hits";
+static const char* CMockString_result = "result";
+static const char* CMockString_stats = "stats";
+static const char* CMockString_type = "type";
+
+typedef struct _CMOCK_Statistics_Create_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stats_t* Expected_stats;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_stats_Used;
+  stats_t* ReturnThruPtr_stats_Val;
+  int ReturnThruPtr_stats_Size;
+  int IgnoreArg_stats;
+
+} CMOCK_Statistics_Create_CALL_INSTANCE;
+
+typedef struct _CMOCK_Statistics_Print_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stats_t const* Expected_stats;
+  CEXCEPTION_T ExceptionToThrow;
+  int IgnoreArg_stats;
+
+} CMOCK_Statistics_Print_CALL_INSTANCE;
+
+typedef struct _CMOCK_Statistics_RecordAccess_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stats_t* Expected_stats;
+  uint8_t Expected_type;
+  uint32_t Expected_cycles;
+  uint32_t Expected_n_aligned;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_stats_Used;
+  stats_t* ReturnThruPtr_stats_Val;
+  int ReturnThruPtr_stats_Size;
+  int IgnoreArg_stats;
+  int IgnoreArg_type;
+  int IgnoreArg_cycles;
+  int IgnoreArg_n_aligned;
+
+} CMOCK_Statistics_RecordAccess_CALL_INSTANCE;
+
+typedef struct _CMOCK_Statistics_RecordCycles_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  stats_t* Expected_stats;
+  uint8_t Expected_type;
+  uint32_t Expected_cycles;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_stats_Used;
+  stats_t* ReturnThruPtr_stats_Val;
+  int ReturnThruPtr_stats_Size;
+  int IgnoreArg_stats;
+  int IgnoreArg_type;
+  int IgnoreArg_cycles;
+
+} CMOCK_Statistics_RecordCycles_CALL_INSTANCE;
+
+typedef struct _CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_stats_t* Expected_cache_stats;
+  result_t Expected_result;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_cache_stats_Used;
+  cache_stats_t* ReturnThruPtr_cache_stats_Val;
+  int ReturnThruPtr_cache_stats_Size;
+  int IgnoreArg_cache_stats;
+  int IgnoreArg_result;
+
+} CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE;
+
+typedef struct _CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  cache_stats_t* Expected_cache_stats;
+  uint32_t Expected_n_hits;
+  CEXCEPTION_T ExceptionToThrow;
+  int ReturnThruPtr_cache_stats_Used;
+  cache_stats_t* ReturnThruPtr_cache_stats_Val;
+  int ReturnThruPtr_cache_stats_Size;
+  int IgnoreArg_cache_stats;
+  int IgnoreArg_n_hits;
+
+} CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE;
+
+static struct mock_StatisticsInstance
+{
+  int Statistics_Create_IgnoreBool;
+  CMOCK_Statistics_Create_CALLBACK Statistics_Create_CallbackFunctionPointer;
+  int Statistics_Create_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_Create_CallInstance;
+  int Statistics_Print_IgnoreBool;
+  CMOCK_Statistics_Print_CALLBACK Statistics_Print_CallbackFunctionPointer;
+  int Statistics_Print_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_Print_CallInstance;
+  int Statistics_RecordAccess_IgnoreBool;
+  CMOCK_Statistics_RecordAccess_CALLBACK Statistics_RecordAccess_CallbackFunctionPointer;
+  int Statistics_RecordAccess_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_RecordAccess_CallInstance;
+  int Statistics_RecordCycles_IgnoreBool;
+  CMOCK_Statistics_RecordCycles_CALLBACK Statistics_RecordCycles_CallbackFunctionPointer;
+  int Statistics_RecordCycles_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_RecordCycles_CallInstance;
+  int Statistics_RecordCacheAccess_IgnoreBool;
+  CMOCK_Statistics_RecordCacheAccess_CALLBACK Statistics_RecordCacheAccess_CallbackFunctionPointer;
+  int Statistics_RecordCacheAccess_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_RecordCacheAccess_CallInstance;
+  int Statistics_RecordCacheHits_IgnoreBool;
+  CMOCK_Statistics_RecordCacheHits_CALLBACK Statistics_RecordCacheHits_CallbackFunctionPointer;
+  int Statistics_RecordCacheHits_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE Statistics_RecordCacheHits_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void mock_Statistics_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  if (Mock.Statistics_Create_IgnoreBool)
+    Mock.Statistics_Create_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_Create);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_Create_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_Create_CallbackFunctionPointer != NULL)
+    Mock.Statistics_Create_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.Statistics_Print_IgnoreBool)
+    Mock.Statistics_Print_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_Print);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_Print_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_Print_CallbackFunctionPointer != NULL)
+    Mock.Statistics_Print_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.Statistics_RecordAccess_IgnoreBool)
+    Mock.Statistics_RecordAccess_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordAccess);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_RecordAccess_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_RecordAccess_CallbackFunctionPointer != NULL)
+    Mock.Statistics_RecordAccess_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.Statistics_RecordCycles_IgnoreBool)
+    Mock.Statistics_RecordCycles_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCycles);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_RecordCycles_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_RecordCycles_CallbackFunctionPointer != NULL)
+    Mock.Statistics_RecordCycles_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.Statistics_RecordCacheAccess_IgnoreBool)
+    Mock.Statistics_RecordCacheAccess_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCacheAccess);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_RecordCacheAccess_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_RecordCacheAccess_CallbackFunctionPointer != NULL)
+    Mock.Statistics_RecordCacheAccess_CallInstance = CMOCK_GUTS_NONE;
+  if (Mock.Statistics_RecordCacheHits_IgnoreBool)
+    Mock.Statistics_RecordCacheHits_CallInstance = CMOCK_GUTS_NONE;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCacheHits);
+  UNITY_TEST_ASSERT(CMOCK_GUTS_NONE == Mock.Statistics_RecordCacheHits_CallInstance, cmock_line, CMockStringCalledLess);
+  if (Mock.Statistics_RecordCacheHits_CallbackFunctionPointer != NULL)
+    Mock.Statistics_RecordCacheHits_CallInstance = CMOCK_GUTS_NONE;
+}
+
+void mock_Statistics_Init(void)
+{
+  mock_Statistics_Destroy();
+}
+
+void mock_Statistics_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  Mock.Statistics_Create_CallbackFunctionPointer = NULL;
+  Mock.Statistics_Create_CallbackCalls = 0;
+  Mock.Statistics_Print_CallbackFunctionPointer = NULL;
+  Mock.Statistics_Print_CallbackCalls = 0;
+  Mock.Statistics_RecordAccess_CallbackFunctionPointer = NULL;
+  Mock.Statistics_RecordAccess_CallbackCalls = 0;
+  Mock.Statistics_RecordCycles_CallbackFunctionPointer = NULL;
+  Mock.Statistics_RecordCycles_CallbackCalls = 0;
+  Mock.Statistics_RecordCacheAccess_CallbackFunctionPointer = NULL;
+  Mock.Statistics_RecordCacheAccess_CallbackCalls = 0;
+  Mock.Statistics_RecordCacheHits_CallbackFunctionPointer = NULL;
+  Mock.Statistics_RecordCacheHits_CallbackCalls = 0;
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void Statistics_Create(stats_t* stats)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_Create);
+  CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_Create_CallInstance);
+  Mock.Statistics_Create_CallInstance = CMock_Guts_MemNext(Mock.Statistics_Create_CallInstance);
+  if (Mock.Statistics_Create_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_Create_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_Create_CallbackFunctionPointer(stats, Mock.Statistics_Create_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_Create,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_stats_Used)
+  {
+    memcpy(stats, cmock_call_instance->ReturnThruPtr_stats_Val,
+      cmock_call_instance->ReturnThruPtr_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_Create(CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance, stats_t* stats)
+{
+  cmock_call_instance->Expected_stats = stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+  cmock_call_instance->ReturnThruPtr_stats_Used = 0;
+}
+
+void Statistics_Create_CMockIgnore(void)
+{
+  Mock.Statistics_Create_IgnoreBool = (int)1;
+}
+
+void Statistics_Create_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_Create_CALL_INSTANCE));
+  CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_Create_CallInstance = CMock_Guts_MemChain(Mock.Statistics_Create_CallInstance, cmock_guts_index);
+  Mock.Statistics_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_Create(cmock_call_instance, stats);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_Create_StubWithCallback(CMOCK_Statistics_Create_CALLBACK Callback)
+{
+  Mock.Statistics_Create_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_Create_CALL_INSTANCE));
+  CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_Create_CallInstance = CMock_Guts_MemChain(Mock.Statistics_Create_CallInstance, cmock_guts_index);
+  Mock.Statistics_Create_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_Create(cmock_call_instance, stats);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_Create_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size)
+{
+  CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_stats_Val = stats;
+  cmock_call_instance->ReturnThruPtr_stats_Size = cmock_size;
+}
+
+void Statistics_Create_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_Create_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Create_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_Create_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+void Statistics_Print(stats_t const* stats)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_Print);
+  CMOCK_Statistics_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_Print_CallInstance);
+  Mock.Statistics_Print_CallInstance = CMock_Guts_MemNext(Mock.Statistics_Print_CallInstance);
+  if (Mock.Statistics_Print_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_Print_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_Print_CallbackFunctionPointer(stats, Mock.Statistics_Print_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_Print,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t const), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_Print(CMOCK_Statistics_Print_CALL_INSTANCE* cmock_call_instance, stats_t const* stats)
+{
+  cmock_call_instance->Expected_stats = (stats_t const*)stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+}
+
+void Statistics_Print_CMockIgnore(void)
+{
+  Mock.Statistics_Print_IgnoreBool = (int)1;
+}
+
+void Statistics_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t const* stats)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_Print_CALL_INSTANCE));
+  CMOCK_Statistics_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_Print_CallInstance = CMock_Guts_MemChain(Mock.Statistics_Print_CallInstance, cmock_guts_index);
+  Mock.Statistics_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_Print(cmock_call_instance, stats);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_Print_StubWithCallback(CMOCK_Statistics_Print_CALLBACK Callback)
+{
+  Mock.Statistics_Print_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t const* stats, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_Print_CALL_INSTANCE));
+  CMOCK_Statistics_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_Print_CallInstance = CMock_Guts_MemChain(Mock.Statistics_Print_CallInstance, cmock_guts_index);
+  Mock.Statistics_Print_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_Print(cmock_call_instance, stats);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_Print_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_Print_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_Print_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_Print_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+void Statistics_RecordAccess(stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordAccess);
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_RecordAccess_CallInstance);
+  Mock.Statistics_RecordAccess_CallInstance = CMock_Guts_MemNext(Mock.Statistics_RecordAccess_CallInstance);
+  if (Mock.Statistics_RecordAccess_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_RecordAccess_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_RecordAccess_CallbackFunctionPointer(stats, type, cycles, n_aligned, Mock.Statistics_RecordAccess_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordAccess,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_type)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordAccess,CMockString_type);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_type, type, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_cycles)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordAccess,CMockString_cycles);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_cycles, cycles, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_n_aligned)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordAccess,CMockString_n_aligned);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_aligned, n_aligned, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_stats_Used)
+  {
+    memcpy(stats, cmock_call_instance->ReturnThruPtr_stats_Val,
+      cmock_call_instance->ReturnThruPtr_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_RecordAccess(CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance, stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned)
+{
+  cmock_call_instance->Expected_stats = stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+  cmock_call_instance->ReturnThruPtr_stats_Used = 0;
+  cmock_call_instance->Expected_type = type;
+  cmock_call_instance->IgnoreArg_type = 0;
+  cmock_call_instance->Expected_cycles = cycles;
+  cmock_call_instance->IgnoreArg_cycles = 0;
+  cmock_call_instance->Expected_n_aligned = n_aligned;
+  cmock_call_instance->IgnoreArg_n_aligned = 0;
+}
+
+void Statistics_RecordAccess_CMockIgnore(void)
+{
+  Mock.Statistics_RecordAccess_IgnoreBool = (int)1;
+}
+
+void Statistics_RecordAccess_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordAccess_CALL_INSTANCE));
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordAccess_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordAccess_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordAccess_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordAccess(cmock_call_instance, stats, type, cycles, n_aligned);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_RecordAccess_StubWithCallback(CMOCK_Statistics_RecordAccess_CALLBACK Callback)
+{
+  Mock.Statistics_RecordAccess_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_RecordAccess_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordAccess_CALL_INSTANCE));
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordAccess_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordAccess_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordAccess_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordAccess(cmock_call_instance, stats, type, cycles, n_aligned);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_RecordAccess_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size)
+{
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_stats_Val = stats;
+  cmock_call_instance->ReturnThruPtr_stats_Size = cmock_size;
+}
+
+void Statistics_RecordAccess_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+void Statistics_RecordAccess_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_type = 1;
+}
+
+void Statistics_RecordAccess_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cycles = 1;
+}
+
+void Statistics_RecordAccess_CMockIgnoreArg_n_aligned(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_aligned = 1;
+}
+
+void Statistics_RecordCycles(stats_t* stats, uint8_t type, uint32_t cycles)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCycles);
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_RecordCycles_CallInstance);
+  Mock.Statistics_RecordCycles_CallInstance = CMock_Guts_MemNext(Mock.Statistics_RecordCycles_CallInstance);
+  if (Mock.Statistics_RecordCycles_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_RecordCycles_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_RecordCycles_CallbackFunctionPointer(stats, type, cycles, Mock.Statistics_RecordCycles_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCycles,CMockString_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_stats), (void*)(stats), sizeof(stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_type)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCycles,CMockString_type);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_type, type, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_cycles)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCycles,CMockString_cycles);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_cycles, cycles, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_stats_Used)
+  {
+    memcpy(stats, cmock_call_instance->ReturnThruPtr_stats_Val,
+      cmock_call_instance->ReturnThruPtr_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_RecordCycles(CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance, stats_t* stats, uint8_t type, uint32_t cycles)
+{
+  cmock_call_instance->Expected_stats = stats;
+  cmock_call_instance->IgnoreArg_stats = 0;
+  cmock_call_instance->ReturnThruPtr_stats_Used = 0;
+  cmock_call_instance->Expected_type = type;
+  cmock_call_instance->IgnoreArg_type = 0;
+  cmock_call_instance->Expected_cycles = cycles;
+  cmock_call_instance->IgnoreArg_cycles = 0;
+}
+
+void Statistics_RecordCycles_CMockIgnore(void)
+{
+  Mock.Statistics_RecordCycles_IgnoreBool = (int)1;
+}
+
+void Statistics_RecordCycles_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCycles_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCycles_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCycles_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCycles_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCycles(cmock_call_instance, stats, type, cycles);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_RecordCycles_StubWithCallback(CMOCK_Statistics_RecordCycles_CALLBACK Callback)
+{
+  Mock.Statistics_RecordCycles_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_RecordCycles_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCycles_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCycles_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCycles_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCycles_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCycles(cmock_call_instance, stats, type, cycles);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_RecordCycles_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size)
+{
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCycles_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_stats_Val = stats;
+  cmock_call_instance->ReturnThruPtr_stats_Size = cmock_size;
+}
+
+void Statistics_RecordCycles_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCycles_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stats = 1;
+}
+
+void Statistics_RecordCycles_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCycles_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_type = 1;
+}
+
+void Statistics_RecordCycles_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCycles_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCycles_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCycles_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cycles = 1;
+}
+
+void Statistics_RecordCacheAccess(cache_stats_t* cache_stats, result_t result)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCacheAccess);
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_RecordCacheAccess_CallInstance);
+  Mock.Statistics_RecordCacheAccess_CallInstance = CMock_Guts_MemNext(Mock.Statistics_RecordCacheAccess_CallInstance);
+  if (Mock.Statistics_RecordCacheAccess_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_RecordCacheAccess_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_RecordCacheAccess_CallbackFunctionPointer(cache_stats, result, Mock.Statistics_RecordCacheAccess_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCacheAccess,CMockString_cache_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_cache_stats), (void*)(cache_stats), sizeof(cache_stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_result)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCacheAccess,CMockString_result);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_result), (void*)(&result), sizeof(result_t), cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_cache_stats_Used)
+  {
+    memcpy(cache_stats, cmock_call_instance->ReturnThruPtr_cache_stats_Val,
+      cmock_call_instance->ReturnThruPtr_cache_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_RecordCacheAccess(CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance, cache_stats_t* cache_stats, result_t result)
+{
+  cmock_call_instance->Expected_cache_stats = cache_stats;
+  cmock_call_instance->IgnoreArg_cache_stats = 0;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Used = 0;
+  memcpy(&cmock_call_instance->Expected_result, &result, sizeof(result_t));
+  cmock_call_instance->IgnoreArg_result = 0;
+}
+
+void Statistics_RecordCacheAccess_CMockIgnore(void)
+{
+  Mock.Statistics_RecordCacheAccess_IgnoreBool = (int)1;
+}
+
+void Statistics_RecordCacheAccess_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, result_t result)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCacheAccess_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCacheAccess_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCacheAccess_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCacheAccess(cmock_call_instance, cache_stats, result);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_RecordCacheAccess_StubWithCallback(CMOCK_Statistics_RecordCacheAccess_CALLBACK Callback)
+{
+  Mock.Statistics_RecordCacheAccess_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_RecordCacheAccess_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, result_t result, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCacheAccess_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCacheAccess_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCacheAccess_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCacheAccess(cmock_call_instance, cache_stats, result);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_RecordCacheAccess_CMockReturnMemThruPtr_cache_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, int cmock_size)
+{
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_cache_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Val = cache_stats;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Size = cmock_size;
+}
+
+void Statistics_RecordCacheAccess_CMockIgnoreArg_cache_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache_stats = 1;
+}
+
+void Statistics_RecordCacheAccess_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheAccess_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheAccess_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_result = 1;
+}
+
+void Statistics_RecordCacheHits(cache_stats_t* cache_stats, uint32_t n_hits)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  UNITY_SET_DETAIL(CMockString_Statistics_RecordCacheHits);
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.Statistics_RecordCacheHits_CallInstance);
+  Mock.Statistics_RecordCacheHits_CallInstance = CMock_Guts_MemNext(Mock.Statistics_RecordCacheHits_CallInstance);
+  if (Mock.Statistics_RecordCacheHits_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (Mock.Statistics_RecordCacheHits_CallbackFunctionPointer != NULL)
+  {
+    Mock.Statistics_RecordCacheHits_CallbackFunctionPointer(cache_stats, n_hits, Mock.Statistics_RecordCacheHits_CallbackCalls++);
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cache_stats)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCacheHits,CMockString_cache_stats);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_cache_stats), (void*)(cache_stats), sizeof(cache_stats_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_n_hits)
+  {
+    UNITY_SET_DETAILS(CMockString_Statistics_RecordCacheHits,CMockString_n_hits);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_n_hits, n_hits, cmock_line, CMockStringMismatch);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_cache_stats_Used)
+  {
+    memcpy(cache_stats, cmock_call_instance->ReturnThruPtr_cache_stats_Val,
+      cmock_call_instance->ReturnThruPtr_cache_stats_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_Statistics_RecordCacheHits(CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance, cache_stats_t* cache_stats, uint32_t n_hits)
+{
+  cmock_call_instance->Expected_cache_stats = cache_stats;
+  cmock_call_instance->IgnoreArg_cache_stats = 0;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Used = 0;
+  cmock_call_instance->Expected_n_hits = n_hits;
+  cmock_call_instance->IgnoreArg_n_hits = 0;
+}
+
+void Statistics_RecordCacheHits_CMockIgnore(void)
+{
+  Mock.Statistics_RecordCacheHits_IgnoreBool = (int)1;
+}
+
+void Statistics_RecordCacheHits_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, uint32_t n_hits)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCacheHits_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCacheHits_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCacheHits_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCacheHits(cmock_call_instance, cache_stats, n_hits);
+  UNITY_CLR_DETAILS();
+}
+
+void Statistics_RecordCacheHits_StubWithCallback(CMOCK_Statistics_RecordCacheHits_CALLBACK Callback)
+{
+  Mock.Statistics_RecordCacheHits_CallbackFunctionPointer = Callback;
+}
+
+void Statistics_RecordCacheHits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, uint32_t n_hits, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE));
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.Statistics_RecordCacheHits_CallInstance = CMock_Guts_MemChain(Mock.Statistics_RecordCacheHits_CallInstance, cmock_guts_index);
+  Mock.Statistics_RecordCacheHits_IgnoreBool = (int)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_Statistics_RecordCacheHits(cmock_call_instance, cache_stats, n_hits);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void Statistics_RecordCacheHits_CMockReturnMemThruPtr_cache_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, int cmock_size)
+{
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheHits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_cache_stats_Used = 1;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Val = cache_stats;
+  cmock_call_instance->ReturnThruPtr_cache_stats_Size = cmock_size;
+}
+
+void Statistics_RecordCacheHits_CMockIgnoreArg_cache_stats(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheHits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cache_stats = 1;
+}
+
+void Statistics_RecordCacheHits_CMockIgnoreArg_n_hits(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE* cmock_call_instance = (CMOCK_Statistics_RecordCacheHits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.Statistics_RecordCacheHits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_n_hits = 1;
+}
+
@@ -0,0 +1,120 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCK_STATISTICS_H
+#define _MOCK_STATISTICS_H
+
+#include "unity_Helper.h"
+#include "Statistics.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC)
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void mock_Statistics_Init(void);
+void mock_Statistics_Destroy(void);
+void mock_Statistics_Verify(void);
+
+
+
+
+#define Statistics_Create_Ignore() Statistics_Create_CMockIgnore()
+void Statistics_Create_CMockIgnore(void);
+#define Statistics_Create_Expect(stats) Statistics_Create_CMockExpect(__LINE__, stats)
+void Statistics_Create_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats);
+typedef void (* CMOCK_Statistics_Create_CALLBACK)(stats_t* stats, int cmock_num_calls);
+void Statistics_Create_StubWithCallback(CMOCK_Statistics_Create_CALLBACK Callback);
+#define Statistics_Create_ExpectAndThrow(stats, cmock_to_throw) Statistics_Create_CMockExpectAndThrow(__LINE__, stats, cmock_to_throw)
+void Statistics_Create_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, CEXCEPTION_T cmock_to_throw);
+#define Statistics_Create_ReturnThruPtr_stats(stats) Statistics_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, sizeof(*stats))
+#define Statistics_Create_ReturnArrayThruPtr_stats(stats, cmock_len) Statistics_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, (int)(cmock_len * (int)sizeof(*stats)))
+#define Statistics_Create_ReturnMemThruPtr_stats(stats, cmock_size) Statistics_Create_CMockReturnMemThruPtr_stats(__LINE__, stats, cmock_size)
+void Statistics_Create_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size);
+#define Statistics_Create_IgnoreArg_stats() Statistics_Create_CMockIgnoreArg_stats(__LINE__)
+void Statistics_Create_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_Print_Ignore() Statistics_Print_CMockIgnore()
+void Statistics_Print_CMockIgnore(void);
+#define Statistics_Print_Expect(stats) Statistics_Print_CMockExpect(__LINE__, stats)
+void Statistics_Print_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t const* stats);
+typedef void (* CMOCK_Statistics_Print_CALLBACK)(stats_t const* stats, int cmock_num_calls);
+void Statistics_Print_StubWithCallback(CMOCK_Statistics_Print_CALLBACK Callback);
+#define Statistics_Print_ExpectAndThrow(stats, cmock_to_throw) Statistics_Print_CMockExpectAndThrow(__LINE__, stats, cmock_to_throw)
+void Statistics_Print_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t const* stats, CEXCEPTION_T cmock_to_throw);
+#define Statistics_Print_IgnoreArg_stats() Statistics_Print_CMockIgnoreArg_stats(__LINE__)
+void Statistics_Print_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordAccess_Ignore() Statistics_RecordAccess_CMockIgnore()
+void Statistics_RecordAccess_CMockIgnore(void);
+#define Statistics_RecordAccess_Expect(stats, type, cycles, n_aligned) Statistics_RecordAccess_CMockExpect(__LINE__, stats, type, cycles, n_aligned)
+void Statistics_RecordAccess_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned);
+typedef void (* CMOCK_Statistics_RecordAccess_CALLBACK)(stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned, int cmock_num_calls);
+void Statistics_RecordAccess_StubWithCallback(CMOCK_Statistics_RecordAccess_CALLBACK Callback);
+#define Statistics_RecordAccess_ExpectAndThrow(stats, type, cycles, n_aligned, cmock_to_throw) Statistics_RecordAccess_CMockExpectAndThrow(__LINE__, stats, type, cycles, n_aligned, cmock_to_throw)
+void Statistics_RecordAccess_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, uint32_t n_aligned, CEXCEPTION_T cmock_to_throw);
+#define Statistics_RecordAccess_ReturnThruPtr_stats(stats) Statistics_RecordAccess_CMockReturnMemThruPtr_stats(__LINE__, stats, sizeof(*stats))
+#define Statistics_RecordAccess_ReturnArrayThruPtr_stats(stats, cmock_len) Statistics_RecordAccess_CMockReturnMemThruPtr_stats(__LINE__, stats, (int)(cmock_len * (int)sizeof(*stats)))
+#define Statistics_RecordAccess_ReturnMemThruPtr_stats(stats, cmock_size) Statistics_RecordAccess_CMockReturnMemThruPtr_stats(__LINE__, stats, cmock_size)
+void Statistics_RecordAccess_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size);
+#define Statistics_RecordAccess_IgnoreArg_stats() Statistics_RecordAccess_CMockIgnoreArg_stats(__LINE__)
+void Statistics_RecordAccess_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordAccess_IgnoreArg_type() Statistics_RecordAccess_CMockIgnoreArg_type(__LINE__)
+void Statistics_RecordAccess_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordAccess_IgnoreArg_cycles() Statistics_RecordAccess_CMockIgnoreArg_cycles(__LINE__)
+void Statistics_RecordAccess_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordAccess_IgnoreArg_n_aligned() Statistics_RecordAccess_CMockIgnoreArg_n_aligned(__LINE__)
+void Statistics_RecordAccess_CMockIgnoreArg_n_aligned(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCycles_Ignore() Statistics_RecordCycles_CMockIgnore()
+void Statistics_RecordCycles_CMockIgnore(void);
+#define Statistics_RecordCycles_Expect(stats, type, cycles) Statistics_RecordCycles_CMockExpect(__LINE__, stats, type, cycles)
+void Statistics_RecordCycles_CMockExpect(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles);
+typedef void (* CMOCK_Statistics_RecordCycles_CALLBACK)(stats_t* stats, uint8_t type, uint32_t cycles, int cmock_num_calls);
+void Statistics_RecordCycles_StubWithCallback(CMOCK_Statistics_RecordCycles_CALLBACK Callback);
+#define Statistics_RecordCycles_ExpectAndThrow(stats, type, cycles, cmock_to_throw) Statistics_RecordCycles_CMockExpectAndThrow(__LINE__, stats, type, cycles, cmock_to_throw)
+void Statistics_RecordCycles_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, stats_t* stats, uint8_t type, uint32_t cycles, CEXCEPTION_T cmock_to_throw);
+#define Statistics_RecordCycles_ReturnThruPtr_stats(stats) Statistics_RecordCycles_CMockReturnMemThruPtr_stats(__LINE__, stats, sizeof(*stats))
+#define Statistics_RecordCycles_ReturnArrayThruPtr_stats(stats, cmock_len) Statistics_RecordCycles_CMockReturnMemThruPtr_stats(__LINE__, stats, (int)(cmock_len * (int)sizeof(*stats)))
+#define Statistics_RecordCycles_ReturnMemThruPtr_stats(stats, cmock_size) Statistics_RecordCycles_CMockReturnMemThruPtr_stats(__LINE__, stats, cmock_size)
+void Statistics_RecordCycles_CMockReturnMemThruPtr_stats(UNITY_LINE_TYPE cmock_line, stats_t* stats, int cmock_size);
+#define Statistics_RecordCycles_IgnoreArg_stats() Statistics_RecordCycles_CMockIgnoreArg_stats(__LINE__)
+void Statistics_RecordCycles_CMockIgnoreArg_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCycles_IgnoreArg_type() Statistics_RecordCycles_CMockIgnoreArg_type(__LINE__)
+void Statistics_RecordCycles_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCycles_IgnoreArg_cycles() Statistics_RecordCycles_CMockIgnoreArg_cycles(__LINE__)
+void Statistics_RecordCycles_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCacheAccess_Ignore() Statistics_RecordCacheAccess_CMockIgnore()
+void Statistics_RecordCacheAccess_CMockIgnore(void);
+#define Statistics_RecordCacheAccess_Expect(cache_stats, result) Statistics_RecordCacheAccess_CMockExpect(__LINE__, cache_stats, result)
+void Statistics_RecordCacheAccess_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, result_t result);
+typedef void (* CMOCK_Statistics_RecordCacheAccess_CALLBACK)(cache_stats_t* cache_stats, result_t result, int cmock_num_calls);
+void Statistics_RecordCacheAccess_StubWithCallback(CMOCK_Statistics_RecordCacheAccess_CALLBACK Callback);
+#define Statistics_RecordCacheAccess_ExpectAndThrow(cache_stats, result, cmock_to_throw) Statistics_RecordCacheAccess_CMockExpectAndThrow(__LINE__, cache_stats, result, cmock_to_throw)
+void Statistics_RecordCacheAccess_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, result_t result, CEXCEPTION_T cmock_to_throw);
+#define Statistics_RecordCacheAccess_ReturnThruPtr_cache_stats(cache_stats) Statistics_RecordCacheAccess_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, sizeof(*cache_stats))
+#define Statistics_RecordCacheAccess_ReturnArrayThruPtr_cache_stats(cache_stats, cmock_len) Statistics_RecordCacheAccess_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, (int)(cmock_len * (int)sizeof(*cache_stats)))
+#define Statistics_RecordCacheAccess_ReturnMemThruPtr_cache_stats(cache_stats, cmock_size) Statistics_RecordCacheAccess_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, cmock_size)
+void Statistics_RecordCacheAccess_CMockReturnMemThruPtr_cache_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, int cmock_size);
+#define Statistics_RecordCacheAccess_IgnoreArg_cache_stats() Statistics_RecordCacheAccess_CMockIgnoreArg_cache_stats(__LINE__)
+void Statistics_RecordCacheAccess_CMockIgnoreArg_cache_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCacheAccess_IgnoreArg_result() Statistics_RecordCacheAccess_CMockIgnoreArg_result(__LINE__)
+void Statistics_RecordCacheAccess_CMockIgnoreArg_result(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCacheHits_Ignore() Statistics_RecordCacheHits_CMockIgnore()
+void Statistics_RecordCacheHits_CMockIgnore(void);
+#define Statistics_RecordCacheHits_Expect(cache_stats, n_hits) Statistics_RecordCacheHits_CMockExpect(__LINE__, cache_stats, n_hits)
+void Statistics_RecordCacheHits_CMockExpect(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, uint32_t n_hits);
+typedef void (* CMOCK_Statistics_RecordCacheHits_CALLBACK)(cache_stats_t* cache_stats, uint32_t n_hits, int cmock_num_calls);
+void Statistics_RecordCacheHits_StubWithCallback(CMOCK_Statistics_RecordCacheHits_CALLBACK Callback);
+#define Statistics_RecordCacheHits_ExpectAndThrow(cache_stats, n_hits, cmock_to_throw) Statistics_RecordCacheHits_CMockExpectAndThrow(__LINE__, cache_stats, n_hits, cmock_to_throw)
+void Statistics_RecordCacheHits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, uint32_t n_hits, CEXCEPTION_T cmock_to_throw);
+#define Statistics_RecordCacheHits_ReturnThruPtr_cache_stats(cache_stats) Statistics_RecordCacheHits_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, sizeof(*cache_stats))
+#define Statistics_RecordCacheHits_ReturnArrayThruPtr_cache_stats(cache_stats, cmock_len) Statistics_RecordCacheHits_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, (int)(cmock_len * (int)sizeof(*cache_stats)))
+#define Statistics_RecordCacheHits_ReturnMemThruPtr_cache_stats(cache_stats, cmock_size) Statistics_RecordCacheHits_CMockReturnMemThruPtr_cache_stats(__LINE__, cache_stats, cmock_size)
+void Statistics_RecordCacheHits_CMockReturnMemThruPtr_cache_stats(UNITY_LINE_TYPE cmock_line, cache_stats_t* cache_stats, int cmock_size);
+#define Statistics_RecordCacheHits_IgnoreArg_cache_stats() Statistics_RecordCacheHits_CMockIgnoreArg_cache_stats(__LINE__)
+void Statistics_RecordCacheHits_CMockIgnoreArg_cache_stats(UNITY_LINE_TYPE cmock_line);
+#define Statistics_RecordCacheHits_IgnoreArg_n_hits() Statistics_RecordCacheHits_CMockIgnoreArg_n_hits(__LINE__)
+void Statistics_RecordCacheHits_CMockIgnoreArg_n_hits(UNITY_LINE_TYPE cmock_line);
+
+#endif
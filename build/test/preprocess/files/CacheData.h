@@ -0,0 +1,128 @@
+#include "Access.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+
+
+    RESULT_HIT = 0,
+
+
+
+
+
+
+
+
+
+
+
+
+
+    RESULT_HIT_VICTIM_CACHE,
+
+
+
+
+
+    RESULT_MISS,
+
+
+
+
+
+    RESULT_MISS_KICKOUT,
+
+
+
+
+
+    RESULT_MISS_DIRTY_KICKOUT,
+
+} result_t;
+
+
+
+
+
+
+
+
+
+typedef struct _cache_data_t * cache_data_t;
+
+cache_data_t CacheData_Create(uint32_t n_sets,
+
+                              uint32_t set_len,
+
+                              uint32_t block_size_bytes,
+
+                              uint32_t victim_cache_len_blocks);
+
+void CacheData_Destroy(cache_data_t data);
+
+
+
+_Bool 
+
+    CacheData_Contains(cache_data_t data, uint64_t address);
+
+uint64_t CacheData_Write(cache_data_t data, uint64_t address, result_t * result);
+
+uint64_t CacheData_Read(cache_data_t data, uint64_t address, result_t * result);
+
+void CacheData_Prefetch(cache_data_t data, uint64_t address);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+_Bool 
+
+    CacheData_PrefetchEnabled(cache_data_t data);
+
+void CacheData_AccessBatch(cache_data_t data,
+
+                           access_t const * accesses,
+
+                           uint32_t n_accesses,
+
+                           result_t * results,
+
+                           uint64_t * dirty_kickout_addresses);
+
+
+
+
+
+
+
+
+
+
+
+void CacheData_Print(cache_data_t data);
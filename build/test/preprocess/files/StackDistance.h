@@ -0,0 +1,99 @@
+
+
+typedef struct _stack_distance_t * stack_distance_t;
+
+stack_distance_t StackDistance_Create(uint32_t block_size_bytes,
+
+                                      uint32_t associativity,
+
+                                      uint32_t n_caches);
+
+stack_distance_t StackDistance_CreateAllWays(uint32_t block_size_bytes,
+
+                                             uint32_t cache_size_bytes);
+
+
+
+
+
+
+
+
+
+
+
+void StackDistance_Destroy(stack_distance_t stack_distance);
+
+void StackDistance_Access(stack_distance_t stack_distance,
+
+                          uint64_t address,
+
+                          uint32_t n_accesses,
+
+                          
+
+                         _Bool 
+
+                              write);
+
+
+
+
+
+uint32_t StackDistance_Caches(stack_distance_t stack_distance);
+
+
+
+
+
+uint64_t StackDistance_SizeBytes(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+uint32_t StackDistance_Ways(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+uint64_t StackDistance_Hits(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+uint64_t StackDistance_Misses(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+uint64_t StackDistance_Kickouts(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+
+
+
+
+
+
+uint64_t StackDistance_DirtyKickouts(stack_distance_t stack_distance, uint32_t i);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void StackDistance_Print(stack_distance_t stack_distance, char const * name);
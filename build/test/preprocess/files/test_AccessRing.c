@@ -0,0 +1,753 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Access.h"
+#include "AccessRing.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static void * produce(void * arg);
+
+
+
+
+
+
+
+
+
+
+
+
+
+static void * consume(void * arg);
+
+
+
+
+
+
+
+
+
+
+
+static void * wait_for_close(void * arg);
+
+
+
+
+
+
+
+
+
+static access_ring_t ring;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    ring = AccessRing_Create((4), (16), 1);
+
+    if ((((ring)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(73))));};
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    AccessRing_Destroy(ring);
+
+}
+
+
+
+void test_AccessRing_Create_should_ThrowException_when_LengthIsNotPowerOfTwo(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        AccessRing_Create(3, (16), 1);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(89), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_AccessRing_Create_should_ThrowException_when_NoConsumers(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        AccessRing_Create((4), (16), 0);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(100), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_AccessRing_should_DeliverBatchesInOrder(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < (4); i++) {
+
+        access_batch_t * batch = AccessRing_Claim(ring);
+
+        if ((((batch)) != 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(108))));};
+
+        batch->accesses[0].address = i;
+
+        batch->n_accesses = 1;
+
+        AccessRing_Publish(ring);
+
+    }
+
+
+
+    for (i = 0; i < (4); i++) {
+
+        access_batch_t const * batch = AccessRing_Acquire(ring, 0);
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((batch->n_accesses)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(116), UNITY_DISPLAY_STYLE_UINT32);
+
+        UnityAssertEqualNumber((_U_SINT)((i)), (_U_SINT)((batch->accesses[0].address)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(117), UNITY_DISPLAY_STYLE_UINT64);
+
+        AccessRing_Release(ring, 0);
+
+    }
+
+}
+
+
+
+void test_AccessRing_should_ReuseBatches_when_Released(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < 3 * (4); i++) {
+
+        access_batch_t * batch = AccessRing_Claim(ring);
+
+        batch->accesses[(16) - 1].address = i;
+
+        batch->n_accesses = (16);
+
+        AccessRing_Publish(ring);
+
+
+
+        access_batch_t const * received = AccessRing_Acquire(ring, 0);
+
+        UnityAssertEqualNumber((_U_SINT)(_UP)((batch)), (_U_SINT)(_UP)((received)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(132), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((i)), (_U_SINT)((received->accesses[(16) - 1].address)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(133), UNITY_DISPLAY_STYLE_UINT64);
+
+        AccessRing_Release(ring, 0);
+
+    }
+
+}
+
+
+
+void test_AccessRing_Claim_should_ReturnNull_when_Closed(void)
+
+{
+
+    AccessRing_Close(ring);
+
+    if ((((AccessRing_Claim(ring))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(141))));};
+
+}
+
+
+
+void test_AccessRing_Claim_should_ReturnNull_when_ClosedWhileFull(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < (4); i++) {
+
+        if ((((AccessRing_Claim(ring))) != 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(148))));};
+
+        AccessRing_Publish(ring);
+
+    }
+
+
+
+
+
+    AccessRing_Close(ring);
+
+    if ((((AccessRing_Claim(ring))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(154))));};
+
+}
+
+
+
+void test_AccessRing_Acquire_should_ReturnNull_when_ClosedWhileEmpty(void)
+
+{
+
+    if ((((AccessRing_Claim(ring))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(159))));};
+
+    AccessRing_Publish(ring);
+
+    AccessRing_Close(ring);
+
+
+
+
+
+    if ((((AccessRing_Acquire(ring, 0))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(164))));};
+
+    AccessRing_Release(ring, 0);
+
+    if ((((AccessRing_Acquire(ring, 0))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(166))));};
+
+}
+
+
+
+void test_AccessRing_Acquire_should_Wake_when_ClosedWhileAsleep(void)
+
+{
+
+    pthread_t consumer;
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((pthread_create(&consumer, 
+
+   ((void *)0)
+
+   , wait_for_close, 
+
+   ((void *)0)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(172), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    struct timespec const delay = { .tv_sec = 0, .tv_nsec = 50 * 1000 * 1000 };
+
+    nanosleep(&delay, 
+
+                     ((void *)0)
+
+                         );
+
+    AccessRing_Close(ring);
+
+
+
+    void * result;
+
+    pthread_join(consumer, &result);
+
+    if ((((result)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(181))));};
+
+}
+
+
+
+void test_AccessRing_should_PassEveryAccess_between_Threads(void)
+
+{
+
+    pthread_t producer;
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((pthread_create(&producer, 
+
+   ((void *)0)
+
+   , produce, 
+
+   ((void *)0)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(187), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    uint64_t expected = 0;
+
+    while (
+
+          1
+
+              ) {
+
+        access_batch_t const * batch = AccessRing_Acquire(ring, 0);
+
+        if (batch->n_accesses == 0) {
+
+            break;
+
+        }
+
+
+
+        uint32_t i;
+
+        for (i = 0; i < batch->n_accesses; i++) {
+
+            UnityAssertEqualNumber((_U_SINT)((expected)), (_U_SINT)((batch->accesses[i].address)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(198), UNITY_DISPLAY_STYLE_UINT64);
+
+            expected++;
+
+        }
+
+        AccessRing_Release(ring, 0);
+
+    }
+
+
+
+    pthread_join(producer, 
+
+                          ((void *)0)
+
+                              );
+
+    UnityAssertEqualNumber((_U_SINT)(((uint64_t) (10000) * (16))), (_U_SINT)((expected)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(205), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_AccessRing_Claim_should_WaitForEveryConsumer(void)
+
+{
+
+    AccessRing_Destroy(ring);
+
+    ring = AccessRing_Create((4), (16), (3));
+
+    if ((((ring)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(212))));};
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (4); i++) {
+
+        if ((((AccessRing_Claim(ring))) != 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(216))));};
+
+        AccessRing_Publish(ring);
+
+    }
+
+
+
+
+
+    uint32_t consumer;
+
+    for (consumer = 0; consumer < (3) - 1; consumer++) {
+
+        for (i = 0; i < (4); i++) {
+
+            AccessRing_Acquire(ring, consumer);
+
+            AccessRing_Release(ring, consumer);
+
+        }
+
+    }
+
+
+
+
+
+    AccessRing_Close(ring);
+
+    if ((((AccessRing_Claim(ring))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(231))));};
+
+}
+
+
+
+void test_AccessRing_should_PassEveryAccess_to_EveryConsumer(void)
+
+{
+
+    AccessRing_Destroy(ring);
+
+    ring = AccessRing_Create((4), (16), (3));
+
+    if ((((ring)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(238))));};
+
+
+
+    pthread_t producer;
+
+    pthread_t consumers[(3)];
+
+    uint32_t indices[(3)];
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((pthread_create(&producer, 
+
+   ((void *)0)
+
+   , produce, 
+
+   ((void *)0)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(243), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (3); i++) {
+
+        indices[i] = i;
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((pthread_create(&consumers[i], 
+
+       ((void *)0)
+
+       , consume, &indices[i]))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(248), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+
+
+    for (i = 0; i < (3); i++) {
+
+        void * result;
+
+        pthread_join(consumers[i], &result);
+
+        if ((((result)) == 
+
+       ((void *)0)
+
+       )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(254))));};
+
+    }
+
+    pthread_join(producer, 
+
+                          ((void *)0)
+
+                              );
+
+}
+
+
+
+
+
+
+
+static void * produce(void * arg)
+
+{
+
+    (void) arg;
+
+
+
+    uint64_t address = 0;
+
+    uint32_t n;
+
+    for (n = 0; n <= (10000); n++) {
+
+        access_batch_t * batch = AccessRing_Claim(ring);
+
+
+
+        batch->n_accesses = n < (10000) ? (16) : 0;
+
+        uint32_t i;
+
+        for (i = 0; i < batch->n_accesses; i++) {
+
+            batch->accesses[i].address = address++;
+
+        }
+
+
+
+        AccessRing_Publish(ring);
+
+    }
+
+
+
+    return 
+
+          ((void *)0)
+
+              ;
+
+}
+
+
+
+static void * consume(void * arg)
+
+{
+
+    uint32_t consumer = *(uint32_t *) arg;
+
+
+
+
+
+
+
+    uint64_t expected = 0;
+
+    
+
+   _Bool 
+
+        in_order = 
+
+                   1
+
+                       ;
+
+    while (
+
+          1
+
+              ) {
+
+        access_batch_t const * batch = AccessRing_Acquire(ring, consumer);
+
+        if (batch->n_accesses == 0) {
+
+            break;
+
+        }
+
+
+
+        uint32_t i;
+
+        for (i = 0; i < batch->n_accesses; i++) {
+
+            in_order &= batch->accesses[i].address == expected;
+
+            expected++;
+
+        }
+
+        AccessRing_Release(ring, consumer);
+
+    }
+
+
+
+    if (!in_order || expected != (uint64_t) (10000) * (16)) {
+
+        return arg;
+
+    }
+
+    return 
+
+          ((void *)0)
+
+              ;
+
+}
+
+
+
+static void * wait_for_close(void * arg)
+
+{
+
+    (void) arg;
+
+
+
+    if (AccessRing_Acquire(ring, 0) != 
+
+                                      ((void *)0)
+
+                                          ) {
+
+        return ring;
+
+    }
+
+    return 
+
+          ((void *)0)
+
+              ;
+
+}
@@ -0,0 +1,661 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "BinaryTrace.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "BlockTrace.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static void write_trace(FILE * file, uint32_t n_records);
+
+
+
+
+
+static access_t record(uint32_t i);
+
+
+
+
+
+
+
+
+
+static FILE * file;
+
+static block_trace_index_t trace_index;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    file = tmpfile();
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(63))));};
+
+    trace_index.entries = 
+
+                         ((void *)0)
+
+                             ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    BlockTrace_FreeIndex(&trace_index);
+
+    fclose(file);
+
+}
+
+
+
+void test_BlockTrace_IsBlockTrace_should_RecognizeMagic(void)
+
+{
+
+    write_trace(file, (10));
+
+    if ((BlockTrace_IsBlockTrace(fileno(file)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(76)));};
+
+}
+
+
+
+void test_BlockTrace_IsBlockTrace_should_RejectBinaryTrace(void)
+
+{
+
+    BinaryTrace_WriteHeader(file, 0);
+
+    fflush(file);
+
+    if (!(BlockTrace_IsBlockTrace(fileno(file)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(83)));};
+
+}
+
+
+
+void test_BlockTrace_ReadIndex_should_DescribeEveryBlock(void)
+
+{
+
+    write_trace(file, (10));
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((4))), (_U_SINT)(_UU32)((trace_index.block_len)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(91), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((trace_index.n_blocks)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(92), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(((10))), (_U_SINT)((trace_index.n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(93), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((trace_index.entries[0].first_record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(95), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((trace_index.entries[1].first_record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(96), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((8)), (_U_SINT)((trace_index.entries[2].first_record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(97), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((4)), (_U_SINT)(_UU32)((trace_index.entries[0].n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(98), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((trace_index.entries[2].n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(99), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(((24))), (_U_SINT)((trace_index.entries[0].offset)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(100), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_BlockTrace_DecompressBlock_should_RecoverRecords(void)
+
+{
+
+    write_trace(file, (10));
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+
+
+    block_trace_entry_t const * entry = &trace_index.entries[1];
+
+    uint8_t compressed[256];
+
+    if ((entry->compressed_length <= sizeof(compressed))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(110)));};
+
+    fseek(file, entry->offset, 
+
+                              0
+
+                                      );
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((fread(compressed, entry->compressed_length, 1, file))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(112), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    uint8_t records[(4) * (16)];
+
+    if ((BlockTrace_DecompressBlock(records, compressed, entry))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(115)));};
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < entry->n_records; i++) {
+
+        access_t access;
+
+        BinaryTrace_DecodeAccess(&access, &records[i * (16)]);
+
+        AssertEqual_access_t(record(4 + i), access, 121, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_BlockTrace_DecompressBlock_should_Fail_when_BlockIsCorrupt(void)
+
+{
+
+    write_trace(file, (10));
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+
+
+    uint8_t compressed[256];
+
+    memset(compressed, 0xa5, sizeof(compressed));
+
+
+
+    uint8_t records[(4) * (16)];
+
+    if (!(BlockTrace_DecompressBlock(records, compressed, &trace_index.entries[0]))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(134)));};
+
+}
+
+
+
+void test_BlockTrace_FindBlock_should_FindBlockHoldingRecord(void)
+
+{
+
+    write_trace(file, (10));
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(142), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 3))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(143), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 4))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(144), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 9))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(145), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 10))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(146), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_BlockTrace_ReadIndex_should_HandleEmptyTrace(void)
+
+{
+
+    write_trace(file, 0);
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((trace_index.n_blocks)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(154), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((trace_index.n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(155), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((BlockTrace_FindBlock(&trace_index, 0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(156), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_BlockTrace_ReadIndex_should_ThrowException_when_TrailerIsMissing(void)
+
+{
+
+    write_trace(file, (10));
+
+
+
+
+
+    fseek(file, 0, 
+
+                  2
+
+                          );
+
+    long length = ftell(file) - (32);
+
+    uint8_t contents[1024];
+
+    if ((length <= (long) sizeof(contents))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(167)));};
+
+    rewind(file);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((fread(contents, length, 1, file))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(169), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    FILE * truncated = tmpfile();
+
+    if ((((truncated)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(172))));};
+
+    fwrite(contents, length, 1, truncated);
+
+    fflush(truncated);
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BlockTrace_ReadIndex(fileno(truncated), &trace_index);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    fclose(truncated);
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(183), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_BlockTrace_CreateWriter_should_ThrowException_when_BlockLenIsZero(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BlockTrace_CreateWriter(file, 0);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(194), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_BlockTrace_WriteBlock_should_AppendPrecompressedBlock(void)
+
+{
+
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, (4));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(200))));};
+
+
+
+
+
+    access_t access = record(0);
+
+    BlockTrace_Write(writer, &access, 1);
+
+
+
+    uint8_t records[(4) * (16)];
+
+    uint32_t i;
+
+    for (i = 0; i < (4); i++) {
+
+        access = record(1 + i);
+
+        BinaryTrace_EncodeAccess(&records[i * (16)], &access);
+
+    }
+
+
+
+    uint8_t compressed[256];
+
+    size_t length = 0;
+
+    if ((BlockTrace_CompressBound((4)) <= sizeof(compressed))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(215)));};
+
+    if ((BlockTrace_CompressBlock(compressed, &length, records, (4)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(216)));};
+
+    BlockTrace_WriteBlock(writer, compressed, length, (4));
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1 + (4))), (_U_SINT)((BlockTrace_Finish(writer))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(219), UNITY_DISPLAY_STYLE_UINT64);
+
+    BlockTrace_DestroyWriter(writer);
+
+
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((trace_index.n_blocks)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(223), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((trace_index.entries[0].n_records)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(224), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((trace_index.entries[1].first_record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(225), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((length)), (_U_SINT)(_UU32)((trace_index.entries[1].compressed_length)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(226), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    uint8_t decompressed[(4) * (16)];
+
+    if ((BlockTrace_DecompressBlock(decompressed, compressed, &trace_index.entries[1]))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(229)));}
+
+                                                                         ;
+
+    UnityAssertEqualMemory(( const void*)((records)), ( const void*)((decompressed)), (_UU32)((sizeof(records))), 1, (
+
+   ((void *)0)
+
+   ), (_U_UINT)(231));
+
+}
+
+
+
+void test_BlockTrace_WriteBlock_should_ThrowException_when_BlockIsTooLong(void)
+
+{
+
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, (4));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(237))));};
+
+
+
+    uint8_t compressed[1] = { 0 };
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        BlockTrace_WriteBlock(writer, compressed, sizeof(compressed), (4) + 1);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    BlockTrace_DestroyWriter(writer);
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(247), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+
+
+
+
+static void write_trace(FILE * file, uint32_t n_records)
+
+{
+
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, (4));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(255))));};
+
+
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_records; i++) {
+
+        access_t access = record(i);
+
+        BlockTrace_Write(writer, &access, 1);
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((n_records)), (_U_SINT)((BlockTrace_Finish(writer))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(264), UNITY_DISPLAY_STYLE_UINT64);
+
+    BlockTrace_DestroyWriter(writer);
+
+}
+
+
+
+static access_t record(uint32_t i)
+
+{
+
+    static enum ACCESS_TYPE const types[] = { TYPE_INSTR, TYPE_READ, TYPE_WRITE };
+
+
+
+    access_t access = {
+
+        .type = types[i % (sizeof(types)/sizeof((types)[0]))],
+
+        .address = 0x7fff00000000 + 8 * i,
+
+        .n_bytes = 1 + (i % 8),
+
+    };
+
+    return access;
+
+}
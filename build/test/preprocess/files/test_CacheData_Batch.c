@@ -0,0 +1,237 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "Access.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static void compare_with_single(uint32_t set_len);
+
+
+
+
+
+
+
+
+
+static cache_data_t batch_cache;
+
+static cache_data_t single_cache;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    batch_cache = 
+
+                  ((void *)0)
+
+                      ;
+
+    single_cache = 
+
+                  ((void *)0)
+
+                      ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(batch_cache);
+
+    CacheData_Destroy(single_cache);
+
+}
+
+
+
+void test_CacheData_PrefetchEnabled_should_DependOnSize(void)
+
+{
+
+    batch_cache = CacheData_Create((256 * 1024) / 4, 4, (64), (8));
+
+    single_cache = CacheData_Create(64, 4, (64), (8));
+
+    if ((((batch_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(73))));};
+
+    if ((((single_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(74))));};
+
+
+
+    if ((CacheData_PrefetchEnabled(batch_cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(76)));};
+
+    if (!(CacheData_PrefetchEnabled(single_cache))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(77)));};
+
+
+
+
+
+    CacheData_Prefetch(batch_cache, 0x1000);
+
+    CacheData_Prefetch(single_cache, 0x1000);
+
+    if (!(CacheData_Contains(batch_cache, 0x1000))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(82)));};
+
+}
+
+
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_DirectMapped(void)
+
+{
+
+    compare_with_single(1);
+
+}
+
+
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_FourWay(void)
+
+{
+
+    compare_with_single(4);
+
+}
+
+
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_Compact(void)
+
+{
+
+    compare_with_single(16);
+
+}
+
+
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_Hashed(void)
+
+{
+
+    compare_with_single(64);
+
+}
+
+
+
+
+
+
+
+static void compare_with_single(uint32_t set_len)
+
+{
+
+    batch_cache = CacheData_Create((256 * 1024) / set_len, set_len, (64), (8));
+
+    single_cache = CacheData_Create((256 * 1024) / set_len, set_len, (64), (8));
+
+    if ((((batch_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(111))));};
+
+    if ((((single_cache)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(112))));};
+
+    if ((CacheData_PrefetchEnabled(batch_cache))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(113)));};
+
+
+
+    static access_t accesses[(999)];
+
+    static result_t results[(999)];
+
+    static uint64_t kickouts[(999)];
+
+
+
+
+
+    uint32_t state = 7;
+
+    uint32_t batch;
+
+    for (batch = 0; batch < (20); batch++) {
+
+        uint32_t i;
+
+        for (i = 0; i < (999); i++) {
+
+            state = state * 1103515245 + 12345;
+
+            accesses[i].type = (state >> 28) & 1 ? TYPE_WRITE : TYPE_READ;
+
+            accesses[i].address = 0x20000000 + ((state >> 4) % (2 * (256 * 1024))) * (64);
+
+            accesses[i].n_bytes = 4;
+
+        }
+
+
+
+        CacheData_AccessBatch(batch_cache, accesses, (999), results, kickouts);
+
+
+
+        for (i = 0; i < (999); i++) {
+
+            result_t result;
+
+            uint64_t kickout = accesses[i].type == TYPE_WRITE ?
+
+                               CacheData_Write(single_cache, accesses[i].address, &result) :
+
+                               CacheData_Read(single_cache, accesses[i].address, &result);
+
+            UnityAssertEqualNumber((_U_SINT)((result)), (_U_SINT)((results[i])), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(138), UNITY_DISPLAY_STYLE_INT);
+
+            UnityAssertEqualNumber((_U_SINT)((kickout)), (_U_SINT)((kickouts[i])), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(139), UNITY_DISPLAY_STYLE_HEX64);
+
+        }
+
+    }
+
+}
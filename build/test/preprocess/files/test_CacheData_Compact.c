@@ -0,0 +1,530 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct {
+
+    uint64_t addresses[(8)];
+
+    
+
+   _Bool 
+
+        dirty[(8)];
+
+    uint32_t n_valid;
+
+} model_set_t;
+
+
+
+
+
+
+
+
+
+
+
+static uint64_t address_in_set(uint32_t set, uint32_t i);
+
+
+
+
+
+
+
+
+
+
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, 
+
+                                                                  _Bool 
+
+                                                                       write, result_t * result);
+
+
+
+
+
+
+
+
+
+
+
+static void check_model(model_set_t * sets, uint32_t * state, uint32_t n_accesses, 
+
+                                                                                  _Bool 
+
+                                                                                       wide);
+
+
+
+
+
+
+
+
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create((8192), (8), (64), (8));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Read_should_KickoutFullAddress_when_BlockHasBeenWritten(void)
+
+{
+
+    result_t result;
+
+
+
+    CacheData_Write(cache_data, address_in_set((8192) - 1, 0) + 5, &result);
+
+
+
+    uint32_t i;
+
+    for (i = 1; i < (8) + (8); i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address_in_set((8192) - 1, i), &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(105), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((address_in_set((8192) - 1, 0))), (_U_SINT)((CacheData_Read(cache_data, address_in_set((8192) - 1, i), &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(108), UNITY_DISPLAY_STYLE_HEX64)
+
+                                                                                               ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(110), UNITY_DISPLAY_STYLE_INT);
+
+    if (!(CacheData_Contains(cache_data, address_in_set((8192) - 1, 0)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(111)));};
+
+}
+
+
+
+void test_CacheData_Read_should_HitVictimSet_when_BlockWasEvicted(void)
+
+{
+
+    result_t result;
+
+
+
+    uint32_t i;
+
+    for (i = 0; i <= (8); i++) {
+
+        CacheData_Read(cache_data, address_in_set(3, i), &result);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(121), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+
+
+    CacheData_Read(cache_data, address_in_set(3, 0), &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT_VICTIM_CACHE)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(125), UNITY_DISPLAY_STYLE_INT);
+
+    CacheData_Read(cache_data, address_in_set(3, 0), &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_KeepEveryBlock_when_TagDoesNotFit(void)
+
+{
+
+    uint64_t wide_address = address_in_set(7, 0) + (0xffff800000000000);
+
+    result_t result;
+
+
+
+    if (!(CacheData_Contains(cache_data, wide_address))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(135)));};
+
+
+
+    CacheData_Write(cache_data, address_in_set(7, 0), &result);
+
+    uint32_t i;
+
+    for (i = 1; i < (8) - 1; i++) {
+
+        CacheData_Read(cache_data, address_in_set(7, i), &result);
+
+    }
+
+
+
+    CacheData_Read(cache_data, wide_address, &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+    CacheData_Read(cache_data, wide_address, &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(146), UNITY_DISPLAY_STYLE_INT);
+
+    if ((CacheData_Contains(cache_data, wide_address))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(147)));};
+
+    for (i = 0; i < (8) - 1; i++) {
+
+        if ((CacheData_Contains(cache_data, address_in_set(7, i)))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(149)));};
+
+    }
+
+
+
+
+
+    for (i = (8) - 1; i < 2 * (8) - 1; i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address_in_set(7, i), &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(154), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)((address_in_set(7, 0))), (_U_SINT)((CacheData_Read(cache_data, address_in_set(7, i), &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(156), UNITY_DISPLAY_STYLE_HEX64)
+
+                                                                                      ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(158), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Access_should_MatchModel_when_NoVictimSet(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+    cache_data = CacheData_Create((8192), (8), (64), 0);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(165))));};
+
+
+
+    static model_set_t sets[(8192)];
+
+    memset(sets, 0, sizeof(sets));
+
+
+
+    uint32_t state = 12345;
+
+    check_model(sets, &state, (50000), 
+
+                                               0
+
+                                                    );
+
+}
+
+
+
+void test_CacheData_Access_should_MatchModel_when_TagsOutgrowCompactSets(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+    cache_data = CacheData_Create((8192), (8), (64), 0);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(178))));};
+
+
+
+    static model_set_t sets[(8192)];
+
+    memset(sets, 0, sizeof(sets));
+
+
+
+
+
+    uint32_t state = 54321;
+
+    check_model(sets, &state, (50000) / 2, 
+
+                                                   0
+
+                                                        );
+
+    check_model(sets, &state, (50000) / 2, 
+
+                                                   1
+
+                                                       );
+
+}
+
+
+
+
+
+
+
+static uint64_t address_in_set(uint32_t set, uint32_t i)
+
+{
+
+    return (0x0007ffe000000000) + ((uint64_t) i * (8192) + set) * (64);
+
+}
+
+
+
+static void check_model(model_set_t * sets, uint32_t * state, uint32_t n_accesses, 
+
+                                                                                  _Bool 
+
+                                                                                       wide)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < n_accesses; i++) {
+
+        *state = *state * 1103515245 + 12345;
+
+        uint32_t set = ((*state >> 8) % (64)) * ((8192) / (64)) + 1;
+
+        uint32_t tag = (*state >> 16) % (12);
+
+        uint64_t address = address_in_set(set, tag);
+
+        if (wide && (tag & 1)) {
+
+            address += (0xffff800000000000);
+
+        }
+
+        
+
+       _Bool 
+
+            write = (*state >> 28) & 1;
+
+
+
+        result_t expected_result;
+
+        result_t actual_result;
+
+        uint64_t expected = model_access(sets, address, write, &expected_result);
+
+        uint64_t actual = write ? CacheData_Write(cache_data, address, &actual_result) :
+
+                                  CacheData_Read(cache_data, address, &actual_result);
+
+        UnityAssertEqualNumber((_U_SINT)((expected_result)), (_U_SINT)((actual_result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(214), UNITY_DISPLAY_STYLE_INT);
+
+        UnityAssertEqualNumber((_U_SINT)((expected)), (_U_SINT)((actual)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(215), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+}
+
+
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, 
+
+                                                                  _Bool 
+
+                                                                       write, result_t * result)
+
+{
+
+    model_set_t * set = &sets[(address / (64)) % (8192)];
+
+    uint64_t dirty_kickout_address = 0;
+
+    
+
+   _Bool 
+
+        dirty = 
+
+                0
+
+                     ;
+
+
+
+    uint32_t way;
+
+    for (way = 0; way < set->n_valid; way++) {
+
+        if (set->addresses[way] == address) {
+
+            break;
+
+        }
+
+    }
+
+
+
+    if (way < set->n_valid) {
+
+        dirty = set->dirty[way];
+
+        *result = RESULT_HIT;
+
+    }
+
+    else if (set->n_valid < (8)) {
+
+        way = set->n_valid++;
+
+        *result = RESULT_MISS;
+
+    }
+
+    else {
+
+        way = (8) - 1;
+
+        if (set->dirty[way]) {
+
+            dirty_kickout_address = set->addresses[way];
+
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+
+        }
+
+        else {
+
+            *result = RESULT_MISS_KICKOUT;
+
+        }
+
+    }
+
+
+
+
+
+    memmove(&set->addresses[1], &set->addresses[0], way * sizeof(set->addresses[0]));
+
+    memmove(&set->dirty[1], &set->dirty[0], way * sizeof(set->dirty[0]));
+
+    set->addresses[0] = address;
+
+    set->dirty[0] = dirty || write;
+
+
+
+    return dirty_kickout_address;
+
+}
@@ -0,0 +1,148 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+void test_CacheData_Create_should_ReturnNonNull_when_GivenValidParameters(void)
+
+{
+
+    cache_data_t cache_data;
+
+
+
+    cache_data = CacheData_Create(8, 4, 4, 8);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(38))));};
+
+    CacheData_Destroy(cache_data);
+
+
+
+    cache_data = CacheData_Create(1, 4, 4, 8);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(42))));};
+
+    CacheData_Destroy(cache_data);
+
+
+
+    cache_data = CacheData_Create(8, 1, 4, 8);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(46))));};
+
+    CacheData_Destroy(cache_data);
+
+
+
+    cache_data = CacheData_Create(8, 1, 4, 0);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(50))));};
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoNumberOfSets(void)
+
+{
+
+    cache_data_t cache_data = CacheData_Create(3, 4, 4, 0);
+
+    if ((((cache_data)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(57))));};
+
+}
+
+
+
+void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoSetLength(void)
+
+{
+
+    cache_data_t cache_data = CacheData_Create(8, 3, 4, 0);
+
+    if ((((cache_data)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(63))));};
+
+}
+
+
+
+void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoBlockSize(void)
+
+{
+
+    cache_data_t cache_data = CacheData_Create(8, 1, 5, 0);
+
+    if ((((cache_data)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(69))));};
+
+}
+
+
+
+void test_CacheData_Create_shouild_ReturnNull_when_GivenBlockSizeSmallerThanAWord(void)
+
+{
+
+    cache_data_t cache_data = CacheData_Create(8, 1, 2, 0);
+
+    if ((((cache_data)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(75))));};
+
+}
+
+
+
+void test_CacheData_Create_should_ReturnNull_when_GivenNonPowerOfTwoVictimCacheSize(void)
+
+{
+
+    cache_data_t cache_data = CacheData_Create(8, 4, 4, 3);
+
+    if ((((cache_data)) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(81))));};
+
+}
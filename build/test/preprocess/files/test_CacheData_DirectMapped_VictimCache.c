@@ -0,0 +1,338 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+static const uint32_t n_sets = 16;
+
+static const uint32_t victim_cache_len_blocks = 2;
+
+static const uint32_t block_size_bytes = 16;
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create(n_sets, 1, block_size_bytes, victim_cache_len_blocks);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Read_should_SendBlockToVictimCache_when_WritingAnotherBlock(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x293800;
+
+
+
+    CacheData_Write(cache_data, base_address, &result);
+
+
+
+    uint64_t address;
+
+    uint32_t i;
+
+    for (i = 0; i < victim_cache_len_blocks; i++) {
+
+        address = base_address + (i + 1) *
+
+                                 n_sets *
+
+                                 block_size_bytes;
+
+        UnityAssertEqualNumber((_U_SINT)(_US32)((0)), (_U_SINT)(_US32)((CacheData_Read(cache_data, address, &result))), (("Didn't send block to victim cache")), (_U_UINT)(62), UNITY_DISPLAY_STYLE_HEX32)
+
+
+
+                                                                            ;
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(65), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+    address = base_address + ((victim_cache_len_blocks + 1) *
+
+                              n_sets *
+
+                              block_size_bytes);
+
+    UnityAssertEqualNumber((_U_SINT)((base_address)), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Didn't dirty kickout from victim cache")), (_U_UINT)(70), UNITY_DISPLAY_STYLE_HEX64)
+
+
+
+                                                                             ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(73), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_PullBlockBackFromVictimCache(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x823233300;
+
+
+
+    CacheData_Write(cache_data, base_address, &result);
+
+    uint64_t address;
+
+    uint32_t i;
+
+    for (i = 0; i < victim_cache_len_blocks; i++) {
+
+        address = base_address + (i + 1) *
+
+                                 n_sets *
+
+                                 block_size_bytes;
+
+        CacheData_Write(cache_data, address, &result);
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, base_address, &result))), (("Kicked out when should have just reshuffled")), (_U_UINT)(91), UNITY_DISPLAY_STYLE_HEX64)
+
+
+
+                                                                                  ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT_VICTIM_CACHE)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(94), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    address = base_address + (victim_cache_len_blocks + 1) * n_sets * block_size_bytes;
+
+    uint64_t expected_kickout_address = base_address + n_sets * block_size_bytes;
+
+    UnityAssertEqualNumber((_U_SINT)((expected_kickout_address)), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Kicked out wrong block from victim cache")), (_U_UINT)(98), UNITY_DISPLAY_STYLE_HEX64)
+
+
+
+                                                                               ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(101), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_DifferentSets_should_AllWriteToVictimCache(void)
+
+{
+
+    result_t result;
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((victim_cache_len_blocks)), (("Test parameters need attention")), (_U_UINT)(108), UNITY_DISPLAY_STYLE_INT);
+
+    uint64_t base_address = 0x9820200;
+
+    uint64_t insertion_sequence[] = {
+
+        base_address,
+
+        base_address + block_size_bytes,
+
+        base_address + n_sets * block_size_bytes,
+
+        base_address + (n_sets + 1) * block_size_bytes,
+
+    };
+
+    uint32_t n_insertions = (sizeof(insertion_sequence)/sizeof((insertion_sequence)[0]));
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < n_insertions; i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, insertion_sequence[i], &result))), (("Kicked out early")), (_U_UINT)(120), UNITY_DISPLAY_STYLE_HEX64)
+
+
+
+                                                           ;
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(123), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+
+
+    uint64_t address = base_address + (2 * n_sets + 1) * block_size_bytes;
+
+    UnityAssertEqualNumber((_U_SINT)((insertion_sequence[0])), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Wrong kickout order")), (_U_UINT)(127), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    address = base_address + 2 * n_sets * block_size_bytes;
+
+    UnityAssertEqualNumber((_U_SINT)((insertion_sequence[1])), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Wrong kickout order")), (_U_UINT)(131), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(132), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    address = base_address + 3 * n_sets * block_size_bytes;
+
+    UnityAssertEqualNumber((_U_SINT)((insertion_sequence[3])), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Wrong kickout order")), (_U_UINT)(135), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(136), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    address = base_address + (3 * n_sets + 1) * block_size_bytes;
+
+    UnityAssertEqualNumber((_U_SINT)((insertion_sequence[2])), (_U_SINT)((CacheData_Read(cache_data, address, &result))), (("Wrong kickout order")), (_U_UINT)(139), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(140), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Write_should_FillUpSetsAndVictimCache(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x7340F0;
+
+
+
+    uint64_t address;
+
+    uint32_t i;
+
+    for (i = 0; i < n_sets; i++) {
+
+        address = base_address + i * block_size_bytes;
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, address, &result))), (("Kickout while filling cache")), (_U_UINT)(152), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(153), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+
+
+    for (i = 0; i < victim_cache_len_blocks; i++) {
+
+        address = base_address + (n_sets + i) * block_size_bytes;
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Write(cache_data, address, &result))), (("Kickout while filling victim cache")), (_U_UINT)(158), UNITY_DISPLAY_STYLE_HEX64);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(159), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+void test_CacheData_Contains_should_FindBlockInVictimCache(void)
+
+{
+
+    result_t result;
+
+    uint64_t base_address = 0x98cf9990;
+
+
+
+    CacheData_Read(cache_data, base_address, &result);
+
+    CacheData_Read(cache_data, base_address + n_sets * block_size_bytes, &result);
+
+
+
+    if ((CacheData_Contains(cache_data, base_address))) {} else {UnityFail( ((("Failed to find block in victim cache"))), (_U_UINT)((_U_UINT)(171)));};
+
+}
@@ -0,0 +1,414 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TagSearch.h"
+#include "unity.h"
+#include "CacheData.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct {
+
+    uint64_t addresses[(64)];
+
+    
+
+   _Bool 
+
+        dirty[(64)];
+
+    uint32_t n_valid;
+
+} model_set_t;
+
+
+
+
+
+
+
+
+
+
+
+static uint64_t address_in_set(uint32_t set, uint32_t i);
+
+
+
+
+
+
+
+
+
+
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, 
+
+                                                                  _Bool 
+
+                                                                       write, result_t * result);
+
+
+
+
+
+
+
+
+
+static cache_data_t cache_data;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    cache_data = CacheData_Create((4), (64), (4), (8));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+}
+
+
+
+void test_CacheData_Read_should_EvictOnlyFromFullSet(void)
+
+{
+
+    result_t result;
+
+
+
+    CacheData_Read(cache_data, address_in_set(1, 0), &result);
+
+
+
+    uint32_t i;
+
+    for (i = 0; i < (64); i++) {
+
+        CacheData_Read(cache_data, address_in_set(0, i), &result);
+
+        UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(86), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+    CacheData_Read(cache_data, address_in_set(0, (64)), &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(89), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    CacheData_Read(cache_data, address_in_set(1, 0), &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(93), UNITY_DISPLAY_STYLE_INT);
+
+    CacheData_Read(cache_data, address_in_set(0, 0), &result);
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_HIT_VICTIM_CACHE)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(95), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CacheData_Read_should_KickoutFromVictimSetDirty_when_BlockHasBeenWritten(void)
+
+{
+
+    result_t result;
+
+
+
+    CacheData_Write(cache_data, address_in_set(2, 0), &result);
+
+
+
+    uint32_t i;
+
+    for (i = 1; i < (64) + (8); i++) {
+
+        UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((CacheData_Read(cache_data, address_in_set(2, i), &result))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((address_in_set(2, 0))), (_U_SINT)((CacheData_Read(cache_data, address_in_set(2, i), &result))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(109), UNITY_DISPLAY_STYLE_HEX64)
+
+                                                                                      ;
+
+    UnityAssertEqualNumber((_U_SINT)((RESULT_MISS_DIRTY_KICKOUT)), (_U_SINT)((result)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(111), UNITY_DISPLAY_STYLE_INT);
+
+    if (!(CacheData_Contains(cache_data, address_in_set(2, 0)))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(112)));};
+
+}
+
+
+
+void test_CacheData_Access_should_MatchModel_when_NoVictimSet(void)
+
+{
+
+    CacheData_Destroy(cache_data);
+
+    cache_data = CacheData_Create((4), (64), (4), 0);
+
+    if ((((cache_data)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(119))));};
+
+
+
+    static model_set_t sets[(4)];
+
+    memset(sets, 0, sizeof(sets));
+
+
+
+
+
+
+
+    uint32_t state = 12345;
+
+    uint32_t i;
+
+    for (i = 0; i < (50000); i++) {
+
+        state = state * 1103515245 + 12345;
+
+        uint64_t address = 0x40000000 + ((state >> 8) % (1024)) * (4);
+
+        
+
+       _Bool 
+
+            write = (state >> 28) & 1;
+
+
+
+        result_t expected_result;
+
+        result_t actual_result;
+
+        uint64_t expected = model_access(sets, address, write, &expected_result);
+
+        uint64_t actual = write ? CacheData_Write(cache_data, address, &actual_result) :
+
+                                  CacheData_Read(cache_data, address, &actual_result);
+
+        UnityAssertEqualNumber((_U_SINT)((expected_result)), (_U_SINT)((actual_result)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(138), UNITY_DISPLAY_STYLE_INT);
+
+        UnityAssertEqualNumber((_U_SINT)((expected)), (_U_SINT)((actual)), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(139), UNITY_DISPLAY_STYLE_HEX64);
+
+    }
+
+
+
+    for (i = 0; i < (1024); i++) {
+
+        uint64_t address = 0x40000000 + i * (4);
+
+        model_set_t const * set = &sets[i % (4)];
+
+        
+
+       _Bool 
+
+            expected = 
+
+                       0
+
+                            ;
+
+        uint32_t j;
+
+        for (j = 0; j < set->n_valid; j++) {
+
+            expected |= set->addresses[j] == address;
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)((expected)), (_U_SINT)((CacheData_Contains(cache_data, address))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(150), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+
+
+
+
+static uint64_t address_in_set(uint32_t set, uint32_t i)
+
+{
+
+    return 0x71234000 + (i * (4) + set) * (4);
+
+}
+
+
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, 
+
+                                                                  _Bool 
+
+                                                                       write, result_t * result)
+
+{
+
+    model_set_t * set = &sets[(address / (4)) % (4)];
+
+    uint64_t dirty_kickout_address = 0;
+
+    
+
+   _Bool 
+
+        dirty = 
+
+                0
+
+                     ;
+
+
+
+    uint32_t way;
+
+    for (way = 0; way < set->n_valid; way++) {
+
+        if (set->addresses[way] == address) {
+
+            break;
+
+        }
+
+    }
+
+
+
+    if (way < set->n_valid) {
+
+        dirty = set->dirty[way];
+
+        *result = RESULT_HIT;
+
+    }
+
+    else if (set->n_valid < (64)) {
+
+        way = set->n_valid++;
+
+        *result = RESULT_MISS;
+
+    }
+
+    else {
+
+        way = (64) - 1;
+
+        if (set->dirty[way]) {
+
+            dirty_kickout_address = set->addresses[way];
+
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+
+        }
+
+        else {
+
+            *result = RESULT_MISS_KICKOUT;
+
+        }
+
+    }
+
+
+
+
+
+    memmove(&set->addresses[1], &set->addresses[0], way * sizeof(set->addresses[0]));
+
+    memmove(&set->dirty[1], &set->dirty[0], way * sizeof(set->dirty[0]));
+
+    set->addresses[0] = address;
+
+    set->dirty[0] = dirty || write;
+
+
+
+    return dirty_kickout_address;
+
+}
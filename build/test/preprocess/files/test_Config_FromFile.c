@@ -0,0 +1,199 @@
+#include "unity_Helper.h"
+#include "test_utilities.h"
+#include "ConfigDefaults.h"
+#include "Config.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "unity.h"
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_SetsDefaultsWithoutConfigFile(void)
+
+{
+
+    config_t expected_config;
+
+    SetDefaultConfigValues(&expected_config);
+
+
+
+    config_t actual_config;
+
+    Config_FromFile(
+
+                   ((void *)0)
+
+                       , &actual_config);
+
+
+
+    AssertEqual_config_t(expected_config, actual_config, 51, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_SetsDefaultsWithoutEmptyConfigFile(void)
+
+{
+
+    config_t expected_config;
+
+    SetDefaultConfigValues(&expected_config);
+
+
+
+    config_t actual_config;
+
+    Config_FromFile("test/support/empty", &actual_config);
+
+
+
+    AssertEqual_config_t(expected_config, actual_config, 62, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ThrowsExceptionWithNonexistentConfigFile(void)
+
+{
+
+    volatile unsigned int e;
+
+
+
+    config_t dummy_config;
+
+
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        Config_FromFile("doesnt/exist/at/all", &dummy_config);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)((BAD_CONFIG_FILE)), (_U_SINT)((e)), (("Should have caught nonexistent config file")), (_U_UINT)(76), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_AnyConfigFileOptionsOverrideDefaults(void)
+
+{
+
+    config_t expected_config;
+
+    SetDefaultConfigValues(&expected_config);
+
+    expected_config.l2.hit_time_cycles = 10;
+
+
+
+    config_t actual_config;
+
+    Config_FromFile("test/support/l2_hit_time_10", &actual_config);
+
+
+
+    AssertEqual_config_t(expected_config, actual_config, 88, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ExceptionPointsToBadConfigLine(void)
+
+{
+
+    volatile unsigned int e;
+
+
+
+    config_t dummy_config;
+
+
+
+    const char * bad_config_file = "test/support/config_with_error_line_3";
+
+
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        Config_FromFile(bad_config_file, &dummy_config);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)((BAD_CONFIG_PARAM)), (_U_SINT)((e)), (("Should have caught bad config file")), (_U_UINT)(104), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualString((const char*)((bad_config_file)), (const char*)((exception_file)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(105));
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((exception_line)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_INT);
+
+}
@@ -0,0 +1,713 @@
+#include "unity_Helper.h"
+#include "test_utilities.h"
+#include "ConfigDefaults.h"
+#include "Config.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "unity.h"
+
+
+
+
+
+
+static void lineShouldCauseException(const char * line, volatile unsigned int exception_e, const char * message);
+
+
+
+
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_ConfigDefaultValues(void)
+
+{
+
+    config_t expected_config;
+
+    SetDefaultConfigValues(&expected_config);
+
+
+
+    config_t default_config;
+
+    memset(&(default_config), 0, sizeof(default_config));
+
+
+
+    Config_Defaults(&default_config);
+
+
+
+    AssertEqual_config_t(expected_config, default_config, 56, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_BlankLineDoesntModifyConfig(void)
+
+{
+
+    config_t expected_config;
+
+    memset(&(expected_config), 0, sizeof(expected_config));
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 69, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseBlockSizeString(void)
+
+{
+
+    config_t expected_config = {
+
+        .l1 = {
+
+            .block_size_bytes = 128,
+
+        },
+
+        .l2 = {
+
+            .block_size_bytes = 32,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L1_block_size=128\n", &config);
+
+    Config_ParseLine("L2_block_size=32\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 89, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseCacheSizeString(void)
+
+{
+
+    config_t expected_config = {
+
+        .l1 = {
+
+            .cache_size_bytes = 1024,
+
+        },
+
+        .l2 = {
+
+            .cache_size_bytes = 1024,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L1_cache_size=1024\n", &config);
+
+    Config_ParseLine("L2_cache_size=1024\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 109, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseAssociativeString(void)
+
+{
+
+    config_t expected_config = {
+
+        .l1 = {
+
+            .associativity = 2,
+
+        },
+
+        .l2 = {
+
+            .associativity = 4,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L1_assoc=2\n", &config);
+
+    Config_ParseLine("L2_assoc=4\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 129, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseHitTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .l1 = {
+
+            .hit_time_cycles = 2,
+
+        },
+
+        .l2 = {
+
+            .hit_time_cycles = 12,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L1_hit_time=2\n", &config);
+
+    Config_ParseLine("L2_hit_time=12\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 149, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseMissTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .l1 = {
+
+            .miss_time_cycles = 2,
+
+        },
+
+        .l2 = {
+
+            .miss_time_cycles = 12,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L1_miss_time=2\n", &config);
+
+    Config_ParseLine("L2_miss_time=12\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 169, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseTransferTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .l2 = {
+
+            .transfer_time_cycles = 12,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L2_transfer_time=12\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 185, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseBusWidth(void)
+
+{
+
+    config_t expected_config = {
+
+        .l2 = {
+
+            .bus_width_bytes = 32,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L2_bus_width=32\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 201, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseMemSendAddressTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .main_mem = {
+
+            .send_address_cycles = 13,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("mem_sendaddr=13\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 217, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseMemReadyTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .main_mem = {
+
+            .ready_cycles = 20,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("mem_ready=20\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 233, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseMemChunkTime(void)
+
+{
+
+    config_t expected_config = {
+
+        .main_mem = {
+
+            .send_chunk_cycles = 23,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("mem_chunktime=23\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 249, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_ParseMemChunkSize(void)
+
+{
+
+    config_t expected_config = {
+
+        .main_mem = {
+
+            .chunk_size_bytes = 16,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("mem_chunksize=16\n", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 265, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_NewlineDoesntMatter(void)
+
+{
+
+    config_t expected_config = {
+
+        .l2 = {
+
+            .bus_width_bytes = 32,
+
+        },
+
+    };
+
+
+
+    config_t config;
+
+    memset(&(config), 0, sizeof(config));
+
+
+
+    Config_ParseLine("L2_bus_width=32", &config);
+
+
+
+    AssertEqual_config_t(expected_config, config, 281, 
+
+   ((void *)0)
+
+   );
+
+}
+
+
+
+void test_RejectsSyntaxError(void)
+
+{
+
+    lineShouldCauseException("syntax errors all over da place", SYNTAX_ERROR, "Should detect syntax error");
+
+}
+
+
+
+void test_RejectsL1InvalidParameters(void)
+
+{
+
+    lineShouldCauseException("L1_transfer_time=3\n", BAD_CONFIG_PARAM, "L1 has no transfer time parameter");
+
+    lineShouldCauseException("L1_bus_width=32\n", BAD_CONFIG_PARAM, "L1 has no bus width parameter");
+
+}
+
+
+
+void test_RejetcsInvalidCacheName(void)
+
+{
+
+    lineShouldCauseException("L3_cache_size=1024\n", BAD_CONFIG_CACHE, "There is no L3 cache");
+
+}
+
+
+
+void test_RejectsInvalidParameterName(void)
+
+{
+
+    lineShouldCauseException("L1_doesnt_exist=1024\n", BAD_CONFIG_PARAM, "Should catch doesnt_exist parameter");
+
+}
+
+
+
+void test_ThrowsExceptionWithNullPointers(void)
+
+{
+
+    lineShouldCauseException(
+
+                            ((void *)0)
+
+                                , ARGUMENT_ERROR, "Should catch null string");
+
+
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        Config_ParseLine("L1_hit_time=1\n", 
+
+                                           ((void *)0)
+
+                                               );
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (("Should catch null config struct")), (_U_UINT)(316), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_WidthsMustBePowersOfTwo(void)
+
+{
+
+    lineShouldCauseException("L1_block_size=31\n", BAD_CONFIG_VALUE, "Should catch non power-of-two block size");
+
+    lineShouldCauseException("L2_cache_size=1000\n", BAD_CONFIG_VALUE, "Should catch non power-of-two cache size");
+
+    lineShouldCauseException("L1_assoc=5\n", BAD_CONFIG_VALUE, "Should catch non power-of-two associative value");
+
+    lineShouldCauseException("L2_bus_width=9\n", BAD_CONFIG_VALUE, "Should catch non power-of-two bus width");
+
+    lineShouldCauseException("mem_chunksize=15\n", BAD_CONFIG_VALUE, "Should catch non power-of-two chunk size");
+
+}
+
+
+
+
+
+
+
+static void lineShouldCauseException(const char * line, volatile unsigned int expected_e, const char * message)
+
+{
+
+    config_t dummy_config;
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        Config_ParseLine(line, &dummy_config);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((expected_e)), (_U_SINT)(_US32)((e)), ((message)), (_U_UINT)(340), UNITY_DISPLAY_STYLE_HEX32);
+
+}
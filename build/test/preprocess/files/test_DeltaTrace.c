@@ -0,0 +1,808 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "DeltaTrace.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static size_t read_file(FILE * file, uint8_t * trace);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static access_t const accesses[] = {
+
+    { TYPE_INSTR, 0x400000, 4 },
+
+    { TYPE_INSTR, 0x400004, 3 },
+
+    { TYPE_READ, 0x7fff0010, 8 },
+
+    { TYPE_INSTR, 0x400007, 5 },
+
+    { TYPE_INSTR, 0x40000c, 2 },
+
+    { TYPE_WRITE, 0x7fff0008, 4 },
+
+    { TYPE_READ, 0x601000, 1 },
+
+    { TYPE_INSTR, 0x3ffff0, 6 },
+
+    { TYPE_INSTR, 0x3ffff6, 6 },
+
+    { TYPE_INSTR, 0x3ffffc, 4 },
+
+    { TYPE_WRITE, 0xfffffffffffffff8, 8 },
+
+    { TYPE_WRITE, 0x10, 8 },
+
+};
+
+
+
+static delta_trace_encoder_t encoder;
+
+static delta_trace_decoder_t decoder;
+
+static FILE * file;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    encoder = DeltaTrace_CreateEncoder();
+
+    decoder = DeltaTrace_CreateDecoder();
+
+    file = tmpfile();
+
+    if ((((encoder)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(84))));};
+
+    if ((((decoder)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(85))));};
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(86))));};
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    DeltaTrace_DestroyEncoder(encoder);
+
+    DeltaTrace_DestroyDecoder(decoder);
+
+    fclose(file);
+
+}
+
+
+
+void test_DeltaTrace_DecodeChunk_should_RecoverEncodedAccesses(void)
+
+{
+
+    uint8_t const * chunk;
+
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, ((sizeof(accesses)/sizeof((accesses)[0]))), &chunk);
+
+    UnityAssertEqualNumber((_U_SINT)((length)), (_U_SINT)((DeltaTrace_DecodeChunk(decoder, chunk, length))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(100), UNITY_DISPLAY_STYLE_INT);
+
+    if (!(DeltaTrace_Ended(decoder))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(101)));};
+
+
+
+    access_t actual[((sizeof(accesses)/sizeof((accesses)[0]))) + 1];
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((((sizeof(accesses)/sizeof((accesses)[0]))))), (_U_SINT)(_UU32)((DeltaTrace_ReadAccesses(decoder, actual, ((sizeof(accesses)/sizeof((accesses)[0]))) + 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(104), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < ((sizeof(accesses)/sizeof((accesses)[0]))); i++) {
+
+        AssertEqual_access_t(accesses[i], actual[i], 107, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((DeltaTrace_ReadAccesses(decoder, actual, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(109), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_DeltaTrace_ReadRuns_should_CollapseSequentialFetches(void)
+
+{
+
+    uint8_t const * chunk;
+
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, ((sizeof(accesses)/sizeof((accesses)[0]))), &chunk);
+
+    DeltaTrace_DecodeChunk(decoder, chunk, length);
+
+
+
+    access_run_t runs[((sizeof(accesses)/sizeof((accesses)[0])))];
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((8)), (_U_SINT)(_UU32)((DeltaTrace_ReadRuns(decoder, runs, ((sizeof(accesses)/sizeof((accesses)[0])))))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(119), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_US8 )((TYPE_INSTR)), (_U_SINT)(_US8 )((runs[0].type)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(121), UNITY_DISPLAY_STYLE_HEX8);
+
+    UnityAssertEqualNumber((_U_SINT)((0x400000)), (_U_SINT)((runs[0].address)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(122), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((runs[0].n_bytes)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(123), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((runs[0].n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(124), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((4)), (_U_SINT)(_UU32)((runs[0].sizes[0])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(125), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((runs[0].sizes[1])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(126), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_US8 )((TYPE_READ)), (_U_SINT)(_US8 )((runs[1].type)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(128), UNITY_DISPLAY_STYLE_HEX8);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((runs[1].n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(129), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0x400007)), (_U_SINT)((runs[2].address)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(133), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((runs[2].n_bytes)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(134), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0x3ffff0)), (_U_SINT)((runs[5].address)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(136), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((runs[5].n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(137), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((16)), (_U_SINT)((runs[5].n_bytes)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(138), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_DeltaTrace_ReadRuns_should_ReturnRemainder_when_RunIsPartlyRead(void)
+
+{
+
+    uint8_t const * chunk;
+
+    size_t length = DeltaTrace_EncodeChunk(encoder, &accesses[7], 3, &chunk);
+
+    DeltaTrace_DecodeChunk(decoder, chunk, length);
+
+
+
+    access_t access;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((DeltaTrace_ReadAccesses(decoder, &access, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(148), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(accesses[7], access, 149, 
+
+   ((void *)0)
+
+   );
+
+
+
+    access_run_t run;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((DeltaTrace_ReadRuns(decoder, &run, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(152), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((accesses[8].address)), (_U_SINT)((run.address)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(153), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((10)), (_U_SINT)((run.n_bytes)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(154), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((run.n_accesses)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(155), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((6)), (_U_SINT)(_UU32)((run.sizes[0])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(156), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((4)), (_U_SINT)(_UU32)((run.sizes[1])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(157), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((DeltaTrace_ReadRuns(decoder, &run, 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(159), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_DeltaTrace_DecodeChunk_should_ReturnZero_when_ChunkIsIncomplete(void)
+
+{
+
+    uint8_t const * chunk;
+
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, ((sizeof(accesses)/sizeof((accesses)[0]))), &chunk);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((DeltaTrace_DecodeChunk(decoder, chunk, length - 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(167), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((DeltaTrace_DecodeChunk(decoder, chunk, (8 + 8 * (7)) - 1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(168), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_DeltaTrace_DecodeChunk_should_ThrowException_when_ChunkIsCorrupt(void)
+
+{
+
+    uint8_t const * chunk;
+
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, ((sizeof(accesses)/sizeof((accesses)[0]))), &chunk);
+
+
+
+
+
+    uint8_t corrupt[1024];
+
+    if ((length <= sizeof(corrupt))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(178)));};
+
+    memcpy(corrupt, chunk, length);
+
+    PutLE32(&corrupt[0], ((sizeof(accesses)/sizeof((accesses)[0]))) + 1);
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        DeltaTrace_DecodeChunk(decoder, corrupt, length);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(188), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_DeltaTrace_EncodeChunk_should_ThrowException_when_AccessIsInvalid(void)
+
+{
+
+    access_t invalid[] = {
+
+        { TYPE_INSTR, 0x400000, 4 },
+
+        { 'X', 0x400004, 4 },
+
+    };
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    uint8_t const * chunk;
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        DeltaTrace_EncodeChunk(encoder, invalid, (sizeof(invalid)/sizeof((invalid)[0])), &chunk);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(205), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+    invalid[1].type = TYPE_INSTR;
+
+    invalid[1].n_bytes = 0;
+
+    e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        DeltaTrace_EncodeChunk(encoder, invalid, (sizeof(invalid)/sizeof((invalid)[0])), &chunk);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(215), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_DeltaTrace_Finish_should_WriteChunksAndEnd(void)
+
+{
+
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, (4));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(221))));};
+
+
+
+
+
+    DeltaTrace_Write(writer, &accesses[0], 3);
+
+    DeltaTrace_Write(writer, &accesses[3], ((sizeof(accesses)/sizeof((accesses)[0]))) - 4);
+
+    DeltaTrace_Write(writer, &accesses[((sizeof(accesses)/sizeof((accesses)[0]))) - 1], 1);
+
+    UnityAssertEqualNumber((_U_SINT)((((sizeof(accesses)/sizeof((accesses)[0]))))), (_U_SINT)((DeltaTrace_Finish(writer))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(227), UNITY_DISPLAY_STYLE_UINT64);
+
+    DeltaTrace_DestroyWriter(writer);
+
+
+
+    uint8_t trace[(4096)];
+
+    size_t length = read_file(file, trace);
+
+    DeltaTrace_CheckHeader(trace);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((4))), (_U_SINT)(_UU32)((GetLE32(&trace[12]))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(233), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    access_t actual[((sizeof(accesses)/sizeof((accesses)[0])))];
+
+    uint32_t n_actual = 0;
+
+    uint32_t n_chunks = 0;
+
+    size_t offset = (24);
+
+    while (!DeltaTrace_Ended(decoder)) {
+
+        size_t chunk_length = DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+
+        if (((0) != (chunk_length))) {} else {UnityFail( ((" Expected Not-Equal")), (_U_UINT)((_U_UINT)(241)));};
+
+        offset += chunk_length;
+
+        n_actual += DeltaTrace_ReadAccesses(decoder, &actual[n_actual], ((sizeof(accesses)/sizeof((accesses)[0]))) - n_actual);
+
+        n_chunks++;
+
+    }
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((length)), (_U_SINT)((offset)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(247), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1 + ((sizeof(accesses)/sizeof((accesses)[0]))) / (4))), (_U_SINT)(_UU32)((n_chunks)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(248), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((((sizeof(accesses)/sizeof((accesses)[0]))))), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(249), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < ((sizeof(accesses)/sizeof((accesses)[0]))); i++) {
+
+        AssertEqual_access_t(accesses[i], actual[i], 252, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_DeltaTrace_WriteChunk_should_AppendPrecompressedChunk(void)
+
+{
+
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, (4));
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(259))));};
+
+
+
+
+
+    DeltaTrace_Write(writer, &accesses[0], 1);
+
+
+
+    uint8_t const * chunk;
+
+    size_t chunk_length = DeltaTrace_EncodeChunk(encoder, &accesses[1], (4), &chunk);
+
+    DeltaTrace_WriteChunk(writer, chunk, chunk_length, (4));
+
+    UnityAssertEqualNumber((_U_SINT)((1 + (4))), (_U_SINT)((DeltaTrace_Finish(writer))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(267), UNITY_DISPLAY_STYLE_UINT64);
+
+    DeltaTrace_DestroyWriter(writer);
+
+
+
+    uint8_t trace[(4096)];
+
+    size_t length = read_file(file, trace);
+
+    size_t offset = (24);
+
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+
+    UnityAssertEqualMemory(( const void*)((chunk)), ( const void*)((&trace[offset])), (_UU32)((chunk_length)), 1, (
+
+   ((void *)0)
+
+   ), (_U_UINT)(274));
+
+
+
+    access_t actual[(4)];
+
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((4))), (_U_SINT)(_UU32)((DeltaTrace_ReadAccesses(decoder, actual, (4)))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(278), UNITY_DISPLAY_STYLE_UINT32);
+
+    AssertEqual_access_t(accesses[1], actual[0], 279, 
+
+   ((void *)0)
+
+   );
+
+
+
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+
+    if ((DeltaTrace_Ended(decoder))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(282)));};
+
+    UnityAssertEqualNumber((_U_SINT)((length)), (_U_SINT)((offset)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(283), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_DeltaTrace_CreateWriter_should_ThrowException_when_ChunkLenIsZero(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        DeltaTrace_CreateWriter(file, 0);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(294), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_DeltaTrace_CheckHeader_should_ThrowException_when_VersionIsWrong(void)
+
+{
+
+    uint8_t header[(24)];
+
+    memset(header, 0, sizeof(header));
+
+    memcpy(header, "SIMDELTA", 8);
+
+    PutLE32(&header[8], (1) + 1);
+
+    PutLE32(&header[12], (4));
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        DeltaTrace_CheckHeader(header);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(311), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+
+
+
+
+static size_t read_file(FILE * file, uint8_t * trace)
+
+{
+
+    rewind(file);
+
+    size_t length = fread(trace, 1, (4096), file);
+
+    if ((length < (4096))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(320)));};
+
+
+
+    return length;
+
+}
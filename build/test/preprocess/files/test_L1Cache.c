@@ -0,0 +1,1559 @@
+#include "mock_Statistics.h"
+#include "mock_StackDistance.h"
+#include "mock_L2Cache.h"
+#include "mock_CacheData.h"
+#include "ConfigDefaults.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Config.h"
+#include "CacheInternals.h"
+#include "Access.h"
+#include "L1Cache.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static l1_cache_t l1_cache;
+
+
+
+static l2_cache_t dummy_l2_cache;
+
+static cache_stats_t * dummy_cache_stats;
+
+static cache_data_t dummy_cache_data = (cache_data_t) 4;
+
+
+
+static config_t config;
+
+static uint32_t n_blocks;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    SetDefaultConfigValues(&config);
+
+
+
+    n_blocks = config.l1.cache_size_bytes / config.l1.block_size_bytes;
+
+    CacheData_Create_CMockExpectAndReturn(57, n_blocks, 1, config.l1.block_size_bytes, 8, dummy_cache_data)
+
+
+
+
+
+
+
+                                                      ;
+
+    CacheData_PrefetchEnabled_CMockExpectAndReturn(62, dummy_cache_data, 
+
+   0
+
+   );
+
+    L2Cache_PrefetchEnabled_CMockExpectAndReturn(63, dummy_l2_cache, 
+
+   0
+
+   );
+
+
+
+    l1_cache = L1Cache_Create(dummy_l2_cache, dummy_cache_stats, &(config.l1));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy_CMockExpect(70, dummy_cache_data);
+
+    L1Cache_Destroy(l1_cache);
+
+}
+
+
+
+void test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails(void)
+
+{
+
+    CacheData_Create_CMockIgnoreAndReturn(76, 
+
+   ((void *)0)
+
+   );
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UP)((
+
+   ((void *)0)
+
+   )), (_U_SINT)(_UP)((L1Cache_Create(dummy_l2_cache, dummy_cache_stats, &(config.l1)))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(78), UNITY_DISPLAY_STYLE_HEX64);
+
+}
+
+
+
+void test_InstructionMiss_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Read_CMockExpectAndReturn(96, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(97);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(98, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 75;
+
+    L2Cache_Access_CMockExpectAndReturn(101, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(103, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(108), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadMiss_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xbbccfa00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xbbccfa00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Read_CMockExpectAndReturn(126, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(127);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(128, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 31;
+
+    L2Cache_Access_CMockExpectAndReturn(131, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(133, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(138), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteMiss_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xcccc00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xcccc00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Write_CMockExpectAndReturn(156, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(157);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(158, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 829;
+
+    L2Cache_Access_CMockExpectAndReturn(161, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(163, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(168), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionMissKickout_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(186, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(187);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(188, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 75;
+
+    L2Cache_Access_CMockExpectAndReturn(191, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(193, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(198), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadMissKickout_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xbbccfa00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xbbccfa00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(216, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(217);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(218, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 31;
+
+    L2Cache_Access_CMockExpectAndReturn(221, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(223, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(228), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteMissKickout_should_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xcccc00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0xcccc00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Write_CMockExpectAndReturn(246, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(247);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(248, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_access_cycles = 829;
+
+    L2Cache_Access_CMockExpectAndReturn(251, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(253, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(258), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(270, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(271);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(272, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(274, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(277), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(289, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(290);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(291, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(293, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(296), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(308, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(309);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(310, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(312, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(315), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionVictimCacheHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Read_CMockExpectAndReturn(327, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(328);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(329, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(331, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(335), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadVictimCacheHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Read_CMockExpectAndReturn(347, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(348);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(349, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(351, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(355), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteVictimCacheHit_should_not_CauseL2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Read_CMockExpectAndReturn(367, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(368);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(369, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(371, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(375), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadDirtyKickout_should_CauseL2Write_then_L2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_dirty_writeback = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xacacddf1200,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_DIRTY_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(399, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , expected_dirty_writeback.address)
+
+                                                                    ;
+
+    CacheData_Read_CMockIgnoreArg_result(401);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(402, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_writeback_cycles = 110;
+
+    L2Cache_Access_CMockExpectAndReturn(405, dummy_l2_cache, &expected_dirty_writeback, l2_writeback_cycles);
+
+
+
+    uint32_t l2_access_cycles = 19;
+
+    L2Cache_Access_CMockExpectAndReturn(408, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(410, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_writeback_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(416), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteDirtyKickout_should_CauseL2Write_then_L2Read(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    access_t expected_dirty_writeback = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xacacddf1200,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_DIRTY_KICKOUT;
+
+    CacheData_Write_CMockExpectAndReturn(440, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , expected_dirty_writeback.address)
+
+                                                                     ;
+
+    CacheData_Write_CMockIgnoreArg_result(442);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(443, &result, sizeof(*&result));
+
+
+
+    uint32_t l2_writeback_cycles = 110;
+
+    L2Cache_Access_CMockExpectAndReturn(446, dummy_l2_cache, &expected_dirty_writeback, l2_writeback_cycles);
+
+
+
+    uint32_t l2_access_cycles = 19;
+
+    L2Cache_Access_CMockExpectAndReturn(449, dummy_l2_cache, &expected_memory_access, l2_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(451, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l1.miss_time_cycles +
+
+                                      l2_writeback_cycles +
+
+                                      l2_access_cycles +
+
+                                      config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(457), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_RepeatedBlockAccess_should_HitWithoutCacheData(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Read_CMockExpectAndReturn(469, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(470);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(471, &result, sizeof(*&result));
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = access.address,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+    L2Cache_Access_CMockExpectAndReturn(478, dummy_l2_cache, &expected_memory_access, 19);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(480, dummy_cache_stats, result);
+
+    L1Cache_Access(l1_cache, &access);
+
+
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(484, dummy_cache_stats, RESULT_HIT);
+
+    Statistics_RecordCacheAccess_CMockExpect(485, dummy_cache_stats, RESULT_HIT);
+
+    access.address += 4;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((config.l1.hit_time_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(487), UNITY_DISPLAY_STYLE_UINT32);
+
+    access.address += config.l1.block_size_bytes - 8;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((config.l1.hit_time_cycles)), (_U_SINT)(_UU32)((L1Cache_Access(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(489), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteAfterRead_should_MarkBlockDirtyOnce(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(501, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(502);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(503, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(504, dummy_cache_stats, result);
+
+    L1Cache_Access(l1_cache, &access);
+
+
+
+
+
+    access.type = TYPE_WRITE;
+
+    CacheData_Write_CMockExpectAndReturn(509, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(510);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(511, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(512, dummy_cache_stats, result);
+
+    L1Cache_Access(l1_cache, &access);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(515, dummy_cache_stats, RESULT_HIT);
+
+    L1Cache_Access(l1_cache, &access);
+
+
+
+
+
+    access.address += config.l1.block_size_bytes;
+
+    CacheData_Write_CMockExpectAndReturn(520, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(521);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(522, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(523, dummy_cache_stats, result);
+
+    L1Cache_Access(l1_cache, &access);
+
+}
+
+
+
+void test_AccessSpan_should_LookUpBlockOnce(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4 * (4),
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Write_CMockExpectAndReturn(536, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(537);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(538, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(539, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(540, dummy_cache_stats, 3);
+
+
+
+    uint32_t expected_access_cycles = 4 * config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_AccessSpan(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(543), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_AccessSpan_should_LookUpEachBlock_when_SpanCrossesBlocks(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00 + config.l1.block_size_bytes - (4),
+
+        .n_bytes = 3 * (4),
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(555, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(556);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(557, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(558, dummy_cache_stats, result);
+
+
+
+
+
+    CacheData_Read_CMockExpectAndReturn(561, dummy_cache_data, access.address + (4), 
+
+   ((void *)0)
+
+   , 0)
+
+
+
+
+
+                                     ;
+
+    CacheData_Read_CMockIgnoreArg_result(565);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(566, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(567, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(568, dummy_cache_stats, 1);
+
+
+
+    uint32_t expected_access_cycles = 3 * config.l1.hit_time_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L1Cache_AccessSpan(l1_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(571), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_AccessSpan_should_CountEachLookup_when_StackDistanceIsAttached(void)
+
+{
+
+    stack_distance_t dummy_stack_distance = (stack_distance_t) 8;
+
+    L1Cache_AttachStackDistance(l1_cache, dummy_stack_distance);
+
+
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 2 * (4),
+
+    };
+
+
+
+    StackDistance_Access_CMockExpect(585, dummy_stack_distance, access.address, 2, 
+
+   0
+
+   );
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(588, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(589);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(590, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(591, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(592, dummy_cache_stats, 1);
+
+
+
+
+
+    StackDistance_Access_CMockExpect(595, dummy_stack_distance, access.address, 2, 
+
+   0
+
+   );
+
+    Statistics_RecordCacheAccess_CMockExpect(596, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(597, dummy_cache_stats, 1);
+
+
+
+    L1Cache_AccessSpan(l1_cache, &access);
+
+    L1Cache_AccessSpan(l1_cache, &access);
+
+}
+
+
+
+void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < (2); i++) {
+
+        L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+
+    }
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(616), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+
+
+    L1Cache_AttachStackDistance(l1_cache, 
+
+                                         ((void *)0)
+
+                                             );
+
+    L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+
+}
+
+
+
+void test_AccessBatch_should_AlignAndSimulateInOrder(void)
+
+{
+
+    access_t accesses[] = {
+
+        { .type = TYPE_INSTR, .address = 0x4cd7f0c02, .n_bytes = 4 },
+
+        { .type = TYPE_WRITE, .address = 0x4cd7f1000, .n_bytes = 8 },
+
+    };
+
+    uint32_t cycles[(sizeof(accesses)/sizeof((accesses)[0]))];
+
+    uint32_t n_aligned[(sizeof(accesses)/sizeof((accesses)[0]))];
+
+
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(634, dummy_cache_data, 0x4cd7f0c00, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(635);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(636, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(637, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(638, dummy_cache_stats, 1);
+
+
+
+    CacheData_Write_CMockExpectAndReturn(640, dummy_cache_data, 0x4cd7f1000, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(641);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(642, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(643, dummy_cache_stats, result);
+
+    Statistics_RecordCacheHits_CMockExpect(644, dummy_cache_stats, 1);
+
+
+
+    L1Cache_AccessBatch(l1_cache, l1_cache, accesses, (sizeof(accesses)/sizeof((accesses)[0])), cycles, n_aligned);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((n_aligned[0])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(648), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((n_aligned[1])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(649), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2 * config.l1.hit_time_cycles)), (_U_SINT)(_UU32)((cycles[0])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(650), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2 * config.l1.hit_time_cycles)), (_U_SINT)(_UU32)((cycles[1])), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(651), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_AccessBatch_should_PrefetchAhead_when_CachesAreLarge(void)
+
+{
+
+    CacheData_Destroy_CMockExpect(656, dummy_cache_data);
+
+    L1Cache_Destroy(l1_cache);
+
+
+
+    CacheData_Create_CMockIgnoreAndReturn(659, dummy_cache_data);
+
+    CacheData_PrefetchEnabled_CMockExpectAndReturn(660, dummy_cache_data, 
+
+   1
+
+   );
+
+    L2Cache_PrefetchEnabled_CMockExpectAndReturn(661, dummy_l2_cache, 
+
+   1
+
+   );
+
+    l1_cache = L1Cache_Create(dummy_l2_cache, dummy_cache_stats, &(config.l1));
+
+
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x4cd7f0c00,
+
+        .n_bytes = 4,
+
+    };
+
+    uint32_t cycles;
+
+    uint32_t n_aligned;
+
+
+
+    CacheData_Prefetch_CMockExpect(672, dummy_cache_data, access.address);
+
+    L2Cache_Prefetch_CMockExpect(673, dummy_l2_cache, access.address);
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(676, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(677);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(678, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(679, dummy_cache_stats, result);
+
+
+
+    L1Cache_AccessBatch(l1_cache, l1_cache, &access, 1, &cycles, &n_aligned);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((config.l1.hit_time_cycles)), (_U_SINT)(_UU32)((cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(682), UNITY_DISPLAY_STYLE_UINT32);
+
+}
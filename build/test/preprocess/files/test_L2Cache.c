@@ -0,0 +1,1285 @@
+#include "mock_Statistics.h"
+#include "mock_StackDistance.h"
+#include "mock_MainMem.h"
+#include "mock_L2Stream.h"
+#include "mock_CacheData.h"
+#include "ConfigDefaults.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "CacheInternals.h"
+#include "Access.h"
+#include "L2Cache.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static const uint32_t victim_cache_len = 8;
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static config_t config;
+
+
+
+static main_mem_t dummy_main_mem;
+
+static cache_stats_t * dummy_cache_stats;
+
+static cache_data_t dummy_cache_data = (cache_data_t)8;
+
+
+
+static l2_cache_t l2_cache;
+
+static uint32_t l1_block_transfer_cycles;
+
+static uint32_t n_blocks;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    SetDefaultConfigValues(&config);
+
+
+
+    l1_block_transfer_cycles = config.l2.transfer_time_cycles *
+
+                               (config.l1.block_size_bytes /
+
+                                config.l2.bus_width_bytes);
+
+    n_blocks = config.l2.cache_size_bytes / config.l2.block_size_bytes;
+
+
+
+    CacheData_Create_CMockExpectAndReturn(65, n_blocks, 1, config.l2.block_size_bytes, victim_cache_len, dummy_cache_data)
+
+
+
+
+
+
+
+                                                      ;
+
+
+
+    l2_cache = L2Cache_Create(dummy_main_mem, dummy_cache_stats, &(config.l2));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    CacheData_Destroy_CMockExpect(76, dummy_cache_data);
+
+    L2Cache_Destroy(l2_cache);
+
+}
+
+
+
+void test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails(void)
+
+{
+
+    CacheData_Create_CMockIgnoreAndReturn(82, 
+
+   ((void *)0)
+
+   );
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UP)((
+
+   ((void *)0)
+
+   )), (_U_SINT)(_UP)((L2Cache_Create(dummy_main_mem, dummy_cache_stats, &(config.l2)))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(84), UNITY_DISPLAY_STYLE_HEX64);
+
+}
+
+
+
+void test_InstructionMiss_should_CauseMainMemReadAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Read_CMockExpectAndReturn(102, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(103);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(104, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 75;
+
+    MainMem_Access_CMockExpectAndReturn(107, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(109, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(115), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadMiss_should_CauseMainMemReadAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Read_CMockExpectAndReturn(133, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(134);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(135, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 32;
+
+    MainMem_Access_CMockExpectAndReturn(138, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(140, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(146), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteMiss_should_CauseMainMemReadAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS;
+
+    CacheData_Write_CMockExpectAndReturn(164, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(165);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(166, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 256;
+
+    MainMem_Access_CMockExpectAndReturn(169, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(171, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(177), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(189, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(190);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(191, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(193, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(197), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(209, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(210);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(211, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(213, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(217), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Write_CMockExpectAndReturn(229, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(230);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(231, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(233, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(237), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionVictimCacheHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Read_CMockExpectAndReturn(249, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(250);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(251, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(253, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(258), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadVictimCacheHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Read_CMockExpectAndReturn(270, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(271);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(272, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(274, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(279), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteVictimCacheHit_should_not_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT_VICTIM_CACHE;
+
+    CacheData_Write_CMockExpectAndReturn(291, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(292);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(293, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(295, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(300), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_InstructionKickout_should_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(318, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(319);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(320, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 12;
+
+    MainMem_Access_CMockExpectAndReturn(323, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(325, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(331), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadKickout_should_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(349, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(350);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(351, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 12;
+
+    MainMem_Access_CMockExpectAndReturn(354, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(356, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(362), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteKickout_should_CauseMainMemAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_KICKOUT;
+
+    CacheData_Write_CMockExpectAndReturn(380, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(381);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(382, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_access_cycles = 12;
+
+    MainMem_Access_CMockExpectAndReturn(385, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(387, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(393), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_ReadDirtyKickout_should_CauseWriteback(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_dirty_writeback = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xf90dfca8500,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_DIRTY_KICKOUT;
+
+    CacheData_Read_CMockExpectAndReturn(417, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , expected_dirty_writeback.address)
+
+
+
+
+
+                                                                    ;
+
+    CacheData_Read_CMockIgnoreArg_result(421);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(422, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_writeback_cycles = 32;
+
+    uint32_t main_mem_access_cycles = 181;
+
+    MainMem_Access_CMockExpectAndReturn(426, dummy_main_mem, &expected_dirty_writeback, main_mem_writeback_cycles);
+
+    MainMem_Access_CMockExpectAndReturn(427, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(429, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_writeback_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(436), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_WriteDirtyKickout_should_CauseWriteback(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_dirty_writeback = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0xf90dfca8500,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    access_t expected_memory_access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l2.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_MISS_DIRTY_KICKOUT;
+
+    CacheData_Write_CMockExpectAndReturn(460, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , expected_dirty_writeback.address)
+
+
+
+
+
+                                                                     ;
+
+    CacheData_Write_CMockIgnoreArg_result(464);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(465, &result, sizeof(*&result));
+
+
+
+    uint32_t main_mem_writeback_cycles = 32;
+
+    uint32_t main_mem_access_cycles = 181;
+
+    MainMem_Access_CMockExpectAndReturn(469, dummy_main_mem, &expected_dirty_writeback, main_mem_writeback_cycles);
+
+    MainMem_Access_CMockExpectAndReturn(470, dummy_main_mem, &expected_memory_access, main_mem_access_cycles);
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(472, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.miss_time_cycles +
+
+                                      main_mem_writeback_cycles +
+
+                                      main_mem_access_cycles +
+
+                                      config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(479), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_Access_should_CountEachAccess_when_StackDistancesAreAttached(void)
+
+{
+
+    stack_distance_t dummy_stack_distances[] = {
+
+        (stack_distance_t) 8,
+
+        (stack_distance_t) 16,
+
+    };
+
+    L2Cache_AttachStackDistance(l2_cache, dummy_stack_distances[0]);
+
+    L2Cache_AttachStackDistance(l2_cache, dummy_stack_distances[1]);
+
+
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    StackDistance_Access_CMockExpect(497, dummy_stack_distances[0], access.address, 1, 
+
+   1
+
+   );
+
+    StackDistance_Access_CMockExpect(498, dummy_stack_distances[1], access.address, 1, 
+
+   1
+
+   );
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Write_CMockExpectAndReturn(501, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Write_CMockIgnoreArg_result(502);
+
+    CacheData_Write_CMockReturnMemThruPtr_result(503, &result, sizeof(*&result));
+
+    Statistics_RecordCacheAccess_CMockExpect(504, dummy_cache_stats, result);
+
+
+
+
+
+    StackDistance_Access_CMockExpect(507, dummy_stack_distances[0], access.address, 1, 
+
+   1
+
+   );
+
+    StackDistance_Access_CMockExpect(508, dummy_stack_distances[1], access.address, 1, 
+
+   1
+
+   );
+
+    Statistics_RecordCacheAccess_CMockExpect(509, dummy_cache_stats, result);
+
+
+
+    L2Cache_Access(l2_cache, &access);
+
+    L2Cache_Access(l2_cache, &access);
+
+}
+
+
+
+void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < (2); i++) {
+
+        L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+
+    }
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(528), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+
+
+    L2Cache_AttachStackDistance(l2_cache, 
+
+                                         ((void *)0)
+
+                                             );
+
+    L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+
+}
+
+
+
+void test_Access_should_RecordAccessAndCycles_when_CaptureIsAttached(void)
+
+{
+
+    l2_stream_writer_t dummy_writer = (l2_stream_writer_t) 8;
+
+    L2Cache_AttachCapture(l2_cache, dummy_writer);
+
+
+
+    access_t access = {
+
+        .type = TYPE_READ,
+
+        .address = 0x10123400,
+
+        .n_bytes = config.l1.block_size_bytes,
+
+    };
+
+
+
+    result_t result = RESULT_HIT;
+
+    CacheData_Read_CMockExpectAndReturn(547, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(548);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(549, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(551, dummy_cache_stats, result);
+
+
+
+    uint32_t expected_access_cycles = config.l2.hit_time_cycles +
+
+                                      l1_block_transfer_cycles;
+
+    L2Stream_Record_CMockExpect(555, dummy_writer, &access, expected_access_cycles);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(557), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+
+
+    L2Cache_AttachCapture(l2_cache, 
+
+                                   ((void *)0)
+
+                                       );
+
+    access.address += config.l2.block_size_bytes;
+
+
+
+    CacheData_Read_CMockExpectAndReturn(563, dummy_cache_data, access.address, 
+
+   ((void *)0)
+
+   , 0);
+
+    CacheData_Read_CMockIgnoreArg_result(564);
+
+    CacheData_Read_CMockReturnMemThruPtr_result(565, &result, sizeof(*&result));
+
+
+
+    Statistics_RecordCacheAccess_CMockExpect(567, dummy_cache_stats, result);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((L2Cache_Access(l2_cache, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(569), UNITY_DISPLAY_STYLE_UINT32);
+
+}
@@ -0,0 +1,562 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Statistics.h"
+#include "Config.h"
+#include "Access.h"
+#include "L2Stream.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static cache_param_t const l1_config = {
+
+    .block_size_bytes = (32),
+
+    .cache_size_bytes = 8192,
+
+    .associativity = 2,
+
+    .hit_time_cycles = 1,
+
+    .miss_time_cycles = 1,
+
+    .transfer_time_cycles = 0,
+
+    .bus_width_bytes = 4,
+
+};
+
+
+
+static l2_stream_writer_t writer;
+
+static l2_stream_reader_t reader;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    remove("build/test/test_L2Stream.bin");
+
+    writer = 
+
+            ((void *)0)
+
+                ;
+
+    reader = 
+
+            ((void *)0)
+
+                ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    L2Stream_DestroyWriter(writer);
+
+    L2Stream_DestroyReader(reader);
+
+    remove("build/test/test_L2Stream.bin");
+
+}
+
+
+
+void test_L2Stream_CreateReader_should_ThrowException_when_FileIsMissing(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        reader = L2Stream_CreateReader("build/test/test_L2Stream.bin");
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(83), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_L2Stream_CreateReader_should_ThrowException_when_StreamIsNotFinished(void)
+
+{
+
+    writer = L2Stream_CreateWriter("build/test/test_L2Stream.bin", &l1_config);
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(89))));};
+
+
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = (32) };
+
+    L2Stream_Record(writer, &access, 10);
+
+    L2Stream_DestroyWriter(writer);
+
+    writer = 
+
+            ((void *)0)
+
+                ;
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        reader = L2Stream_CreateReader("build/test/test_L2Stream.bin");
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((BAD_TRACE_FILE)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(102), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_L2Stream_Record_should_ThrowException_when_AccessIsNotABlock(void)
+
+{
+
+    writer = L2Stream_CreateWriter("build/test/test_L2Stream.bin", &l1_config);
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(108))));};
+
+
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = 4 };
+
+
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        L2Stream_Record(writer, &access, 10);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(118), UNITY_DISPLAY_STYLE_HEX32);
+
+
+
+    e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        L2Stream_SetOrigin(writer, 'X');
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((INVALID_OPERATION)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(126), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_L2Stream_Read_should_ReturnEveryAccessInOrder(void)
+
+{
+
+    static access_t accesses[(100000)];
+
+    static uint8_t origins[(100000)];
+
+    uint8_t const types[] = { TYPE_INSTR, TYPE_READ, TYPE_WRITE };
+
+
+
+    writer = L2Stream_CreateWriter("build/test/test_L2Stream.bin", &l1_config);
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(136))));};
+
+
+
+
+
+    uint32_t state = 42;
+
+    uint32_t i;
+
+    for (i = 0; i < (100000); i++) {
+
+        state = state * 1103515245 + 12345;
+
+        origins[i] = types[(state >> 28) % 3];
+
+        accesses[i].type = (state >> 27) & 1 ? TYPE_WRITE : TYPE_READ;
+
+        accesses[i].n_bytes = (32);
+
+        accesses[i].address = (state >> 26) & 1 ?
+
+                              (uint64_t) state << 20 :
+
+                              0x7fff0000 + ((state >> 8) & 0xff) * (32) + (state & 3) * 4;
+
+
+
+        L2Stream_SetOrigin(writer, origins[i]);
+
+        L2Stream_Record(writer, &accesses[i], 0);
+
+    }
+
+
+
+    stats_t stats;
+
+    Statistics_Create(&stats);
+
+    L2Stream_Finish(writer, &stats);
+
+    L2Stream_DestroyWriter(writer);
+
+    writer = 
+
+            ((void *)0)
+
+                ;
+
+
+
+    reader = L2Stream_CreateReader("build/test/test_L2Stream.bin");
+
+    if ((((reader)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(161))));};
+
+
+
+    uint32_t n_read = 0;
+
+    while (
+
+          1
+
+              ) {
+
+        access_t batch[(777)];
+
+        uint8_t batch_origins[(777)];
+
+        uint32_t n = L2Stream_Read(reader, batch, batch_origins, (777));
+
+        if (n == 0) {
+
+            break;
+
+        }
+
+
+
+        if ((n_read + n <= (100000))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(172)));};
+
+        for (i = 0; i < n; i++) {
+
+            UnityAssertEqualNumber((_U_SINT)(_US8 )((accesses[n_read + i].type)), (_U_SINT)(_US8 )((batch[i].type)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(174), UNITY_DISPLAY_STYLE_HEX8);
+
+            UnityAssertEqualNumber((_U_SINT)((accesses[n_read + i].address)), (_U_SINT)((batch[i].address)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(175), UNITY_DISPLAY_STYLE_HEX64);
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)(((32))), (_U_SINT)(_UU32)((batch[i].n_bytes)), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(176), UNITY_DISPLAY_STYLE_UINT32);
+
+            UnityAssertEqualNumber((_U_SINT)(_US8 )((origins[n_read + i])), (_U_SINT)(_US8 )((batch_origins[i])), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(177), UNITY_DISPLAY_STYLE_HEX8);
+
+        }
+
+        n_read += n;
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((100000))), (_U_SINT)(_UU32)((n_read)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(181), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_L2Stream_ReadStats_should_LeaveOut_CyclesSpentInL2(void)
+
+{
+
+    writer = L2Stream_CreateWriter("build/test/test_L2Stream.bin", &l1_config);
+
+    if ((((writer)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(187))));};
+
+
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = (32) };
+
+    L2Stream_SetOrigin(writer, TYPE_INSTR);
+
+    L2Stream_Record(writer, &access, 40);
+
+    L2Stream_SetOrigin(writer, TYPE_WRITE);
+
+    L2Stream_Record(writer, &access, 50);
+
+    access.type = TYPE_WRITE;
+
+    L2Stream_Record(writer, &access, 60);
+
+
+
+    stats_t stats;
+
+    Statistics_Create(&stats);
+
+    Statistics_RecordAccess(&stats, TYPE_INSTR, 42, 1);
+
+    Statistics_RecordAccess(&stats, TYPE_WRITE, 112, 2);
+
+    Statistics_RecordAccess(&stats, TYPE_READ, 1, 1);
+
+    stats.l1i.miss_count = 1;
+
+    stats.l1d.hit_count = 1;
+
+    stats.l1d.miss_count = 1;
+
+    stats.l1d.dirty_kickouts = 1;
+
+    L2Stream_Finish(writer, &stats);
+
+    L2Stream_DestroyWriter(writer);
+
+    writer = 
+
+            ((void *)0)
+
+                ;
+
+
+
+    reader = L2Stream_CreateReader("build/test/test_L2Stream.bin");
+
+    if ((((reader)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(211))));};
+
+    UnityAssertEqualMemory(( const void*)((&l1_config)), ( const void*)((L2Stream_Config(reader))), (_UU32)((sizeof(l1_config))), 1, (
+
+   ((void *)0)
+
+   ), (_U_UINT)(212));
+
+
+
+    stats_t replayed;
+
+    Statistics_Create(&replayed);
+
+    L2Stream_ReadStats(reader, &replayed);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(218), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((replayed.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(219), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(220), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((replayed.write_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(221), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((replayed.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(222), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(223), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(224), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.l1i.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(225), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(226), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((replayed.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(227), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((replayed.l2.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(228), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualString((const char*)((stats.l1d.name)), (const char*)((replayed.l1d.name)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(229));
+
+}
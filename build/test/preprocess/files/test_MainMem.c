@@ -0,0 +1,182 @@
+#include "ConfigDefaults.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "Config.h"
+#include "Access.h"
+#include "MainMem.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+static config_t config;
+
+static main_mem_t main_mem;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    SetDefaultConfigValues(&config);
+
+
+
+    main_mem = MainMem_Create(&(config.main_mem));
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    MainMem_Destroy(main_mem);
+
+}
+
+
+
+void test_AlignedBusWidthAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_WRITE,
+
+        .address = 0x08004580,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    if (((access.address % config.main_mem.chunk_size_bytes == 0) && (access.n_bytes == config.main_mem.chunk_size_bytes))) {} else {UnityFail( ((("Test parameters need attention"))), (_U_UINT)((_U_UINT)(60)));}
+
+
+
+                                                          ;
+
+
+
+    uint32_t expected_access_cycles = config.main_mem.send_address_cycles +
+
+                                      config.main_mem.ready_cycles +
+
+                                      config.main_mem.send_chunk_cycles;
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((MainMem_Access(main_mem, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(68), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_LargeAccess(void)
+
+{
+
+    access_t access = {
+
+        .type = TYPE_INSTR,
+
+        .address = 0x08004580,
+
+        .n_bytes = 64,
+
+    };
+
+
+
+    if (((access.address % config.main_mem.chunk_size_bytes == 0) && (access.n_bytes > config.main_mem.chunk_size_bytes))) {} else {UnityFail( ((("Test parameters need attention"))), (_U_UINT)((_U_UINT)(79)));}
+
+
+
+                                                          ;
+
+
+
+    uint32_t expected_access_cycles = config.main_mem.send_address_cycles +
+
+                                      config.main_mem.ready_cycles +
+
+                                      (8 * config.main_mem.send_chunk_cycles);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((expected_access_cycles)), (_U_SINT)(_UU32)((MainMem_Access(main_mem, &access))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(87), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_AccessTypeDoesntMatter(void)
+
+{
+
+    access_t access = {
+
+        .address = 0x08004580,
+
+        .n_bytes = 8,
+
+    };
+
+
+
+    access.type = TYPE_INSTR;
+
+    uint32_t instruction_access_time = MainMem_Access(main_mem, &access);
+
+    access.type = TYPE_READ;
+
+    uint32_t read_access_time = MainMem_Access(main_mem, &access);
+
+    access.type = TYPE_WRITE;
+
+    uint32_t write_access_time = MainMem_Access(main_mem, &access);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((instruction_access_time)), (_U_SINT)(_UU32)((read_access_time)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(104), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((instruction_access_time)), (_U_SINT)(_UU32)((write_access_time)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(105), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((read_access_time)), (_U_SINT)(_UU32)((write_access_time)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_UINT32);
+
+}
@@ -0,0 +1,988 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "unity.h"
+#include "Statistics.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static stats_t stats;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    Statistics_Create(&stats);
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_Statistics_Create_should_InitializeAllStatFields(void)
+
+{
+
+    memset(&stats, 0xFF, sizeof(stats));
+
+
+
+    Statistics_Create(&stats);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(49), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(50), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(51), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(52), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(53), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(54), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(55), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(56), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(57), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualString((const char*)(("L1i")), (const char*)((stats.l1i.name)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(59));
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(60), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(61), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(62), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(63), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(64), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(65), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualString((const char*)(("L1d")), (const char*)((stats.l1d.name)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(67));
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(68), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(69), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(70), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(71), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(72), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(73), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualString((const char*)(("L2")), (const char*)((stats.l2.name)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(75));
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(76), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(77), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(78), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(79), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(80), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(81), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordAccess_should_RecordReadAccess(void)
+
+{
+
+    uint32_t cycles = 38;
+
+    Statistics_RecordAccess(&stats, TYPE_READ, cycles, 1);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(89), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.read_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(90), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(91), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(93), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(94), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(95), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(96), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordAccess_should_RecordWriteAccess(void)
+
+{
+
+    uint32_t cycles = 21;
+
+    Statistics_RecordAccess(&stats, TYPE_WRITE, cycles, 1);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(104), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.write_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(105), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(106), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(108), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(109), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(110), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(111), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordAccess_should_RecordInstructionAccess(void)
+
+{
+
+    uint32_t cycles = 111;
+
+    Statistics_RecordAccess(&stats, TYPE_INSTR, cycles, 1);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(119), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.instr_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(120), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(121), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(123), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(124), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(125), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(126), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordAccess_should_RecordMisalignedAccess(void)
+
+{
+
+    uint8_t type;
+
+    uint32_t cycles;
+
+    uint32_t n_aligned;
+
+
+
+    type = TYPE_READ;
+
+    cycles = 38;
+
+    n_aligned = 2;
+
+    Statistics_RecordAccess(&stats, type, cycles, n_aligned);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(140), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((n_aligned)), (_U_SINT)((stats.read_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(141), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(142), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    type = TYPE_WRITE;
+
+    cycles = 118;
+
+    n_aligned = 3;
+
+    Statistics_RecordAccess(&stats, type, cycles, n_aligned);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(149), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((n_aligned)), (_U_SINT)((stats.write_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(150), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(151), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    type = TYPE_INSTR;
+
+    cycles = 21;
+
+    n_aligned = 2;
+
+    Statistics_RecordAccess(&stats, type, cycles, n_aligned);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(158), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((n_aligned)), (_U_SINT)((stats.instr_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(159), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(160), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordAccess_should_RecordMultipleAccesses(void)
+
+{
+
+    uint32_t cycles = 38;
+
+    Statistics_RecordAccess(&stats, TYPE_READ, cycles, 1);
+
+    Statistics_RecordAccess(&stats, TYPE_READ, cycles, 2);
+
+    Statistics_RecordAccess(&stats, TYPE_READ, cycles, 2);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((stats.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(170), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)((stats.read_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(171), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((cycles*3)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(172), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCycles_should_AddCyclesWithoutCountingAccesses(void)
+
+{
+
+    Statistics_RecordAccess(&stats, TYPE_WRITE, 21, 1);
+
+    Statistics_RecordCycles(&stats, TYPE_WRITE, 100);
+
+    Statistics_RecordCycles(&stats, TYPE_INSTR, 7);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(181), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((121)), (_U_SINT)((stats.write_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(182), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(183), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((stats.instr_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(184), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.read_cycles)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(185), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_RecordCacheHit(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(192), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(193), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(194), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(195), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(196), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(197), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheHits_should_RecordOnlyHits(void)
+
+{
+
+    Statistics_RecordCacheHits(&(stats.l1d), 7);
+
+    Statistics_RecordCacheHits(&(stats.l1d), 0);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((7)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(205), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(206), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(207), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(208), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(209), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(210), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_RecordVictimCacheHit(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT_VICTIM_CACHE);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(217), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(218), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(219), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(220), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(221), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(222), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_RecordCacheMiss(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l1i), RESULT_MISS);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(229), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1i.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(230), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(231), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(232), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1i.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(233), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1i.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(234), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_RecordCacheKickout(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l2), RESULT_MISS_KICKOUT);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(241), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l2.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(242), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l2.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(243), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(244), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l2.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(245), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l2.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(246), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_RecordCacheDirtyyKickout(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_MISS_DIRTY_KICKOUT);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(253), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(254), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(255), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(256), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(257), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(258), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_Statistics_RecordCacheAccess_should_IncrementForMultipleAccesses(void)
+
+{
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT);
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT);
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(267), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(268), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(269), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(270), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(271), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(272), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_MISS_DIRTY_KICKOUT);
+
+    Statistics_RecordCacheAccess(&(stats.l1d), RESULT_MISS_DIRTY_KICKOUT);
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((stats.l1d.hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(277), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((stats.l1d.miss_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(278), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((stats.l1d.kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(279), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((stats.l1d.dirty_kickouts)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(280), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((stats.l1d.transfers)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(281), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((stats.l1d.vc_hit_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(282), UNITY_DISPLAY_STYLE_UINT64);
+
+}
@@ -0,0 +1,264 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "TagSearch.h"
+#include "unity.h"
+
+
+
+
+static uint64_t addresses[(2 * (8))];
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 0; i < (2 * (8)); i++) {
+
+        addresses[i] = 0x1000 + 0x40 * i;
+
+    }
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_TagSearch_Get_should_AlwaysProvideScalarAndBest(void)
+
+{
+
+    if ((((TagSearch_Get(TAG_SEARCH_SCALAR))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(53))));};
+
+    if ((((TagSearch_Get(TagSearch_BestLevel()))) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(54))));};
+
+    if ((((TagSearch_Get(TAG_SEARCH_N_LEVELS))) == 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(55))));};
+
+}
+
+
+
+void test_TagSearch_should_FindEveryPosition(void)
+
+{
+
+    tag_search_level_t level;
+
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+
+        tag_search_t search = TagSearch_Get(level);
+
+        if (search == 
+
+                     ((void *)0)
+
+                         ) {
+
+            continue;
+
+        }
+
+
+
+        uint32_t i;
+
+        for (i = 0; i < (2 * (8)); i++) {
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)((i)), (_U_SINT)(_UU32)((search(addresses, (2 * (8)), addresses[i]))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(69), UNITY_DISPLAY_STYLE_UINT32);
+
+        }
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)(((
+
+       (4294967295U)
+
+       ))), (_U_SINT)(_UU32)((search(addresses, (2 * (8)), 0x40))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(71), UNITY_DISPLAY_STYLE_UINT32);
+
+        UnityAssertEqualNumber((_U_SINT)(_UU32)(((
+
+       (4294967295U)
+
+       ))), (_U_SINT)(_UU32)((search(addresses, 0, addresses[0]))), (
+
+       ((void *)0)
+
+       ), (_U_UINT)(72), UNITY_DISPLAY_STYLE_UINT32);
+
+    }
+
+}
+
+
+
+void test_TagSearch_should_ReturnFirstMatch(void)
+
+{
+
+    addresses[3] = addresses[11];
+
+    addresses[(8) + 5] = addresses[11];
+
+
+
+    tag_search_level_t level;
+
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+
+        tag_search_t search = TagSearch_Get(level);
+
+        if (search != 
+
+                     ((void *)0)
+
+                         ) {
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((search(addresses, (2 * (8)), addresses[11]))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(85), UNITY_DISPLAY_STYLE_UINT32);
+
+        }
+
+    }
+
+}
+
+
+
+void test_TagSearch_should_CompareWholeAddress(void)
+
+{
+
+
+
+    addresses[2] = 0x0000000100001000;
+
+    addresses[5] = 0x0000000200001000;
+
+    uint64_t address = 0x0000000300001000;
+
+
+
+    tag_search_level_t level;
+
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+
+        tag_search_t search = TagSearch_Get(level);
+
+        if (search != 
+
+                     ((void *)0)
+
+                         ) {
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)(((
+
+           (4294967295U)
+
+           ))), (_U_SINT)(_UU32)((search(addresses, (2 * (8)), address))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(101), UNITY_DISPLAY_STYLE_UINT32);
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)((5)), (_U_SINT)(_UU32)((search(addresses, (2 * (8)), addresses[5]))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(102), UNITY_DISPLAY_STYLE_UINT32);
+
+        }
+
+    }
+
+}
+
+
+
+void test_TagSearch_should_SearchPartialGroup_when_RestIsEmpty(void)
+
+{
+
+    uint32_t i;
+
+    for (i = 3; i < (2 * (8)); i++) {
+
+        addresses[i] = (
+
+                      (18446744073709551615UL)
+
+                      );
+
+    }
+
+
+
+    tag_search_level_t level;
+
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+
+        tag_search_t search = TagSearch_Get(level);
+
+        if (search != 
+
+                     ((void *)0)
+
+                         ) {
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((search(addresses, 3, addresses[2]))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(118), UNITY_DISPLAY_STYLE_UINT32);
+
+            UnityAssertEqualNumber((_U_SINT)(_UU32)(((
+
+           (4294967295U)
+
+           ))), (_U_SINT)(_UU32)((search(addresses, 3, 0x1000 + 0x40 * 4))), (
+
+           ((void *)0)
+
+           ), (_U_UINT)(119), UNITY_DISPLAY_STYLE_UINT32);
+
+        }
+
+    }
+
+}
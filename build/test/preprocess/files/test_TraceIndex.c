@@ -0,0 +1,556 @@
+#include "test_utilities.h"
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "TraceReader.h"
+#include "GzipStream.h"
+#include "DeltaTrace.h"
+#include "BlockTrace.h"
+#include "BlockStream.h"
+#include "BinaryTrace.h"
+#include "Access.h"
+#include "unity_Helper.h"
+#include "TraceIndex.h"
+#include "unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static uint32_t read_through(trace_reader_t reader, trace_index_t index, access_t * accesses);
+
+
+
+
+
+static void remove_index(void);
+
+
+
+
+
+
+
+
+
+static trace_index_t trace_index;
+
+static trace_reader_t reader;
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+    remove_index();
+
+    trace_index = 
+
+                 ((void *)0)
+
+                     ;
+
+    reader = 
+
+                 ((void *)0)
+
+                     ;
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+    TraceIndex_Destroy(trace_index);
+
+    TraceReader_Destroy(reader);
+
+    remove_index();
+
+    remove("build/test/test_TraceIndex.bin");
+
+}
+
+
+
+void test_TraceIndex_Create_should_ThrowException_when_IntervalIsZero(void)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", 0);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((ARGUMENT_ERROR)), (_U_SINT)(_US32)((e)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(99), UNITY_DISPLAY_STYLE_HEX32);
+
+}
+
+
+
+void test_TraceIndex_Create_should_BeInactive_when_TraceIsBinary(void)
+
+{
+
+    FILE * file = fopen("build/test/test_TraceIndex.bin", "wb");
+
+    if ((((file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(105))));};
+
+    BinaryTrace_WriteHeader(file, 0);
+
+    fclose(file);
+
+
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "build/test/test_TraceIndex.bin", (8));
+
+    if ((((trace_index)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (_U_UINT)((_U_UINT)((_U_UINT)(110))));};
+
+    if (!(TraceIndex_Active(trace_index))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (_U_UINT)((_U_UINT)(111)));};
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1000)), (_U_SINT)(_UU32)((TraceIndex_Limit(trace_index, 1000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(112), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    trace_checkpoint_t checkpoint;
+
+    TraceIndex_Seek(trace_index, 20, &checkpoint);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((checkpoint.record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(116), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((checkpoint.offset)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(117), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_TraceIndex_Limit_should_StopReadsAtNextCheckpoint(void)
+
+{
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", (8));
+
+    if ((TraceIndex_Active(trace_index))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(123)));};
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((8))), (_U_SINT)(_UU32)((TraceIndex_Limit(trace_index, 1000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(124), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    access_t accesses[(50)];
+
+    reader = TraceReader_Create("traces/traces-short/tr3", 
+
+                                           0
+
+                                                );
+
+    uint32_t n_read = TraceReader_Read(reader, accesses, 3);
+
+    TraceIndex_Record(trace_index, accesses, n_read, TraceReader_Offset(reader));
+
+
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((8) - 3)), (_U_SINT)(_UU32)((TraceIndex_Limit(trace_index, 1000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(131), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((TraceIndex_Limit(trace_index, 2))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(132), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_TraceIndex_Record_should_AddCheckpointEveryInterval(void)
+
+{
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", (8));
+
+    reader = TraceReader_Create("traces/traces-short/tr3", 
+
+                                           0
+
+                                                );
+
+
+
+    access_t accesses[(50)];
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((50))), (_U_SINT)(_UU32)((read_through(reader, trace_index, accesses))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(141), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)((1 + (50) / (8))), (_U_SINT)((TraceIndex_Checkpoints(trace_index))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(142), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+
+
+    trace_checkpoint_t expected;
+
+    memset(&expected, 0, sizeof(expected));
+
+    uint32_t i;
+
+    for (i = 0; i < 3 * (8); i++) {
+
+        access_t aligned;
+
+        Access_Align(&aligned, &accesses[i], 4);
+
+        if (accesses[i].type == TYPE_READ) {
+
+            expected.read_count++;
+
+            expected.read_count_aligned += aligned.n_bytes >> 2;
+
+        }
+
+        else if (accesses[i].type == TYPE_WRITE) {
+
+            expected.write_count++;
+
+            expected.write_count_aligned += aligned.n_bytes >> 2;
+
+        }
+
+        else {
+
+            expected.instr_count++;
+
+            expected.instr_count_aligned += aligned.n_bytes >> 2;
+
+        }
+
+    }
+
+
+
+    trace_checkpoint_t checkpoint;
+
+    TraceIndex_Seek(trace_index, 3 * (8) + 1, &checkpoint);
+
+    UnityAssertEqualNumber((_U_SINT)((3 * (8))), (_U_SINT)((checkpoint.record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(167), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.read_count)), (_U_SINT)((checkpoint.read_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(168), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.read_count_aligned)), (_U_SINT)((checkpoint.read_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(169), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.write_count)), (_U_SINT)((checkpoint.write_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(170), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.write_count_aligned)), (_U_SINT)((checkpoint.write_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(171), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.instr_count)), (_U_SINT)((checkpoint.instr_count)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(172), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((_U_SINT)((expected.instr_count_aligned)), (_U_SINT)((checkpoint.instr_count_aligned)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(173), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void test_TraceIndex_Seek_should_FindLineInSavedIndex(void)
+
+{
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", (8));
+
+    reader = TraceReader_Create("traces/traces-short/tr3", 
+
+                                           0
+
+                                                );
+
+
+
+    access_t expected[(50)];
+
+    read_through(reader, trace_index, expected);
+
+    if ((TraceIndex_Save(trace_index))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(183)));};
+
+    TraceIndex_Destroy(trace_index);
+
+    TraceReader_Destroy(reader);
+
+
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", (8));
+
+    UnityAssertEqualNumber((_U_SINT)((1 + (50) / (8))), (_U_SINT)((TraceIndex_Checkpoints(trace_index))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(188), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    trace_checkpoint_t checkpoint;
+
+    TraceIndex_Seek(trace_index, 2 * (8) + 3, &checkpoint);
+
+    UnityAssertEqualNumber((_U_SINT)((2 * (8))), (_U_SINT)((checkpoint.record)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(192), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    reader = TraceReader_Create("traces/traces-short/tr3", 
+
+                                           0
+
+                                                );
+
+    TraceReader_Seek(reader, checkpoint.offset, checkpoint.record);
+
+
+
+    access_t actual[(50)];
+
+    uint32_t n_actual = read_through(reader, trace_index, actual);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)(((50) - 2 * (8))), (_U_SINT)(_UU32)((n_actual)), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(199), UNITY_DISPLAY_STYLE_UINT32);
+
+    uint32_t i;
+
+    for (i = 0; i < n_actual; i++) {
+
+        AssertEqual_access_t(expected[2 * (8) + i], actual[i], 202, 
+
+       ((void *)0)
+
+       );
+
+    }
+
+}
+
+
+
+void test_TraceIndex_Create_should_IgnoreSidecar_when_IntervalDiffers(void)
+
+{
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", (8));
+
+    reader = TraceReader_Create("traces/traces-short/tr3", 
+
+                                           0
+
+                                                );
+
+
+
+    access_t accesses[(50)];
+
+    read_through(reader, trace_index, accesses);
+
+    if ((TraceIndex_Save(trace_index))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(213)));};
+
+    TraceIndex_Destroy(trace_index);
+
+
+
+    trace_index = TraceIndex_Create("build/test/test_TraceIndex", "traces/traces-short/tr3", 2 * (8));
+
+    if ((TraceIndex_Active(trace_index))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (_U_UINT)((_U_UINT)(217)));};
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((TraceIndex_Checkpoints(trace_index))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(218), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+
+
+
+
+static uint32_t read_through(trace_reader_t reader, trace_index_t index, access_t * accesses)
+
+{
+
+    uint32_t n_total = 0;
+
+    uint32_t n_read;
+
+    do {
+
+        uint32_t n_wanted = TraceIndex_Limit(index, (5));
+
+        n_read = TraceReader_Read(reader, &accesses[n_total], n_wanted);
+
+        TraceIndex_Record(index, &accesses[n_total], n_read, TraceReader_Offset(reader));
+
+        n_total += n_read;
+
+    } while (n_read > 0);
+
+
+
+    return n_total;
+
+}
+
+
+
+static void remove_index(void)
+
+{
+
+    DIR * dir = opendir("build/test/test_TraceIndex");
+
+    if (dir == 
+
+              ((void *)0)
+
+                  ) {
+
+        return;
+
+    }
+
+
+
+    struct dirent * entry;
+
+    while ((entry = readdir(dir)) != 
+
+                                    ((void *)0)
+
+                                        ) {
+
+        char path[512];
+
+        snprintf(path, sizeof(path), "%s/%s", "build/test/test_TraceIndex", entry->d_name);
+
+        if (entry->d_name[0] != '.') {
+
+            unlink(path);
+
+        }
+
+    }
+
+    closedir(dir);
+
+    rmdir("build/test/test_TraceIndex");
+
+}
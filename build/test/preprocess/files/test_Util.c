@@ -0,0 +1,578 @@
+#include "ExceptionTypes.h"
+#include "CExceptionConfig.h"
+#include "CException.h"
+#include "Util.h"
+#include "unity.h"
+
+
+
+
+
+
+static void AlignmentMask_ShouldThrowExceptionWithInput(volatile unsigned int expected_e,
+
+                                                        uint32_t block_size,
+
+                                                        const char * message);
+
+
+
+
+
+
+
+
+
+
+
+void setUp(void)
+
+{
+
+}
+
+
+
+void tearDown(void)
+
+{
+
+}
+
+
+
+void test_ArrayElementsChar(void)
+
+{
+
+    char arr1[1];
+
+    char arr5[5];
+
+    char arr1024[1024];
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)(((sizeof(arr1)/sizeof((arr1)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(50), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)(((sizeof(arr5)/sizeof((arr5)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(51), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((1024)), (_U_SINT)(((sizeof(arr1024)/sizeof((arr1024)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(52), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ArrayElementsInt(void)
+
+{
+
+    int arr1[1];
+
+    int arr5[5];
+
+    int arr1024[1024];
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)(((sizeof(arr1)/sizeof((arr1)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(61), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)(((sizeof(arr5)/sizeof((arr5)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(62), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((1024)), (_U_SINT)(((sizeof(arr1024)/sizeof((arr1024)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(63), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ArrayElementsDouble(void)
+
+{
+
+    double arr1[1];
+
+    double arr5[5];
+
+    double arr1024[1024];
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)(((sizeof(arr1)/sizeof((arr1)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(72), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)(((sizeof(arr5)/sizeof((arr5)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(73), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((1024)), (_U_SINT)(((sizeof(arr1024)/sizeof((arr1024)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(74), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ArrayElementsPointer(void)
+
+{
+
+    void * arr1[1];
+
+    void * arr5[5];
+
+    void * arr1024[1024];
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)(((sizeof(arr1)/sizeof((arr1)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(83), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)(((sizeof(arr5)/sizeof((arr5)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(84), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((1024)), (_U_SINT)(((sizeof(arr1024)/sizeof((arr1024)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(85), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_ArrayElementsStruct(void)
+
+{
+
+    struct DummyStruct{
+
+        int x;
+
+        double y;
+
+        void * next;
+
+    };
+
+
+
+    struct DummyStruct arr1[1];
+
+    struct DummyStruct arr5[5];
+
+    struct DummyStruct arr1024[1024];
+
+
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)(((sizeof(arr1)/sizeof((arr1)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(100), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)(((sizeof(arr5)/sizeof((arr5)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(101), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((1024)), (_U_SINT)(((sizeof(arr1024)/sizeof((arr1024)[0])))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(102), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_PowersOfTwo(void)
+
+{
+
+    if ((( ((1) != 0) && ((1) & ((1) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(107)));};
+
+    if ((( ((2) != 0) && ((2) & ((2) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(108)));};
+
+    if ((( ((4) != 0) && ((4) & ((4) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(109)));};
+
+    if ((( ((1024) != 0) && ((1024) & ((1024) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(110)));};
+
+    if ((( ((32768) != 0) && ((32768) & ((32768) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(111)));};
+
+    if ((( ((1 << 30) != 0) && ((1 << 30) & ((1 << 30) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(112)));};
+
+}
+
+
+
+void test_NotPowersOfTwo(void)
+
+{
+
+    if ((!( ((0) != 0) && ((0) & ((0) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(117)));};
+
+    if ((!( ((3) != 0) && ((3) & ((3) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(118)));};
+
+    if ((!( ((12) != 0) && ((12) & ((12) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(119)));};
+
+    if ((!( ((33) != 0) && ((33) & ((33) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(120)));};
+
+    if ((!( ((32767) != 0) && ((32767) & ((32767) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(121)));};
+
+    if ((!( (((1 << 30) + 1) != 0) && (((1 << 30) + 1) & (((1 << 30) + 1) - 1)) == 0 ))) {} else {UnityFail( ((" Expression Evaluated To FALSE")), (_U_UINT)((_U_UINT)(122)));};
+
+}
+
+
+
+void test_CeilDivide_should_BeRegularDivision_when_DivisorIsDivisible(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)((1)), (_U_SINT)((( (3) == 0 ? 0 : ( 1 + ( ( (3) - 1 ) / (3) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(127), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((( (24) == 0 ? 0 : ( 1 + ( ( (24) - 1 ) / (12) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(128), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((5)), (_U_SINT)((( (5) == 0 ? 0 : ( 1 + ( ( (5) - 1 ) / (1) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(129), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((321)), (_U_SINT)((( (642) == 0 ? 0 : ( 1 + ( ( (642) - 1 ) / (2) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(130), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CeilDivide_should_ReturnZero_when_DividentIsZero(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((( (0) == 0 ? 0 : ( 1 + ( ( (0) - 1 ) / (1) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(135), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((( (0) == 0 ? 0 : ( 1 + ( ( (0) - 1 ) / (12) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(136), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((( (0) == 0 ? 0 : ( 1 + ( ( (0) - 1 ) / (0x7fffffff) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(137), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_CeilDivide_should_RoundUp_when_DivisorIsNotDivisible(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)((2)), (_U_SINT)((( (4) == 0 ? 0 : ( 1 + ( ( (4) - 1 ) / (3) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(142), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((( (25) == 0 ? 0 : ( 1 + ( ( (25) - 1 ) / (12) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(143), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((3)), (_U_SINT)((( (35) == 0 ? 0 : ( 1 + ( ( (35) - 1 ) / (12) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((( (37) == 0 ? 0 : ( 1 + ( ( (37) - 1 ) / (12) ) ) ))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(145), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_HighestBitSet_should_ReturnZero_when_PassedZero(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((HighestBitSet(0))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(150), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_HighestBitSet_should_ReturnOnlySetBit_when_PassedPowerOf2(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((0)), (_U_SINT)(_UU32)((HighestBitSet(0x01))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(155), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((HighestBitSet(0x02))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(156), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((HighestBitSet(0x04))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(157), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((4)), (_U_SINT)(_UU32)((HighestBitSet(0x10))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(158), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((63)), (_U_SINT)(_UU32)((HighestBitSet(0x8000000000000000))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(159), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_HighestBitSet_should_ReturnHighestSetBit_when_PassedNonPowerOf2(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((1)), (_U_SINT)(_UU32)((HighestBitSet(0x03))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(164), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((2)), (_U_SINT)(_UU32)((HighestBitSet(0x05))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(165), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((3)), (_U_SINT)(_UU32)((HighestBitSet(0x0F))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(166), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((5)), (_U_SINT)(_UU32)((HighestBitSet(0x21))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(167), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((_U_SINT)(_UU32)((63)), (_U_SINT)(_UU32)((HighestBitSet(0x8000143235990345))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(168), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void test_HighestBitSet_should_ZeroExtend32BitValue(void)
+
+{
+
+    uint32_t val;
+
+    val = 0;
+
+    UnityAssertEqualNumber((_U_SINT)((0)), (_U_SINT)((HighestBitSet(val))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(175), UNITY_DISPLAY_STYLE_INT);
+
+    val = 0x10;
+
+    UnityAssertEqualNumber((_U_SINT)((4)), (_U_SINT)((HighestBitSet(val))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(177), UNITY_DISPLAY_STYLE_INT);
+
+    val = 0x80000000;
+
+    UnityAssertEqualNumber((_U_SINT)((31)), (_U_SINT)((HighestBitSet(val))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(179), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void test_AlignmentMask_should_CalculateMask_when_BlockSizeIsAPowerOfTwo(void)
+
+{
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFFF)), (_U_SINT)((AlignmentMask(1))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(184), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFFE)), (_U_SINT)((AlignmentMask(2))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(185), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFFC)), (_U_SINT)((AlignmentMask(4))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(186), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFF8)), (_U_SINT)((AlignmentMask(8))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(187), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFF0)), (_U_SINT)((AlignmentMask(16))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(188), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFFFFFFFFC0)), (_U_SINT)((AlignmentMask(64))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(189), UNITY_DISPLAY_STYLE_HEX64);
+
+    UnityAssertEqualNumber((_U_SINT)((0xFFFFFFFF80000000)), (_U_SINT)((AlignmentMask(1U << 31))), (
+
+   ((void *)0)
+
+   ), (_U_UINT)(190), UNITY_DISPLAY_STYLE_HEX64);
+
+}
+
+
+
+void test_AlignmentMask_should_ThrowException_when_BlockSizeIsNotAPowerOfTwo(void)
+
+{
+
+    AlignmentMask_ShouldThrowExceptionWithInput(ARGUMENT_ERROR, 0, "Failed to catch non-power-of-two block size");
+
+    AlignmentMask_ShouldThrowExceptionWithInput(ARGUMENT_ERROR, 3, "Failed to catch non-power-of-two block size");
+
+    AlignmentMask_ShouldThrowExceptionWithInput(ARGUMENT_ERROR, 5, "Failed to catch non-power-of-two block size");
+
+    AlignmentMask_ShouldThrowExceptionWithInput(ARGUMENT_ERROR, 7, "Failed to catch non-power-of-two block size");
+
+    AlignmentMask_ShouldThrowExceptionWithInput(ARGUMENT_ERROR, (1U << 31) + 1, "Failed to catch non-power-of-two block size");
+
+}
+
+
+
+
+
+
+
+static void AlignmentMask_ShouldThrowExceptionWithInput(volatile unsigned int expected_e, uint32_t block_size, const char * message)
+
+{
+
+    volatile unsigned int e = (0x5A5A5A5A);
+
+    { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (exception_thread_id); PrevFrame = CExceptionFrames[(exception_thread_id)].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) {
+
+        AlignmentMask(block_size);
+
+    }
+
+    else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); } else { e = CExceptionFrames[MY_ID].Exception; e=e; } CExceptionFrames[MY_ID].pFrame = PrevFrame; } if (CExceptionFrames[(exception_thread_id)].Exception != (0x5A5A5A5A)) {
+
+    }
+
+    UnityAssertEqualNumber((_U_SINT)(_US32)((expected_e)), (_U_SINT)(_US32)((e)), ((message)), (_U_UINT)(212), UNITY_DISPLAY_STYLE_HEX32);
+
+}
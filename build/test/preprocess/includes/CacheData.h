@@ -0,0 +1,2 @@
+---
+- Access.h
@@ -0,0 +1,7 @@
+---
+- Access.h
+- Config.h
+- L2Stream.h
+- MainMem.h
+- StackDistance.h
+- Statistics.h
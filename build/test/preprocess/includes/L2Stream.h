@@ -0,0 +1,4 @@
+---
+- Access.h
+- Config.h
+- Statistics.h
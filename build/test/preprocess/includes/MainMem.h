@@ -0,0 +1,3 @@
+---
+- Access.h
+- Config.h
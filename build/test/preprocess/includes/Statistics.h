@@ -0,0 +1,3 @@
+---
+- Access.h
+- CacheData.h
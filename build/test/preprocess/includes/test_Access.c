@@ -0,0 +1,9 @@
+---
+- unity.h
+- Access.h
+- unity_Helper.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
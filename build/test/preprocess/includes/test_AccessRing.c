@@ -0,0 +1,9 @@
+---
+- unity.h
+- AccessRing.h
+- Access.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
@@ -0,0 +1,10 @@
+---
+- unity.h
+- BinaryTrace.h
+- unity_Helper.h
+- Access.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
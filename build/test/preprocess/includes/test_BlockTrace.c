@@ -0,0 +1,11 @@
+---
+- unity.h
+- BlockTrace.h
+- unity_Helper.h
+- Access.h
+- BinaryTrace.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
@@ -0,0 +1,9 @@
+---
+- CacheData.h
+- unity.h
+- Access.h
+- TagSearch.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,8 @@
+---
+- CacheData.h
+- unity.h
+- TagSearch.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
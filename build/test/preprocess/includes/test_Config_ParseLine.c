@@ -0,0 +1,9 @@
+---
+- unity.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- Config.h
+- ConfigDefaults.h
+- test_utilities.h
+- unity_Helper.h
@@ -0,0 +1,10 @@
+---
+- unity.h
+- DeltaTrace.h
+- unity_Helper.h
+- Access.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
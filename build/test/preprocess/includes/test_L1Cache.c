@@ -0,0 +1,15 @@
+---
+- unity.h
+- L1Cache.h
+- Access.h
+- CacheInternals.h
+- Config.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- ConfigDefaults.h
+- mock_CacheData.h
+- mock_L2Cache.h
+- mock_StackDistance.h
+- mock_Statistics.h
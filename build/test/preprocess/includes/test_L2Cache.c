@@ -0,0 +1,15 @@
+---
+- unity.h
+- L2Cache.h
+- Access.h
+- CacheInternals.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- ConfigDefaults.h
+- mock_CacheData.h
+- mock_L2Stream.h
+- mock_MainMem.h
+- mock_StackDistance.h
+- mock_Statistics.h
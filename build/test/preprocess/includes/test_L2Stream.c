@@ -0,0 +1,10 @@
+---
+- unity.h
+- L2Stream.h
+- Access.h
+- Config.h
+- Statistics.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,10 @@
+---
+- unity.h
+- MainMem.h
+- Access.h
+- Config.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- ConfigDefaults.h
@@ -0,0 +1,9 @@
+---
+- unity.h
+- StackDistance.h
+- CacheData.h
+- TagSearch.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,6 @@
+---
+- Statistics.h
+- unity.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,6 @@
+---
+- unity.h
+- TagSearch.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,16 @@
+---
+- unity.h
+- TraceCache.h
+- unity_Helper.h
+- Access.h
+- BinaryTrace.h
+- BlockStream.h
+- BlockTrace.h
+- DeltaTrace.h
+- GzipStream.h
+- TraceReader.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
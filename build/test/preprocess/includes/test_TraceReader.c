@@ -0,0 +1,15 @@
+---
+- unity.h
+- TraceReader.h
+- unity_Helper.h
+- Access.h
+- BinaryTrace.h
+- BlockStream.h
+- BlockTrace.h
+- DeltaTrace.h
+- GzipStream.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
+- test_utilities.h
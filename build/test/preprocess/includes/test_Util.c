@@ -0,0 +1,6 @@
+---
+- unity.h
+- Util.h
+- CException.h
+- CExceptionConfig.h
+- ExceptionTypes.h
@@ -0,0 +1,76 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_AccessRing_Create_should_ThrowException_when_LengthIsNotPowerOfTwo(void);
+extern void test_AccessRing_Create_should_ThrowException_when_NoConsumers(void);
+extern void test_AccessRing_should_DeliverBatchesInOrder(void);
+extern void test_AccessRing_should_ReuseBatches_when_Released(void);
+extern void test_AccessRing_Claim_should_ReturnNull_when_Closed(void);
+extern void test_AccessRing_Claim_should_ReturnNull_when_ClosedWhileFull(void);
+extern void test_AccessRing_Acquire_should_ReturnNull_when_ClosedWhileEmpty(void);
+extern void test_AccessRing_Acquire_should_Wake_when_ClosedWhileAsleep(void);
+extern void test_AccessRing_should_PassEveryAccess_between_Threads(void);
+extern void test_AccessRing_Claim_should_WaitForEveryConsumer(void);
+extern void test_AccessRing_should_PassEveryAccess_to_EveryConsumer(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_AccessRing.c");
+  RUN_TEST(test_AccessRing_Create_should_ThrowException_when_LengthIsNotPowerOfTwo, 81);
+  RUN_TEST(test_AccessRing_Create_should_ThrowException_when_NoConsumers, 92);
+  RUN_TEST(test_AccessRing_should_DeliverBatchesInOrder, 103);
+  RUN_TEST(test_AccessRing_should_ReuseBatches_when_Released, 122);
+  RUN_TEST(test_AccessRing_Claim_should_ReturnNull_when_Closed, 138);
+  RUN_TEST(test_AccessRing_Claim_should_ReturnNull_when_ClosedWhileFull, 144);
+  RUN_TEST(test_AccessRing_Acquire_should_ReturnNull_when_ClosedWhileEmpty, 157);
+  RUN_TEST(test_AccessRing_Acquire_should_Wake_when_ClosedWhileAsleep, 169);
+  RUN_TEST(test_AccessRing_should_PassEveryAccess_between_Threads, 184);
+  RUN_TEST(test_AccessRing_Claim_should_WaitForEveryConsumer, 208);
+  RUN_TEST(test_AccessRing_should_PassEveryAccess_to_EveryConsumer, 234);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,92 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_InstrAccess(void);
+extern void test_WriteAccess(void);
+extern void test_ReadAccess(void);
+extern void test_NewlineDoesntMatter(void);
+extern void test_NullPointerThrowsException(void);
+extern void test_InvalidOperationThrowsException(void);
+extern void test_InvalidAccessSizeThrowsException(void);
+extern void test_SyntaxErrorThrowsException(void);
+extern void test_OutOfRangeFieldsThrowException(void);
+extern void test_LeadingZerosDontCountTowardAddressWidth(void);
+extern void test_Access_ParseBuffer_should_ParseEveryCompleteLine(void);
+extern void test_Access_ParseBuffer_should_LeavePartialLine_when_NotFinal(void);
+extern void test_Access_ParseBuffer_should_ParsePartialLine_when_Final(void);
+extern void test_Access_ParseBuffer_should_StopAtMaxAccesses(void);
+extern void test_Access_ParseBuffer_should_ReportOffendingLine_when_LineIsInvalid(void);
+extern void test_Access_Align_should_NotModifyAccess_when_AccessIsAlreadyAligned(void);
+extern void test_Access_Align_should_ExpandToBlockSize_when_AccessIsSmallerThanABlock(void);
+extern void test_Access_Align_should_SetAddressToBlockBeginning_when_AddressIsUnaligned(void);
+extern void test_Access_Align_should_AccessMultipleBlocks_when_AccessSpansMultipleBlocks(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_Access.c");
+  RUN_TEST(test_InstrAccess, 46);
+  RUN_TEST(test_WriteAccess, 62);
+  RUN_TEST(test_ReadAccess, 78);
+  RUN_TEST(test_NewlineDoesntMatter, 94);
+  RUN_TEST(test_NullPointerThrowsException, 110);
+  RUN_TEST(test_InvalidOperationThrowsException, 123);
+  RUN_TEST(test_InvalidAccessSizeThrowsException, 132);
+  RUN_TEST(test_SyntaxErrorThrowsException, 141);
+  RUN_TEST(test_OutOfRangeFieldsThrowException, 158);
+  RUN_TEST(test_LeadingZerosDontCountTowardAddressWidth, 175);
+  RUN_TEST(test_Access_ParseBuffer_should_ParseEveryCompleteLine, 191);
+  RUN_TEST(test_Access_ParseBuffer_should_LeavePartialLine_when_NotFinal, 217);
+  RUN_TEST(test_Access_ParseBuffer_should_ParsePartialLine_when_Final, 232);
+  RUN_TEST(test_Access_ParseBuffer_should_StopAtMaxAccesses, 252);
+  RUN_TEST(test_Access_ParseBuffer_should_ReportOffendingLine_when_LineIsInvalid, 267);
+  RUN_TEST(test_Access_Align_should_NotModifyAccess_when_AccessIsAlreadyAligned, 300);
+  RUN_TEST(test_Access_Align_should_ExpandToBlockSize_when_AccessIsSmallerThanABlock, 317);
+  RUN_TEST(test_Access_Align_should_SetAddressToBlockBeginning_when_AddressIsUnaligned, 337);
+  RUN_TEST(test_Access_Align_should_AccessMultipleBlocks_when_AccessSpansMultipleBlocks, 357);
+
+  return (UnityEnd());
+}
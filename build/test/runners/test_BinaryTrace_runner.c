@@ -0,0 +1,68 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_BinaryTrace_DecodeAccess_should_ReverseEncodeAccess(void);
+extern void test_BinaryTrace_EncodeAccess_should_UseLittleEndianLayout(void);
+extern void test_BinaryTrace_DecodeAccess_should_ThrowException_when_TypeIsInvalid(void);
+extern void test_BinaryTrace_ReadHeader_should_ReturnCountWrittenByWriteHeader(void);
+extern void test_BinaryTrace_ReadHeader_should_ThrowException_when_MagicIsWrong(void);
+extern void test_BinaryTrace_Read_should_ReturnAccessesWrittenByWrite(void);
+extern void test_BinaryTrace_Read_should_ThrowException_when_RecordIsTruncated(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_BinaryTrace.c");
+  RUN_TEST(test_BinaryTrace_DecodeAccess_should_ReverseEncodeAccess, 57);
+  RUN_TEST(test_BinaryTrace_EncodeAccess_should_UseLittleEndianLayout, 73);
+  RUN_TEST(test_BinaryTrace_DecodeAccess_should_ThrowException_when_TypeIsInvalid, 87);
+  RUN_TEST(test_BinaryTrace_ReadHeader_should_ReturnCountWrittenByWriteHeader, 104);
+  RUN_TEST(test_BinaryTrace_ReadHeader_should_ThrowException_when_MagicIsWrong, 117);
+  RUN_TEST(test_BinaryTrace_Read_should_ReturnAccessesWrittenByWrite, 133);
+  RUN_TEST(test_BinaryTrace_Read_should_ThrowException_when_RecordIsTruncated, 153);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,76 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_BlockTrace_IsBlockTrace_should_RecognizeMagic(void);
+extern void test_BlockTrace_IsBlockTrace_should_RejectBinaryTrace(void);
+extern void test_BlockTrace_ReadIndex_should_DescribeEveryBlock(void);
+extern void test_BlockTrace_DecompressBlock_should_RecoverRecords(void);
+extern void test_BlockTrace_DecompressBlock_should_Fail_when_BlockIsCorrupt(void);
+extern void test_BlockTrace_FindBlock_should_FindBlockHoldingRecord(void);
+extern void test_BlockTrace_ReadIndex_should_HandleEmptyTrace(void);
+extern void test_BlockTrace_ReadIndex_should_ThrowException_when_TrailerIsMissing(void);
+extern void test_BlockTrace_CreateWriter_should_ThrowException_when_BlockLenIsZero(void);
+extern void test_BlockTrace_WriteBlock_should_AppendPrecompressedBlock(void);
+extern void test_BlockTrace_WriteBlock_should_ThrowException_when_BlockIsTooLong(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_BlockTrace.c");
+  RUN_TEST(test_BlockTrace_IsBlockTrace_should_RecognizeMagic, 73);
+  RUN_TEST(test_BlockTrace_IsBlockTrace_should_RejectBinaryTrace, 79);
+  RUN_TEST(test_BlockTrace_ReadIndex_should_DescribeEveryBlock, 86);
+  RUN_TEST(test_BlockTrace_DecompressBlock_should_RecoverRecords, 103);
+  RUN_TEST(test_BlockTrace_DecompressBlock_should_Fail_when_BlockIsCorrupt, 125);
+  RUN_TEST(test_BlockTrace_FindBlock_should_FindBlockHoldingRecord, 137);
+  RUN_TEST(test_BlockTrace_ReadIndex_should_HandleEmptyTrace, 149);
+  RUN_TEST(test_BlockTrace_ReadIndex_should_ThrowException_when_TrailerIsMissing, 159);
+  RUN_TEST(test_BlockTrace_CreateWriter_should_ThrowException_when_BlockLenIsZero, 186);
+  RUN_TEST(test_BlockTrace_WriteBlock_should_AppendPrecompressedBlock, 197);
+  RUN_TEST(test_BlockTrace_WriteBlock_should_ThrowException_when_BlockIsTooLong, 234);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Read_should_KickoutFullAddress_when_BlockHasBeenWritten(void);
+extern void test_CacheData_Read_should_HitVictimSet_when_BlockWasEvicted(void);
+extern void test_CacheData_Read_should_KeepEveryBlock_when_TagDoesNotFit(void);
+extern void test_CacheData_Access_should_MatchModel_when_NoVictimSet(void);
+extern void test_CacheData_Access_should_MatchModel_when_TagsOutgrowCompactSets(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_CacheData_Compact.c");
+  RUN_TEST(test_CacheData_Read_should_KickoutFullAddress_when_BlockHasBeenWritten, 97);
+  RUN_TEST(test_CacheData_Read_should_HitVictimSet_when_BlockWasEvicted, 114);
+  RUN_TEST(test_CacheData_Read_should_KeepEveryBlock_when_TagDoesNotFit, 130);
+  RUN_TEST(test_CacheData_Access_should_MatchModel_when_NoVictimSet, 161);
+  RUN_TEST(test_CacheData_Access_should_MatchModel_when_TagsOutgrowCompactSets, 174);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,66 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Create_should_ReturnNonNull_when_GivenValidParameters(void);
+extern void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoNumberOfSets(void);
+extern void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoSetLength(void);
+extern void test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoBlockSize(void);
+extern void test_CacheData_Create_shouild_ReturnNull_when_GivenBlockSizeSmallerThanAWord(void);
+extern void test_CacheData_Create_should_ReturnNull_when_GivenNonPowerOfTwoVictimCacheSize(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_CacheData_Create.c");
+  RUN_TEST(test_CacheData_Create_should_ReturnNonNull_when_GivenValidParameters, 33);
+  RUN_TEST(test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoNumberOfSets, 54);
+  RUN_TEST(test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoSetLength, 60);
+  RUN_TEST(test_CacheData_Create_shouild_ReturnNull_when_GivenNonPowerOfTwoBlockSize, 66);
+  RUN_TEST(test_CacheData_Create_shouild_ReturnNull_when_GivenBlockSizeSmallerThanAWord, 72);
+  RUN_TEST(test_CacheData_Create_should_ReturnNull_when_GivenNonPowerOfTwoVictimCacheSize, 78);
+
+  return (UnityEnd());
+}
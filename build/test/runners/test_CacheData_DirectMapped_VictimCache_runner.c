@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Read_should_SendBlockToVictimCache_when_WritingAnotherBlock(void);
+extern void test_CacheData_Read_should_PullBlockBackFromVictimCache(void);
+extern void test_DifferentSets_should_AllWriteToVictimCache(void);
+extern void test_CacheData_Write_should_FillUpSetsAndVictimCache(void);
+extern void test_CacheData_Contains_should_FindBlockInVictimCache(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_CacheData_DirectMapped_VictimCache.c");
+  RUN_TEST(test_CacheData_Read_should_SendBlockToVictimCache_when_WritingAnotherBlock, 49);
+  RUN_TEST(test_CacheData_Read_should_PullBlockBackFromVictimCache, 76);
+  RUN_TEST(test_DifferentSets_should_AllWriteToVictimCache, 104);
+  RUN_TEST(test_CacheData_Write_should_FillUpSetsAndVictimCache, 143);
+  RUN_TEST(test_CacheData_Contains_should_FindBlockInVictimCache, 163);
+
+  return (UnityEnd());
+}
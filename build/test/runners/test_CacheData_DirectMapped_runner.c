@@ -0,0 +1,80 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Contains_should_ReturnFalse_when_CacheDataIsEmpty(void);
+extern void test_CacheData_Read_should_NotKickOutBlock_when_CacheDataIsEmpty(void);
+extern void test_CacheData_Contains_should_ReturnTrue_when_BlockHasBeenInserted(void);
+extern void test_CacheData_Contains_should_ReturnFalse_when_DifferentBlockHasBeenInserted(void);
+extern void test_CacheData_Contains_should_ReportTrue_when_MultipleBlocksInDifferentSetsHaveBeenSaved(void);
+extern void test_CacheData_Read_should_NotKickout_when_TheSameBlockIsInserted(void);
+extern void test_CacheData_Read_should_KickOutOldBlock_when_TwoAddressesMappedToSameBlockAreInserted(void);
+extern void test_CacheData_Write_should_AddBlock_when_BlockIsntPresent(void);
+extern void test_CacheData_Write_should_NotDirtyKickout_when_WritingSameBlock(void);
+extern void test_CacheData_Write_should_DirtyKickout_when_ReplacingBlock(void);
+extern void test_CacheData_Read_should_KickOutDirtyBlock_when_BlockHasBeenWritten(void);
+extern void test_CacheData_Contains_should_IgnoreOffsetWithinBlock(void);
+extern void test_CacheData_Read_should_BeAbleToFillCache(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_CacheData_DirectMapped.c");
+  RUN_TEST(test_CacheData_Contains_should_ReturnFalse_when_CacheDataIsEmpty, 48);
+  RUN_TEST(test_CacheData_Read_should_NotKickOutBlock_when_CacheDataIsEmpty, 54);
+  RUN_TEST(test_CacheData_Contains_should_ReturnTrue_when_BlockHasBeenInserted, 62);
+  RUN_TEST(test_CacheData_Contains_should_ReturnFalse_when_DifferentBlockHasBeenInserted, 71);
+  RUN_TEST(test_CacheData_Contains_should_ReportTrue_when_MultipleBlocksInDifferentSetsHaveBeenSaved, 81);
+  RUN_TEST(test_CacheData_Read_should_NotKickout_when_TheSameBlockIsInserted, 97);
+  RUN_TEST(test_CacheData_Read_should_KickOutOldBlock_when_TwoAddressesMappedToSameBlockAreInserted, 109);
+  RUN_TEST(test_CacheData_Write_should_AddBlock_when_BlockIsntPresent, 122);
+  RUN_TEST(test_CacheData_Write_should_NotDirtyKickout_when_WritingSameBlock, 131);
+  RUN_TEST(test_CacheData_Write_should_DirtyKickout_when_ReplacingBlock, 142);
+  RUN_TEST(test_CacheData_Read_should_KickOutDirtyBlock_when_BlockHasBeenWritten, 154);
+  RUN_TEST(test_CacheData_Contains_should_IgnoreOffsetWithinBlock, 166);
+  RUN_TEST(test_CacheData_Read_should_BeAbleToFillCache, 181);
+
+  return (UnityEnd());
+}
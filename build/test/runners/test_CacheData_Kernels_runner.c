@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Kernel_should_MatchGeneric_when_DirectMapped(void);
+extern void test_CacheData_Kernel_should_MatchGeneric_when_DirectMappedWithoutVictimSet(void);
+extern void test_CacheData_Kernel_should_MatchGeneric_when_TwoWay(void);
+extern void test_CacheData_Kernel_should_MatchGeneric_when_FourWayWithoutVictimSet(void);
+extern void test_CacheData_Kernel_should_MatchGeneric_when_EightWay(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_CacheData_Kernels.c");
+  RUN_TEST(test_CacheData_Kernel_should_MatchGeneric_when_DirectMapped, 70);
+  RUN_TEST(test_CacheData_Kernel_should_MatchGeneric_when_DirectMappedWithoutVictimSet, 75);
+  RUN_TEST(test_CacheData_Kernel_should_MatchGeneric_when_TwoWay, 80);
+  RUN_TEST(test_CacheData_Kernel_should_MatchGeneric_when_FourWayWithoutVictimSet, 85);
+  RUN_TEST(test_CacheData_Kernel_should_MatchGeneric_when_EightWay, 90);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_SetsDefaultsWithoutConfigFile(void);
+extern void test_SetsDefaultsWithoutEmptyConfigFile(void);
+extern void test_ThrowsExceptionWithNonexistentConfigFile(void);
+extern void test_AnyConfigFileOptionsOverrideDefaults(void);
+extern void test_ExceptionPointsToBadConfigLine(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_Config_FromFile.c");
+  RUN_TEST(test_SetsDefaultsWithoutConfigFile, 43);
+  RUN_TEST(test_SetsDefaultsWithoutEmptyConfigFile, 54);
+  RUN_TEST(test_ThrowsExceptionWithNonexistentConfigFile, 65);
+  RUN_TEST(test_AnyConfigFileOptionsOverrideDefaults, 79);
+  RUN_TEST(test_ExceptionPointsToBadConfigLine, 91);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,94 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ConfigDefaultValues(void);
+extern void test_BlankLineDoesntModifyConfig(void);
+extern void test_ParseBlockSizeString(void);
+extern void test_ParseCacheSizeString(void);
+extern void test_ParseAssociativeString(void);
+extern void test_ParseHitTime(void);
+extern void test_ParseMissTime(void);
+extern void test_ParseTransferTime(void);
+extern void test_ParseBusWidth(void);
+extern void test_ParseMemSendAddressTime(void);
+extern void test_ParseMemReadyTime(void);
+extern void test_ParseMemChunkTime(void);
+extern void test_ParseMemChunkSize(void);
+extern void test_NewlineDoesntMatter(void);
+extern void test_RejectsSyntaxError(void);
+extern void test_RejectsL1InvalidParameters(void);
+extern void test_RejetcsInvalidCacheName(void);
+extern void test_RejectsInvalidParameterName(void);
+extern void test_ThrowsExceptionWithNullPointers(void);
+extern void test_WidthsMustBePowersOfTwo(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_Config_ParseLine.c");
+  RUN_TEST(test_ConfigDefaultValues, 46);
+  RUN_TEST(test_BlankLineDoesntModifyConfig, 59);
+  RUN_TEST(test_ParseBlockSizeString, 72);
+  RUN_TEST(test_ParseCacheSizeString, 92);
+  RUN_TEST(test_ParseAssociativeString, 112);
+  RUN_TEST(test_ParseHitTime, 132);
+  RUN_TEST(test_ParseMissTime, 152);
+  RUN_TEST(test_ParseTransferTime, 172);
+  RUN_TEST(test_ParseBusWidth, 188);
+  RUN_TEST(test_ParseMemSendAddressTime, 204);
+  RUN_TEST(test_ParseMemReadyTime, 220);
+  RUN_TEST(test_ParseMemChunkTime, 236);
+  RUN_TEST(test_ParseMemChunkSize, 252);
+  RUN_TEST(test_NewlineDoesntMatter, 268);
+  RUN_TEST(test_RejectsSyntaxError, 284);
+  RUN_TEST(test_RejectsL1InvalidParameters, 289);
+  RUN_TEST(test_RejetcsInvalidCacheName, 295);
+  RUN_TEST(test_RejectsInvalidParameterName, 300);
+  RUN_TEST(test_ThrowsExceptionWithNullPointers, 305);
+  RUN_TEST(test_WidthsMustBePowersOfTwo, 319);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,74 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_DeltaTrace_DecodeChunk_should_RecoverEncodedAccesses(void);
+extern void test_DeltaTrace_ReadRuns_should_CollapseSequentialFetches(void);
+extern void test_DeltaTrace_ReadRuns_should_ReturnRemainder_when_RunIsPartlyRead(void);
+extern void test_DeltaTrace_DecodeChunk_should_ReturnZero_when_ChunkIsIncomplete(void);
+extern void test_DeltaTrace_DecodeChunk_should_ThrowException_when_ChunkIsCorrupt(void);
+extern void test_DeltaTrace_EncodeChunk_should_ThrowException_when_AccessIsInvalid(void);
+extern void test_DeltaTrace_Finish_should_WriteChunksAndEnd(void);
+extern void test_DeltaTrace_WriteChunk_should_AppendPrecompressedChunk(void);
+extern void test_DeltaTrace_CreateWriter_should_ThrowException_when_ChunkLenIsZero(void);
+extern void test_DeltaTrace_CheckHeader_should_ThrowException_when_VersionIsWrong(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_DeltaTrace.c");
+  RUN_TEST(test_DeltaTrace_DecodeChunk_should_RecoverEncodedAccesses, 96);
+  RUN_TEST(test_DeltaTrace_ReadRuns_should_CollapseSequentialFetches, 112);
+  RUN_TEST(test_DeltaTrace_ReadRuns_should_ReturnRemainder_when_RunIsPartlyRead, 141);
+  RUN_TEST(test_DeltaTrace_DecodeChunk_should_ReturnZero_when_ChunkIsIncomplete, 162);
+  RUN_TEST(test_DeltaTrace_DecodeChunk_should_ThrowException_when_ChunkIsCorrupt, 171);
+  RUN_TEST(test_DeltaTrace_EncodeChunk_should_ThrowException_when_AccessIsInvalid, 191);
+  RUN_TEST(test_DeltaTrace_Finish_should_WriteChunksAndEnd, 218);
+  RUN_TEST(test_DeltaTrace_WriteChunk_should_AppendPrecompressedChunk, 256);
+  RUN_TEST(test_DeltaTrace_CreateWriter_should_ThrowException_when_ChunkLenIsZero, 286);
+  RUN_TEST(test_DeltaTrace_CheckHeader_should_ThrowException_when_VersionIsWrong, 297);
+
+  return (UnityEnd());
+}
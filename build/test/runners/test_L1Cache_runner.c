@@ -0,0 +1,139 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  CMock_Init(); \
+  UNITY_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+    CMock_Verify(); \
+  } \
+  CMock_Destroy(); \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include "cmock.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+#include "mock_CacheData.h"
+#include "mock_L2Cache.h"
+#include "mock_StackDistance.h"
+#include "mock_Statistics.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails(void);
+extern void test_InstructionMiss_should_CauseL2Read(void);
+extern void test_ReadMiss_should_CauseL2Read(void);
+extern void test_WriteMiss_should_CauseL2Read(void);
+extern void test_InstructionMissKickout_should_CauseL2Read(void);
+extern void test_ReadMissKickout_should_CauseL2Read(void);
+extern void test_WriteMissKickout_should_CauseL2Read(void);
+extern void test_InstructionHit_should_not_CauseL2Read(void);
+extern void test_ReadHit_should_not_CauseL2Read(void);
+extern void test_WriteHit_should_not_CauseL2Read(void);
+extern void test_InstructionVictimCacheHit_should_not_CauseL2Read(void);
+extern void test_ReadVictimCacheHit_should_not_CauseL2Read(void);
+extern void test_WriteVictimCacheHit_should_not_CauseL2Read(void);
+extern void test_ReadDirtyKickout_should_CauseL2Write_then_L2Read(void);
+extern void test_WriteDirtyKickout_should_CauseL2Write_then_L2Read(void);
+extern void test_RepeatedBlockAccess_should_HitWithoutCacheData(void);
+extern void test_WriteAfterRead_should_MarkBlockDirtyOnce(void);
+extern void test_AccessSpan_should_LookUpBlockOnce(void);
+extern void test_AccessSpan_should_LookUpEachBlock_when_SpanCrossesBlocks(void);
+extern void test_AccessSpan_should_CountEachLookup_when_StackDistanceIsAttached(void);
+extern void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void);
+extern void test_AccessBatch_should_AlignAndSimulateInOrder(void);
+extern void test_AccessBatch_should_PrefetchAhead_when_CachesAreLarge(void);
+
+
+//=======Mock Management=====
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_CacheData_Init();
+  mock_L2Cache_Init();
+  mock_StackDistance_Init();
+  mock_Statistics_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_CacheData_Verify();
+  mock_L2Cache_Verify();
+  mock_StackDistance_Verify();
+  mock_Statistics_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_CacheData_Destroy();
+  mock_L2Cache_Destroy();
+  mock_StackDistance_Destroy();
+  mock_Statistics_Destroy();
+}
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_L1Cache.c");
+  RUN_TEST(test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails, 74);
+  RUN_TEST(test_InstructionMiss_should_CauseL2Read, 81);
+  RUN_TEST(test_ReadMiss_should_CauseL2Read, 111);
+  RUN_TEST(test_WriteMiss_should_CauseL2Read, 141);
+  RUN_TEST(test_InstructionMissKickout_should_CauseL2Read, 171);
+  RUN_TEST(test_ReadMissKickout_should_CauseL2Read, 201);
+  RUN_TEST(test_WriteMissKickout_should_CauseL2Read, 231);
+  RUN_TEST(test_InstructionHit_should_not_CauseL2Read, 261);
+  RUN_TEST(test_ReadHit_should_not_CauseL2Read, 280);
+  RUN_TEST(test_WriteHit_should_not_CauseL2Read, 299);
+  RUN_TEST(test_InstructionVictimCacheHit_should_not_CauseL2Read, 318);
+  RUN_TEST(test_ReadVictimCacheHit_should_not_CauseL2Read, 338);
+  RUN_TEST(test_WriteVictimCacheHit_should_not_CauseL2Read, 358);
+  RUN_TEST(test_ReadDirtyKickout_should_CauseL2Write_then_L2Read, 378);
+  RUN_TEST(test_WriteDirtyKickout_should_CauseL2Write_then_L2Read, 419);
+  RUN_TEST(test_RepeatedBlockAccess_should_HitWithoutCacheData, 460);
+  RUN_TEST(test_WriteAfterRead_should_MarkBlockDirtyOnce, 492);
+  RUN_TEST(test_AccessSpan_should_LookUpBlockOnce, 527);
+  RUN_TEST(test_AccessSpan_should_LookUpEachBlock_when_SpanCrossesBlocks, 546);
+  RUN_TEST(test_AccessSpan_should_CountEachLookup_when_StackDistanceIsAttached, 574);
+  RUN_TEST(test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached, 603);
+  RUN_TEST(test_AccessBatch_should_AlignAndSimulateInOrder, 623);
+  RUN_TEST(test_AccessBatch_should_PrefetchAhead_when_CachesAreLarge, 654);
+
+  CMock_Guts_MemFreeFinal();
+  return (UnityEnd());
+}
@@ -0,0 +1,133 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  CMock_Init(); \
+  UNITY_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+    CMock_Verify(); \
+  } \
+  CMock_Destroy(); \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include "cmock.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+#include "mock_CacheData.h"
+#include "mock_L2Stream.h"
+#include "mock_MainMem.h"
+#include "mock_StackDistance.h"
+#include "mock_Statistics.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails(void);
+extern void test_InstructionMiss_should_CauseMainMemReadAccess(void);
+extern void test_ReadMiss_should_CauseMainMemReadAccess(void);
+extern void test_WriteMiss_should_CauseMainMemReadAccess(void);
+extern void test_InstructionHit_should_not_CauseMainMemAccess(void);
+extern void test_ReadHit_should_not_CauseMainMemAccess(void);
+extern void test_WriteHit_should_not_CauseMainMemAccess(void);
+extern void test_InstructionVictimCacheHit_should_not_CauseMainMemAccess(void);
+extern void test_ReadVictimCacheHit_should_not_CauseMainMemAccess(void);
+extern void test_WriteVictimCacheHit_should_not_CauseMainMemAccess(void);
+extern void test_InstructionKickout_should_CauseMainMemAccess(void);
+extern void test_ReadKickout_should_CauseMainMemAccess(void);
+extern void test_WriteKickout_should_CauseMainMemAccess(void);
+extern void test_ReadDirtyKickout_should_CauseWriteback(void);
+extern void test_WriteDirtyKickout_should_CauseWriteback(void);
+extern void test_Access_should_CountEachAccess_when_StackDistancesAreAttached(void);
+extern void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void);
+extern void test_Access_should_RecordAccessAndCycles_when_CaptureIsAttached(void);
+
+
+//=======Mock Management=====
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  mock_CacheData_Init();
+  mock_L2Stream_Init();
+  mock_MainMem_Init();
+  mock_StackDistance_Init();
+  mock_Statistics_Init();
+}
+static void CMock_Verify(void)
+{
+  mock_CacheData_Verify();
+  mock_L2Stream_Verify();
+  mock_MainMem_Verify();
+  mock_StackDistance_Verify();
+  mock_Statistics_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mock_CacheData_Destroy();
+  mock_L2Stream_Destroy();
+  mock_MainMem_Destroy();
+  mock_StackDistance_Destroy();
+  mock_Statistics_Destroy();
+}
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_L2Cache.c");
+  RUN_TEST(test_CacheData_Create_should_ReturnNULL_when_CacheDataAllocationFails, 80);
+  RUN_TEST(test_InstructionMiss_should_CauseMainMemReadAccess, 87);
+  RUN_TEST(test_ReadMiss_should_CauseMainMemReadAccess, 118);
+  RUN_TEST(test_WriteMiss_should_CauseMainMemReadAccess, 149);
+  RUN_TEST(test_InstructionHit_should_not_CauseMainMemAccess, 180);
+  RUN_TEST(test_ReadHit_should_not_CauseMainMemAccess, 200);
+  RUN_TEST(test_WriteHit_should_not_CauseMainMemAccess, 220);
+  RUN_TEST(test_InstructionVictimCacheHit_should_not_CauseMainMemAccess, 240);
+  RUN_TEST(test_ReadVictimCacheHit_should_not_CauseMainMemAccess, 261);
+  RUN_TEST(test_WriteVictimCacheHit_should_not_CauseMainMemAccess, 282);
+  RUN_TEST(test_InstructionKickout_should_CauseMainMemAccess, 303);
+  RUN_TEST(test_ReadKickout_should_CauseMainMemAccess, 334);
+  RUN_TEST(test_WriteKickout_should_CauseMainMemAccess, 365);
+  RUN_TEST(test_ReadDirtyKickout_should_CauseWriteback, 396);
+  RUN_TEST(test_WriteDirtyKickout_should_CauseWriteback, 439);
+  RUN_TEST(test_Access_should_CountEachAccess_when_StackDistancesAreAttached, 482);
+  RUN_TEST(test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached, 515);
+  RUN_TEST(test_Access_should_RecordAccessAndCycles_when_CaptureIsAttached, 535);
+
+  CMock_Guts_MemFreeFinal();
+  return (UnityEnd());
+}
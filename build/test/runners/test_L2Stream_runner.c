@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_L2Stream_CreateReader_should_ThrowException_when_FileIsMissing(void);
+extern void test_L2Stream_CreateReader_should_ThrowException_when_StreamIsNotFinished(void);
+extern void test_L2Stream_Record_should_ThrowException_when_AccessIsNotABlock(void);
+extern void test_L2Stream_Read_should_ReturnEveryAccessInOrder(void);
+extern void test_L2Stream_ReadStats_should_LeaveOut_CyclesSpentInL2(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_L2Stream.c");
+  RUN_TEST(test_L2Stream_CreateReader_should_ThrowException_when_FileIsMissing, 75);
+  RUN_TEST(test_L2Stream_CreateReader_should_ThrowException_when_StreamIsNotFinished, 86);
+  RUN_TEST(test_L2Stream_Record_should_ThrowException_when_AccessIsNotABlock, 105);
+  RUN_TEST(test_L2Stream_Read_should_ReturnEveryAccessInOrder, 129);
+  RUN_TEST(test_L2Stream_ReadStats_should_LeaveOut_CyclesSpentInL2, 184);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,76 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_StackDistance_Create_should_ThrowException_when_ParameterIsOutOfRange(void);
+extern void test_StackDistance_SizeBytes_should_DoubleFromOneSet(void);
+extern void test_StackDistance_Access_should_CountRepeatsAsHits(void);
+extern void test_StackDistance_Access_should_SeeConflicts_only_when_SetsAreShared(void);
+extern void test_StackDistance_CreateAllWays_should_ThrowException_when_ParameterIsOutOfRange(void);
+extern void test_StackDistance_CreateAllWays_should_HalveWaysFromFullyAssociative(void);
+extern void test_StackDistance_Access_should_CountDirtyKickouts_only_when_Written(void);
+extern void test_StackDistance_should_MatchCaches_when_DirectMapped(void);
+extern void test_StackDistance_should_MatchCaches_when_FourWay(void);
+extern void test_StackDistance_should_MatchCaches_when_HighlyAssociative(void);
+extern void test_StackDistance_should_MatchCaches_when_EveryAssociativity(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_StackDistance.c");
+  RUN_TEST(test_StackDistance_Create_should_ThrowException_when_ParameterIsOutOfRange, 96);
+  RUN_TEST(test_StackDistance_SizeBytes_should_DoubleFromOneSet, 117);
+  RUN_TEST(test_StackDistance_Access_should_CountRepeatsAsHits, 127);
+  RUN_TEST(test_StackDistance_Access_should_SeeConflicts_only_when_SetsAreShared, 142);
+  RUN_TEST(test_StackDistance_CreateAllWays_should_ThrowException_when_ParameterIsOutOfRange, 163);
+  RUN_TEST(test_StackDistance_CreateAllWays_should_HalveWaysFromFullyAssociative, 184);
+  RUN_TEST(test_StackDistance_Access_should_CountDirtyKickouts_only_when_Written, 198);
+  RUN_TEST(test_StackDistance_should_MatchCaches_when_DirectMapped, 219);
+  RUN_TEST(test_StackDistance_should_MatchCaches_when_FourWay, 224);
+  RUN_TEST(test_StackDistance_should_MatchCaches_when_HighlyAssociative, 229);
+  RUN_TEST(test_StackDistance_should_MatchCaches_when_EveryAssociativity, 234);
+
+  return (UnityEnd());
+}
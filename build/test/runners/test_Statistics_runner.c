@@ -0,0 +1,82 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_Statistics_Create_should_InitializeAllStatFields(void);
+extern void test_Statistics_RecordAccess_should_RecordReadAccess(void);
+extern void test_Statistics_RecordAccess_should_RecordWriteAccess(void);
+extern void test_Statistics_RecordAccess_should_RecordInstructionAccess(void);
+extern void test_Statistics_RecordAccess_should_RecordMisalignedAccess(void);
+extern void test_Statistics_RecordAccess_should_RecordMultipleAccesses(void);
+extern void test_Statistics_RecordCycles_should_AddCyclesWithoutCountingAccesses(void);
+extern void test_Statistics_RecordCacheAccess_should_RecordCacheHit(void);
+extern void test_Statistics_RecordCacheHits_should_RecordOnlyHits(void);
+extern void test_Statistics_RecordCacheAccess_should_RecordVictimCacheHit(void);
+extern void test_Statistics_RecordCacheAccess_should_RecordCacheMiss(void);
+extern void test_Statistics_RecordCacheAccess_should_RecordCacheKickout(void);
+extern void test_Statistics_RecordCacheAccess_should_RecordCacheDirtyyKickout(void);
+extern void test_Statistics_RecordCacheAccess_should_IncrementForMultipleAccesses(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_Statistics.c");
+  RUN_TEST(test_Statistics_Create_should_InitializeAllStatFields, 43);
+  RUN_TEST(test_Statistics_RecordAccess_should_RecordReadAccess, 84);
+  RUN_TEST(test_Statistics_RecordAccess_should_RecordWriteAccess, 99);
+  RUN_TEST(test_Statistics_RecordAccess_should_RecordInstructionAccess, 114);
+  RUN_TEST(test_Statistics_RecordAccess_should_RecordMisalignedAccess, 129);
+  RUN_TEST(test_Statistics_RecordAccess_should_RecordMultipleAccesses, 163);
+  RUN_TEST(test_Statistics_RecordCycles_should_AddCyclesWithoutCountingAccesses, 175);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_RecordCacheHit, 188);
+  RUN_TEST(test_Statistics_RecordCacheHits_should_RecordOnlyHits, 200);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_RecordVictimCacheHit, 213);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_RecordCacheMiss, 225);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_RecordCacheKickout, 237);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_RecordCacheDirtyyKickout, 249);
+  RUN_TEST(test_Statistics_RecordCacheAccess_should_IncrementForMultipleAccesses, 261);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,64 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TagSearch_Get_should_AlwaysProvideScalarAndBest(void);
+extern void test_TagSearch_should_FindEveryPosition(void);
+extern void test_TagSearch_should_ReturnFirstMatch(void);
+extern void test_TagSearch_should_CompareWholeAddress(void);
+extern void test_TagSearch_should_SearchPartialGroup_when_RestIsEmpty(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_TagSearch.c");
+  RUN_TEST(test_TagSearch_Get_should_AlwaysProvideScalarAndBest, 51);
+  RUN_TEST(test_TagSearch_should_FindEveryPosition, 58);
+  RUN_TEST(test_TagSearch_should_ReturnFirstMatch, 76);
+  RUN_TEST(test_TagSearch_should_CompareWholeAddress, 90);
+  RUN_TEST(test_TagSearch_should_SearchPartialGroup_when_RestIsEmpty, 107);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,68 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TraceCache_Create_should_Record_when_TraceIsNotCached(void);
+extern void test_TraceCache_Create_should_NotRecord_when_NotAsked(void);
+extern void test_TraceCache_Commit_should_AddCopyMatchingTrace(void);
+extern void test_TraceCache_Create_should_Miss_when_TraceDiffers(void);
+extern void test_TraceCache_Destroy_should_DiscardCopy_when_NotCommitted(void);
+extern void test_TraceCache_Create_should_NotRecord_when_TraceIsBinary(void);
+extern void test_TraceCache_Create_should_NotRecord_when_DirectoryCannotBeCreated(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_TraceCache.c");
+  RUN_TEST(test_TraceCache_Create_should_Record_when_TraceIsNotCached, 78);
+  RUN_TEST(test_TraceCache_Create_should_NotRecord_when_NotAsked, 87);
+  RUN_TEST(test_TraceCache_Commit_should_AddCopyMatchingTrace, 96);
+  RUN_TEST(test_TraceCache_Create_should_Miss_when_TraceDiffers, 120);
+  RUN_TEST(test_TraceCache_Destroy_should_DiscardCopy_when_NotCommitted, 135);
+  RUN_TEST(test_TraceCache_Create_should_NotRecord_when_TraceIsBinary, 149);
+  RUN_TEST(test_TraceCache_Create_should_NotRecord_when_DirectoryCannotBeCreated, 163);
+
+  return (UnityEnd());
+}
@@ -0,0 +1,66 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TraceIndex_Create_should_ThrowException_when_IntervalIsZero(void);
+extern void test_TraceIndex_Create_should_BeInactive_when_TraceIsBinary(void);
+extern void test_TraceIndex_Limit_should_StopReadsAtNextCheckpoint(void);
+extern void test_TraceIndex_Record_should_AddCheckpointEveryInterval(void);
+extern void test_TraceIndex_Seek_should_FindLineInSavedIndex(void);
+extern void test_TraceIndex_Create_should_IgnoreSidecar_when_IntervalDiffers(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_TraceIndex.c");
+  RUN_TEST(test_TraceIndex_Create_should_ThrowException_when_IntervalIsZero, 91);
+  RUN_TEST(test_TraceIndex_Create_should_BeInactive_when_TraceIsBinary, 102);
+  RUN_TEST(test_TraceIndex_Limit_should_StopReadsAtNextCheckpoint, 120);
+  RUN_TEST(test_TraceIndex_Record_should_AddCheckpointEveryInterval, 135);
+  RUN_TEST(test_TraceIndex_Seek_should_FindLineInSavedIndex, 176);
+  RUN_TEST(test_TraceIndex_Create_should_IgnoreSidecar_when_IntervalDiffers, 206);
+
+  return (UnityEnd());
+}
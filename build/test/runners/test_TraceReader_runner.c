@@ -0,0 +1,96 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TraceReader_Read_should_MatchParseLine_when_ReadingTextFile(void);
+extern void test_TraceReader_Read_should_ReturnFullBatches_until_TraceEnds(void);
+extern void test_TraceReader_Read_should_PointToBadTraceLine(void);
+extern void test_TraceReader_Create_should_ThrowException_when_FileDoesNotExist(void);
+extern void test_TraceReader_Read_should_MatchText_when_ReadingBinaryFile(void);
+extern void test_TraceReader_Read_should_ThrowException_when_BinaryTraceIsShort(void);
+extern void test_TraceReader_Create_should_ThrowException_when_BinaryHeaderIsBad(void);
+extern void test_TraceReader_Read_should_MatchText_when_ReadingGzipFile(void);
+extern void test_TraceReader_Read_should_ThrowException_when_GzipFileIsTruncated(void);
+extern void test_TraceReader_Read_should_MatchText_when_ReadingBlockTrace(void);
+extern void test_TraceReader_Skip_should_StartMidBlock_when_ReadingBlockTrace(void);
+extern void test_TraceReader_Skip_should_StopAtEnd_when_SkippingPastEnd(void);
+extern void test_TraceReader_Skip_should_DiscardAccesses_when_ReadingText(void);
+extern void test_TraceReader_Seek_should_MoveToOffset_when_ReadingText(void);
+extern void test_TraceReader_Seek_should_MoveToOffset_when_ReadingGzipFile(void);
+extern void test_TraceReader_Seek_should_ThrowException_when_TraceIsBinary(void);
+extern void test_TraceReader_Skip_should_StepOverRecords_when_ReadingBinaryFile(void);
+extern void test_TraceReader_Read_should_MatchText_when_ReadingDeltaTrace(void);
+extern void test_TraceReader_ReadRuns_should_ExpandToText_when_ReadingDeltaTrace(void);
+extern void test_TraceReader_ReadRuns_should_WrapEachAccess_when_ReadingText(void);
+extern void test_TraceReader_Read_should_ThrowException_when_DeltaTraceIsTruncated(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_TraceReader.c");
+  RUN_TEST(test_TraceReader_Read_should_MatchParseLine_when_ReadingTextFile, 100);
+  RUN_TEST(test_TraceReader_Read_should_ReturnFullBatches_until_TraceEnds, 117);
+  RUN_TEST(test_TraceReader_Read_should_PointToBadTraceLine, 140);
+  RUN_TEST(test_TraceReader_Create_should_ThrowException_when_FileDoesNotExist, 157);
+  RUN_TEST(test_TraceReader_Read_should_MatchText_when_ReadingBinaryFile, 168);
+  RUN_TEST(test_TraceReader_Read_should_ThrowException_when_BinaryTraceIsShort, 185);
+  RUN_TEST(test_TraceReader_Create_should_ThrowException_when_BinaryHeaderIsBad, 202);
+  RUN_TEST(test_TraceReader_Read_should_MatchText_when_ReadingGzipFile, 213);
+  RUN_TEST(test_TraceReader_Read_should_ThrowException_when_GzipFileIsTruncated, 230);
+  RUN_TEST(test_TraceReader_Read_should_MatchText_when_ReadingBlockTrace, 247);
+  RUN_TEST(test_TraceReader_Skip_should_StartMidBlock_when_ReadingBlockTrace, 265);
+  RUN_TEST(test_TraceReader_Skip_should_StopAtEnd_when_SkippingPastEnd, 283);
+  RUN_TEST(test_TraceReader_Skip_should_DiscardAccesses_when_ReadingText, 300);
+  RUN_TEST(test_TraceReader_Seek_should_MoveToOffset_when_ReadingText, 314);
+  RUN_TEST(test_TraceReader_Seek_should_MoveToOffset_when_ReadingGzipFile, 334);
+  RUN_TEST(test_TraceReader_Seek_should_ThrowException_when_TraceIsBinary, 355);
+  RUN_TEST(test_TraceReader_Skip_should_StepOverRecords_when_ReadingBinaryFile, 372);
+  RUN_TEST(test_TraceReader_Read_should_MatchText_when_ReadingDeltaTrace, 387);
+  RUN_TEST(test_TraceReader_ReadRuns_should_ExpandToText_when_ReadingDeltaTrace, 405);
+  RUN_TEST(test_TraceReader_ReadRuns_should_WrapEachAccess_when_ReadingText, 446);
+  RUN_TEST(test_TraceReader_Read_should_ThrowException_when_DeltaTraceIsTruncated, 465);
+
+  return (UnityEnd());
+}
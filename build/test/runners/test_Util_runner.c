@@ -0,0 +1,86 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+//=======Test Runner Used To Run Each Test Below=====
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Unity.CurrentTestName = #TestFunc; \
+  Unity.CurrentTestLineNumber = TestLineNum; \
+  Unity.NumberOfTests++; \
+  if (TEST_PROTECT()) \
+  { \
+    CEXCEPTION_T e; \
+    Try { \
+      setUp(); \
+      TestFunc(); \
+    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \
+  } \
+  if (TEST_PROTECT() && !TEST_IS_IGNORED) \
+  { \
+    tearDown(); \
+  } \
+  UnityConcludeTest(); \
+}
+
+//=======Automagically Detected Files To Include=====
+#include "unity.h"
+#include <setjmp.h>
+#include <stdio.h>
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+//=======External Functions This Runner Calls=====
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ArrayElementsChar(void);
+extern void test_ArrayElementsInt(void);
+extern void test_ArrayElementsDouble(void);
+extern void test_ArrayElementsPointer(void);
+extern void test_ArrayElementsStruct(void);
+extern void test_PowersOfTwo(void);
+extern void test_NotPowersOfTwo(void);
+extern void test_CeilDivide_should_BeRegularDivision_when_DivisorIsDivisible(void);
+extern void test_CeilDivide_should_ReturnZero_when_DividentIsZero(void);
+extern void test_CeilDivide_should_RoundUp_when_DivisorIsNotDivisible(void);
+extern void test_HighestBitSet_should_ReturnZero_when_PassedZero(void);
+extern void test_HighestBitSet_should_ReturnOnlySetBit_when_PassedPowerOf2(void);
+extern void test_HighestBitSet_should_ReturnHighestSetBit_when_PassedNonPowerOf2(void);
+extern void test_HighestBitSet_should_ZeroExtend32BitValue(void);
+extern void test_AlignmentMask_should_CalculateMask_when_BlockSizeIsAPowerOfTwo(void);
+extern void test_AlignmentMask_should_ThrowException_when_BlockSizeIsNotAPowerOfTwo(void);
+
+
+//=======Test Reset Option=====
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+//=======MAIN=====
+int main(void)
+{
+  UnityBegin("test_Util.c");
+  RUN_TEST(test_ArrayElementsChar, 44);
+  RUN_TEST(test_ArrayElementsInt, 55);
+  RUN_TEST(test_ArrayElementsDouble, 66);
+  RUN_TEST(test_ArrayElementsPointer, 77);
+  RUN_TEST(test_ArrayElementsStruct, 88);
+  RUN_TEST(test_PowersOfTwo, 105);
+  RUN_TEST(test_NotPowersOfTwo, 115);
+  RUN_TEST(test_CeilDivide_should_BeRegularDivision_when_DivisorIsDivisible, 125);
+  RUN_TEST(test_CeilDivide_should_ReturnZero_when_DividentIsZero, 133);
+  RUN_TEST(test_CeilDivide_should_RoundUp_when_DivisorIsNotDivisible, 140);
+  RUN_TEST(test_HighestBitSet_should_ReturnZero_when_PassedZero, 148);
+  RUN_TEST(test_HighestBitSet_should_ReturnOnlySetBit_when_PassedPowerOf2, 153);
+  RUN_TEST(test_HighestBitSet_should_ReturnHighestSetBit_when_PassedNonPowerOf2, 162);
+  RUN_TEST(test_HighestBitSet_should_ZeroExtend32BitValue, 171);
+  RUN_TEST(test_AlignmentMask_should_CalculateMask_when_BlockSizeIsAPowerOfTwo, 182);
+  RUN_TEST(test_AlignmentMask_should_ThrowException_when_BlockSizeIsNotAPowerOfTwo, 193);
+
+  return (UnityEnd());
+}
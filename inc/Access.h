@@ -17,6 +17,7 @@
 /* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* --- PUBLIC CONSTANTS ----------------------------------------------------- */
@@ -41,6 +42,21 @@ typedef struct {
     uint32_t n_bytes;   /**< The number of bytes being accessed */
 } access_t;
 
+/**@brief   A run of accesses of the same type, each starting where the last
+ *          ended
+ *
+ * A lone read or write is a run of one. Instruction fetches usually follow
+ * one another through memory, so form longer runs.
+ */
+typedef struct {
+    uint8_t type;               /**< The accesses' type. Member of @ref enum
+                                     ACCESS_TYPE */
+    uint64_t address;           /**< Address of the first access */
+    uint64_t n_bytes;           /**< Bytes covered by the whole run */
+    uint32_t n_accesses;        /**< Number of accesses in the run */
+    uint32_t const * sizes;     /**< Size of each access in the run [bytes] */
+} access_run_t;
+
 /* --- PUBLIC MACROS -------------------------------------------------------- */
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
@@ -66,6 +82,50 @@ typedef struct {
  */
 void Access_ParseLine(const char * line, access_t * access);
 
+/**@brief   Reads many lines from a block of trace text
+ *
+ * Each line has the format accepted by @ref Access_ParseLine(). Parsing stops
+ * when @p max_accesses accesses have been produced, or when no complete line
+ * remains in @p buffer. A trailing line with no newline is only parsed when
+ * @p final is set, so that a caller streaming a trace in blocks can carry
+ * it over to the next block.
+ *
+ * @param[in] buffer:           Trace text. Need not be NUL-terminated
+ * @param[in] length:           Number of bytes in @p buffer
+ * @param[in] final:            Whether @p buffer ends the trace
+ * @param[out] accesses:        Space for at least @p max_accesses accesses
+ * @param[in] max_accesses:     Maximum number of accesses to produce
+ * @param[out] n_accesses:      Number of accesses produced
+ * @param[in,out] line_no:      On entry, the trace line number of the first
+ *                              line in @p buffer. On return, the number of the
+ *                              first line not consumed. If an exception is
+ *                              thrown, the number of the offending line
+ *
+ * @return  The number of bytes of @p buffer consumed
+ *
+ * @throws SYNTAX_ERROR         When a line doesn't match the expected syntax
+ * @throws INVALID_OPERATION    When an operation is not one of @ref enum
+ *                              ACCESS_TYPE
+ * @throws INVALID_ACCESS_SIZE  When a line accesses zero bytes
+ */
+size_t Access_ParseBuffer(char const * buffer,
+                          size_t length,
+                          bool final,
+                          access_t * accesses,
+                          uint32_t max_accesses,
+                          uint32_t * n_accesses,
+                          uint64_t * line_no);
+
+/**@brief   Checks that an access describes a legal operation
+ *
+ * @param[in] access:   The access to check
+ *
+ * @throws INVALID_OPERATION    When the operation is not one of @ref enum
+ *                              ACCESS_TYPE
+ * @throws INVALID_ACCESS_SIZE  When one attempts to access zero bytes
+ */
+void Access_Validate(access_t const * access);
+
 /**@brief   Aligns an access to a block size
  *
  * Expands an access to cover all blocks of size @p block_size.
@@ -0,0 +1,123 @@
+/**
+ * @file    AccessRing.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   AccessRing Interface
+ */
+
+#ifndef ACCESSRING_H
+#define ACCESSRING_H
+
+/**@defgroup ACCESSRING AccessRing
+ * @{
+ *
+ * @brief   A bounded queue of access batches, passed from exactly one producer
+ *          thread to one or more consumer threads
+ *
+ * Batches are claimed, filled and published by the producer, then acquired,
+ * used and released by every consumer in turn. Each consumer sees every batch,
+ * read-only, and a batch is only reused once all of them have released it.
+ * While batches flow no side takes a lock: each only writes its own position
+ * in the ring, and every position lives on a cache line of its own. A side
+ * that finds the ring full (or empty) yields the processor a bounded number of
+ * times, then sleeps until another side moves, so waiting threads never starve
+ * the working ones when there are more threads than cores.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   A batch of accesses
+ *
+ * @note    By convention, a batch with no accesses marks the end of the
+ *          stream. If @p error is anything but CEXCEPTION_NONE, the stream
+ *          ended because the producer failed
+ */
+typedef struct {
+    access_t * accesses;        /**< Space for the ring's batch length */
+    uint32_t n_accesses;        /**< Valid accesses in @p accesses */
+    unsigned int error;         /**< Exception the producer failed with */
+    char const * error_file;    /**< File the producer's exception came from */
+    unsigned int error_line;    /**< Line the producer's exception came from */
+} access_batch_t;
+
+/**@brief   Instance of an access ring */
+typedef struct _access_ring_t * access_ring_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Create an empty ring
+ *
+ * @param[in] n_batches:    Number of batches in the ring. Must be a power of
+ *                          two
+ * @param[in] batch_len:    Space for accesses in each batch
+ * @param[in] n_consumers:  Number of consumers each batch is passed to
+ *
+ * @return  A new ring, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When @p n_batches is not a power of two, or there
+ *                          are no consumers
+ */
+access_ring_t AccessRing_Create(uint32_t n_batches, uint32_t batch_len, uint32_t n_consumers);
+
+/**@brief   Free all memory used by @p ring
+ *
+ * @note    Neither side may be using the ring
+ *
+ * @param[in] ring: The ring to destroy
+ */
+void AccessRing_Destroy(access_ring_t ring);
+
+/**@brief   Wait for an empty batch to fill (producer side)
+ *
+ * @param[in,out] ring: The ring
+ *
+ * @return  The batch, or NULL if the ring has been closed
+ */
+access_batch_t * AccessRing_Claim(access_ring_t ring);
+
+/**@brief   Pass the batch returned by @ref AccessRing_Claim on to the
+ *          consumers
+ *
+ * @param[in,out] ring: The ring
+ */
+void AccessRing_Publish(access_ring_t ring);
+
+/**@brief   Wait for the next published batch (consumer side)
+ *
+ * @param[in,out] ring:     The ring
+ * @param[in] consumer:     Index of the calling consumer
+ *
+ * @return  The batch, or NULL if the ring has been closed and none is waiting
+ */
+access_batch_t const * AccessRing_Acquire(access_ring_t ring, uint32_t consumer);
+
+/**@brief   Hand the batch returned by @ref AccessRing_Acquire back to the
+ *          producer
+ *
+ * @param[in,out] ring:     The ring
+ * @param[in] consumer:     Index of the calling consumer
+ */
+void AccessRing_Release(access_ring_t ring, uint32_t consumer);
+
+/**@brief   Tell every side to stop, whether or not it is finished
+ *
+ * Once closed, @ref AccessRing_Claim returns NULL rather than waiting for
+ * space, and @ref AccessRing_Acquire returns NULL rather than waiting for a
+ * batch
+ *
+ * @param[in,out] ring: The ring
+ */
+void AccessRing_Close(access_ring_t ring);
+
+/** @} defgroup ACCESSRING */
+
+#endif /* ifndef ACCESSRING_H */
@@ -0,0 +1,142 @@
+/**
+ * @file    BinaryTrace.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BinaryTrace Interface
+ */
+
+#ifndef BINARYTRACE_H
+#define BINARYTRACE_H
+
+/**@defgroup BINARYTRACE BinaryTrace
+ * @{
+ *
+ * @brief   A compact, fixed-width binary encoding for traces
+ *
+ * A binary trace is a header (@ref binary_trace_header_t) followed by a flat
+ * array of @ref BINARY_TRACE_RECORD_SIZE byte records, one per access. All
+ * multi-byte fields are stored little-endian.
+ *
+ * Record layout:
+ *
+ * Offset | Size | Field
+ * ------ | ---- | -------------------------------
+ * 0      | 8    | address
+ * 8      | 4    | n_bytes
+ * 12     | 1    | type (one of @ref enum ACCESS_TYPE)
+ * 13     | 3    | reserved (zero)
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Magic bytes identifying a binary trace */
+#define BINARY_TRACE_MAGIC              "SIMTRACE"
+
+/**@brief   Current version of the binary trace format */
+#define BINARY_TRACE_VERSION            (1)
+
+/**@brief   Size of the on-disk header [bytes] */
+#define BINARY_TRACE_HEADER_SIZE        (24)
+
+/**@brief   Size of a single on-disk access record [bytes] */
+#define BINARY_TRACE_RECORD_SIZE        (16)
+
+/**@brief   Reference count used when the writer was unable to record one
+ *          (e.g. it was writing to a pipe)
+ */
+#define BINARY_TRACE_UNKNOWN_LENGTH     (UINT64_MAX)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Decoded form of a binary trace's header */
+typedef struct {
+    uint32_t version;           /**< Format version */
+    uint32_t record_size;       /**< Size of each record [bytes] */
+    uint64_t n_records;         /**< Number of records following the header,
+                                     or @ref BINARY_TRACE_UNKNOWN_LENGTH */
+} binary_trace_header_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Encode a single access into its on-disk representation
+ *
+ * @param[out] record:  @ref BINARY_TRACE_RECORD_SIZE bytes of output
+ * @param[in] access:   The access to encode
+ */
+void BinaryTrace_EncodeAccess(uint8_t * record, access_t const * access);
+
+/**@brief   Decode a single access from its on-disk representation
+ *
+ * @param[out] access:  The decoded access
+ * @param[in] record:   @ref BINARY_TRACE_RECORD_SIZE bytes of input
+ *
+ * @throws INVALID_OPERATION    When the record's type is not one of @ref enum
+ *                              ACCESS_TYPE
+ * @throws INVALID_ACCESS_SIZE  When the record accesses zero bytes
+ */
+void BinaryTrace_DecodeAccess(access_t * access, uint8_t const * record);
+
+/**@brief   Decode and validate a header from its on-disk representation
+ *
+ * @param[out] header:      The decoded header
+ * @param[in] raw:          @ref BINARY_TRACE_HEADER_SIZE bytes of input
+ *
+ * @throws BAD_TRACE_FILE   When the header has the wrong magic bytes, or is
+ *                          an unsupported version
+ */
+void BinaryTrace_DecodeHeader(binary_trace_header_t * header, uint8_t const * raw);
+
+/**@brief   Write a header to the current position of @p file
+ *
+ * @param[in] file:         The file to write to
+ * @param[in] n_records:    The number of records that will follow
+ *
+ * @throws BAD_TRACE_FILE   When the header could not be written
+ */
+void BinaryTrace_WriteHeader(FILE * file, uint64_t n_records);
+
+/**@brief   Read and validate a header from the current position of @p file
+ *
+ * @param[in] file:         The file to read from
+ * @param[out] header:      The decoded header
+ *
+ * @throws BAD_TRACE_FILE   When the header is missing, has the wrong magic
+ *                          bytes, or is an unsupported version
+ */
+void BinaryTrace_ReadHeader(FILE * file, binary_trace_header_t * header);
+
+/**@brief   Read up to @p max_accesses records from @p file
+ *
+ * @param[in] file:         The file to read from. Should be positioned just
+ *                          after the header, or just after a previous read
+ * @param[out] accesses:    Space for at least @p max_accesses accesses
+ * @param[in] max_accesses: Maximum number of accesses to read
+ *
+ * @return  The number of accesses read. Zero indicates the end of the trace
+ *
+ * @throws BAD_TRACE_FILE   When the file ends partway through a record
+ */
+uint32_t BinaryTrace_Read(FILE * file, access_t * accesses, uint32_t max_accesses);
+
+/**@brief   Write @p n_accesses records to @p file
+ *
+ * @param[in] file:         The file to write to
+ * @param[in] accesses:     The accesses to write
+ * @param[in] n_accesses:   Number of accesses in @p accesses
+ *
+ * @throws BAD_TRACE_FILE   When the records could not be written
+ */
+void BinaryTrace_Write(FILE * file, access_t const * accesses, uint32_t n_accesses);
+
+/** @} defgroup BINARYTRACE */
+
+#endif /* ifndef BINARYTRACE_H */
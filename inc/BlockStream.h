@@ -0,0 +1,84 @@
+/**
+ * @file    BlockStream.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BlockStream Interface
+ */
+
+#ifndef BLOCKSTREAM_H
+#define BLOCKSTREAM_H
+
+/**@defgroup BLOCKSTREAM BlockStream
+ * @{
+ *
+ * @brief   Decompresses the blocks of a block trace (see @ref BLOCKTRACE) on
+ *          every core, and delivers them in order
+ *
+ * Worker threads take blocks in order and decompress each into a slot of a
+ * ring shared with the consumer. A worker may run up to a ring's length ahead
+ * of the consumer; once the consumer is done with a block, its slot is reused.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a block stream */
+typedef struct _block_stream_t * block_stream_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Start decompressing a block trace
+ *
+ * @param[in] fd:           The block trace. Must remain open until the stream
+ *                          is destroyed
+ * @param[in] first_record: Record to start at (counting from zero). Blocks
+ *                          before the one holding it are never read
+ * @param[in] n_threads:    Number of decompression threads, or zero for one
+ *                          per online core
+ *
+ * @return  A new block stream, or NULL if memory allocation failed
+ *
+ * @throws BAD_TRACE_FILE       When the trace's index is invalid, or the
+ *                              threads can't be started
+ * @throws ALLOCATION_FAILURE   When the index could not be allocated
+ */
+block_stream_t BlockStream_Create(int fd, uint64_t first_record, uint32_t n_threads);
+
+/**@brief   Stop decompression, and free all memory used by @p stream
+ *
+ * @param[in] stream:   The stream to destroy
+ */
+void BlockStream_Destroy(block_stream_t stream);
+
+/**@brief   Get the total number of records in the trace
+ *
+ * @param[in] stream:   The stream
+ *
+ * @return  The number of records, including any before the first record
+ */
+uint64_t BlockStream_Records(block_stream_t stream);
+
+/**@brief   Wait for the next block of records
+ *
+ * The block returned by the previous call is handed back to the decompressors
+ *
+ * @param[in,out] stream:   The stream to read
+ * @param[out] length:      Length of the returned records [bytes]
+ * @param[out] last:        Whether this is the trace's final block
+ *
+ * @return  The records, in the format described in @ref BINARYTRACE
+ *
+ * @throws BAD_TRACE_FILE   When the block is corrupt or can't be read
+ */
+char const * BlockStream_Next(block_stream_t stream, size_t * length, bool * last);
+
+/** @} defgroup BLOCKSTREAM */
+
+#endif /* ifndef BLOCKSTREAM_H */
@@ -0,0 +1,241 @@
+/**
+ * @file    BlockTrace.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BlockTrace Interface
+ */
+
+#ifndef BLOCKTRACE_H
+#define BLOCKTRACE_H
+
+/**@defgroup BLOCKTRACE BlockTrace
+ * @{
+ *
+ * @brief   A seekable container of independently compressed binary trace
+ *          blocks
+ *
+ * The trace is split into blocks of up to a fixed number of records (in the
+ * format described in @ref BINARYTRACE), each compressed on its own with zlib. Since
+ * no block depends on another, blocks can be decompressed in parallel, and a
+ * reader can start at any block without touching those before it.
+ *
+ * Layout (all multi-byte fields little-endian):
+ *
+ * Section | Size                | Contents
+ * ------- | ------------------- | ------------------------------------------
+ * Header  | 24                  | "SIMBLOCK", version (4), record size (4),
+ *         |                     | records per block (4), reserved (4)
+ * Blocks  | variable            | Each block's compressed records
+ * Index   | 24 per block        | Per block: byte offset (8), number of the
+ *         |                     | first record (8), compressed length (4),
+ *         |                     | number of records (4)
+ * Trailer | 32                  | Index offset (8), number of blocks (8),
+ *         |                     | number of records (8), "SIMINDEX"
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Magic bytes identifying a block trace */
+#define BLOCK_TRACE_MAGIC           "SIMBLOCK"
+
+/**@brief   Magic bytes ending a block trace's trailer */
+#define BLOCK_TRACE_INDEX_MAGIC     "SIMINDEX"
+
+/**@brief   Current version of the block trace format */
+#define BLOCK_TRACE_VERSION         (1)
+
+/**@brief   Size of the on-disk header [bytes] */
+#define BLOCK_TRACE_HEADER_SIZE     (24)
+
+/**@brief   Size of a single on-disk index entry [bytes] */
+#define BLOCK_TRACE_ENTRY_SIZE      (24)
+
+/**@brief   Size of the on-disk trailer [bytes] */
+#define BLOCK_TRACE_TRAILER_SIZE    (32)
+
+/**@brief   Records per block, unless the writer is told otherwise */
+#define BLOCK_TRACE_DEFAULT_LEN     (65536)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Where to find a single block */
+typedef struct {
+    uint64_t offset;            /**< Byte offset of the compressed block */
+    uint64_t first_record;      /**< Number of the block's first record */
+    uint32_t compressed_length; /**< Length of the compressed block [bytes] */
+    uint32_t n_records;         /**< Number of records in the block */
+} block_trace_entry_t;
+
+/**@brief   Decoded form of a block trace's index */
+typedef struct {
+    uint32_t block_len;             /**< Records per (full) block */
+    uint64_t n_blocks;              /**< Number of blocks */
+    uint64_t n_records;             /**< Number of records in the trace */
+    block_trace_entry_t * entries;  /**< One entry per block */
+} block_trace_index_t;
+
+/**@brief   Instance of a block trace writer */
+typedef struct _block_trace_writer_t * block_trace_writer_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Determine whether @p fd holds a block trace
+ *
+ * @note    The file's position is not changed
+ *
+ * @param[in] fd:   The file to check
+ *
+ * @return  Whether the file begins with @ref BLOCK_TRACE_MAGIC
+ */
+bool BlockTrace_IsBlockTrace(int fd);
+
+/**@brief   Read and validate the header and index of a block trace
+ *
+ * @note    The file's position is not changed
+ *
+ * @param[in] fd:       The file to read
+ * @param[out] index:   The decoded index. Must be freed with @ref
+ *                      BlockTrace_FreeIndex
+ *
+ * @throws BAD_TRACE_FILE       When the header, trailer or index is invalid
+ * @throws ALLOCATION_FAILURE   When the index could not be allocated
+ */
+void BlockTrace_ReadIndex(int fd, block_trace_index_t * index);
+
+/**@brief   Free the memory used by an index
+ *
+ * @param[in] index:    The index to free
+ */
+void BlockTrace_FreeIndex(block_trace_index_t * index);
+
+/**@brief   Find the block holding a particular record
+ *
+ * @param[in] index:    The trace's index
+ * @param[in] record:   The record to find (counting from zero)
+ *
+ * @return  The block holding @p record, or @p index->n_blocks if the trace
+ *          ends before it
+ */
+uint64_t BlockTrace_FindBlock(block_trace_index_t const * index, uint64_t record);
+
+/**@brief   Decompress a single block
+ *
+ * @note    This doesn't throw, so it may be called from any thread
+ *
+ * @param[out] records:     Space for the block's records (@p entry->n_records
+ *                          times @ref BINARY_TRACE_RECORD_SIZE bytes)
+ * @param[in] compressed:   The compressed block
+ * @param[in] entry:        The block's index entry
+ *
+ * @return  Whether the block decompressed to exactly the expected length
+ */
+bool BlockTrace_DecompressBlock(uint8_t * records,
+                                uint8_t const * compressed,
+                                block_trace_entry_t const * entry);
+
+/**@brief   Get the most space a compressed block could need
+ *
+ * @param[in] n_records:    Number of records in the block
+ *
+ * @return  The size of the buffer to pass to @ref BlockTrace_CompressBlock
+ *          [bytes]
+ */
+size_t BlockTrace_CompressBound(uint32_t n_records);
+
+/**@brief   Compress a single block
+ *
+ * @note    This doesn't throw, so it may be called from any thread
+ *
+ * @param[out] compressed:  Space for the compressed block (see @ref
+ *                          BlockTrace_CompressBound)
+ * @param[out] length:      Length of the compressed block [bytes]
+ * @param[in] records:      The block's encoded records
+ * @param[in] n_records:    Number of records in the block
+ *
+ * @return  Whether the block was compressed
+ */
+bool BlockTrace_CompressBlock(uint8_t * compressed,
+                              size_t * length,
+                              uint8_t const * records,
+                              uint32_t n_records);
+
+/**@brief   Start writing a block trace
+ *
+ * The header is written immediately
+ *
+ * @param[in] file:         The file to write. Doesn't need to be seekable
+ * @param[in] block_len:    Records per block
+ *
+ * @return  A new writer, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When @p block_len is zero
+ * @throws BAD_TRACE_FILE   When the header could not be written
+ */
+block_trace_writer_t BlockTrace_CreateWriter(FILE * file, uint32_t block_len);
+
+/**@brief   Free all memory used by @p writer
+ *
+ * @note    This does not finish the trace; see @ref BlockTrace_Finish
+ *
+ * @param[in] writer:   The writer to destroy
+ */
+void BlockTrace_DestroyWriter(block_trace_writer_t writer);
+
+/**@brief   Append accesses to the trace
+ *
+ * Each time a block fills, it is compressed and written
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] accesses:     The accesses to append
+ * @param[in] n_accesses:   Number of accesses in @p accesses
+ *
+ * @throws BAD_TRACE_FILE       When a block could not be written
+ * @throws ALLOCATION_FAILURE   When the index could not grow
+ */
+void BlockTrace_Write(block_trace_writer_t writer,
+                      access_t const * accesses,
+                      uint32_t n_accesses);
+
+/**@brief   Append a block compressed elsewhere to the trace
+ *
+ * Any accesses appended with @ref BlockTrace_Write are written as a (short)
+ * block first, to keep the trace in order
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] compressed:   The block, from @ref BlockTrace_CompressBlock
+ * @param[in] length:       Length of @p compressed [bytes]
+ * @param[in] n_records:    Number of records in the block
+ *
+ * @throws ARGUMENT_ERROR       When the block holds more records than the
+ *                              writer's block length
+ * @throws BAD_TRACE_FILE       When the block could not be written
+ * @throws ALLOCATION_FAILURE   When the index could not grow
+ */
+void BlockTrace_WriteBlock(block_trace_writer_t writer,
+                           uint8_t const * compressed,
+                           size_t length,
+                           uint32_t n_records);
+
+/**@brief   Write the final (partial) block, the index, and the trailer
+ *
+ * @param[in,out] writer:   The writer
+ *
+ * @return  The number of records in the trace
+ *
+ * @throws BAD_TRACE_FILE   When the trace could not be written
+ */
+uint64_t BlockTrace_Finish(block_trace_writer_t writer);
+
+/** @} defgroup BLOCKTRACE */
+
+#endif /* ifndef BLOCKTRACE_H */
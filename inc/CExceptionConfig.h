@@ -27,6 +27,17 @@
 /**@brief   An exception's type */
 #define CEXCEPTION_T volatile unsigned int
 
+/**@brief   Number of threads which may use exceptions at once */
+#define CEXCEPTION_NUM_ID   (16)
+
+/**@brief   Index of the calling thread's exception stack
+ *
+ * @note    The main thread uses index zero. Any other thread which uses
+ *          exceptions must set @ref exception_thread_id to its own, unique,
+ *          index before doing so
+ */
+#define CEXCEPTION_GET_ID   (exception_thread_id)
+
 /* --- PUBLIC DATATYPES ----------------------------------------------------- */
 /* --- PUBLIC MACROS -------------------------------------------------------- */
 
@@ -47,8 +58,13 @@
 
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 
-extern const char * exception_file; /**< File that caused an exception */
-extern unsigned int exception_line; /**< Line that caused an exception */
+extern _Thread_local const char * exception_file;    /**< File that caused an
+                                                         exception */
+extern _Thread_local unsigned int exception_line;    /**< Line that caused an
+                                                         exception */
+extern _Thread_local unsigned int exception_thread_id; /**< Index of this
+                                                           thread's exception
+                                                           stack */
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
@@ -16,6 +16,8 @@
 
 /* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
 
+#include "Access.h"
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -97,6 +99,11 @@ bool CacheData_Contains(cache_data_t data, uint64_t address);
  *
  * @return                  The address of the dirty block being kicked out (if
  *                          any), or 0 if no dirty block was kicked out
+ *
+ * @throws ALLOCATION_FAILURE   When a large cache, which keeps only 32 bits
+ *                              of each block's tag, is first given an address
+ *                              too wide for its tag to fit, and can't make
+ *                              room to keep full addresses instead
  */
 uint64_t CacheData_Write(cache_data_t data, uint64_t address, result_t * result);
 
@@ -108,9 +115,54 @@ uint64_t CacheData_Write(cache_data_t data, uint64_t address, result_t * result)
  *
  * @return                  The address of the dirty block being kicked out (if
  *                          any), or 0 if no dirty block was kicked out
+ *
+ * @throws ALLOCATION_FAILURE   When a large cache, which keeps only 32 bits
+ *                              of each block's tag, is first given an address
+ *                              too wide for its tag to fit, and can't make
+ *                              room to keep full addresses instead
  */
 uint64_t CacheData_Read(cache_data_t data, uint64_t address, result_t * result);
 
+/**@brief   Start loading the host memory an access to @p address will look at
+ *
+ * Only a hint to the host: the cache's contents don't change. Issued some
+ * accesses ahead, it hides the host's cache misses on large caches' sets.
+ * Caches small enough to stay in the host's caches ignore it
+ *
+ * @param[in] data:         The cache data that will be accessed
+ * @param[in] address:      The address that will be accessed
+ */
+void CacheData_Prefetch(cache_data_t data, uint64_t address);
+
+/**@brief   Whether @ref CacheData_Prefetch() does anything for @p data
+ *
+ * @param[in] data:         The cache data
+ *
+ * @return  False if the cache is small enough to ignore prefetches
+ */
+bool CacheData_PrefetchEnabled(cache_data_t data);
+
+/**@brief   Simulate a batch of accesses, strictly in order
+ *
+ * Equivalent to a @ref CacheData_Write() for each write in @p accesses and a
+ * @ref CacheData_Read() for each other access, but prefetches each access'
+ * set a few accesses before it is simulated
+ *
+ * @param[in,out] data:                 The cache data to access
+ * @param[in] accesses:                 The accesses
+ * @param[in] n_accesses:               The number of accesses
+ * @param[out] results:                 Each access' result
+ * @param[out] dirty_kickout_addresses: The address of the dirty block each
+ *                                      access kicked out, or 0 if none
+ *
+ * @throws ALLOCATION_FAILURE   As @ref CacheData_Read() does
+ */
+void CacheData_AccessBatch(cache_data_t data,
+                           access_t const * accesses,
+                           uint32_t n_accesses,
+                           result_t * results,
+                           uint64_t * dirty_kickout_addresses);
+
 /**@brief   Print the contents of the cache
  *
  * @param[in] data:         The cache data to dump
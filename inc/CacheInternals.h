@@ -18,12 +18,20 @@
 
 #include "Access.h"
 #include "Config.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 
 #include <stdbool.h>
 #include <stdint.h>
 
 /* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   The number of distinct @ref result_t values */
+#define CACHE_N_RESULTS     (RESULT_MISS_DIRTY_KICKOUT + 1)
+
+/**@brief   Most stack distance counters one cache may have attached */
+#define CACHE_MAX_STACK_DISTANCES   (2)
+
 /* --- PUBLIC DATATYPES ----------------------------------------------------- */
 
 /**@brief   Type of a cache */
@@ -38,6 +46,21 @@ typedef struct _cache_t * cache_t;
  */
 typedef uint32_t (*mem_access_f_t)(void * mem, access_t const * access);
 
+/**@brief   The outcome of looking accesses up in a single memory level, before
+ *          any accesses to the next
+ */
+typedef struct {
+    result_t result;                /**< The first access' result */
+    uint32_t n_hits;                /**< The number of accesses after the
+                                         first, which are all hits */
+    uint32_t cycles;                /**< Cycles spent at this level */
+    uint64_t dirty_kickout_address; /**< The block to write back, if @ref
+                                         result is @ref
+                                         RESULT_MISS_DIRTY_KICKOUT */
+    uint32_t block_size_bytes;      /**< Size of each transfer to or from the
+                                         next level [bytes] */
+} cache_lookup_t;
+
 /* --- PUBLIC MACROS -------------------------------------------------------- */
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
@@ -65,6 +88,81 @@ cache_t CacheInternals_Create(mem_access_f_t sub_access_f,
  */
 void CacheInternals_Destroy(cache_t cache);
 
+/**@brief   Look @p n_accesses accesses to one block up in this level alone
+ *
+ * Updates the cache's data as @ref CacheInternals_Access() would, but leaves
+ * accessing the next level to the caller. Hits are recorded in the statistics
+ * here. Misses, from @ref RESULT_MISS on, are left for the caller to record
+ * with @ref CacheInternals_Record() once it has accessed the next level
+ *
+ * @param[in,out] cache:        The cache to access
+ * @param[in] access:           The first access
+ * @param[in] n_accesses:       The number of accesses of the same type to the
+ *                              same block. At least 1
+ * @param[out] lookup:          What the next level has to do, and what this
+ *                              level cost
+ */
+void CacheInternals_Lookup(cache_t cache,
+                           access_t const * access,
+                           uint32_t n_accesses,
+                           cache_lookup_t * lookup);
+
+/**@brief   Record the statistics of a lookup
+ *
+ * @param[in,out] cache:        The cache that was accessed
+ * @param[in] lookup:           The lookup's outcome
+ */
+void CacheInternals_Record(cache_t cache, cache_lookup_t const * lookup);
+
+/**@brief   Simulate accesses to this memory level, and through it to the next
+ *
+ * The next level is given by the caller rather than taken from the cache, so
+ * that a caller that knows it at compile time can have the call to it inlined
+ *
+ * @param[in,out] cache:        The cache to access
+ * @param[in] access:           The first access
+ * @param[in] n_accesses:       The number of accesses of the same type to the
+ *                              same block. At least 1
+ * @param[in] sub_access_f:     Accesses the next level
+ * @param[in] sub_mem:          The next level
+ *
+ * @return                      The total cycles the accesses consumed
+ */
+static inline uint32_t CacheInternals_AccessThrough(cache_t cache,
+                                                    access_t const * access,
+                                                    uint32_t n_accesses,
+                                                    mem_access_f_t sub_access_f,
+                                                    void * sub_mem)
+{
+    cache_lookup_t lookup;
+    CacheInternals_Lookup(cache, access, n_accesses, &lookup);
+
+    uint32_t access_time_cycles = lookup.cycles;
+
+    // Every result from RESULT_MISS on brought the block in from below
+    if (lookup.result >= RESULT_MISS) {
+        if (lookup.result == RESULT_MISS_DIRTY_KICKOUT) {
+            access_t dirty_write = {
+                .type    = TYPE_WRITE,
+                .address = lookup.dirty_kickout_address,
+                .n_bytes = lookup.block_size_bytes,
+            };
+            access_time_cycles += sub_access_f(sub_mem, &dirty_write);
+        }
+
+        access_t miss_read = {
+            .type    = TYPE_READ,
+            .address = access->address,
+            .n_bytes = lookup.block_size_bytes,
+        };
+        access_time_cycles += sub_access_f(sub_mem, &miss_read);
+
+        CacheInternals_Record(cache, &lookup);
+    }
+
+    return access_time_cycles;
+}
+
 /**@brief   Simulate an access to this memory level
  *
  * Accesses the next memory level if a miss (and possibly dirty kickout)
@@ -77,6 +175,29 @@ void CacheInternals_Destroy(cache_t cache);
  */
 uint32_t CacheInternals_Access(cache_t cache, access_t const * access);
 
+/**@brief   Have every later lookup in @p cache also counted by
+ *          @p stack_distance, as well as any counters already attached
+ *
+ * @param[in,out] cache:        The cache
+ * @param[in] stack_distance:   The counter, or NULL to detach every counter
+ *
+ * @throws ARGUMENT_ERROR   When @ref CACHE_MAX_STACK_DISTANCES counters are
+ *                          already attached
+ */
+void CacheInternals_AttachStackDistance(cache_t cache, stack_distance_t stack_distance);
+
+/**@brief   Start loading the host memory an access to @p address will look at
+ *
+ * @note    Thin wrapper around @ref CacheData_Prefetch()
+ */
+void CacheInternals_Prefetch(cache_t cache, uint64_t address);
+
+/**@brief   Whether @ref CacheInternals_Prefetch() does anything for @p cache
+ *
+ * @note    Thin wrapper around @ref CacheData_PrefetchEnabled()
+ */
+bool CacheInternals_PrefetchEnabled(cache_t cache);
+
 /**@brief   Prints the cache's current state
  *
  * @note    Thin wrapper around @ref CacheData_Print()
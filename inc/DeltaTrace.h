@@ -0,0 +1,273 @@
+/**
+ * @file    DeltaTrace.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   DeltaTrace Interface
+ */
+
+#ifndef DELTATRACE_H
+#define DELTATRACE_H
+
+/**@defgroup DELTATRACE DeltaTrace
+ * @{
+ *
+ * @brief   A compact trace encoding, with each access type in its own stream
+ *          and sequential instruction fetches collapsed into runs
+ *
+ * The trace is split into chunks of up to a fixed number of records. Within a
+ * chunk, consecutive instruction fetches that each start where the last ended
+ * are stored as a single run: its start address and the number of bytes it
+ * covers, with the size of each fetch kept separately. Reads and writes are
+ * stored one at a time. Every address is stored as the difference from the
+ * previous one of its type (for a run, from where the previous run ended), as
+ * a zigzag-encoded varint. Each kind of field goes in a stream of its own, and
+ * each stream is deflated on its own, so that similar values sit together.
+ * Chunks don't depend on one another, so can be encoded or decoded in any
+ * order.
+ *
+ * Layout (all fixed-width fields little-endian):
+ *
+ * Section   | Size      | Contents
+ * --------- | --------- | -------------------------------------------------
+ * Header    | 24        | "SIMDELTA", version (4), records per chunk (4),
+ *           |           | reserved (8)
+ * Chunks    | variable  | Chunk header, then each stream's deflated bytes
+ * End       | 64        | A chunk header holding no records
+ *
+ * Chunk header (64 bytes): number of records (4), length of the deflated
+ * streams (4), then for each of the @ref DELTA_TRACE_N_STREAMS streams its
+ * inflated length (4) and deflated length (4). The streams are:
+ *
+ * Stream       | Contents, per entry
+ * ------------ | -----------------------------------------------------------
+ * Operations   | Type of each run, in trace order (1 byte)
+ * Runs         | Instruction run start delta, bytes covered (varints)
+ * Fetch sizes  | Size of each instruction fetch (varint)
+ * Reads        | Read address delta (varint)
+ * Read sizes   | Size of each read (varint)
+ * Writes       | Write address delta (varint)
+ * Write sizes  | Size of each write (varint)
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Magic bytes identifying a delta trace */
+#define DELTA_TRACE_MAGIC           "SIMDELTA"
+
+/**@brief   Current version of the delta trace format */
+#define DELTA_TRACE_VERSION         (1)
+
+/**@brief   Size of the on-disk header [bytes] */
+#define DELTA_TRACE_HEADER_SIZE     (24)
+
+/**@brief   Number of streams in each chunk */
+#define DELTA_TRACE_N_STREAMS       (7)
+
+/**@brief   Size of each chunk's header [bytes] */
+#define DELTA_TRACE_CHUNK_HEADER_SIZE   (8 + 8 * DELTA_TRACE_N_STREAMS)
+
+/**@brief   Records per chunk, unless the writer is told otherwise */
+#define DELTA_TRACE_DEFAULT_LEN     (65536)
+
+/**@brief   Most records a chunk may hold */
+#define DELTA_TRACE_MAX_LEN         (1 << 20)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a chunk encoder */
+typedef struct _delta_trace_encoder_t * delta_trace_encoder_t;
+
+/**@brief   Instance of a chunk decoder */
+typedef struct _delta_trace_decoder_t * delta_trace_decoder_t;
+
+/**@brief   Instance of a delta trace writer */
+typedef struct _delta_trace_writer_t * delta_trace_writer_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Check a delta trace's header
+ *
+ * @param[in] header:   The first @ref DELTA_TRACE_HEADER_SIZE bytes of the
+ *                      trace
+ *
+ * @throws BAD_TRACE_FILE   When the magic, version or chunk length is wrong
+ */
+void DeltaTrace_CheckHeader(uint8_t const * header);
+
+/**@brief   Create an encoder, which holds the space needed to encode chunks
+ *
+ * @return  A new encoder, or NULL if memory allocation failed
+ */
+delta_trace_encoder_t DeltaTrace_CreateEncoder(void);
+
+/**@brief   Free all memory used by @p encoder
+ *
+ * @param[in] encoder:  The encoder to destroy
+ */
+void DeltaTrace_DestroyEncoder(delta_trace_encoder_t encoder);
+
+/**@brief   Encode accesses as a single chunk
+ *
+ * @note    Encoders are independent, so each thread may use its own
+ *
+ * @param[in,out] encoder:  The encoder
+ * @param[in] accesses:     The chunk's accesses
+ * @param[in] n_accesses:   Number of accesses, at most @ref
+ *                          DELTA_TRACE_MAX_LEN
+ * @param[out] chunk:       The encoded chunk, header included. Valid until the
+ *                          encoder is next used
+ *
+ * @return  Length of the encoded chunk [bytes]
+ *
+ * @throws ARGUMENT_ERROR       When there are no accesses or too many, or
+ *                              an access is invalid
+ * @throws ALLOCATION_FAILURE   When the streams could not be allocated
+ * @throws BAD_TRACE_FILE       When a stream could not be deflated
+ */
+size_t DeltaTrace_EncodeChunk(delta_trace_encoder_t encoder,
+                              access_t const * accesses,
+                              uint32_t n_accesses,
+                              uint8_t const * * chunk);
+
+/**@brief   Create a decoder, which holds a decoded chunk
+ *
+ * @return  A new decoder, or NULL if memory allocation failed
+ */
+delta_trace_decoder_t DeltaTrace_CreateDecoder(void);
+
+/**@brief   Free all memory used by @p decoder
+ *
+ * @param[in] decoder:  The decoder to destroy
+ */
+void DeltaTrace_DestroyDecoder(delta_trace_decoder_t decoder);
+
+/**@brief   Decode the next chunk, replacing whatever the decoder held
+ *
+ * @param[in,out] decoder:  The decoder
+ * @param[in] data:         The trace, from the start of a chunk
+ * @param[in] length:       Bytes available in @p data
+ *
+ * @return  Length of the chunk [bytes], or zero if @p data doesn't hold all
+ *          of it
+ *
+ * @throws BAD_TRACE_FILE       When the chunk is corrupt
+ * @throws ALLOCATION_FAILURE   When the decoded chunk could not be allocated
+ */
+size_t DeltaTrace_DecodeChunk(delta_trace_decoder_t decoder,
+                              uint8_t const * data,
+                              size_t length);
+
+/**@brief   Check whether the last chunk decoded ended the trace
+ *
+ * @param[in] decoder:  The decoder
+ *
+ * @return  Whether the end of the trace has been decoded
+ */
+bool DeltaTrace_Ended(delta_trace_decoder_t decoder);
+
+/**@brief   Take the next accesses from the decoded chunk
+ *
+ * @param[in,out] decoder:  The decoder
+ * @param[out] accesses:    Space for at least @p max_accesses accesses
+ * @param[in] max_accesses: Maximum number of accesses to take
+ *
+ * @return  Number of accesses taken. Zero once the chunk is used up
+ */
+uint32_t DeltaTrace_ReadAccesses(delta_trace_decoder_t decoder,
+                                 access_t * accesses,
+                                 uint32_t max_accesses);
+
+/**@brief   Take the next runs from the decoded chunk
+ *
+ * A run partly taken as accesses is returned as the part that remains.
+ *
+ * @param[in,out] decoder:  The decoder
+ * @param[out] runs:        Space for at least @p max_runs runs. Their sizes
+ *                          are valid until the next chunk is decoded
+ * @param[in] max_runs:     Maximum number of runs to take
+ *
+ * @return  Number of runs taken. Zero once the chunk is used up
+ */
+uint32_t DeltaTrace_ReadRuns(delta_trace_decoder_t decoder,
+                             access_run_t * runs,
+                             uint32_t max_runs);
+
+/**@brief   Start writing a delta trace
+ *
+ * The header is written immediately
+ *
+ * @param[in] file:         The file to write. Doesn't need to be seekable
+ * @param[in] chunk_len:    Records per chunk
+ *
+ * @return  A new writer, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When @p chunk_len is zero or more than @ref
+ *                          DELTA_TRACE_MAX_LEN
+ * @throws BAD_TRACE_FILE   When the header could not be written
+ */
+delta_trace_writer_t DeltaTrace_CreateWriter(FILE * file, uint32_t chunk_len);
+
+/**@brief   Free all memory used by @p writer
+ *
+ * @note    This does not finish the trace; see @ref DeltaTrace_Finish
+ *
+ * @param[in] writer:   The writer to destroy
+ */
+void DeltaTrace_DestroyWriter(delta_trace_writer_t writer);
+
+/**@brief   Append accesses to the trace
+ *
+ * Each time a chunk fills, it is encoded and written
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] accesses:     The accesses to append
+ * @param[in] n_accesses:   Number of accesses in @p accesses
+ *
+ * @throws ARGUMENT_ERROR   When an access is invalid
+ * @throws BAD_TRACE_FILE   When a chunk could not be written
+ */
+void DeltaTrace_Write(delta_trace_writer_t writer,
+                      access_t const * accesses,
+                      uint32_t n_accesses);
+
+/**@brief   Append a chunk encoded elsewhere (see @ref DeltaTrace_EncodeChunk)
+ *
+ * Any accesses already appended are written as a chunk of their own first.
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] chunk:        The encoded chunk
+ * @param[in] length:       Length of @p chunk [bytes]
+ * @param[in] n_records:    Records in the chunk
+ *
+ * @throws ARGUMENT_ERROR   When the chunk holds more records than the
+ *                          writer's chunks may
+ * @throws BAD_TRACE_FILE   When the chunk could not be written
+ */
+void DeltaTrace_WriteChunk(delta_trace_writer_t writer,
+                           uint8_t const * chunk,
+                           size_t length,
+                           uint32_t n_records);
+
+/**@brief   Write any buffered accesses, and end the trace
+ *
+ * @param[in,out] writer:   The writer
+ *
+ * @return  The total number of records written
+ *
+ * @throws BAD_TRACE_FILE   When the trace could not be written
+ */
+uint64_t DeltaTrace_Finish(delta_trace_writer_t writer);
+
+/** @} defgroup DELTATRACE */
+
+#endif /* ifndef DELTATRACE_H */
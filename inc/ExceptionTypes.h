@@ -35,6 +35,7 @@ enum EXCEPTION_TYPES {
     BAD_CONFIG_FILE,        /**< Invalid configuration file */
     INVALID_OPERATION,      /**< Bad operation specifier */
     INVALID_ACCESS_SIZE,    /**< Bad number of bytes accessed */
+    BAD_TRACE_FILE,         /**< Unreadable or malformed trace file */
     MAX_EXCEPTION_N,        /**< Total number of exception types */
     INVALID_EXCEPTION       /**< An invalid exception */
 };
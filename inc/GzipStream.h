@@ -0,0 +1,89 @@
+/**
+ * @file    GzipStream.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   GzipStream Interface
+ */
+
+#ifndef GZIPSTREAM_H
+#define GZIPSTREAM_H
+
+/**@defgroup GZIPSTREAM GzipStream
+ * @{
+ *
+ * @brief   Decompresses a gzip file on its own thread
+ *
+ * The decompressor fills a small ring of large blocks, which are handed to the
+ * consumer whole. While the consumer works through one block, the next is
+ * being inflated.
+ *
+ * Each block is preceded by some headroom, so the consumer can carry the
+ * unconsumed tail of one block (e.g. a partial line) into the front of the
+ * next without a second buffer.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   The two bytes every gzip file begins with */
+#define GZIP_STREAM_MAGIC   "\x1f\x8b"
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a gzip stream */
+typedef struct _gzip_stream_t * gzip_stream_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Start decompressing a gzip file
+ *
+ * @param[in] fd:       The compressed file. It is duplicated, so the caller
+ *                      remains responsible for closing it
+ * @param[in] headroom: Bytes reserved before each block [bytes]
+ *
+ * @return  A new gzip stream, or NULL if memory allocation failed
+ *
+ * @throws BAD_TRACE_FILE   When the file can't be opened, or the decompression
+ *                          thread can't be started
+ */
+gzip_stream_t GzipStream_Create(int fd, size_t headroom);
+
+/**@brief   Stop decompression, and free all memory used by @p stream
+ *
+ * @param[in] stream:   The stream to destroy
+ */
+void GzipStream_Destroy(gzip_stream_t stream);
+
+/**@brief   Wait for the next block of decompressed data
+ *
+ * The block returned by the previous call is handed back to the decompressor,
+ * after @p carry has been copied out of it.
+ *
+ * @param[in,out] stream:   The stream to read
+ * @param[in] carry:        Bytes to place in front of the new block. May point
+ *                          into the previous block
+ * @param[in] n_carry:      Length of @p carry. Must not exceed the headroom
+ *                          given at creation [bytes]
+ * @param[out] length:      Length of the returned data, including @p carry
+ *                          [bytes]
+ * @param[out] last:        Whether this is the final block of the file
+ *
+ * @return  The start of the data (the carried bytes, then the new block)
+ *
+ * @throws BAD_TRACE_FILE   When the file is corrupt or truncated
+ */
+char const * GzipStream_Next(gzip_stream_t stream,
+                             char const * carry,
+                             size_t n_carry,
+                             size_t * length,
+                             bool * last);
+
+/** @} defgroup GZIPSTREAM */
+
+#endif /* ifndef GZIPSTREAM_H */
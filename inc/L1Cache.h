@@ -19,12 +19,18 @@
 #include "Access.h"
 #include "Config.h"
 #include "L2Cache.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 
 #include <stdbool.h>
 #include <stdint.h>
 
 /* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Width of the bus into an L1 cache. Every L1 access is this size
+ *          [bytes]
+ */
+#define L1_BUS_WIDTH_BYTES  (4)
 /* --- PUBLIC DATATYPES ----------------------------------------------------- */
 
 /**@brief   Instance of an L1 cache */
@@ -63,6 +69,49 @@ void L1Cache_Destroy(l1_cache_t cache);
  */
 uint32_t L1Cache_Access(l1_cache_t cache, access_t const * access);
 
+/**@brief   Simulate an access spanning several bus words
+ *
+ * Equivalent to an @ref L1Cache_Access() for each @ref L1_BUS_WIDTH_BYTES word
+ * in the span, in order. Words after the first in each block are hits, so each
+ * block is only looked up once
+ *
+ * @param[in,out] cache:    The cache to access
+ * @param[in] access:       Access descriptor. Its address and size must both
+ *                          be multiples of @ref L1_BUS_WIDTH_BYTES
+ *
+ * @return  The total number of cycles to resolve every word
+ */
+uint32_t L1Cache_AccessSpan(l1_cache_t cache, access_t const * access);
+
+/**@brief   Simulate a batch of trace accesses, strictly in order
+ *
+ * Instruction fetches go to @p instr_cache and every other access to @p
+ * data_cache. Each access is aligned to the bus, and simulated as @ref
+ * L1Cache_AccessSpan() would. Both caches' sets, and the L2's, are
+ * prefetched a few accesses before they are needed
+ *
+ * @param[in,out] instr_cache:  The instruction cache
+ * @param[in,out] data_cache:   The data cache. Must share an L2 cache with
+ *                              @p instr_cache
+ * @param[in] accesses:         The accesses, as read from a trace
+ * @param[in] n_accesses:       The number of accesses
+ * @param[out] cycles:          The cycles each access took
+ * @param[out] n_aligned:       The number of bus words each access covered
+ */
+void L1Cache_AccessBatch(l1_cache_t instr_cache,
+                         l1_cache_t data_cache,
+                         access_t const * accesses,
+                         uint32_t n_accesses,
+                         uint32_t * cycles,
+                         uint32_t * n_aligned);
+
+/**@brief   Have every later lookup in the cache also counted by
+ *          @p stack_distance
+ *
+ * @note    Thin wrapper around @ref CacheInternals_AttachStackDistance()
+ */
+void L1Cache_AttachStackDistance(l1_cache_t l1_cache, stack_distance_t stack_distance);
+
 /**@brief   Print the current cache contents
  *
  * @param[in] l1_cache:     The cache instance to print
@@ -17,7 +17,9 @@
 
 #include "Access.h"
 #include "Config.h"
+#include "L2Stream.h"
 #include "MainMem.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 
 #include <stdbool.h>
@@ -62,6 +64,36 @@ void L2Cache_Destroy(l2_cache_t cache);
  */
 uint32_t L2Cache_Access(l2_cache_t cache, access_t const * access);
 
+/**@brief   Start loading the host memory an access to @p address will look at
+ *
+ * @param[in] cache:        The cache that will be accessed
+ * @param[in] address:      The address that will be accessed
+ */
+void L2Cache_Prefetch(l2_cache_t cache, uint64_t address);
+
+/**@brief   Whether @ref L2Cache_Prefetch() does anything for @p cache
+ *
+ * @param[in] cache:        The cache
+ *
+ * @return  False if the cache is small enough to ignore prefetches
+ */
+bool L2Cache_PrefetchEnabled(l2_cache_t cache);
+
+/**@brief   Have every later access to the cache also counted by
+ *          @p stack_distance
+ *
+ * @note    Thin wrapper around @ref CacheInternals_AttachStackDistance()
+ */
+void L2Cache_AttachStackDistance(l2_cache_t cache, stack_distance_t stack_distance);
+
+/**@brief   Have every later access to the cache also recorded by
+ *          @p writer, with the cycles it took
+ *
+ * @param[in,out] cache:    The cache
+ * @param[in] writer:       The writer, or NULL to stop recording
+ */
+void L2Cache_AttachCapture(l2_cache_t cache, l2_stream_writer_t writer);
+
 /**@brief   Print the current cache contents
  *
  * @param[in] cache:        The cache instance to print
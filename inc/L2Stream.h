@@ -0,0 +1,184 @@
+/**
+ * @file    L2Stream.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   L2Stream Interface
+ */
+
+#ifndef L2STREAM_H
+#define L2STREAM_H
+
+/**@defgroup L2STREAM L2Stream
+ * @{
+ *
+ * @brief   A record of every access the L1 caches made to L2 during a
+ *          simulation, with everything else the L1 caches contributed to its
+ *          results, so that other L2 and main memory configurations can be
+ *          simulated without simulating L1 again
+ *
+ * Each access is a miss fill (a read) or a dirty write-back (a write) of a
+ * whole L1 block, made on behalf of one of the trace's references. The
+ * reference's type (its origin) is kept with the access, so that the cycles
+ * L2 takes can be charged to the right kind of reference. The L1 caches'
+ * statistics, and the cycles spent on each kind of reference outside L2, are
+ * kept at the end.
+ *
+ * Layout (all fixed-width fields little-endian):
+ *
+ * Section   | Size      | Contents
+ * --------- | --------- | -------------------------------------------------
+ * Header    | 16        | "SIML2STR", version (4), reserved (4)
+ * Records   | variable  | One per access, in order
+ * End       | 1         | @ref L2_STREAM_END_TAG
+ * Trailer   | 208       | L1 configuration (7 x 4, then 4 reserved), number
+ *           |           | of records (8), then for reads, writes and
+ *           |           | instruction fetches in turn: references, aligned
+ *           |           | references and cycles outside L2 (8 each), then
+ *           |           | for L1i and L1d in turn: hits, misses, kickouts,
+ *           |           | dirty kickouts, transfers and victim cache hits
+ *           |           | (8 each)
+ *
+ * Each record is a tag byte, holding the origin's index (instruction fetch,
+ * read, write) shifted left once, plus one for a write-back, followed by the
+ * access's address as a zigzag-encoded varint difference from the previous
+ * access made for the same L1 cache.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+#include "Config.h"
+#include "Statistics.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Magic bytes identifying an L2 stream */
+#define L2_STREAM_MAGIC             "SIML2STR"
+
+/**@brief   Current version of the L2 stream format */
+#define L2_STREAM_VERSION           (1)
+
+/**@brief   Size of the on-disk header [bytes] */
+#define L2_STREAM_HEADER_SIZE       (16)
+
+/**@brief   Size of the on-disk trailer [bytes] */
+#define L2_STREAM_TRAILER_SIZE      (208)
+
+/**@brief   Tag byte marking the end of the records */
+#define L2_STREAM_END_TAG           (0xff)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of an L2 stream writer */
+typedef struct _l2_stream_writer_t * l2_stream_writer_t;
+
+/**@brief   Instance of an L2 stream reader */
+typedef struct _l2_stream_reader_t * l2_stream_reader_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Start writing a stream to @p path
+ *
+ * @param[in] path:         The file to write, replacing any already there
+ * @param[in] l1_config:    The configuration of both L1 caches
+ *
+ * @return  A new writer, or NULL if memory allocation failed
+ *
+ * @throws BAD_TRACE_FILE   When the file could not be created
+ */
+l2_stream_writer_t L2Stream_CreateWriter(char const * path, cache_param_t const * l1_config);
+
+/**@brief   Close the file and free all memory used by @p writer
+ *
+ * @note    A stream not yet finished is left unreadable
+ *
+ * @param[in] writer:   The writer to destroy
+ */
+void L2Stream_DestroyWriter(l2_stream_writer_t writer);
+
+/**@brief   Set the type of the trace reference later accesses are made for
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] type:         One of @ref enum ACCESS_TYPE
+ *
+ * @throws INVALID_OPERATION    When @p type isn't an access type
+ */
+void L2Stream_SetOrigin(l2_stream_writer_t writer, uint8_t type);
+
+/**@brief   Record an access made to L2
+ *
+ * @param[in,out] writer:   The writer
+ * @param[in] access:       The access, of a whole L1 block
+ * @param[in] cycles:       Cycles L2 took to resolve the access
+ *
+ * @throws ARGUMENT_ERROR   When the access isn't the size of an L1 block
+ * @throws BAD_TRACE_FILE   When the records could not be written
+ */
+void L2Stream_Record(l2_stream_writer_t writer, access_t const * access, uint32_t cycles);
+
+/**@brief   End the stream, keeping the L1 results from @p stats
+ *
+ * @param[in,out] writer:   The writer. Nothing more may be recorded
+ * @param[in] stats:        The statistics of the simulation the stream was
+ *                          recorded from
+ *
+ * @throws BAD_TRACE_FILE   When the stream could not be written
+ */
+void L2Stream_Finish(l2_stream_writer_t writer, stats_t const * stats);
+
+/**@brief   Open a finished stream
+ *
+ * @param[in] path:     The file to read
+ *
+ * @return  A new reader, positioned at the first access, or NULL if memory
+ *          allocation failed
+ *
+ * @throws BAD_TRACE_FILE   When the file could not be read, or isn't a
+ *                          finished stream
+ */
+l2_stream_reader_t L2Stream_CreateReader(char const * path);
+
+/**@brief   Close the file and free all memory used by @p reader
+ *
+ * @param[in] reader:   The reader to destroy
+ */
+void L2Stream_DestroyReader(l2_stream_reader_t reader);
+
+/**@brief   The configuration of the L1 caches the stream was recorded with */
+cache_param_t const * L2Stream_Config(l2_stream_reader_t reader);
+
+/**@brief   Fill in everything the L1 caches contributed to @p stats
+ *
+ * Every reference's count, the cycles spent on them outside L2, and the L1
+ * caches' statistics are set. Cycles spent in L2 are left to be added as the
+ * stream is simulated.
+ *
+ * @param[in] reader:   The reader
+ * @param[in,out] stats:    Statistics, as created
+ */
+void L2Stream_ReadStats(l2_stream_reader_t reader, stats_t * stats);
+
+/**@brief   Read the next accesses from the stream
+ *
+ * @param[in,out] reader:   The reader
+ * @param[out] accesses:    Space for at least @p max_accesses accesses
+ * @param[out] origins:     Space for the type of the reference each access
+ *                          was made for
+ * @param[in] max_accesses: Maximum number of accesses to read
+ *
+ * @return  The number of accesses read. Zero at the end of the stream
+ *
+ * @throws BAD_TRACE_FILE   When the stream is corrupt
+ */
+uint32_t L2Stream_Read(l2_stream_reader_t reader,
+                       access_t * accesses,
+                       uint8_t * origins,
+                       uint32_t max_accesses);
+
+/** @} defgroup L2STREAM */
+
+#endif /* ifndef L2STREAM_H */
@@ -0,0 +1,137 @@
+/**
+ * @file    StackDistance.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   StackDistance Interface
+ */
+
+#ifndef STACKDISTANCE_H
+#define STACKDISTANCE_H
+
+/**@defgroup STACKDISTANCE StackDistance
+ * @{
+ *
+ * @brief   Counts, in a single pass, what a stream of accesses would do to a
+ *          family of LRU caches: either every power-of-two size at one
+ *          associativity, or every power-of-two associativity at one size
+ *
+ * Every cache shares a block size, and the @p i th holds @p 2^i sets. None
+ * has a victim cache. Each set of each cache keeps its blocks as a stack
+ * (Mattson et al.): an access hits when fewer than associativity other blocks
+ * of its set have been touched since it last was. That count is kept as a
+ * Fenwick tree over the set's accesses, in which only the latest access to
+ * each block is marked, so an access to any cache costs O(log n).
+ *
+ * Each cache's sets split those of the one before, as in Hill and Smith's
+ * all-associativity simulation, so a block on top of its set's stack in one
+ * cache is on top in every later one
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Most caches a single instance may count */
+#define STACK_DISTANCE_MAX_CACHES   (24)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a stack distance counter */
+typedef struct _stack_distance_t * stack_distance_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Create a counter for caches of every size, with no accesses seen
+ *
+ * @param[in] block_size_bytes: Block size of every cache [bytes]. Must be a
+ *                              power of two
+ * @param[in] associativity:    Blocks in each set of every cache
+ * @param[in] n_caches:         Number of sizes counted, the smallest having a
+ *                              single set. At most @ref
+ *                              STACK_DISTANCE_MAX_CACHES
+ *
+ * @return  A new counter, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When a parameter is out of range
+ */
+stack_distance_t StackDistance_Create(uint32_t block_size_bytes,
+                                      uint32_t associativity,
+                                      uint32_t n_caches);
+
+/**@brief   Create a counter for caches of every associativity, with no
+ *          accesses seen
+ *
+ * The first cache counted is fully associative, and the last direct mapped
+ *
+ * @param[in] block_size_bytes: Block size of every cache [bytes]. Must be a
+ *                              power of two
+ * @param[in] cache_size_bytes: Size of every cache [bytes]. Must be a power of
+ *                              two number of blocks, and no more than @ref
+ *                              STACK_DISTANCE_MAX_CACHES associativities
+ *
+ * @return  A new counter, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When a parameter is out of range
+ */
+stack_distance_t StackDistance_CreateAllWays(uint32_t block_size_bytes,
+                                             uint32_t cache_size_bytes);
+
+/**@brief   Free all memory used by @p stack_distance
+ *
+ * @param[in] stack_distance:   The counter to destroy
+ */
+void StackDistance_Destroy(stack_distance_t stack_distance);
+
+/**@brief   Count accesses to one block in every cache
+ *
+ * @param[in,out] stack_distance:   The counter
+ * @param[in] address:              Any address in the block
+ * @param[in] n_accesses:           The number of accesses to the block in a
+ *                                  row. At least 1; all after the first hit
+ * @param[in] write:                Whether the accesses write the block
+ *
+ * @throws ALLOCATION_FAILURE   When a set's stack could not grow
+ */
+void StackDistance_Access(stack_distance_t stack_distance,
+                          uint64_t address,
+                          uint32_t n_accesses,
+                          bool write);
+
+/**@brief   The number of caches counted */
+uint32_t StackDistance_Caches(stack_distance_t stack_distance);
+
+/**@brief   The size of the @p i th cache counted [bytes] */
+uint64_t StackDistance_SizeBytes(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   The associativity of the @p i th cache counted */
+uint32_t StackDistance_Ways(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   The number of accesses that hit in the @p i th cache */
+uint64_t StackDistance_Hits(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   The number of accesses that missed in the @p i th cache */
+uint64_t StackDistance_Misses(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   The number of blocks the @p i th cache's misses kicked out */
+uint64_t StackDistance_Kickouts(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   The number of those blocks that were dirty
+ *
+ * @note    Takes time in proportion to the blocks seen
+ */
+uint64_t StackDistance_DirtyKickouts(stack_distance_t stack_distance, uint32_t i);
+
+/**@brief   Prints every cache's counts, one cache to a line
+ *
+ * @param[in] stack_distance:   The counter
+ * @param[in] name:             The memory level counted
+ */
+void StackDistance_Print(stack_distance_t stack_distance, char const * name);
+
+/** @} defgroup STACKDISTANCE */
+
+#endif /* ifndef STACKDISTANCE_H */
@@ -93,6 +93,14 @@ void Statistics_RecordAccess(stats_t * stats,
                              uint32_t cycles,
                              uint32_t n_aligned);
 
+/**@brief   Add cycles spent on an access already recorded
+ *
+ * @param[in,out] stats:    Location to store data
+ * @param[in] type:         The type of the access
+ * @param[in] cycles:       Further cycles to resolve the access
+ */
+void Statistics_RecordCycles(stats_t * stats, uint8_t type, uint32_t cycles);
+
 /**@brief   Record a single access to a cache
  *
  * @param[in,out] cache_stats:  This cache's statistics
@@ -100,6 +108,16 @@ void Statistics_RecordAccess(stats_t * stats,
  */
 void Statistics_RecordCacheAccess(cache_stats_t * cache_stats, result_t result);
 
+/**@brief   Record several hits to a cache at once
+ *
+ * Equivalent to @p n_hits calls to @ref Statistics_RecordCacheAccess() with
+ * @ref RESULT_HIT
+ *
+ * @param[in,out] cache_stats:  This cache's statistics
+ * @param[in] n_hits:           The number of hits
+ */
+void Statistics_RecordCacheHits(cache_stats_t * cache_stats, uint32_t n_hits);
+
 /** @} defgroup STATISTICS */
 
 #endif /* ifndef STATISTICS_H */
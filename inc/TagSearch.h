@@ -0,0 +1,84 @@
+/**
+ * @file    TagSearch.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TagSearch Interface
+ */
+
+#ifndef TAGSEARCH_H
+#define TAGSEARCH_H
+
+/**@defgroup TAGSEARCH TagSearch
+ * @{
+ *
+ * @brief   Find a block address in a set's contiguous array of addresses
+ *
+ * Addresses are compared @ref TAG_SEARCH_WIDTH at a time, using the widest
+ * vector instructions the host supports. The implementation is picked at run
+ * time, so a single binary runs on any host, falling back to plain C where no
+ * vector instructions are available.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Addresses compared in each step. Arrays are searched in whole
+ *          groups of this many
+ */
+#define TAG_SEARCH_WIDTH        (8)
+
+/**@brief   Returned when no address matches */
+#define TAG_SEARCH_NO_MATCH     (UINT32_MAX)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   The instruction sets a search may be implemented with, from
+ *          narrowest to widest
+ */
+typedef enum {
+    TAG_SEARCH_SCALAR = 0,      /**< Plain C */
+    TAG_SEARCH_SSE2,            /**< Two addresses per compare */
+    TAG_SEARCH_AVX2,            /**< Four addresses per compare */
+    TAG_SEARCH_AVX512,          /**< Eight addresses per compare */
+    TAG_SEARCH_N_LEVELS,        /**< Number of levels. Not a valid level */
+} tag_search_level_t;
+
+/**@brief   A search implementation
+ *
+ * @param[in] addresses:    The addresses to search. Must be readable up to the
+ *                          next multiple of @ref TAG_SEARCH_WIDTH beyond @p
+ *                          n_addresses, and those extra entries must never
+ *                          match
+ * @param[in] n_addresses:  Number of valid addresses
+ * @param[in] address:      The address to look for
+ *
+ * @return  Index of the first matching address, or @ref TAG_SEARCH_NO_MATCH
+ */
+typedef uint32_t (*tag_search_t)(uint64_t const * addresses,
+                                 uint32_t n_addresses,
+                                 uint64_t address);
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Determine the widest level the host supports
+ *
+ * @return  The best supported level
+ */
+tag_search_level_t TagSearch_BestLevel(void);
+
+/**@brief   Retrieve the search implemented with @p level
+ *
+ * @param[in] level:    The instruction set to use
+ *
+ * @return  The search, or NULL if the host (or the compiler) doesn't support
+ *          @p level
+ */
+tag_search_t TagSearch_Get(tag_search_level_t level);
+
+/** @} defgroup TAGSEARCH */
+
+#endif /* ifndef TAGSEARCH_H */
@@ -0,0 +1,110 @@
+/**
+ * @file    TraceCache.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceCache Interface
+ */
+
+#ifndef TRACECACHE_H
+#define TRACECACHE_H
+
+/**@defgroup TRACECACHE TraceCache
+ * @{
+ *
+ * @brief   Keeps a converted copy of each text or gzip trace simulated, so that
+ *          it is only parsed once
+ *
+ * Converted traces are stored as block traces (see @ref BLOCKTRACE) in a cache
+ * directory, named by a hash of the source trace's size and contents. If a
+ * trace's converted copy is missing, the accesses parsed from it can be
+ * recorded as they're simulated; the copy only appears in the cache once the
+ * whole trace has been recorded.
+ *
+ * The cache never causes a simulation to fail: if the directory can't be
+ * created or written, the trace is simply parsed as usual.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   Directory used when no other is given */
+#define TRACE_CACHE_DEFAULT_DIR     ".trace-cache"
+
+/**@brief   Environment variable overriding @ref TRACE_CACHE_DEFAULT_DIR */
+#define TRACE_CACHE_DIR_VARIABLE    "TRACE_CACHE_DIR"
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   A single trace's entry in the cache */
+typedef struct _trace_cache_t * trace_cache_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Look a trace up in the cache, and start recording it if it's
+ *          missing
+ *
+ * Only text and gzip traces in regular files are cached. Anything else gets an
+ * entry that neither hits nor records.
+ *
+ * @param[in] dir:          The cache directory. Created if it doesn't exist
+ * @param[in] trace_file:   The source trace
+ * @param[in] record:       Whether to record the trace if it's missing. Only
+ *                          worthwhile if the whole trace will be read
+ *
+ * @return  The trace's entry, or NULL if memory allocation failed
+ */
+trace_cache_t TraceCache_Create(char const * dir, char const * trace_file, bool record);
+
+/**@brief   Free all memory used by @p cache. If the trace was being recorded
+ *          but not committed, the partial copy is discarded
+ *
+ * @param[in] cache:    The entry to destroy
+ */
+void TraceCache_Destroy(trace_cache_t cache);
+
+/**@brief   Get the converted copy of the trace
+ *
+ * @param[in] cache:    The trace's entry
+ *
+ * @return  Path to the converted trace, or NULL if it isn't cached
+ */
+char const * TraceCache_Path(trace_cache_t cache);
+
+/**@brief   Check whether accesses passed to @ref TraceCache_Record are kept
+ *
+ * @param[in] cache:    The trace's entry
+ *
+ * @return  Whether the trace is being recorded
+ */
+bool TraceCache_Recording(trace_cache_t cache);
+
+/**@brief   Record the next accesses of the trace
+ *
+ * Does nothing if the trace isn't being recorded. If the copy can't be
+ * written, recording stops.
+ *
+ * @param[in,out] cache:    The trace's entry
+ * @param[in] accesses:     The accesses, in trace order
+ * @param[in] n_accesses:   Number of accesses in @p accesses
+ */
+void TraceCache_Record(trace_cache_t cache, access_t const * accesses, uint32_t n_accesses);
+
+/**@brief   Finish recording, and add the copy to the cache. Must only be
+ *          called once every access in the trace has been recorded
+ *
+ * @param[in,out] cache:    The trace's entry
+ *
+ * @return  Whether the copy was added to the cache
+ */
+bool TraceCache_Commit(trace_cache_t cache);
+
+/** @} defgroup TRACECACHE */
+
+#endif /* ifndef TRACECACHE_H */
@@ -0,0 +1,169 @@
+/**
+ * @file    TraceIndex.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceIndex Interface
+ */
+
+#ifndef TRACEINDEX_H
+#define TRACEINDEX_H
+
+/**@defgroup TRACEINDEX TraceIndex
+ * @{
+ *
+ * @brief   Checkpoints through a text or gzip trace, so a run can start
+ *          partway through without parsing everything before
+ *
+ * Every fixed number of references, a checkpoint records where the next
+ * reference starts in the (uncompressed) text, and how many reads, writes and
+ * instruction fetches came before it -- both as trace references and as the L1
+ * accesses they're split into.
+ *
+ * Checkpoints are kept in a sidecar file in the trace cache directory (see
+ * @ref TRACECACHE), named by the trace file's identity (device, inode, size
+ * and modification time), so finding the index costs nothing however long the
+ * trace is. The index grows whenever a run parses past its last checkpoint,
+ * and is saved once parsing finishes.
+ *
+ * The accesses a reader returns must all be passed through the index, in
+ * order, and each read must stop at the next checkpoint (see
+ * @ref TraceIndex_Limit).
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+
+/**@brief   References between checkpoints used by the simulator */
+#define TRACE_INDEX_DEFAULT_INTERVAL    (1 << 20)
+
+/**@brief   Identifies a checkpoint sidecar */
+#define TRACE_INDEX_MAGIC               "SIMCHKPT"
+
+/**@brief   Version of the sidecar format */
+#define TRACE_INDEX_VERSION             (1)
+
+/**@brief   Size of the sidecar's header [bytes] */
+#define TRACE_INDEX_HEADER_SIZE         (64)
+
+/**@brief   Size of each checkpoint in the sidecar [bytes] */
+#define TRACE_INDEX_ENTRY_SIZE          (56)
+
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a trace's checkpoint index */
+typedef struct _trace_index_t * trace_index_t;
+
+/**@brief   The state of a trace just before a reference */
+typedef struct {
+    uint64_t record;                /**< The reference (counting from 0) */
+    uint64_t offset;                /**< Where the reference's line starts in
+                                         the text [bytes] */
+
+    uint64_t read_count;            /**< Read references before this one */
+    uint64_t read_count_aligned;    /**< L1 reads they were split into */
+    uint64_t write_count;           /**< Write references before this one */
+    uint64_t write_count_aligned;   /**< L1 writes they were split into */
+    uint64_t instr_count;           /**< Instruction references before this
+                                         one */
+    uint64_t instr_count_aligned;   /**< L1 instruction reads they were split
+                                         into */
+} trace_checkpoint_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Load a trace's checkpoint index, or start a new one
+ *
+ * Only text and gzip traces in regular files are indexed. Anything else gets an
+ * inactive index, which never moves the reader and never limits reads.
+ *
+ * @param[in] dir:          Directory holding sidecars, or NULL for an
+ *                          inactive index. Must remain valid until the index
+ *                          is destroyed
+ * @param[in] trace_file:   The trace, or NULL for an inactive index
+ * @param[in] interval:     References between checkpoints. A sidecar written
+ *                          with a different interval is ignored
+ *
+ * @return  The index, or NULL if memory allocation failed
+ *
+ * @throws ARGUMENT_ERROR   When @p interval is zero
+ */
+trace_index_t TraceIndex_Create(char const * dir, char const * trace_file, uint32_t interval);
+
+/**@brief   Free all memory used by @p index, without saving it
+ *
+ * @param[in] index:    The index to destroy
+ */
+void TraceIndex_Destroy(trace_index_t index);
+
+/**@brief   Check whether the index is kept for this trace
+ *
+ * @param[in] index:    The index
+ *
+ * @return  Whether the index is active
+ */
+bool TraceIndex_Active(trace_index_t index);
+
+/**@brief   Get the number of checkpoints known
+ *
+ * @param[in] index:    The index
+ *
+ * @return  The number of checkpoints, including the one at the start of the
+ *          trace
+ */
+uint64_t TraceIndex_Checkpoints(trace_index_t index);
+
+/**@brief   Move to the last known checkpoint at or before @p record
+ *
+ * The reader must then be moved to @p checkpoint's offset (see
+ * TraceReader_Seek()), and read from there.
+ *
+ * @param[in,out] index:    The index
+ * @param[in] record:       The reference to find
+ * @param[out] checkpoint:  The checkpoint. For an inactive index, always the
+ *                          start of the trace
+ */
+void TraceIndex_Seek(trace_index_t index, uint64_t record, trace_checkpoint_t * checkpoint);
+
+/**@brief   Limit the length of a read, so it stops at the next checkpoint
+ *
+ * @param[in] index:        The index
+ * @param[in] max_accesses: The most accesses wanted
+ *
+ * @return  The most accesses that may be read
+ */
+uint32_t TraceIndex_Limit(trace_index_t index, uint32_t max_accesses);
+
+/**@brief   Count accesses just read, adding a checkpoint if they reach one
+ *
+ * @param[in,out] index:    The index
+ * @param[in] accesses:     The accesses read
+ * @param[in] n_accesses:   Number of accesses in @p accesses
+ * @param[in] offset:       Where the next line starts in the text [bytes]
+ */
+void TraceIndex_Record(trace_index_t index,
+                       access_t const * accesses,
+                       uint32_t n_accesses,
+                       uint64_t offset);
+
+/**@brief   Write the index's sidecar, if checkpoints have been added since it
+ *          was loaded
+ *
+ * The sidecar is replaced atomically. Failing to write it isn't an error: the
+ * checkpoints are simply found again on a later run.
+ *
+ * @param[in] index:    The index
+ *
+ * @return  Whether the sidecar is up to date
+ */
+bool TraceIndex_Save(trace_index_t index);
+
+/** @} defgroup TRACEINDEX */
+
+#endif /* ifndef TRACEINDEX_H */
@@ -0,0 +1,154 @@
+/**
+ * @file    TraceReader.h
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceReader Interface
+ */
+
+#ifndef TRACEREADER_H
+#define TRACEREADER_H
+
+/**@defgroup TRACEREADER TraceReader
+ * @{
+ *
+ * @brief   Turns a trace, wherever it's stored, into batches of accesses
+ *
+ * Regular files (whether named by path or redirected to stdin) are mapped into
+ * memory and parsed in place, unless they are gzip-compressed, in which case
+ * they are decompressed on a separate thread (see @ref GZIPSTREAM). Block
+ * traces (see @ref BLOCKTRACE) are decompressed on every core, and can be
+ * skipped through without decompressing what's skipped. Delta traces (see @ref
+ * DELTATRACE) are decoded a chunk at a time, and can also be read as runs of
+ * accesses. Anything else (e.g. a pipe) is read in large blocks.
+ */
+
+/* --- PUBLIC DEPENDENCIES -------------------------------------------------- */
+
+#include "Access.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PUBLIC CONSTANTS ----------------------------------------------------- */
+/* --- PUBLIC DATATYPES ----------------------------------------------------- */
+
+/**@brief   Instance of a trace reader */
+typedef struct _trace_reader_t * trace_reader_t;
+
+/* --- PUBLIC MACROS -------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Open a trace for reading
+ *
+ * @param[in] path:     The trace file to read, or NULL to read from stdin
+ * @param[in] binary:   Whether the trace is in the format described in @ref
+ *                      BINARYTRACE (rather than text). Block and delta
+ *                      traces are recognized whatever this says
+ *
+ * @return  A new trace reader, or NULL if memory allocation failed
+ *
+ * @throws BAD_TRACE_FILE   When @p path can't be opened, or a binary trace
+ *                          has an invalid header
+ */
+trace_reader_t TraceReader_Create(char const * path, bool binary);
+
+/**@brief   Close a trace, and free all memory used by @p reader
+ *
+ * @param[in] reader:   The reader to destroy
+ */
+void TraceReader_Destroy(trace_reader_t reader);
+
+/**@brief   Read the next accesses from a trace
+ *
+ * @param[in,out] reader:   The trace to read
+ * @param[out] accesses:    Space for at least @p max_accesses accesses
+ * @param[in] max_accesses: Maximum number of accesses to read
+ *
+ * @return  The number of accesses read. Fewer than @p max_accesses are only
+ *          returned at the end of the trace
+ *
+ * @throws SYNTAX_ERROR         When a text line is malformed. The exception's
+ *                              file and line refer to the trace
+ * @throws INVALID_OPERATION    When an access' type is invalid
+ * @throws INVALID_ACCESS_SIZE  When an access is for zero bytes
+ * @throws BAD_TRACE_FILE       When a binary trace is truncated, or a
+ *                              compressed trace is corrupt
+ */
+uint32_t TraceReader_Read(trace_reader_t reader,
+                          access_t * accesses,
+                          uint32_t max_accesses);
+
+/**@brief   Read the next accesses from a trace, as runs
+ *
+ * Runs come from delta traces as they were stored: sequential instruction
+ * fetches form a single run. Any other trace's accesses are each returned as
+ * a run of their own.
+ *
+ * @note    The runs read at once from a delta trace all come from the same
+ *          chunk, so fewer than @p max_runs may be read before the end of the
+ *          trace
+ *
+ * @param[in,out] reader:   The trace to read
+ * @param[out] runs:        Space for at least @p max_runs runs. Their sizes are
+ *                          valid until the trace is next read
+ * @param[in] max_runs:     Maximum number of runs to read
+ *
+ * @return  The number of runs read. Zero is only returned at the end of the
+ *          trace
+ *
+ * @throws ALLOCATION_FAILURE   When space for wrapping accesses couldn't be
+ *                              allocated
+ * @throws SYNTAX_ERROR         When a text line is malformed
+ * @throws INVALID_OPERATION    When an access' type is invalid
+ * @throws INVALID_ACCESS_SIZE  When an access is for zero bytes
+ * @throws BAD_TRACE_FILE       When a binary trace is truncated, or a
+ *                              compressed trace is corrupt
+ */
+uint32_t TraceReader_ReadRuns(trace_reader_t reader,
+                              access_run_t * runs,
+                              uint32_t max_runs);
+
+/**@brief   Skip past accesses without returning them
+ *
+ * @param[in,out] reader:   The trace to read
+ * @param[in] n_accesses:   Number of accesses to skip
+ *
+ * @return  The number of accesses skipped. Fewer than @p n_accesses are only
+ *          skipped at the end of the trace
+ *
+ * @throws SYNTAX_ERROR         When a skipped text line is malformed
+ * @throws INVALID_OPERATION    When a skipped access' type is invalid
+ * @throws INVALID_ACCESS_SIZE  When a skipped access is for zero bytes
+ * @throws BAD_TRACE_FILE       When the trace is truncated or corrupt
+ */
+uint64_t TraceReader_Skip(trace_reader_t reader, uint64_t n_accesses);
+
+/**@brief   Get the position of the next access in a text trace
+ *
+ * @param[in] reader:   The trace
+ *
+ * @return  Where the next access' line starts in the (uncompressed) text
+ *          [bytes]
+ */
+uint64_t TraceReader_Offset(trace_reader_t reader);
+
+/**@brief   Move forward through a text trace to a known line
+ *
+ * A mapped trace moves directly to @p offset. A compressed trace, or one that
+ * isn't mapped, is read up to it, but nothing skipped is parsed.
+ *
+ * @param[in,out] reader:   The trace to move through
+ * @param[in] offset:       Where the line starts in the (uncompressed) text,
+ *                          as given by @ref TraceReader_Offset [bytes]
+ * @param[in] record:       The access on that line (counting from 0)
+ *
+ * @throws ARGUMENT_ERROR   When the trace is binary, or @p offset is behind
+ *                          the reader
+ * @throws BAD_TRACE_FILE   When the trace ends before @p offset, or a
+ *                          compressed trace is corrupt
+ */
+void TraceReader_Seek(trace_reader_t reader, uint64_t offset, uint64_t record);
+
+/** @} defgroup TRACEREADER */
+
+#endif /* ifndef TRACEREADER_H */
@@ -55,6 +55,38 @@ uint32_t HighestBitSet(uint64_t value);
  */
 uint64_t AlignmentMask(uint32_t block_size);
 
+/**@brief   Store @p value at @p bytes, little-endian */
+static inline void PutLE32(uint8_t * bytes, uint32_t value)
+{
+    uint32_t i;
+    for (i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t) (value >> (8 * i));
+    }
+}
+
+/**@brief   Store @p value at @p bytes, little-endian */
+static inline void PutLE64(uint8_t * bytes, uint64_t value)
+{
+    PutLE32(&bytes[0], (uint32_t) value);
+    PutLE32(&bytes[4], (uint32_t) (value >> 32));
+}
+
+/**@brief   Load a little-endian value from @p bytes */
+static inline uint32_t GetLE32(uint8_t const * bytes)
+{
+    // GCC folds these into a single load on little-endian hosts
+    return ((uint32_t) bytes[0])       |
+           ((uint32_t) bytes[1] << 8)  |
+           ((uint32_t) bytes[2] << 16) |
+           ((uint32_t) bytes[3] << 24);
+}
+
+/**@brief   Load a little-endian value from @p bytes */
+static inline uint64_t GetLE64(uint8_t const * bytes)
+{
+    return ((uint64_t) GetLE32(&bytes[4]) << 32) | GetLE32(&bytes[0]);
+}
+
 /** @} defgroup UTIL */
 
 #endif /* ifndef UTIL_H */
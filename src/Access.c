@@ -18,12 +18,17 @@
 #include "ExceptionTypes.h"
 
 #include <inttypes.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
 /* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Marks a character that is not a digit in @ref hex_digit_values */
+#define NOT_A_DIGIT         (0)
+
 /* --- PRIVATE DATATYPES ---------------------------------------------------- */
 /* --- PRIVATE MACROS ------------------------------------------------------- */
 /* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
@@ -31,8 +36,40 @@
 /**@brief   Determines whether @p type is an acceptable access type*/
 static inline bool isValidType(uint8_t type);
 
+/**@brief   Scans a single line, without checking its semantics
+ *
+ * A line is a one-character type, a hexadecimal address with an optional
+ * "0x" prefix, and a decimal size, separated by any blanks. Anything following
+ * the size is ignored. Signs are not accepted, nor is an address with more
+ * than 16 significant digits or a size that does not fit in 32 bits.
+ *
+ * @param[in] p:        Start of the line
+ * @param[in] end:      End of the line (exclusive). Scanning also stops at a
+ *                      NUL or newline
+ * @param[out] access:  The scanned access
+ *
+ * @return  Whether the line could be scanned
+ */
+static inline bool scanLine(char const * p, char const * end, access_t * access);
+
+/**@brief   Determines whether @p c is whitespace that may separate fields */
+static inline bool isFieldSpace(char c);
+
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   Maps a character to one more than its value as a hex digit, or
+ *          NOT_A_DIGIT
+ *
+ * @note    The offset lets every non-digit be left zero-initialized
+ */
+static const uint8_t hex_digit_values[256] = {
+    ['0'] = 1,  ['1'] = 2,  ['2'] = 3,  ['3'] = 4,  ['4'] = 5,
+    ['5'] = 6,  ['6'] = 7,  ['7'] = 8,  ['8'] = 9,  ['9'] = 10,
+    ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+    ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+};
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 void Access_ParseLine(const char * line, access_t * access)
@@ -41,13 +78,65 @@ void Access_ParseLine(const char * line, access_t * access)
         ThrowHere(ARGUMENT_ERROR);
     }
 
-    if (sscanf(line, "%c %" SCNx64 " %" SCNu32 "\n",
-               &access->type,
-               &access->address,
-               &access->n_bytes) != 3) {
+    if (!scanLine(line, line + strlen(line), access)) {
         ThrowHere(SYNTAX_ERROR);
     }
 
+    Access_Validate(access);
+}
+
+size_t Access_ParseBuffer(char const * buffer,
+                          size_t length,
+                          bool final,
+                          access_t * accesses,
+                          uint32_t max_accesses,
+                          uint32_t * n_accesses,
+                          uint64_t * line_no)
+{
+    char const * p = buffer;
+    char const * end = buffer + length;
+    uint64_t line = *line_no;
+    uint32_t n = 0;
+
+    while (n < max_accesses && p < end) {
+        char const * eol = memchr(p, '\n', end - p);
+        if (eol == NULL) {
+            if (!final) {
+                break;
+            }
+            eol = end;
+        }
+
+        access_t * access = &accesses[n];
+        uint32_t e = NO_EXCEPTION;
+        if (!scanLine(p, eol, access)) {
+            e = SYNTAX_ERROR;
+        }
+        else if (!isValidType(access->type)) {
+            e = INVALID_OPERATION;
+        }
+        else if (access->n_bytes == 0) {
+            e = INVALID_ACCESS_SIZE;
+        }
+
+        if (e != NO_EXCEPTION) {
+            *line_no = line;
+            ThrowHere(e);
+        }
+
+        n += 1;
+        line += 1;
+        p = (eol < end) ? eol + 1 : end;
+    }
+
+    *n_accesses = n;
+    *line_no = line;
+
+    return p - buffer;
+}
+
+void Access_Validate(access_t const * access)
+{
     if (!isValidType(access->type)) {
         ThrowHere(INVALID_OPERATION);
     }
@@ -90,4 +179,58 @@ static inline bool isValidType(uint8_t type)
     return (type == TYPE_INSTR) || (type == TYPE_WRITE) || (type == TYPE_READ);
 }
 
+static inline bool scanLine(char const * p, char const * end, access_t * access)
+{
+    if (p >= end || *p == '\0' || *p == '\n') {
+        return false;
+    }
+    access->type = (uint8_t) *p++;
+
+    while (p < end && isFieldSpace(*p)) p++;
+
+    if ((end - p) > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X') &&
+        hex_digit_values[(uint8_t) p[2]] != NOT_A_DIGIT) {
+        p += 2;
+    }
+
+    char const * digits = p;
+    while (p < end && *p == '0') p++;
+
+    uint64_t address = 0;
+    char const * significant = p;
+    uint8_t value;
+    while (p < end && (value = hex_digit_values[(uint8_t) *p]) != NOT_A_DIGIT) {
+        address = (address << 4) | (uint64_t) (value - 1);
+        p++;
+    }
+    if (p == digits || (p - significant) > (ptrdiff_t) (2 * sizeof(address))) {
+        return false;
+    }
+
+    while (p < end && isFieldSpace(*p)) p++;
+
+    uint64_t n_bytes = 0;
+    digits = p;
+    while (p < end && *p >= '0' && *p <= '9') {
+        n_bytes = (n_bytes * 10) + (uint64_t) (*p - '0');
+        if (n_bytes > UINT32_MAX) {
+            return false;
+        }
+        p++;
+    }
+    if (p == digits) {
+        return false;
+    }
+
+    access->address = address;
+    access->n_bytes = (uint32_t) n_bytes;
+
+    return true;
+}
+
+static inline bool isFieldSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
 /** @} addtogroup ACCESS */
@@ -0,0 +1,303 @@
+/**
+ * @file    AccessRing.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   AccessRing Source
+ *
+ * @addtogroup ACCESSRING
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for sched_yield()
+#define _DEFAULT_SOURCE
+
+#include "AccessRing.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Size of a cache line on the host [bytes] */
+#define CACHE_LINE_SIZE     (64)
+
+/**@brief   Number of times a side finds the ring full (or empty), yielding
+ *          between each, before it sleeps until the other side moves */
+#define ACCESS_RING_SPIN_LIMIT  (64)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The position of one consumer, on a cache line of its own */
+typedef struct {
+    _Alignas(CACHE_LINE_SIZE) atomic_uint_fast64_t tail;
+    uint64_t head_cache;        /**< Consumer's copy of the ring's head */
+} ring_consumer_t;
+
+/**@brief   The internals of an access ring
+ *
+ * @note    @p head and each consumer's tail count batches published and
+ *          released since the ring was created; they are never wrapped. Each
+ *          side keeps a private copy of the other's position (the producer,
+ *          of the oldest consumer's), and only re-reads the shared one when
+ *          its copy says the ring is full (or empty)
+ */
+struct _access_ring_t {
+    access_batch_t * batches;   /**< The ring's batches */
+    access_t * accesses;        /**< Storage for every batch's accesses */
+    ring_consumer_t * consumers; /**< Each consumer's position */
+    uint32_t n_consumers;
+    uint32_t mask;              /**< Number of batches, less one */
+
+    /** Written by the producer */
+    _Alignas(CACHE_LINE_SIZE) atomic_uint_fast64_t head;
+    uint64_t tail_cache;        /**< Producer's copy of the oldest tail */
+    atomic_bool closed;         /**< Whether the producer should stop */
+
+    /** Shared by every side that has stopped spinning */
+    pthread_mutex_t lock;
+    pthread_cond_t changed;     /**< Signalled when any position moves */
+    atomic_uint n_waiting;      /**< Number of sides asleep on @p changed */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   The tail of whichever consumer is furthest behind */
+static uint64_t AccessRing_OldestTail(access_ring_t ring);
+
+/**@brief   Whether the producer has room to claim the batch at @p head */
+static bool AccessRing_HasRoom(access_ring_t ring, uint64_t head);
+
+/**@brief   Whether a batch has been published past @p tail */
+static bool AccessRing_HasBatch(access_ring_t ring, uint64_t tail);
+
+/**@brief   Wait for the ring to change, after finding it full (or empty)
+ *
+ * Yields the processor for the first @ref ACCESS_RING_SPIN_LIMIT checks, then
+ * sleeps until another side moves or the ring is closed
+ *
+ * @param[in]       ring:       The ring
+ * @param[in,out]   n_checks:   Number of times the caller has found the ring
+ *                              not ready. Incremented
+ * @param[in]       is_ready:   Re-checks the caller's condition once it may
+ *                              no longer miss a wake-up
+ * @param[in]       position:   Passed to @p is_ready
+ */
+static void AccessRing_Wait(access_ring_t ring,
+                            uint32_t * n_checks,
+                            bool (*is_ready)(access_ring_t, uint64_t),
+                            uint64_t position);
+
+/**@brief   Wake every side asleep on the ring, if there are any */
+static void AccessRing_Wake(access_ring_t ring);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+access_ring_t AccessRing_Create(uint32_t n_batches, uint32_t batch_len, uint32_t n_consumers)
+{
+    if (!IS_POWER_OF_TWO(n_batches) || n_consumers == 0) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    access_ring_t ring = (access_ring_t) aligned_alloc(CACHE_LINE_SIZE, sizeof(*ring));
+    if (ring == NULL) {
+        return NULL;
+    }
+    memset(ring, 0, sizeof(*ring));
+
+    if (pthread_mutex_init(&ring->lock, NULL) != 0) {
+        free(ring);
+        return NULL;
+    }
+    if (pthread_cond_init(&ring->changed, NULL) != 0) {
+        pthread_mutex_destroy(&ring->lock);
+        free(ring);
+        return NULL;
+    }
+
+    ring->mask        = n_batches - 1;
+    ring->n_consumers = n_consumers;
+    ring->batches     = (access_batch_t *) malloc(n_batches * sizeof(access_batch_t));
+    ring->accesses    = (access_t *) malloc((size_t) n_batches * batch_len * sizeof(access_t));
+    ring->consumers   = (ring_consumer_t *) aligned_alloc(CACHE_LINE_SIZE,
+                                                         n_consumers * sizeof(ring_consumer_t));
+    if (ring->batches == NULL || ring->accesses == NULL || ring->consumers == NULL) {
+        AccessRing_Destroy(ring);
+        return NULL;
+    }
+
+    uint32_t i;
+    for (i = 0; i < n_batches; i++) {
+        ring->batches[i].accesses   = &ring->accesses[(size_t) i * batch_len];
+        ring->batches[i].n_accesses = 0;
+        ring->batches[i].error      = CEXCEPTION_NONE;
+        ring->batches[i].error_file = NULL;
+        ring->batches[i].error_line = 0;
+    }
+
+    for (i = 0; i < n_consumers; i++) {
+        atomic_init(&ring->consumers[i].tail, 0);
+        ring->consumers[i].head_cache = 0;
+    }
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->closed, false);
+    atomic_init(&ring->n_waiting, 0);
+
+    return ring;
+}
+
+void AccessRing_Destroy(access_ring_t ring)
+{
+    if (ring) {
+        free(ring->batches);
+        free(ring->accesses);
+        free(ring->consumers);
+        pthread_cond_destroy(&ring->changed);
+        pthread_mutex_destroy(&ring->lock);
+        free(ring);
+    }
+}
+
+access_batch_t * AccessRing_Claim(access_ring_t ring)
+{
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t n_checks = 0;
+
+    while (head - ring->tail_cache > ring->mask) {
+        if (atomic_load_explicit(&ring->closed, memory_order_relaxed)) {
+            return NULL;
+        }
+        ring->tail_cache = AccessRing_OldestTail(ring);
+        if (head - ring->tail_cache > ring->mask) {
+            AccessRing_Wait(ring, &n_checks, AccessRing_HasRoom, head);
+        }
+    }
+
+    if (atomic_load_explicit(&ring->closed, memory_order_relaxed)) {
+        return NULL;
+    }
+
+    return &ring->batches[head & ring->mask];
+}
+
+void AccessRing_Publish(access_ring_t ring)
+{
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    AccessRing_Wake(ring);
+}
+
+access_batch_t const * AccessRing_Acquire(access_ring_t ring, uint32_t consumer)
+{
+    ring_consumer_t * self = &ring->consumers[consumer];
+    uint64_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+    uint32_t n_checks = 0;
+
+    while (tail == self->head_cache) {
+        self->head_cache = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (tail == self->head_cache) {
+            if (atomic_load_explicit(&ring->closed, memory_order_relaxed)) {
+                return NULL;
+            }
+            AccessRing_Wait(ring, &n_checks, AccessRing_HasBatch, tail);
+        }
+    }
+
+    return &ring->batches[tail & ring->mask];
+}
+
+void AccessRing_Release(access_ring_t ring, uint32_t consumer)
+{
+    ring_consumer_t * self = &ring->consumers[consumer];
+    uint64_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+    atomic_store_explicit(&self->tail, tail + 1, memory_order_release);
+    AccessRing_Wake(ring);
+}
+
+void AccessRing_Close(access_ring_t ring)
+{
+    atomic_store_explicit(&ring->closed, true, memory_order_seq_cst);
+    AccessRing_Wake(ring);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint64_t AccessRing_OldestTail(access_ring_t ring)
+{
+    uint64_t oldest = atomic_load_explicit(&ring->consumers[0].tail, memory_order_acquire);
+
+    uint32_t i;
+    for (i = 1; i < ring->n_consumers; i++) {
+        uint64_t tail = atomic_load_explicit(&ring->consumers[i].tail, memory_order_acquire);
+        if (tail < oldest) {
+            oldest = tail;
+        }
+    }
+
+    return oldest;
+}
+
+static bool AccessRing_HasRoom(access_ring_t ring, uint64_t head)
+{
+    return head - AccessRing_OldestTail(ring) <= ring->mask;
+}
+
+static bool AccessRing_HasBatch(access_ring_t ring, uint64_t tail)
+{
+    return atomic_load_explicit(&ring->head, memory_order_acquire) != tail;
+}
+
+static void AccessRing_Wait(access_ring_t ring,
+                            uint32_t * n_checks,
+                            bool (*is_ready)(access_ring_t, uint64_t),
+                            uint64_t position)
+{
+    if (*n_checks < ACCESS_RING_SPIN_LIMIT) {
+        (*n_checks)++;
+        sched_yield();
+        return;
+    }
+
+    // Announce the sleep before the last check: a side that moves after that
+    // check is then sure to see the announcement (each side's fence orders
+    // its store before its load), and must take the lock to wake us
+    pthread_mutex_lock(&ring->lock);
+    atomic_fetch_add_explicit(&ring->n_waiting, 1, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (!is_ready(ring, position) &&
+        !atomic_load_explicit(&ring->closed, memory_order_seq_cst)) {
+        pthread_cond_wait(&ring->changed, &ring->lock);
+    }
+
+    atomic_fetch_sub_explicit(&ring->n_waiting, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ring->lock);
+}
+
+static void AccessRing_Wake(access_ring_t ring)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&ring->n_waiting, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&ring->lock);
+        pthread_cond_broadcast(&ring->changed);
+        pthread_mutex_unlock(&ring->lock);
+    }
+}
+
+/** @} addtogroup ACCESSRING */
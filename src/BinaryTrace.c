@@ -0,0 +1,155 @@
+/**
+ * @file    BinaryTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BinaryTrace Source
+ *
+ * @addtogroup BINARYTRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "BinaryTrace.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Number of records encoded/decoded per stdio call */
+#define RECORDS_PER_CHUNK   (4096)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void BinaryTrace_EncodeAccess(uint8_t * record, access_t const * access)
+{
+    PutLE64(&record[0], access->address);
+    PutLE32(&record[8], access->n_bytes);
+    record[12] = access->type;
+    record[13] = 0;
+    record[14] = 0;
+    record[15] = 0;
+}
+
+void BinaryTrace_DecodeAccess(access_t * access, uint8_t const * record)
+{
+    access->address = GetLE64(&record[0]);
+    access->n_bytes = GetLE32(&record[8]);
+    access->type    = record[12];
+
+    Access_Validate(access);
+}
+
+void BinaryTrace_DecodeHeader(binary_trace_header_t * header, uint8_t const * raw)
+{
+    if (memcmp(&raw[0], BINARY_TRACE_MAGIC, 8) != 0) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    header->version     = GetLE32(&raw[8]);
+    header->record_size = GetLE32(&raw[12]);
+    header->n_records   = GetLE64(&raw[16]);
+
+    if (header->version != BINARY_TRACE_VERSION ||
+        header->record_size != BINARY_TRACE_RECORD_SIZE) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+}
+
+void BinaryTrace_WriteHeader(FILE * file, uint64_t n_records)
+{
+    uint8_t header[BINARY_TRACE_HEADER_SIZE];
+
+    memcpy(&header[0], BINARY_TRACE_MAGIC, 8);
+    PutLE32(&header[8], BINARY_TRACE_VERSION);
+    PutLE32(&header[12], BINARY_TRACE_RECORD_SIZE);
+    PutLE64(&header[16], n_records);
+
+    if (fwrite(header, sizeof(header), 1, file) != 1) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+}
+
+void BinaryTrace_ReadHeader(FILE * file, binary_trace_header_t * header)
+{
+    uint8_t raw[BINARY_TRACE_HEADER_SIZE];
+
+    if (fread(raw, sizeof(raw), 1, file) != 1) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    BinaryTrace_DecodeHeader(header, raw);
+}
+
+uint32_t BinaryTrace_Read(FILE * file, access_t * accesses, uint32_t max_accesses)
+{
+    uint8_t records[RECORDS_PER_CHUNK][BINARY_TRACE_RECORD_SIZE];
+
+    uint32_t n_read = 0;
+    while (n_read < max_accesses) {
+        uint32_t n_wanted = max_accesses - n_read;
+        if (n_wanted > RECORDS_PER_CHUNK) {
+            n_wanted = RECORDS_PER_CHUNK;
+        }
+
+        size_t n_bytes = fread(records, 1, n_wanted * BINARY_TRACE_RECORD_SIZE, file);
+        if ((n_bytes % BINARY_TRACE_RECORD_SIZE) != 0) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+
+        uint32_t n_records = n_bytes / BINARY_TRACE_RECORD_SIZE;
+        uint32_t i;
+        for (i = 0; i < n_records; i++) {
+            BinaryTrace_DecodeAccess(&accesses[n_read + i], records[i]);
+        }
+        n_read += n_records;
+
+        if (n_records < n_wanted) {
+            break;
+        }
+    }
+
+    return n_read;
+}
+
+void BinaryTrace_Write(FILE * file, access_t const * accesses, uint32_t n_accesses)
+{
+    uint8_t records[RECORDS_PER_CHUNK][BINARY_TRACE_RECORD_SIZE];
+
+    while (n_accesses > 0) {
+        uint32_t n_chunk = n_accesses;
+        if (n_chunk > RECORDS_PER_CHUNK) {
+            n_chunk = RECORDS_PER_CHUNK;
+        }
+
+        uint32_t i;
+        for (i = 0; i < n_chunk; i++) {
+            BinaryTrace_EncodeAccess(records[i], &accesses[i]);
+        }
+
+        if (fwrite(records, BINARY_TRACE_RECORD_SIZE, n_chunk, file) != n_chunk) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+
+        accesses   += n_chunk;
+        n_accesses -= n_chunk;
+    }
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+/** @} addtogroup BINARYTRACE */
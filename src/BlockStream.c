@@ -0,0 +1,331 @@
+/**
+ * @file    BlockStream.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BlockStream Source
+ *
+ * @addtogroup BLOCKSTREAM
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for pread() and sysconf()
+#define _DEFAULT_SOURCE
+
+#include "BlockStream.h"
+
+#include "BinaryTrace.h"
+#include "BlockTrace.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Most decompression threads a stream will start */
+#define BLOCK_STREAM_MAX_THREADS    (32)
+
+/**@brief   Slots in the ring, per decompression thread */
+#define BLOCK_STREAM_SLOTS_PER_THREAD (2)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   A slot holding a single decompressed block */
+typedef struct {
+    uint8_t * records;          /**< The block's records */
+    uint64_t block;             /**< Number of the block held */
+    bool ready;                 /**< Whether the block is decompressed */
+    bool error;                 /**< Whether decompression failed */
+} block_slot_t;
+
+/**@brief   The internals of a block stream
+ *
+ * @note    Block k is always decompressed into slot (k % n_slots), and only
+ *          once the consumer has released block (k - n_slots)
+ */
+struct _block_stream_t {
+    int fd;                         /**< The block trace */
+    block_trace_index_t index;      /**< The trace's index */
+    uint64_t first_record;          /**< Record the stream starts at */
+    uint64_t first_block;           /**< Block holding @p first_record */
+    uint32_t max_compressed;        /**< Longest compressed block [bytes] */
+
+    block_slot_t * slots;           /**< The ring of decompressed blocks */
+    uint32_t n_slots;               /**< Number of slots in @p slots */
+
+    pthread_t * threads;            /**< The decompression threads */
+    uint32_t n_threads;             /**< Threads started */
+
+    pthread_mutex_t lock;           /**< Protects everything below */
+    pthread_cond_t ready;           /**< Signalled when a block is ready */
+    pthread_cond_t released;        /**< Signalled when a slot is released */
+    uint64_t next_decode;           /**< Next block for a thread to take */
+    uint64_t next_deliver;          /**< Next block for the consumer */
+    bool held;                      /**< Whether the consumer holds the block
+                                         before @p next_deliver */
+    bool stop;                      /**< Whether the threads should exit */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Decompression thread entry point */
+static void * BlockStream_Decompress(void * arg);
+
+/**@brief   Read and decompress @p block into @p slot
+ *
+ * @return  Whether the block was read and decompressed successfully
+ */
+static bool BlockStream_DecompressBlock(block_stream_t stream,
+                                        uint64_t block,
+                                        block_slot_t * slot,
+                                        uint8_t * compressed);
+
+/**@brief   Read the trace's index into @p stream
+ *
+ * Kept apart from @ref BlockStream_Create, so none of its locals are live
+ * across the exception handler's setjmp()
+ *
+ * @throws BAD_TRACE_FILE       When the index is invalid
+ * @throws ALLOCATION_FAILURE   When the index could not be allocated
+ *
+ * @note    @p stream is destroyed before either is thrown
+ */
+static void BlockStream_ReadIndex(block_stream_t stream, int fd);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+block_stream_t BlockStream_Create(int fd, uint64_t first_record, uint32_t n_threads)
+{
+    block_stream_t stream = (block_stream_t) calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->ready, NULL);
+    pthread_cond_init(&stream->released, NULL);
+
+    BlockStream_ReadIndex(stream, fd);
+
+    stream->fd           = fd;
+    stream->first_record = first_record;
+    stream->first_block  = BlockTrace_FindBlock(&(stream->index), first_record);
+    stream->next_decode  = stream->first_block;
+    stream->next_deliver = stream->first_block;
+
+    uint64_t i;
+    for (i = 0; i < stream->index.n_blocks; i++) {
+        if (stream->index.entries[i].compressed_length > stream->max_compressed) {
+            stream->max_compressed = stream->index.entries[i].compressed_length;
+        }
+    }
+
+    if (n_threads == 0) {
+        long n_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        n_threads = n_cores > 0 ? n_cores : 1;
+    }
+    if (n_threads > BLOCK_STREAM_MAX_THREADS) {
+        n_threads = BLOCK_STREAM_MAX_THREADS;
+    }
+
+    stream->n_slots = n_threads * BLOCK_STREAM_SLOTS_PER_THREAD;
+    stream->slots   = (block_slot_t *) calloc(stream->n_slots, sizeof(block_slot_t));
+    stream->threads = (pthread_t *) calloc(n_threads, sizeof(pthread_t));
+    if (stream->slots == NULL || stream->threads == NULL) {
+        BlockStream_Destroy(stream);
+        return NULL;
+    }
+
+    size_t block_size = (size_t) stream->index.block_len * BINARY_TRACE_RECORD_SIZE;
+    uint32_t slot;
+    for (slot = 0; slot < stream->n_slots; slot++) {
+        stream->slots[slot].records = (uint8_t *) malloc(block_size);
+        if (stream->slots[slot].records == NULL) {
+            BlockStream_Destroy(stream);
+            return NULL;
+        }
+    }
+
+    while (stream->n_threads < n_threads) {
+        if (pthread_create(&(stream->threads[stream->n_threads]), NULL,
+                           BlockStream_Decompress, stream) != 0) {
+            BlockStream_Destroy(stream);
+            ThrowHere(BAD_TRACE_FILE);
+        }
+        stream->n_threads++;
+    }
+
+    return stream;
+}
+
+void BlockStream_Destroy(block_stream_t stream)
+{
+    if (stream) {
+        pthread_mutex_lock(&stream->lock);
+        stream->stop = true;
+        pthread_cond_broadcast(&stream->released);
+        pthread_mutex_unlock(&stream->lock);
+
+        uint32_t i;
+        for (i = 0; i < stream->n_threads; i++) {
+            pthread_join(stream->threads[i], NULL);
+        }
+
+        if (stream->slots) {
+            for (i = 0; i < stream->n_slots; i++) {
+                free(stream->slots[i].records);
+            }
+        }
+
+        pthread_mutex_destroy(&stream->lock);
+        pthread_cond_destroy(&stream->ready);
+        pthread_cond_destroy(&stream->released);
+
+        BlockTrace_FreeIndex(&(stream->index));
+        free(stream->slots);
+        free(stream->threads);
+        free(stream);
+    }
+}
+
+uint64_t BlockStream_Records(block_stream_t stream)
+{
+    return stream->index.n_records;
+}
+
+char const * BlockStream_Next(block_stream_t stream, size_t * length, bool * last)
+{
+    pthread_mutex_lock(&stream->lock);
+
+    if (stream->held) {
+        uint64_t previous = stream->next_deliver - 1;
+        stream->slots[previous % stream->n_slots].ready = false;
+        stream->held = false;
+        pthread_cond_broadcast(&stream->released);
+    }
+
+    if (stream->next_deliver >= stream->index.n_blocks) {
+        pthread_mutex_unlock(&stream->lock);
+
+        *length = 0;
+        *last   = true;
+        return (char const *) stream->slots[0].records;
+    }
+
+    uint64_t block = stream->next_deliver;
+    block_slot_t * slot = &stream->slots[block % stream->n_slots];
+    while (!slot->ready || slot->block != block) {
+        pthread_cond_wait(&stream->ready, &stream->lock);
+    }
+
+    stream->held = true;
+    stream->next_deliver++;
+
+    pthread_mutex_unlock(&stream->lock);
+
+    if (slot->error) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    block_trace_entry_t const * entry = &(stream->index.entries[block]);
+    size_t start = 0;
+    if (block == stream->first_block) {
+        start = (stream->first_record - entry->first_record) * BINARY_TRACE_RECORD_SIZE;
+    }
+
+    *length = (size_t) entry->n_records * BINARY_TRACE_RECORD_SIZE - start;
+    *last   = block == stream->index.n_blocks - 1;
+
+    return (char const *) slot->records + start;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void BlockStream_ReadIndex(block_stream_t stream, int fd)
+{
+    CEXCEPTION_T e;
+    Try {
+        BlockTrace_ReadIndex(fd, &(stream->index));
+    }
+    Catch (e) {
+        BlockStream_Destroy(stream);
+        Throw(e);
+    }
+}
+
+static void * BlockStream_Decompress(void * arg)
+{
+    block_stream_t stream = (block_stream_t) arg;
+
+    // A failed allocation is reported as a bad block, the same as any other
+    // failure, when the consumer reaches it
+    uint8_t * compressed = (uint8_t *) malloc(stream->max_compressed);
+
+    pthread_mutex_lock(&stream->lock);
+    while (true) {
+        // Released blocks are counted from the first one delivered
+        uint64_t n_released = stream->next_deliver - (stream->held ? 1 : 0);
+        while (!stream->stop &&
+               stream->next_decode < stream->index.n_blocks &&
+               stream->next_decode >= n_released + stream->n_slots) {
+            pthread_cond_wait(&stream->released, &stream->lock);
+            n_released = stream->next_deliver - (stream->held ? 1 : 0);
+        }
+        if (stream->stop || stream->next_decode >= stream->index.n_blocks) {
+            break;
+        }
+
+        uint64_t block = stream->next_decode++;
+        block_slot_t * slot = &stream->slots[block % stream->n_slots];
+        pthread_mutex_unlock(&stream->lock);
+
+        bool ok = compressed != NULL &&
+                  BlockStream_DecompressBlock(stream, block, slot, compressed);
+
+        pthread_mutex_lock(&stream->lock);
+        slot->block = block;
+        slot->error = !ok;
+        slot->ready = true;
+        pthread_cond_broadcast(&stream->ready);
+    }
+    pthread_mutex_unlock(&stream->lock);
+
+    free(compressed);
+    return NULL;
+}
+
+static bool BlockStream_DecompressBlock(block_stream_t stream,
+                                        uint64_t block,
+                                        block_slot_t * slot,
+                                        uint8_t * compressed)
+{
+    block_trace_entry_t const * entry = &(stream->index.entries[block]);
+
+    size_t n_done = 0;
+    while (n_done < entry->compressed_length) {
+        ssize_t n_read = pread(stream->fd,
+                               compressed + n_done,
+                               entry->compressed_length - n_done,
+                               entry->offset + n_done);
+        if (n_read <= 0) {
+            return false;
+        }
+        n_done += n_read;
+    }
+
+    return BlockTrace_DecompressBlock(slot->records, compressed, entry);
+}
+
+/** @} addtogroup BLOCKSTREAM */
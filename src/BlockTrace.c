@@ -0,0 +1,410 @@
+/**
+ * @file    BlockTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   BlockTrace Source
+ *
+ * @addtogroup BLOCKTRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for pread()
+#define _DEFAULT_SOURCE
+
+#include "BlockTrace.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Index entries allocated when the writer's index first grows */
+#define INITIAL_INDEX_LEN   (64)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of a block trace writer */
+struct _block_trace_writer_t {
+    FILE * file;                    /**< The file being written */
+    uint64_t offset;                /**< Bytes written so far */
+
+    uint32_t block_len;             /**< Records per block */
+    uint8_t * records;              /**< Encoded records of the current block */
+    uint32_t n_buffered;            /**< Records in @p records */
+
+    uint8_t * compressed;           /**< Output of the block compressor */
+    size_t compressed_size;         /**< Size of @p compressed [bytes] */
+
+    block_trace_entry_t * entries;  /**< Index of the blocks written */
+    uint64_t n_blocks;              /**< Valid entries in @p entries */
+    uint64_t max_blocks;            /**< Space in @p entries */
+    uint64_t n_records;             /**< Records written */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Read exactly @p length bytes at @p offset, or throw */
+static void BlockTrace_ReadAt(int fd, uint8_t * buffer, size_t length, uint64_t offset);
+
+/**@brief   Write @p length bytes to the writer's file, or throw */
+static void BlockTrace_WriteBytes(block_trace_writer_t writer,
+                                  uint8_t const * buffer,
+                                  size_t length);
+
+/**@brief   Compress and write the buffered records as a block */
+static void BlockTrace_FlushBlock(block_trace_writer_t writer);
+
+/**@brief   Write a compressed block and add it to the index */
+static void BlockTrace_AppendBlock(block_trace_writer_t writer,
+                                   uint8_t const * compressed,
+                                   size_t length,
+                                   uint32_t n_records);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+bool BlockTrace_IsBlockTrace(int fd)
+{
+    char magic[8];
+    return pread(fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+           memcmp(magic, BLOCK_TRACE_MAGIC, sizeof(magic)) == 0;
+}
+
+void BlockTrace_ReadIndex(int fd, block_trace_index_t * index)
+{
+    uint8_t header[BLOCK_TRACE_HEADER_SIZE];
+    BlockTrace_ReadAt(fd, header, sizeof(header), 0);
+    if (memcmp(&header[0], BLOCK_TRACE_MAGIC, 8) != 0 ||
+        GetLE32(&header[8]) != BLOCK_TRACE_VERSION ||
+        GetLE32(&header[12]) != BINARY_TRACE_RECORD_SIZE ||
+        GetLE32(&header[16]) == 0) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        (uint64_t) st.st_size < BLOCK_TRACE_HEADER_SIZE + BLOCK_TRACE_TRAILER_SIZE) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    uint64_t trailer_offset = st.st_size - BLOCK_TRACE_TRAILER_SIZE;
+
+    uint8_t trailer[BLOCK_TRACE_TRAILER_SIZE];
+    BlockTrace_ReadAt(fd, trailer, sizeof(trailer), trailer_offset);
+    uint64_t index_offset = GetLE64(&trailer[0]);
+    uint64_t n_blocks     = GetLE64(&trailer[8]);
+    if (memcmp(&trailer[24], BLOCK_TRACE_INDEX_MAGIC, 8) != 0 ||
+        index_offset < BLOCK_TRACE_HEADER_SIZE ||
+        index_offset > trailer_offset ||
+        n_blocks != (trailer_offset - index_offset) / BLOCK_TRACE_ENTRY_SIZE ||
+        n_blocks * BLOCK_TRACE_ENTRY_SIZE != trailer_offset - index_offset) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    index->block_len = GetLE32(&header[16]);
+    index->n_blocks  = n_blocks;
+    index->n_records = GetLE64(&trailer[16]);
+    index->entries   = NULL;
+
+    size_t raw_length = n_blocks * BLOCK_TRACE_ENTRY_SIZE;
+    uint8_t * raw = (uint8_t *) malloc(raw_length + 1);
+    index->entries = (block_trace_entry_t *) malloc((n_blocks + 1) * sizeof(block_trace_entry_t));
+    if (raw == NULL || index->entries == NULL) {
+        free(raw);
+        BlockTrace_FreeIndex(index);
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        BlockTrace_ReadAt(fd, raw, raw_length, index_offset);
+
+        // Every block must follow on from the last, and lie between the
+        // header and the index
+        uint64_t next_record = 0;
+        uint64_t i;
+        for (i = 0; i < n_blocks; i++) {
+            block_trace_entry_t * entry = &index->entries[i];
+            uint8_t const * bytes = &raw[i * BLOCK_TRACE_ENTRY_SIZE];
+
+            entry->offset            = GetLE64(&bytes[0]);
+            entry->first_record      = GetLE64(&bytes[8]);
+            entry->compressed_length = GetLE32(&bytes[16]);
+            entry->n_records         = GetLE32(&bytes[20]);
+
+            if (entry->first_record != next_record ||
+                entry->n_records == 0 ||
+                entry->n_records > index->block_len ||
+                entry->offset < BLOCK_TRACE_HEADER_SIZE ||
+                entry->offset + entry->compressed_length > index_offset) {
+                ThrowHere(BAD_TRACE_FILE);
+            }
+            next_record += entry->n_records;
+        }
+        if (next_record != index->n_records) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+    }
+    Catch (e) {
+        free(raw);
+        BlockTrace_FreeIndex(index);
+        Throw(e);
+    }
+
+    free(raw);
+}
+
+void BlockTrace_FreeIndex(block_trace_index_t * index)
+{
+    free(index->entries);
+    index->entries = NULL;
+}
+
+uint64_t BlockTrace_FindBlock(block_trace_index_t const * index, uint64_t record)
+{
+    if (record >= index->n_records) {
+        return index->n_blocks;
+    }
+
+    // Find the last block starting at or before the record
+    uint64_t low  = 0;
+    uint64_t high = index->n_blocks - 1;
+    while (low < high) {
+        uint64_t middle = low + (high - low + 1) / 2;
+        if (index->entries[middle].first_record <= record) {
+            low = middle;
+        }
+        else {
+            high = middle - 1;
+        }
+    }
+
+    return low;
+}
+
+bool BlockTrace_DecompressBlock(uint8_t * records,
+                                uint8_t const * compressed,
+                                block_trace_entry_t const * entry)
+{
+    uLongf expected = (uLongf) entry->n_records * BINARY_TRACE_RECORD_SIZE;
+    uLongf length = expected;
+
+    return uncompress(records, &length, compressed, entry->compressed_length) == Z_OK &&
+           length == expected;
+}
+
+size_t BlockTrace_CompressBound(uint32_t n_records)
+{
+    return compressBound((uLong) n_records * BINARY_TRACE_RECORD_SIZE);
+}
+
+bool BlockTrace_CompressBlock(uint8_t * compressed,
+                              size_t * length,
+                              uint8_t const * records,
+                              uint32_t n_records)
+{
+    uLongf compressed_length = BlockTrace_CompressBound(n_records);
+    if (compress(compressed, &compressed_length, records,
+                 (uLong) n_records * BINARY_TRACE_RECORD_SIZE) != Z_OK) {
+        return false;
+    }
+
+    *length = compressed_length;
+    return true;
+}
+
+block_trace_writer_t BlockTrace_CreateWriter(FILE * file, uint32_t block_len)
+{
+    if (block_len == 0) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    block_trace_writer_t writer = (block_trace_writer_t) calloc(1, sizeof(*writer));
+    if (writer == NULL) {
+        return NULL;
+    }
+
+    writer->file            = file;
+    writer->block_len       = block_len;
+    writer->compressed_size = BlockTrace_CompressBound(block_len);
+    writer->records         = (uint8_t *) malloc((size_t) block_len * BINARY_TRACE_RECORD_SIZE);
+    writer->compressed      = (uint8_t *) malloc(writer->compressed_size);
+    if (writer->records == NULL || writer->compressed == NULL) {
+        BlockTrace_DestroyWriter(writer);
+        return NULL;
+    }
+
+    uint8_t header[BLOCK_TRACE_HEADER_SIZE];
+    memcpy(&header[0], BLOCK_TRACE_MAGIC, 8);
+    PutLE32(&header[8], BLOCK_TRACE_VERSION);
+    PutLE32(&header[12], BINARY_TRACE_RECORD_SIZE);
+    PutLE32(&header[16], block_len);
+    PutLE32(&header[20], 0);
+
+    CEXCEPTION_T e;
+    Try {
+        BlockTrace_WriteBytes(writer, header, sizeof(header));
+    }
+    Catch (e) {
+        BlockTrace_DestroyWriter(writer);
+        Throw(e);
+    }
+
+    return writer;
+}
+
+void BlockTrace_DestroyWriter(block_trace_writer_t writer)
+{
+    if (writer) {
+        free(writer->records);
+        free(writer->compressed);
+        free(writer->entries);
+        free(writer);
+    }
+}
+
+void BlockTrace_Write(block_trace_writer_t writer,
+                      access_t const * accesses,
+                      uint32_t n_accesses)
+{
+    uint32_t i;
+    for (i = 0; i < n_accesses; i++) {
+        BinaryTrace_EncodeAccess(&writer->records[writer->n_buffered * BINARY_TRACE_RECORD_SIZE],
+                                 &accesses[i]);
+        writer->n_buffered++;
+
+        if (writer->n_buffered == writer->block_len) {
+            BlockTrace_FlushBlock(writer);
+        }
+    }
+}
+
+void BlockTrace_WriteBlock(block_trace_writer_t writer,
+                           uint8_t const * compressed,
+                           size_t length,
+                           uint32_t n_records)
+{
+    if (n_records > writer->block_len) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+    if (writer->n_buffered > 0) {
+        BlockTrace_FlushBlock(writer);
+    }
+
+    BlockTrace_AppendBlock(writer, compressed, length, n_records);
+}
+
+uint64_t BlockTrace_Finish(block_trace_writer_t writer)
+{
+    if (writer->n_buffered > 0) {
+        BlockTrace_FlushBlock(writer);
+    }
+
+    uint64_t index_offset = writer->offset;
+
+    uint8_t entry[BLOCK_TRACE_ENTRY_SIZE];
+    uint64_t i;
+    for (i = 0; i < writer->n_blocks; i++) {
+        PutLE64(&entry[0],  writer->entries[i].offset);
+        PutLE64(&entry[8],  writer->entries[i].first_record);
+        PutLE32(&entry[16], writer->entries[i].compressed_length);
+        PutLE32(&entry[20], writer->entries[i].n_records);
+        BlockTrace_WriteBytes(writer, entry, sizeof(entry));
+    }
+
+    uint8_t trailer[BLOCK_TRACE_TRAILER_SIZE];
+    PutLE64(&trailer[0],  index_offset);
+    PutLE64(&trailer[8],  writer->n_blocks);
+    PutLE64(&trailer[16], writer->n_records);
+    memcpy(&trailer[24], BLOCK_TRACE_INDEX_MAGIC, 8);
+    BlockTrace_WriteBytes(writer, trailer, sizeof(trailer));
+
+    if (fflush(writer->file) != 0) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    return writer->n_records;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void BlockTrace_ReadAt(int fd, uint8_t * buffer, size_t length, uint64_t offset)
+{
+    while (length > 0) {
+        ssize_t n_read = pread(fd, buffer, length, offset);
+        if (n_read <= 0) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+        buffer += n_read;
+        length -= n_read;
+        offset += n_read;
+    }
+}
+
+static void BlockTrace_WriteBytes(block_trace_writer_t writer,
+                                  uint8_t const * buffer,
+                                  size_t length)
+{
+    if (fwrite(buffer, 1, length, writer->file) != length) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    writer->offset += length;
+}
+
+static void BlockTrace_FlushBlock(block_trace_writer_t writer)
+{
+    size_t length = 0;
+    if (!BlockTrace_CompressBlock(writer->compressed, &length,
+                                  writer->records, writer->n_buffered)) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    BlockTrace_AppendBlock(writer, writer->compressed, length, writer->n_buffered);
+    writer->n_buffered = 0;
+}
+
+static void BlockTrace_AppendBlock(block_trace_writer_t writer,
+                                   uint8_t const * compressed,
+                                   size_t length,
+                                   uint32_t n_records)
+{
+    if (writer->n_blocks == writer->max_blocks) {
+        uint64_t max_blocks = writer->max_blocks ? 2 * writer->max_blocks : INITIAL_INDEX_LEN;
+        block_trace_entry_t * entries = (block_trace_entry_t *)
+            realloc(writer->entries, max_blocks * sizeof(block_trace_entry_t));
+        if (entries == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        writer->entries    = entries;
+        writer->max_blocks = max_blocks;
+    }
+
+    block_trace_entry_t * entry = &writer->entries[writer->n_blocks];
+    entry->offset            = writer->offset;
+    entry->first_record      = writer->n_records;
+    entry->compressed_length = length;
+    entry->n_records         = n_records;
+
+    BlockTrace_WriteBytes(writer, compressed, length);
+
+    writer->n_blocks  += 1;
+    writer->n_records += n_records;
+}
+
+/** @} addtogroup BLOCKTRACE */
@@ -20,8 +20,9 @@
 /* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 
-const char * exception_file = NULL;
-unsigned int exception_line = 0;
+_Thread_local const char * exception_file = NULL;
+_Thread_local unsigned int exception_line = 0;
+_Thread_local unsigned int exception_thread_id = 0;
 
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
@@ -9,63 +9,223 @@
 
 /* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
 
+// Required for madvise()
+#define _DEFAULT_SOURCE
+
 #include "CacheData.h"
 
+#include "TagSearch.h"
 #include "Util.h"
 #include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
 
 #include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
 
 /* --- PRIVATE CONSTANTS ---------------------------------------------------- */
 
-#define VICTIM_SET          (UINT32_MAX)
+/**@brief   Returned when a set holds no matching block */
+#define NO_WAY              (TAG_SEARCH_NO_MATCH)
+
+/**@brief   Most blocks a set can hold, so that every LRU rank fits its field */
+#define MAX_SET_LEN         (1 << 16)
+
+/**@brief   Sets longer than this use the hashed engine, whose costs don't
+ *          grow with associativity
+ */
+#define HASHED_SET_LEN_THRESHOLD    (32)
+
+/**@brief   Most blocks a hashed cache can hold, so that its table's length
+ *          fits in 32 bits
+ */
+#define MAX_HASHED_BLOCKS   (1 << 30)
+
+/**@brief   Marks the end of a hashed set's LRU order, or an empty table entry */
+#define NO_BLOCK            (UINT32_MAX)
+
+/**@brief   Multiplier for hashing block numbers (2^64 over the golden ratio) */
+#define HASH_MULTIPLIER     (UINT64_C(0x9E3779B97F4A7C15))
+
+/**@brief   Caches of at least this many blocks use the compact engine, if
+ *          their sets are short enough
+ */
+#define COMPACT_MIN_BLOCKS  (1 << 16)
+
+/**@brief   Bits of a compact set's rank word given to each way */
+#define COMPACT_RANK_BITS   (4)
+
+/**@brief   Longest set the compact engine holds, so that every way's rank fits
+ *          the set's 64-bit rank word
+ */
+#define COMPACT_MAX_SET_LEN (64 / COMPACT_RANK_BITS)
+
+/**@brief   Allocations at least this large are put on huge pages, where the
+ *          host supports them [bytes]
+ */
+#define HUGE_PAGE_SIZE      (2 * 1024 * 1024)
+
+/**@brief   How many accesses ahead of the one being simulated a batch
+ *          prefetches
+ */
+#define PREFETCH_DISTANCE   (8)
+
+/**@brief   Caches with fewer blocks than this aren't prefetched
+ *
+ * Their tags, at 8 bytes a block, fit in the host's own caches, where
+ * prefetching only costs time
+ */
+#define PREFETCH_MIN_BLOCKS (128 * 1024)
+
+/**@brief   Alignment of the set storage. One host cache line [bytes] */
+#define SET_ALIGNMENT       (64)
+
+/**@brief   Held by every empty way. Never block aligned, so never matches */
+#define EMPTY_ADDRESS       (UINT64_MAX)
 
 /* --- PRIVATE DATATYPES ---------------------------------------------------- */
 
-/**@brief   Structure used to store a single block of data
- *
- * @note    There is no explicit 'valid' field. If a block is present in set,
- *          it's valid.
- *
- * @note    The block stores a full address (rather than simply a tag) for
- *          three reasons:
- *          - This allows direct compatibility between ordinary blocks and
- *            victim set blocks
- *          - Computation of the tag is an extra step, and forces an additional
- *            re-computation of the original address when moving a block to the
- *            victim cache
- *          - The code cannot support the all levels of associativity by only
- *            storing 32 bits, so there's no space savings for stripping an
- *            address to a tag
- */
-typedef struct _block_t {
-    bool dirty;                     /**< Whether this block has been written */
-    uint64_t address;               /**< The base address of the stored block*/
-    struct _block_t * newer;        /**< The next newest block in this set's
-                                         LRU order*/
-    struct _block_t * older;        /**< The next oldest block in this set's
-                                         LRU order */
-} block_t;
-
-/**@brief   A doubly-linked list used to represent a cache set
- *
- * @note    A doubly (as opposed to singly) linked list was chosen so that
- *          removal of the last ('oldest') element is a constant-time operation
- *          that does not require traversal of the list.
- */
-typedef struct _set_t {
-    uint32_t n_valid_blocks;        /**< The current number of valid blocks
-                                         currently stored in the set */
-    struct _block_t * newest;       /**< The newest block in this set's LRU
-                                         order */
-    struct _block_t * oldest;       /**< The oldest block in this set's LRU
-                                         order */
+/**@brief   Bookkeeping kept alongside each set's blocks */
+typedef struct {
+    uint32_t n_valid_blocks;        /**< The number of valid blocks currently
+                                         stored in the set */
+    uint32_t newest_way;            /**< The way of the newest block. Checked
+                                         first, since most accesses reuse it */
+} set_state_t;
+
+/**@brief   A view of the storage of a single set
+ *
+ * Each set's storage is a single contiguous record, so that looking a block up
+ * touches as few host cache lines as possible:
+ *
+ * Field            | Size [bytes]  | Contents
+ * ---------------- | ------------- | ------------------------------------------
+ * Addresses        | 8 per way     | Base address of the block in each way
+ * Dirty mask       | 8 per 64 ways | Bit w set if way w has been written
+ * State            | 8             | Valid count and newest way (see
+ *                  |               | @ref set_state_t)
+ * Ranks            | 2 per way     | Each way's place in the LRU order. 0 is
+ *                  |               | the newest
+ *
+ * @note    There is no explicit 'valid' field. Ways fill in order and are never
+ *          emptied, so the first (valid count) ways are the valid ones
+ *
+ * @note    Full block addresses are stored (rather than simply tags), so
+ *          that ordinary blocks and victim set blocks are directly compatible
+ *          and no tag has to be computed, or turned back into an address when
+ *          its block moves to the victim set. Only large caches with short
+ *          sets gain enough from stripping addresses to tags to make up for
+ *          it: they use @ref compact_set_t, which keeps 32-bit tags. That
+ *          assumes every address fits in 32 bits above the set index, so a
+ *          compact cache is widened to this layout the first time one doesn't
+ */
+typedef struct {
+    uint64_t * addresses;           /**< The address stored in each way */
+    uint64_t * dirty;               /**< Bitmask of ways that have been
+                                         written */
+    set_state_t * state;            /**< The set's bookkeeping */
+    uint16_t * ranks;               /**< Each way's place in LRU order */
+    uint32_t len;                   /**< The number of ways in the set */
 } set_t;
 
+/**@brief   The shape of a cache, as seen by an access kernel
+ *
+ * Specialized kernels are built with constants here, so the compiler can fold
+ * shifts and loop bounds into the code. The generic path passes the cache's
+ * own values
+ */
+typedef struct {
+    uint32_t set_len_blocks;        /**< The cache's associativity */
+    uint32_t block_shift;           /**< log2 of the block size */
+    uint32_t victim_set_len_blocks; /**< The length of the victim set */
+} geometry_t;
+
+/**@brief   A set of the compact engine
+ *
+ * Only each block's tag is kept: the bits of its address above the set index.
+ * The full address is rebuilt from the tag and the set's index when the block
+ * moves to the victim set or is printed. Sets are @ref
+ * CacheData_CompactSetSize() bytes apart
+ *
+ * @note    Tags are 32 bits, which covers every address below 2^(32 + the
+ *          tag's shift); at least 2^48 for the caches this engine is chosen
+ *          for. The first access to a higher address converts the cache to
+ *          @ref set_t sets (see @ref CacheData_Compact_Widen())
+ */
+typedef struct {
+    uint64_t ranks;                 /**< Each way's place in LRU order, in
+                                         @ref COMPACT_RANK_BITS bits. 0 is the
+                                         newest */
+    uint16_t dirty;                 /**< Bit w set if way w has been
+                                         written */
+    uint8_t n_valid_blocks;         /**< The number of valid blocks. As in
+                                         @ref set_t, they fill the first
+                                         ways */
+    uint8_t newest_way;             /**< The way of the newest block */
+    uint32_t tags[];                /**< The tag held by each way */
+} compact_set_t;
+
+/**@brief   A block of a hashed cache, linked into its set's LRU order */
+typedef struct {
+    uint64_t address;               /**< The block's address */
+    uint32_t newer;                 /**< The next newer block in the set, or
+                                         @ref NO_BLOCK */
+    uint32_t older;                 /**< The next older block in the set, or
+                                         @ref NO_BLOCK */
+} lru_block_t;
+
+/**@brief   A set of a hashed cache */
+typedef struct {
+    uint32_t newest;                /**< The newest block, or @ref NO_BLOCK */
+    uint32_t oldest;                /**< The oldest block, or @ref NO_BLOCK */
+    uint32_t n_valid_blocks;        /**< The number of valid blocks currently
+                                         stored in the set. Set i's blocks are
+                                         i * set length onwards, filled in
+                                         order */
+} lru_set_t;
+
+/**@brief   The operations that depend on how a cache's sets are stored
+ *
+ * Picked once, when the cache is created
+ */
+typedef struct {
+    /**@brief   Access the block holding an address (which need not be
+     *          aligned). See @ref CacheData_AccessBlock
+     */
+    uint64_t (*access_block)(cache_data_t data,
+                             uint64_t address,
+                             bool write_access,
+                             result_t * result);
+
+    /**@brief   Whether a block is in its set (not the victim set) */
+    bool (*set_contains)(cache_data_t data, uint64_t address);
+
+    /**@brief   Print every set but the victim set */
+    void (*print_sets)(cache_data_t data);
+
+    /**@brief   Start loading what an access to an address will look at first.
+     *          See @ref CacheData_Prefetch
+     */
+    void (*prefetch)(cache_data_t data, uint64_t address);
+} cache_engine_t;
+
+/**@brief   A kernel specialized for one geometry */
+typedef struct {
+    uint32_t set_len_blocks;        /**< The geometry it is built for */
+    uint32_t block_size_bytes;
+    uint32_t victim_set_len_blocks;
+    uint64_t (*access_block)(cache_data_t data,
+                             uint64_t address,
+                             bool write_access,
+                             result_t * result);
+                                    /**< The kernel */
+} cache_kernel_t;
+
 /**@brief The internal data structure used for a cache's data bookkeeping
  *
  * @note    The victim cache is referred to throughout as the victim 'set' to
@@ -81,39 +241,141 @@ struct _cache_data_t {
     uint32_t set_index_shift;       /**< Shift used to move an address's set
                                          bits to the right, so they can be used
                                          as an array index */
-    uint64_t set_mask;              /**< A mask that can be used to isolate the
-                                         bytes in an a block's address
-                                         determining its set membership */
     uint64_t block_mask;            /**< A mask used for computing in which
                                          block an address falls */
-    block_t * all_blocks;           /**< Reference to the start of the block
-                                         array */
-    block_t * next_free_block;      /**< Reference to the next block that has
-                                         not been inserted into the cache */
-    block_t * last_block;           /**< Reference to the end of the block
-                                         array */
-    set_t victim_set;               /**< A set used to store blocks that have
-                                         just been kicked out of their proper
-                                         set */
-    set_t sets[];                   /**< The array of sets in the cache. n_sets
-                                         long */
+    cache_engine_t const * engine;  /**< Implementation for this layout */
+    uint64_t (*access_block)(cache_data_t data,
+                             uint64_t address,
+                             bool write_access,
+                             result_t * result);
+                                    /**< The engine's access, or a kernel
+                                         specialized for this geometry */
+    void (*prefetch)(cache_data_t data, uint64_t address);
+                                    /**< The engine's prefetch, or NULL if
+                                         the cache is too small to gain */
+    size_t set_stride;              /**< Size of each set's storage [bytes] */
+    uint8_t * sets;                 /**< Storage for every set, one after
+                                         another */
+    uint64_t * block_addresses;     /**< Direct-mapped only: the address held
+                                         by each set, in place of @p sets */
+    uint64_t * dirty_blocks;        /**< Direct-mapped and hashed only: bit
+                                         i set if block i has been written */
+    lru_block_t * lru_blocks;       /**< Hashed only: every block, each set's
+                                         together */
+    lru_set_t * lru_sets;           /**< Hashed only: each set's LRU order */
+    uint32_t * block_table;         /**< Hashed only: index of the block
+                                         holding each address, by linear
+                                         probing from the address's hash */
+    uint32_t table_mask;            /**< Hashed only: mask wrapping a position
+                                         in @p block_table */
+    uint32_t tag_shift;             /**< Compact only: shift taking a block's
+                                         address to its tag */
+    uint32_t table_shift;           /**< Hashed only: shift taking a hash to
+                                         its position in @p block_table */
+    uint8_t * victim_set;           /**< Storage for a set used to store blocks
+                                         that have just been kicked out of their
+                                         proper set */
+    uint32_t * order;               /**< Space to put a set's ways in LRU
+                                         order, for printing */
+    tag_search_t search;            /**< Searches sets of at least @ref
+                                         TAG_SEARCH_WIDTH ways, using the
+                                         host's widest vectors */
 };
 
 /* --- PRIVATE MACROS ------------------------------------------------------- */
 
-/**@brief Helper for iterating over all blocks in a set from newest to oldest */
-#define for_block_in_set(block, set) \
-        for (block = set->newest; block != NULL; block = block->older)
+/**@brief   Marks a function whose callers may pass a constant @ref geometry_t,
+ *          so it must be inlined for the constants to be folded
+ */
+#define KERNEL_INLINE       inline __attribute__((always_inline))
+
+/**@brief   The geometries given their own kernels: associativity, block size
+ *          [bytes], victim set length [blocks]
+ *
+ * These are the combinations of the standard configurations. Fully
+ * associative caches are left to the hashed engine, which has no loops to
+ * specialize
+ */
+#define CACHE_KERNELS(X)                                                       \
+    X(1, 32, 0) X(1, 32, 8) X(1, 64, 0) X(1, 64, 8)                            \
+    X(2, 32, 0) X(2, 32, 8) X(2, 64, 0) X(2, 64, 8)                            \
+    X(4, 32, 0) X(4, 32, 8) X(4, 64, 0) X(4, 64, 8)                            \
+    X(8, 32, 0) X(8, 32, 8) X(8, 64, 0) X(8, 64, 8)
+
+/**@brief   The name of the kernel for a geometry */
+#define CACHE_KERNEL_NAME(set_len, block_size, victim_len)                     \
+    CacheData_Kernel_##set_len##_##block_size##_##victim_len
+
+/**@brief   Declare the kernel for a geometry */
+#define DECLARE_CACHE_KERNEL(set_len, block_size, victim_len)                  \
+    static uint64_t CACHE_KERNEL_NAME(set_len, block_size, victim_len)(        \
+        cache_data_t data, uint64_t address, bool write_access,                \
+        result_t * result);
+
+/**@brief   Define the kernel for a geometry */
+#define DEFINE_CACHE_KERNEL(set_len, block_size, victim_len)                   \
+    static uint64_t CACHE_KERNEL_NAME(set_len, block_size, victim_len)(        \
+        cache_data_t data, uint64_t address, bool write_access,                \
+        result_t * result)                                                     \
+    {                                                                          \
+        geometry_t const geometry = {                                          \
+            set_len, __builtin_ctz(block_size), victim_len                     \
+        };                                                                     \
+        if (set_len == 1) {                                                    \
+            return CacheData_DirectMapped_Kernel(data, geometry, address,      \
+                                                 write_access, result);        \
+        }                                                                      \
+        return CacheData_Kernel(data, geometry, address, write_access, result);\
+    }
+
+/**@brief   The dispatch table entry for a geometry's kernel */
+#define CACHE_KERNEL_ENTRY(set_len, block_size, victim_len)                    \
+    { set_len, block_size, victim_len,                                         \
+      CACHE_KERNEL_NAME(set_len, block_size, victim_len) },
 
 /* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
 
-/**@brief   Perform an  access to a block of cache data
+/**@brief   Perform an access to a block of cache data, for sets of any
+ *          geometry
  *
  * This is the real workhorse of this implementation
  *
  * @param[in,out] data:     The cache
- * @param[in] address:      The address to access. Assumed to be aligned to a
- *                          block boundary
+ * @param[in] geometry:     The cache's geometry. Constant in specialized
+ *                          kernels
+ * @param[in] address:      The address to access
+ * @param[in] write_access: Whether this is a write access
+ * @param[out] result:      The final result (hit, miss, etc)
+ *
+ * @return          The address of a block kicked out dirty, if any
+ */
+static KERNEL_INLINE uint64_t CacheData_Kernel(cache_data_t data,
+                                               geometry_t geometry,
+                                               uint64_t address,
+                                               bool write_access,
+                                               result_t * result);
+
+/**@brief   Perform an access to a block of direct-mapped cache data
+ *
+ * Equivalent to @ref CacheData_Kernel, with sets of one block
+ */
+static KERNEL_INLINE uint64_t CacheData_DirectMapped_Kernel(cache_data_t data,
+                                                            geometry_t geometry,
+                                                            uint64_t address,
+                                                            bool write_access,
+                                                            result_t * result);
+
+/**@brief   The kernels specialized for each of @ref CACHE_KERNELS */
+CACHE_KERNELS(DECLARE_CACHE_KERNEL)
+
+/**@brief   The cache's geometry, for the generic path */
+static geometry_t CacheData_GetGeometry(cache_data_t data);
+
+/**@brief   Perform an access to a block of cache data, with the cache's own
+ *          geometry
+ *
+ * @param[in,out] data:     The cache
+ * @param[in] address:      The address to access
  * @param[in] write_access: Whether this is a write access
  * @param[out] result:      The final result (hit, miss, etc)
  *
@@ -124,41 +386,237 @@ static uint64_t CacheData_AccessBlock(cache_data_t data,
                                       bool write_access,
                                       result_t * result);
 
+/**@brief   Whether the block at @p address is in its set */
+static bool CacheData_SetContains(cache_data_t data, uint64_t address);
+
+/**@brief   Print every set but the victim set */
+static void CacheData_PrintSets(cache_data_t data);
+
+/**@brief   Prefetch every cache line of the set @p address maps to, for the
+ *          engines that store sets one after another in @p sets
+ */
+static void CacheData_PrefetchSet(cache_data_t data, uint64_t address);
+
+/**@brief   Perform an access to a block of direct-mapped cache data, with the
+ *          cache's own geometry
+ */
+static uint64_t CacheData_DirectMapped_AccessBlock(cache_data_t data,
+                                                   uint64_t address,
+                                                   bool write_access,
+                                                   result_t * result);
+
+/**@brief   Whether the block at @p address is in its direct-mapped set */
+static bool CacheData_DirectMapped_SetContains(cache_data_t data, uint64_t address);
+
+/**@brief   Print every direct-mapped set but the victim set */
+static void CacheData_DirectMapped_PrintSets(cache_data_t data);
+
+/**@brief   Prefetch the entry of the set @p address maps to */
+static void CacheData_DirectMapped_Prefetch(cache_data_t data, uint64_t address);
+
+/**@brief   Perform an access to a block of hashed cache data
+ *
+ * Equivalent to @ref CacheData_AccessBlock, in constant time whatever the
+ * associativity
+ */
+static uint64_t CacheData_Hashed_AccessBlock(cache_data_t data,
+                                             uint64_t address,
+                                             bool write_access,
+                                             result_t * result);
+
+/**@brief   Whether the block at @p address is in its hashed set */
+static bool CacheData_Hashed_SetContains(cache_data_t data, uint64_t address);
+
+/**@brief   Print every hashed set but the victim set */
+static void CacheData_Hashed_PrintSets(cache_data_t data);
+
+/**@brief   Prefetch where the search for @p address's block in the block
+ *          table starts
+ *
+ * The block itself can only be found once the table has been read
+ */
+static void CacheData_Hashed_Prefetch(cache_data_t data, uint64_t address);
+
+/**@brief   Perform an access to a block of compact cache data
+ *
+ * Equivalent to @ref CacheData_AccessBlock. An address whose tag doesn't fit
+ * in 32 bits first widens the cache, then is simulated as usual
+ *
+ * @throws ALLOCATION_FAILURE   When the cache can't be widened
+ */
+static uint64_t CacheData_Compact_AccessBlock(cache_data_t data,
+                                              uint64_t address,
+                                              bool write_access,
+                                              result_t * result);
+
+/**@brief   Whether the block at @p address is in its compact set */
+static bool CacheData_Compact_SetContains(cache_data_t data, uint64_t address);
+
+/**@brief   Print every compact set but the victim set */
+static void CacheData_Compact_PrintSets(cache_data_t data);
+
+/**@brief   Size of the storage for a compact set of @p len ways [bytes] */
+static size_t CacheData_CompactSetSize(uint32_t len);
+
+/**@brief   Retrieve compact set @p set_index */
+static compact_set_t * CacheData_GetCompactSet(cache_data_t data, uint32_t set_index);
+
+/**@brief   The tag of the block at @p address. Only its low 32 bits are
+ *          stored
+ */
+static uint64_t CacheData_Compact_GetTag(cache_data_t data, uint64_t address);
+
+/**@brief   Convert every compact set to a set of full addresses, keeping its
+ *          blocks, their LRU order and dirty bits, and use the set-associative
+ *          engine from then on
+ *
+ * @throws ALLOCATION_FAILURE   When the new sets can't be allocated
+ */
+static void CacheData_Compact_Widen(cache_data_t data);
+
+
+/**@brief   Rebuild the address of the block with @p tag in set @p set_index */
+static uint64_t CacheData_Compact_GetAddress(cache_data_t data,
+                                             uint32_t tag,
+                                             uint32_t set_index);
+
+/**@brief   Find the way holding @p tag in @p set, or @ref NO_WAY */
+static uint32_t CacheData_CompactSet_GetMatchingWay(compact_set_t const * set,
+                                                    uint32_t tag);
+
+/**@brief   The place of @p way in @p set's LRU order. 0 is the newest */
+static uint32_t CacheData_CompactSet_GetRank(compact_set_t const * set, uint32_t way);
+
+/**@brief   Find the way holding the oldest block in a full @p set */
+static uint32_t CacheData_CompactSet_GetOldestWay(compact_set_t const * set);
+
+/**@brief   Make the block in @p way the newest in @p set */
+static void CacheData_CompactSet_Touch(compact_set_t * set, uint32_t way);
+
+/**@brief   Use a kernel specialized for @p data's geometry, if its engine has
+ *          one
+ */
+static void CacheData_SelectKernel(cache_data_t data);
+
+/**@brief   Allocate storage for sets, on huge pages if it's large enough
+ *
+ * @note    Free with free()
+ *
+ * @return  The storage, aligned to at least @ref SET_ALIGNMENT, or NULL if
+ *          memory allocation failed
+ */
+static void * CacheData_AllocateSets(size_t size);
+
+/**@brief   Find where @p address is in the block table
+ *
+ * @return  The position holding @p address, or else the empty position where
+ *          it would be added
+ */
+static uint32_t CacheData_Table_Find(cache_data_t data, uint64_t address);
+
+/**@brief   Empty the block table's entry at @p position, moving later entries
+ *          back so that every probe still reaches its address
+ */
+static void CacheData_Table_Remove(cache_data_t data, uint32_t position);
+
+/**@brief   The position probing for @p address starts from */
+static uint32_t CacheData_Table_Home(cache_data_t data, uint64_t address);
+
+/**@brief   Take @p block out of @p set's LRU order */
+static void CacheData_Lru_Unlink(cache_data_t data, lru_set_t * set, uint32_t block);
+
+/**@brief   Put @p block into @p set's LRU order, as the newest */
+static void CacheData_Lru_PushNewest(cache_data_t data, lru_set_t * set, uint32_t block);
+
+/**@brief   Whether block @p block has been written (direct-mapped and hashed
+ *          only)
+ */
+static bool CacheData_IsBlockDirty(cache_data_t data, uint32_t block);
+
+/**@brief   Mark block @p block as written, or not (direct-mapped and hashed
+ *          only)
+ */
+static void CacheData_SetBlockDirty(cache_data_t data, uint32_t block, bool dirty);
+
+/**@brief   Handle a block being evicted from its set to make room for another
+ *
+ * The evicted block moves to the victim set. If the incoming block was in the
+ * victim set, the two are exchanged. If not, the victim set's oldest block may
+ * be kicked out
+ *
+ * @param[in,out] data:         The cache
+ * @param[in] geometry:         The cache's geometry
+ * @param[in] address:          The block address coming in
+ * @param[in] evicted_address:  The block address being evicted
+ * @param[in] evicted_dirty:    Whether the evicted block has been written
+ * @param[out] dirty:           Whether the incoming block has been written
+ * @param[out] result:          The final result (hit, miss, etc)
+ *
+ * @return          The address of a block kicked out dirty, if any
+ */
+static KERNEL_INLINE uint64_t CacheData_Evict(cache_data_t data,
+                                              geometry_t geometry,
+                                              uint64_t address,
+                                              uint64_t evicted_address,
+                                              bool evicted_dirty,
+                                              bool * dirty,
+                                              result_t * result);
+
 /**@brief   Retrieve the index of the set @p address belongs in */
-static uint32_t CacheData_GetSetIndex(cache_data_t data, uint64_t address);
+static KERNEL_INLINE uint32_t CacheData_GetSetIndex(cache_data_t data,
+                                                    geometry_t geometry,
+                                                    uint64_t address);
+
+/**@brief   Retrieve a view of the set @p address belongs in */
+static KERNEL_INLINE set_t CacheData_GetSet(cache_data_t data,
+                                            geometry_t geometry,
+                                            uint64_t address);
 
-/**@brief   Retrieve a reference to the set @p address belongs in */
-static set_t * CacheData_GetSet(cache_data_t data, uint64_t address);
+/**@brief   Retrieve a view of the victim set */
+static KERNEL_INLINE set_t CacheData_GetVictimSet(cache_data_t data, geometry_t geometry);
 
 /**@brief   Determine the base address of the block @p address belongs in */
 static uint64_t CacheData_BlockAlignAddress(cache_data_t data,
                                             uint64_t address);
 
-/**@brief   Get a new block from the pool allocated when @p data was created */
-static block_t * CacheData_AllocateBlock(cache_data_t data);
+/**@brief   Size of the storage for a set of @p len ways [bytes] */
+static KERNEL_INLINE size_t CacheData_SetSize(uint32_t len);
 
-/**@brief   Find the block containing @p address in @p set
+/**@brief   Build a view of the set of @p len ways stored at @p storage */
+static KERNEL_INLINE set_t CacheData_SetAt(uint8_t * storage, uint32_t len);
+
+/**@brief   Empty the set of @p len ways stored at @p storage */
+static void CacheData_Set_Clear(uint8_t * storage, uint32_t len);
+
+/**@brief   Find the way holding the block containing @p address in @p set
  *
+ * @param[in] data:     The cache, which holds the search to use
  * @param[in] set:      The set to search
  * @param[in] address:  The block address (assumed to be aligned)
  *
- * @return  A reference to a matching block, or NULL if none exists in @p set
+ * @return  The matching way, or @ref NO_WAY if none exists in @p set
  */
-static block_t * CacheData_Set_GetMatchingBlock(set_t * set, uint64_t address);
+static KERNEL_INLINE uint32_t CacheData_Set_GetMatchingWay(cache_data_t data,
+                                                           set_t const * set,
+                                                           uint64_t address);
 
-/**@brief   Remove block @p block from @p set
- *
- * @warming @p block is assumed to be a current member of set. If it's not,
- *          weird things may occur
- */
-static void CacheData_Set_RemoveBlock(set_t * set, block_t * block);
+/**@brief   Find the way holding the oldest block in a full @p set */
+static uint32_t CacheData_Set_GetOldestWay(set_t const * set);
 
-/**@brief   Insert @p block as the newest in @pset
+/**@brief   Take the next empty way of @p set, as its oldest
  *
- * @warning @p block is assumed not to be a current member of set. If it is,
- *          weird things may occur
+ * @warning @p set is assumed not to be full. If it is, weird things may occur
  */
-static void CacheData_Set_InsertBlockAsNewest(set_t * set, block_t * block);
+static uint32_t CacheData_Set_AddWay(set_t * set);
+
+/**@brief   Make the block in @p way the newest in @p set */
+static KERNEL_INLINE void CacheData_Set_Touch(set_t * set, uint32_t way);
+
+/**@brief   Whether the block in @p way has been written */
+static bool CacheData_Set_IsDirty(set_t const * set, uint32_t way);
+
+/**@brief   Mark the block in @p way as written, or not */
+static void CacheData_Set_SetDirty(set_t * set, uint32_t way, bool dirty);
 
 /**@brief   Print the contents of a single set
  *
@@ -166,11 +624,84 @@ static void CacheData_Set_InsertBlockAsNewest(set_t * set, block_t * block);
  *          can handle the victim set specially
  */
 static void CacheData_Set_Print(cache_data_t data,
-                                set_t * set,
+                                set_t const * set,
+                                bool is_victim_set,
                                 uint32_t set_index);
 
+/**@brief   Begin printing a set, or the victim set */
+static void CacheData_PrintSetStart(bool is_victim_set, uint32_t set_index);
+
+/**@brief   Print one valid block of a set
+ *
+ * @param[in] data:             The cache
+ * @param[in] is_victim_set:    Whether the block is in the victim set
+ * @param[in] block_index:      The block's place in the set, from newest
+ * @param[in] n_blocks:         The length of the set
+ * @param[in] address:          The block's address
+ * @param[in] dirty:            Whether the block has been written
+ */
+static void CacheData_PrintBlock(cache_data_t data,
+                                 bool is_victim_set,
+                                 uint32_t block_index,
+                                 uint32_t n_blocks,
+                                 uint64_t address,
+                                 bool dirty);
+
+/**@brief   Print a set's empty blocks, which come after its valid ones, and
+ *          end the set
+ */
+static void CacheData_PrintSetEnd(bool is_victim_set,
+                                  uint32_t n_valid_blocks,
+                                  uint32_t n_blocks);
+
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   Sets of any length, each with its own LRU order */
+static cache_engine_t const set_associative_engine = {
+    .access_block   = CacheData_AccessBlock,
+    .set_contains   = CacheData_SetContains,
+    .print_sets     = CacheData_PrintSets,
+    .prefetch       = CacheData_PrefetchSet,
+};
+
+/**@brief   Sets of one block, which need no LRU order. Each set is just an
+ *          address and a dirty bit
+ */
+static cache_engine_t const direct_mapped_engine = {
+    .access_block   = CacheData_DirectMapped_AccessBlock,
+    .set_contains   = CacheData_DirectMapped_SetContains,
+    .print_sets     = CacheData_DirectMapped_PrintSets,
+    .prefetch       = CacheData_DirectMapped_Prefetch,
+};
+
+/**@brief   Sets of one block if there's only one, or of many blocks. Blocks
+ *          are found through a hash table and kept in order by a linked list,
+ *          so the cost of an access doesn't depend on the set's length
+ */
+static cache_engine_t const hashed_engine = {
+    .access_block   = CacheData_Hashed_AccessBlock,
+    .set_contains   = CacheData_Hashed_SetContains,
+    .print_sets     = CacheData_Hashed_PrintSets,
+    .prefetch       = CacheData_Hashed_Prefetch,
+};
+
+/**@brief   Every specialized kernel. Searched once, when a cache is created */
+static cache_kernel_t const kernels[] = {
+    CACHE_KERNELS(CACHE_KERNEL_ENTRY)
+};
+
+/**@brief   Large caches with short sets. Sets hold 32-bit tags, with the LRU
+ *          order and dirty bits packed into a couple of words, to keep the
+ *          host's footprint small
+ */
+static cache_engine_t const compact_engine = {
+    .access_block   = CacheData_Compact_AccessBlock,
+    .set_contains   = CacheData_Compact_SetContains,
+    .print_sets     = CacheData_Compact_PrintSets,
+    .prefetch       = CacheData_PrefetchSet,
+};
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
 cache_data_t CacheData_Create(uint32_t n_sets,
@@ -182,29 +713,105 @@ cache_data_t CacheData_Create(uint32_t n_sets,
         !IS_POWER_OF_TWO(set_len_blocks) ||
         !IS_POWER_OF_TWO(block_size_bytes) ||
         (!IS_POWER_OF_TWO(victim_set_len_blocks) && victim_set_len_blocks != 0) ||
+        victim_set_len_blocks > MAX_SET_LEN ||
         block_size_bytes < 4) {
         return NULL;
     }
 
-    cache_data_t data = (cache_data_t) malloc(sizeof(*data) +
-                                              (sizeof(set_t) * n_sets));
+    cache_data_t data = (cache_data_t) calloc(1, sizeof(*data));
     if (data == NULL) {
         return NULL;
     }
 
-    // All blocks are allocated here, since we know from the configuration
-    // parameters exactly how many we will need. This means that NO memory
-    // allocation is done in the body of the functional code -- we're just
-    // grabbing blocks from the all_blocks array as needed
-    uint32_t total_cache_blocks = (n_sets * set_len_blocks) +
-                                  victim_set_len_blocks;
-    data->all_blocks = (block_t *) malloc(sizeof(block_t) * total_cache_blocks);
-    if (data->all_blocks == NULL) {
-        free(data);
+    // All sets are allocated here, since we know from the configuration
+    // parameters exactly how large they are. This means that NO memory
+    // allocation is done in the body of the functional code
+    size_t victim_set_size = CacheData_SetSize(victim_set_len_blocks);
+    uint32_t max_set_len = set_len_blocks > victim_set_len_blocks ?
+                           set_len_blocks : victim_set_len_blocks;
+    uint64_t n_blocks = (uint64_t) n_sets * set_len_blocks;
+
+    // aligned_alloc() needs a multiple of the alignment
+    data->victim_set = (uint8_t *) aligned_alloc(SET_ALIGNMENT,
+                           CEIL_DIVIDE(victim_set_size, SET_ALIGNMENT) * SET_ALIGNMENT);
+    data->order      = (uint32_t *) malloc(sizeof(uint32_t) * max_set_len);
+    if (data->victim_set == NULL || data->order == NULL) {
+        CacheData_Destroy(data);
         return NULL;
     }
-    data->next_free_block           = data->all_blocks;
-    data->last_block                = data->all_blocks + total_cache_blocks;
+    CacheData_Set_Clear(data->victim_set, victim_set_len_blocks);
+
+    uint32_t i;
+    if (set_len_blocks == 1) {
+        data->engine          = &direct_mapped_engine;
+        data->block_addresses = (uint64_t *) CacheData_AllocateSets(sizeof(uint64_t) * n_sets);
+        data->dirty_blocks    = (uint64_t *) calloc(CEIL_DIVIDE(n_sets, 64), sizeof(uint64_t));
+        if (data->block_addresses == NULL || data->dirty_blocks == NULL) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+        for (i = 0; i < n_sets; i++) {
+            data->block_addresses[i] = EMPTY_ADDRESS;
+        }
+    }
+    else if (set_len_blocks > HASHED_SET_LEN_THRESHOLD || n_sets == 1) {
+        if (n_blocks > MAX_HASHED_BLOCKS) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+
+        // At most half full, so probes stay short
+        uint32_t table_len = 2 * n_blocks;
+
+        data->engine       = &hashed_engine;
+        data->lru_blocks   = (lru_block_t *) CacheData_AllocateSets(sizeof(lru_block_t) * n_blocks);
+        data->lru_sets     = (lru_set_t *) malloc(sizeof(lru_set_t) * n_sets);
+        data->dirty_blocks = (uint64_t *) calloc(CEIL_DIVIDE(n_blocks, 64), sizeof(uint64_t));
+        data->block_table  = (uint32_t *) CacheData_AllocateSets(sizeof(uint32_t) * table_len);
+        if (data->lru_blocks == NULL || data->lru_sets == NULL ||
+            data->dirty_blocks == NULL || data->block_table == NULL) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+        for (i = 0; i < n_sets; i++) {
+            data->lru_sets[i].newest         = NO_BLOCK;
+            data->lru_sets[i].oldest         = NO_BLOCK;
+            data->lru_sets[i].n_valid_blocks = 0;
+        }
+        for (i = 0; i < table_len; i++) {
+            data->block_table[i] = NO_BLOCK;
+        }
+        data->table_mask  = table_len - 1;
+        data->table_shift = 64 - HighestBitSet(table_len);
+    }
+    else if (n_blocks >= COMPACT_MIN_BLOCKS && set_len_blocks <= COMPACT_MAX_SET_LEN) {
+        data->engine     = &compact_engine;
+        data->set_stride = CacheData_CompactSetSize(set_len_blocks);
+        data->tag_shift  = HighestBitSet((uint64_t) n_sets * block_size_bytes);
+        data->sets       = (uint8_t *) CacheData_AllocateSets(data->set_stride * n_sets);
+        if (data->sets == NULL) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+        memset(data->sets, 0, data->set_stride * n_sets);
+    }
+    else {
+        if (set_len_blocks > MAX_SET_LEN) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+
+        data->engine     = &set_associative_engine;
+        data->set_stride = CacheData_SetSize(set_len_blocks);
+        data->sets       = (uint8_t *) CacheData_AllocateSets(data->set_stride * n_sets);
+        if (data->sets == NULL) {
+            CacheData_Destroy(data);
+            return NULL;
+        }
+        for (i = 0; i < n_sets; i++) {
+            CacheData_Set_Clear(data->sets + i * data->set_stride, set_len_blocks);
+        }
+    }
 
     data->n_sets                    = n_sets;
     data->set_len_blocks            = set_len_blocks;
@@ -212,26 +819,14 @@ cache_data_t CacheData_Create(uint32_t n_sets,
     data->block_size_bytes          = block_size_bytes;
 
     data->set_index_shift           = HighestBitSet(block_size_bytes);
-    data->set_mask                  = (n_sets - 1) << (data->set_index_shift);
     data->block_mask                = AlignmentMask(block_size_bytes);
+    data->search                    = TagSearch_Get(TagSearch_BestLevel());
 
-    data->victim_set.n_valid_blocks = 0;
-    data->victim_set.newest         = NULL;
-    data->victim_set.oldest         = NULL;
-
-    uint32_t i;
-    for (i = 0; i < n_sets; i++) {
-        data->sets[i].n_valid_blocks = 0;
-        data->sets[i].newest         = NULL;
-        data->sets[i].oldest         = NULL;
-    }
-
-    for (i = 0; i < total_cache_blocks; i++) {
-        data->all_blocks[i].dirty   = false;
-        data->all_blocks[i].address = 0;
-        data->all_blocks[i].older   = NULL;
-        data->all_blocks[i].newer   = NULL;
+    data->prefetch = NULL;
+    if ((uint64_t) n_sets * set_len_blocks >= PREFETCH_MIN_BLOCKS) {
+        data->prefetch = data->engine->prefetch;
     }
+    CacheData_SelectKernel(data);
 
     return data;
 }
@@ -239,9 +834,14 @@ cache_data_t CacheData_Create(uint32_t n_sets,
 void CacheData_Destroy(cache_data_t cache_data)
 {
     if (cache_data) {
-        if (cache_data->all_blocks) {
-            free(cache_data->all_blocks);
-        }
+        free(cache_data->sets);
+        free(cache_data->block_addresses);
+        free(cache_data->dirty_blocks);
+        free(cache_data->lru_blocks);
+        free(cache_data->lru_sets);
+        free(cache_data->block_table);
+        free(cache_data->victim_set);
+        free(cache_data->order);
         free(cache_data);
     }
 }
@@ -249,245 +849,946 @@ void CacheData_Destroy(cache_data_t cache_data)
 bool CacheData_Contains(cache_data_t data, uint64_t address)
 {
     uint64_t aligned_address = CacheData_BlockAlignAddress(data, address);
-
-    set_t * set = CacheData_GetSet(data, aligned_address);
-    block_t * block = CacheData_Set_GetMatchingBlock(set, aligned_address);
-
-    if (block != NULL) {
+    if (data->engine->set_contains(data, aligned_address)) {
         return true;
     }
 
-    block_t * victim_block = CacheData_Set_GetMatchingBlock(&(data->victim_set),
-                                                            aligned_address);
-    return victim_block != NULL;
+    set_t victim_set = CacheData_GetVictimSet(data, CacheData_GetGeometry(data));
+    return CacheData_Set_GetMatchingWay(data, &victim_set, aligned_address) != NO_WAY;
 }
 
 uint64_t CacheData_Write(cache_data_t data, uint64_t address, result_t * result)
 {
-    uint64_t aligned_address = CacheData_BlockAlignAddress(data, address);
-    return CacheData_AccessBlock(data, aligned_address, true, result);
+    return data->access_block(data, address, true, result);
 }
 
 uint64_t CacheData_Read(cache_data_t data, uint64_t address, result_t * result)
 {
-    uint64_t aligned_address = CacheData_BlockAlignAddress(data, address);
-    return CacheData_AccessBlock(data, aligned_address, false, result);
+    return data->access_block(data, address, false, result);
 }
 
-void CacheData_Print(cache_data_t data)
+void CacheData_Prefetch(cache_data_t data, uint64_t address)
+{
+    if (data->prefetch != NULL) {
+        data->prefetch(data, address);
+    }
+}
+
+bool CacheData_PrefetchEnabled(cache_data_t data)
+{
+    return data->prefetch != NULL;
+}
+
+void CacheData_AccessBatch(cache_data_t data,
+                           access_t const * accesses,
+                           uint32_t n_accesses,
+                           result_t * results,
+                           uint64_t * dirty_kickout_addresses)
 {
     uint32_t i;
-    for (i = 0; i < data->n_sets; i++) {
-        CacheData_Set_Print(data, &(data->sets[i]), i);
+    for (i = 0; i < n_accesses && i < PREFETCH_DISTANCE; i++) {
+        CacheData_Prefetch(data, accesses[i].address);
     }
-    CacheData_Set_Print(data, &(data->victim_set), 0);
+
+    for (i = 0; i < n_accesses; i++) {
+        if (i + PREFETCH_DISTANCE < n_accesses) {
+            CacheData_Prefetch(data, accesses[i + PREFETCH_DISTANCE].address);
+        }
+
+        dirty_kickout_addresses[i] = data->access_block(data,
+                                                        accesses[i].address,
+                                                        accesses[i].type == TYPE_WRITE,
+                                                        &results[i]);
+    }
+}
+
+void CacheData_Print(cache_data_t data)
+{
+    data->engine->print_sets(data);
+
+    set_t victim_set = CacheData_GetVictimSet(data, CacheData_GetGeometry(data));
+    CacheData_Set_Print(data, &victim_set, true, 0);
 }
 
 /* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
 
+static KERNEL_INLINE uint64_t CacheData_Kernel(cache_data_t data,
+                                               geometry_t geometry,
+                                               uint64_t address,
+                                               bool write_access,
+                                               result_t * result)
+{
+    uint64_t dirty_kickout_address = 0;
+    bool dirty = false;
+
+    address &= ~(((uint64_t) 1 << geometry.block_shift) - 1);
+    set_t set = CacheData_GetSet(data, geometry, address);
+    uint32_t way = CacheData_Set_GetMatchingWay(data, &set, address);
+
+    if (way != NO_WAY) {
+        // Block already in set
+        dirty = CacheData_Set_IsDirty(&set, way);
+        *result = RESULT_HIT;
+    }
+    else if (set.state->n_valid_blocks < set.len) {
+        // Set not full
+        way = CacheData_Set_AddWay(&set);
+        *result = RESULT_MISS;
+    }
+    else {
+        // Set full. The new block takes the oldest's way
+        way = CacheData_Set_GetOldestWay(&set);
+        dirty_kickout_address = CacheData_Evict(data,
+                                                geometry,
+                                                address,
+                                                set.addresses[way],
+                                                CacheData_Set_IsDirty(&set, way),
+                                                &dirty,
+                                                result);
+    }
+
+    set.addresses[way] = address;
+    CacheData_Set_SetDirty(&set, way, dirty || write_access);
+    CacheData_Set_Touch(&set, way);
+
+    return dirty_kickout_address;
+}
+
+static KERNEL_INLINE uint64_t CacheData_DirectMapped_Kernel(cache_data_t data,
+                                                            geometry_t geometry,
+                                                            uint64_t address,
+                                                            bool write_access,
+                                                            result_t * result)
+{
+    uint64_t dirty_kickout_address = 0;
+
+    address &= ~(((uint64_t) 1 << geometry.block_shift) - 1);
+    uint32_t set_index = CacheData_GetSetIndex(data, geometry, address);
+    uint64_t block_address = data->block_addresses[set_index];
+    bool dirty = CacheData_IsBlockDirty(data, set_index);
+
+    if (block_address == address) {
+        *result = RESULT_HIT;
+    }
+    else if (block_address == EMPTY_ADDRESS) {
+        *result = RESULT_MISS;
+    }
+    else {
+        dirty_kickout_address = CacheData_Evict(data,
+                                                geometry,
+                                                address,
+                                                block_address,
+                                                dirty,
+                                                &dirty,
+                                                result);
+    }
+
+    data->block_addresses[set_index] = address;
+    CacheData_SetBlockDirty(data, set_index, dirty || write_access);
+
+    return dirty_kickout_address;
+}
+
+CACHE_KERNELS(DEFINE_CACHE_KERNEL)
+
 static uint64_t CacheData_AccessBlock(cache_data_t data,
                                       uint64_t address,
                                       bool write_access,
                                       result_t * result)
+{
+    return CacheData_Kernel(data, CacheData_GetGeometry(data), address, write_access, result);
+}
+
+static bool CacheData_SetContains(cache_data_t data, uint64_t address)
+{
+    set_t set = CacheData_GetSet(data, CacheData_GetGeometry(data), address);
+    return CacheData_Set_GetMatchingWay(data, &set, address) != NO_WAY;
+}
+
+static void CacheData_PrintSets(cache_data_t data)
+{
+    uint32_t i;
+    for (i = 0; i < data->n_sets; i++) {
+        set_t set = CacheData_SetAt(data->sets + i * data->set_stride,
+                                    data->set_len_blocks);
+        CacheData_Set_Print(data, &set, false, i);
+    }
+}
+
+static uint64_t CacheData_DirectMapped_AccessBlock(cache_data_t data,
+                                                   uint64_t address,
+                                                   bool write_access,
+                                                   result_t * result)
+{
+    return CacheData_DirectMapped_Kernel(data,
+                                         CacheData_GetGeometry(data),
+                                         address,
+                                         write_access,
+                                         result);
+}
+
+static bool CacheData_DirectMapped_SetContains(cache_data_t data, uint64_t address)
+{
+    uint32_t set_index = CacheData_GetSetIndex(data, CacheData_GetGeometry(data), address);
+    return data->block_addresses[set_index] == address;
+}
+
+static void CacheData_PrefetchSet(cache_data_t data, uint64_t address)
+{
+    uint32_t set_index = CacheData_GetSetIndex(data, CacheData_GetGeometry(data), address);
+    uint8_t const * set = data->sets + set_index * data->set_stride;
+
+    // Sets needn't start on a line, so the last byte may be on one more
+    size_t offset;
+    for (offset = 0; offset < data->set_stride; offset += SET_ALIGNMENT) {
+        __builtin_prefetch(set + offset);
+    }
+    __builtin_prefetch(set + data->set_stride - 1);
+}
+
+static void CacheData_DirectMapped_Prefetch(cache_data_t data, uint64_t address)
+{
+    uint32_t set_index = CacheData_GetSetIndex(data, CacheData_GetGeometry(data), address);
+    __builtin_prefetch(&data->block_addresses[set_index]);
+}
+
+static void CacheData_Hashed_Prefetch(cache_data_t data, uint64_t address)
+{
+    address = CacheData_BlockAlignAddress(data, address);
+    __builtin_prefetch(&data->block_table[CacheData_Table_Home(data, address)]);
+}
+
+static void CacheData_DirectMapped_PrintSets(cache_data_t data)
+{
+    // Matches CacheData_Set_Print()'s output for a set of one block
+    uint32_t tag_shift = HighestBitSet(data->n_sets * data->block_size_bytes);
+    uint32_t i;
+    for (i = 0; i < data->n_sets; i++) {
+        uint64_t address = data->block_addresses[i];
+        if (address == EMPTY_ADDRESS) {
+            continue;
+        }
+
+        printf("Index: %4" PRIx32 " | V:1 D:%" PRIu32 " Tag:  %16" PRIx64 " |\n",
+               i,
+               CacheData_IsBlockDirty(data, i) ? (uint32_t) 1 : (uint32_t) 0,
+               address >> tag_shift);
+    }
+}
+
+static uint64_t CacheData_Hashed_AccessBlock(cache_data_t data,
+                                             uint64_t address,
+                                             bool write_access,
+                                             result_t * result)
 {
     uint64_t dirty_kickout_address = 0;
-    set_t * set = CacheData_GetSet(data, address);
-    block_t * block = CacheData_Set_GetMatchingBlock(set, address);
+    bool dirty = false;
 
-    if (block != NULL) {
+    geometry_t geometry = CacheData_GetGeometry(data);
+    address = CacheData_BlockAlignAddress(data, address);
+    uint32_t set_index = CacheData_GetSetIndex(data, geometry, address);
+    lru_set_t * set = &data->lru_sets[set_index];
+    uint32_t position = CacheData_Table_Find(data, address);
+    uint32_t block = data->block_table[position];
+
+    if (block != NO_BLOCK) {
         // Block already in set
-        CacheData_Set_RemoveBlock(set, block);
+        dirty = CacheData_IsBlockDirty(data, block);
         *result = RESULT_HIT;
+        if (block != set->newest) {
+            CacheData_Lru_Unlink(data, set, block);
+            CacheData_Lru_PushNewest(data, set, block);
+        }
     }
     else if (set->n_valid_blocks < data->set_len_blocks) {
         // Set not full
-        block = CacheData_AllocateBlock(data);
+        block = set_index * data->set_len_blocks + set->n_valid_blocks;
+        set->n_valid_blocks += 1;
+        data->block_table[position] = block;
+        CacheData_Lru_PushNewest(data, set, block);
         *result = RESULT_MISS;
     }
     else {
-        // Set full
-        if (data->victim_set_len_blocks == 0) {
-            // This case is only present to facilitate tests that don't use a
-            // victim cache. In the final implementation, the victim cache is
-            // always 8 entries long, and so one could in theory enable a
-            // switch to turn this off. However, I'm writing this comment after
-            // all simulations have been run. Something about barn doors and
-            // horses?
-            block = set->oldest;
-            CacheData_Set_RemoveBlock(set, block);
-            if (block->dirty) {
-                dirty_kickout_address = block->address;
-                *result = RESULT_MISS_DIRTY_KICKOUT;
-            }
-            else {
-                *result = RESULT_MISS_KICKOUT;
-            }
+        // Set full. The new block takes the oldest's place
+        block = set->oldest;
+        uint64_t evicted_address = data->lru_blocks[block].address;
+        dirty_kickout_address = CacheData_Evict(data,
+                                                geometry,
+                                                address,
+                                                evicted_address,
+                                                CacheData_IsBlockDirty(data, block),
+                                                &dirty,
+                                                result);
+
+        // Removing an entry can move others, so the new address's position
+        // has to be found again
+        CacheData_Table_Remove(data, CacheData_Table_Find(data, evicted_address));
+        data->block_table[CacheData_Table_Find(data, address)] = block;
+        CacheData_Lru_Unlink(data, set, block);
+        CacheData_Lru_PushNewest(data, set, block);
+    }
+
+    data->lru_blocks[block].address = address;
+    CacheData_SetBlockDirty(data, block, dirty || write_access);
+
+    return dirty_kickout_address;
+}
+
+static bool CacheData_Hashed_SetContains(cache_data_t data, uint64_t address)
+{
+    return data->block_table[CacheData_Table_Find(data, address)] != NO_BLOCK;
+}
+
+static void CacheData_Hashed_PrintSets(cache_data_t data)
+{
+    uint32_t i;
+    for (i = 0; i < data->n_sets; i++) {
+        lru_set_t const * set = &data->lru_sets[i];
+        if (set->n_valid_blocks == 0) {
+            continue;
         }
-        else {
-            set_t * victim_set = &(data->victim_set);
-            block = CacheData_Set_GetMatchingBlock(victim_set, address);
-
-            if (block != NULL) {
-                // Block in victim cache
-                CacheData_Set_RemoveBlock(victim_set, block);
-                *result = RESULT_HIT_VICTIM_CACHE;
-            }
-            else if (victim_set->n_valid_blocks <
-                     data->victim_set_len_blocks) {
-                // Victim cache not full
-                block = CacheData_AllocateBlock(data);
-                *result = RESULT_MISS;
-            }
-            else {
-                // Victim cache full
-                block = victim_set->oldest;
-                CacheData_Set_RemoveBlock(victim_set, block);
-                if (block->dirty) {
-                    dirty_kickout_address = block->address;
-                    *result = RESULT_MISS_DIRTY_KICKOUT;
-                }
-                else {
-                    *result = RESULT_MISS_KICKOUT;
-                }
-
-                // THIS LINE IS CRITICAL IF YOU'RE RE-USING BLOCKS
-                block->dirty = false;
-            }
-
-            block_t * oldest = set->oldest;
-            CacheData_Set_RemoveBlock(set, oldest);
-            CacheData_Set_InsertBlockAsNewest(victim_set, oldest);
-        }
-    }
-
-    if (write_access) {
-        block->dirty = true;
-    }
-    block->address = address;
-    CacheData_Set_InsertBlockAsNewest(set, block);
+
+        CacheData_PrintSetStart(false, i);
+        uint32_t block_index = 0;
+        uint32_t block;
+        for (block = set->newest; block != NO_BLOCK; block = data->lru_blocks[block].older) {
+            CacheData_PrintBlock(data,
+                                 false,
+                                 block_index,
+                                 data->set_len_blocks,
+                                 data->lru_blocks[block].address,
+                                 CacheData_IsBlockDirty(data, block));
+            block_index++;
+        }
+        CacheData_PrintSetEnd(false, set->n_valid_blocks, data->set_len_blocks);
+    }
+}
+
+static uint64_t CacheData_Compact_AccessBlock(cache_data_t data,
+                                              uint64_t address,
+                                              bool write_access,
+                                              result_t * result)
+{
+    uint64_t dirty_kickout_address = 0;
+    bool dirty = false;
+
+    geometry_t geometry = CacheData_GetGeometry(data);
+    address = CacheData_BlockAlignAddress(data, address);
+    uint32_t set_index = CacheData_GetSetIndex(data, geometry, address);
+    uint64_t tag = CacheData_Compact_GetTag(data, address);
+    if (tag > UINT32_MAX) {
+        CacheData_Compact_Widen(data);
+        return data->access_block(data, address, write_access, result);
+    }
+
+    compact_set_t * set = CacheData_GetCompactSet(data, set_index);
+    uint32_t way = CacheData_CompactSet_GetMatchingWay(set, (uint32_t) tag);
+
+    if (way != NO_WAY) {
+        // Block already in set
+        dirty = (set->dirty >> way) & 1;
+        *result = RESULT_HIT;
+    }
+    else if (set->n_valid_blocks < data->set_len_blocks) {
+        // Set not full. The new way is ranked behind every valid block, so
+        // the touch below moves them all
+        way = set->n_valid_blocks;
+        set->ranks |= (uint64_t) way << (way * COMPACT_RANK_BITS);
+        set->n_valid_blocks += 1;
+        *result = RESULT_MISS;
+    }
+    else {
+        // Set full. The new block takes the oldest's way
+        way = CacheData_CompactSet_GetOldestWay(set);
+        dirty_kickout_address = CacheData_Evict(data,
+                                                geometry,
+                                                address,
+                                                CacheData_Compact_GetAddress(data,
+                                                                             set->tags[way],
+                                                                             set_index),
+                                                (set->dirty >> way) & 1,
+                                                &dirty,
+                                                result);
+    }
+
+    set->tags[way] = (uint32_t) tag;
+    set->dirty = (set->dirty & ~(1u << way)) | ((dirty || write_access) << way);
+    CacheData_CompactSet_Touch(set, way);
 
     return dirty_kickout_address;
 }
 
-static uint32_t CacheData_GetSetIndex(cache_data_t data, uint64_t address)
+static bool CacheData_Compact_SetContains(cache_data_t data, uint64_t address)
 {
-    return (address & data->set_mask) >> data->set_index_shift;
+    // Addresses too high for a tag can't be in the cache
+    uint64_t tag = CacheData_Compact_GetTag(data, address);
+    if (tag > UINT32_MAX) {
+        return false;
+    }
+
+    uint32_t set_index = CacheData_GetSetIndex(data, CacheData_GetGeometry(data), address);
+    compact_set_t const * set = CacheData_GetCompactSet(data, set_index);
+    return CacheData_CompactSet_GetMatchingWay(set, (uint32_t) tag) != NO_WAY;
 }
 
-static set_t * CacheData_GetSet(cache_data_t data, uint64_t address)
+static void CacheData_Compact_PrintSets(cache_data_t data)
 {
-    uint32_t set_index = CacheData_GetSetIndex(data, address);
-    return &(data->sets[set_index]);
+    uint32_t i;
+    for (i = 0; i < data->n_sets; i++) {
+        compact_set_t const * set = CacheData_GetCompactSet(data, i);
+        if (set->n_valid_blocks == 0) {
+            continue;
+        }
+
+        CacheData_PrintSetStart(false, i);
+
+        // Blocks are printed from newest to oldest
+        uint32_t way;
+        for (way = 0; way < set->n_valid_blocks; way++) {
+            data->order[CacheData_CompactSet_GetRank(set, way)] = way;
+        }
+
+        uint32_t block_index;
+        for (block_index = 0; block_index < set->n_valid_blocks; block_index++) {
+            way = data->order[block_index];
+            CacheData_PrintBlock(data,
+                                 false,
+                                 block_index,
+                                 data->set_len_blocks,
+                                 CacheData_Compact_GetAddress(data, set->tags[way], i),
+                                 (set->dirty >> way) & 1);
+        }
+        CacheData_PrintSetEnd(false, set->n_valid_blocks, data->set_len_blocks);
+    }
 }
 
-static uint64_t CacheData_BlockAlignAddress(cache_data_t data,
-                                            uint64_t address)
+static size_t CacheData_CompactSetSize(uint32_t len)
 {
-    return address & data->block_mask;
+    // Keeps the next set's rank word aligned
+    size_t size = sizeof(compact_set_t) + sizeof(uint32_t) * len;
+    return CEIL_DIVIDE(size, sizeof(uint64_t)) * sizeof(uint64_t);
 }
 
-static block_t * CacheData_Set_GetMatchingBlock(set_t * set, uint64_t address)
+static compact_set_t * CacheData_GetCompactSet(cache_data_t data, uint32_t set_index)
 {
-    block_t * block;
-    for_block_in_set(block, set) {
-        if (block->address == address) {
-            return block;
+    return (compact_set_t *) (data->sets + set_index * data->set_stride);
+}
+
+static uint64_t CacheData_Compact_GetTag(cache_data_t data, uint64_t address)
+{
+    return address >> data->tag_shift;
+}
+
+static void CacheData_Compact_Widen(cache_data_t data)
+{
+    uint32_t set_len_blocks = data->set_len_blocks;
+    size_t set_stride = CacheData_SetSize(set_len_blocks);
+    uint8_t * sets = (uint8_t *) CacheData_AllocateSets(set_stride * data->n_sets);
+    if (sets == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    uint32_t i;
+    for (i = 0; i < data->n_sets; i++) {
+        compact_set_t const * compact_set = CacheData_GetCompactSet(data, i);
+        CacheData_Set_Clear(sets + i * set_stride, set_len_blocks);
+        set_t set = CacheData_SetAt(sets + i * set_stride, set_len_blocks);
+
+        uint32_t way;
+        for (way = 0; way < compact_set->n_valid_blocks; way++) {
+            set.addresses[way] = CacheData_Compact_GetAddress(data, compact_set->tags[way], i);
+            set.ranks[way]     = CacheData_CompactSet_GetRank(compact_set, way);
+            CacheData_Set_SetDirty(&set, way, (compact_set->dirty >> way) & 1);
         }
+        set.state->n_valid_blocks = compact_set->n_valid_blocks;
+        set.state->newest_way     = compact_set->newest_way;
+    }
+
+    free(data->sets);
+    data->sets       = sets;
+    data->set_stride = set_stride;
+    data->engine     = &set_associative_engine;
+    if (data->prefetch != NULL) {
+        data->prefetch = data->engine->prefetch;
     }
+    CacheData_SelectKernel(data);
+}
 
-    return NULL;
+static uint64_t CacheData_Compact_GetAddress(cache_data_t data,
+                                             uint32_t tag,
+                                             uint32_t set_index)
+{
+    return ((uint64_t) tag << data->tag_shift) |
+           ((uint64_t) set_index << data->set_index_shift);
 }
 
-static block_t * CacheData_AllocateBlock(cache_data_t data)
+static uint32_t CacheData_CompactSet_GetMatchingWay(compact_set_t const * set,
+                                                    uint32_t tag)
 {
-    block_t * block = NULL;
-    if (data->next_free_block < data->last_block) {
-        block = data->next_free_block;
-        data->next_free_block += 1;
+    uint32_t way;
+    for (way = 0; way < set->n_valid_blocks; way++) {
+        if (set->tags[way] == tag) {
+            return way;
+        }
     }
-    else {
-        // Could possibly just malloc here. However, this would require special
-        // handling of free, and has performance implications.
-        ThrowHere(ALLOCATION_FAILURE);
+
+    return NO_WAY;
+}
+
+static uint32_t CacheData_CompactSet_GetRank(compact_set_t const * set, uint32_t way)
+{
+    uint64_t rank_mask = ((uint64_t) 1 << COMPACT_RANK_BITS) - 1;
+    return (set->ranks >> (way * COMPACT_RANK_BITS)) & rank_mask;
+}
+
+static uint32_t CacheData_CompactSet_GetOldestWay(compact_set_t const * set)
+{
+    uint32_t oldest_rank = set->n_valid_blocks - 1;
+    uint32_t way;
+    for (way = 0; way < oldest_rank; way++) {
+        if (CacheData_CompactSet_GetRank(set, way) == oldest_rank) {
+            break;
+        }
     }
-    return block;
+
+    return way;
 }
 
-static void CacheData_Set_RemoveBlock(set_t * set, block_t * block)
+static void CacheData_CompactSet_Touch(compact_set_t * set, uint32_t way)
 {
-    if (block == set->newest) {
-        set->newest = block->older;
+    if (way == set->newest_way) {
+        return;
     }
-    if (block == set->oldest) {
-        set->oldest = block->newer;
+
+    // Every block newer than this one ages by one. Only valid ways are aged,
+    // so no rank outgrows its field
+    uint32_t rank = CacheData_CompactSet_GetRank(set, way);
+    uint64_t ranks = set->ranks;
+    uint32_t i;
+    for (i = 0; i < set->n_valid_blocks; i++) {
+        ranks += (uint64_t) (CacheData_CompactSet_GetRank(set, i) < rank) << (i * COMPACT_RANK_BITS);
+    }
+    ranks &= ~((((uint64_t) 1 << COMPACT_RANK_BITS) - 1) << (way * COMPACT_RANK_BITS));
+
+    set->ranks      = ranks;
+    set->newest_way = way;
+}
+
+static void CacheData_SelectKernel(cache_data_t data)
+{
+    data->access_block = data->engine->access_block;
+    if (data->engine != &set_associative_engine && data->engine != &direct_mapped_engine) {
+        return;
     }
 
-    if (block->newer) {
-        block->newer->older = block->older;
+    uint32_t i;
+    for (i = 0; i < ARRAY_ELEMENTS(kernels); i++) {
+        if (kernels[i].set_len_blocks == data->set_len_blocks &&
+            kernels[i].block_size_bytes == data->block_size_bytes &&
+            kernels[i].victim_set_len_blocks == data->victim_set_len_blocks) {
+            data->access_block = kernels[i].access_block;
+            break;
+        }
     }
-    if (block->older) {
-        block->older->newer = block->newer;
+}
+
+static void * CacheData_AllocateSets(size_t size)
+{
+    size_t alignment = size >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : SET_ALIGNMENT;
+
+    // aligned_alloc() needs a multiple of the alignment
+    size = CEIL_DIVIDE(size, alignment) * alignment;
+    void * sets = aligned_alloc(alignment, size);
+
+#ifdef MADV_HUGEPAGE
+    if (sets != NULL && alignment == HUGE_PAGE_SIZE) {
+        // Only advice. Without transparent huge pages, this does nothing
+        madvise(sets, size, MADV_HUGEPAGE);
     }
+#endif
 
-    set->n_valid_blocks -= 1;
+    return sets;
 }
 
-static void CacheData_Set_InsertBlockAsNewest(set_t * set, block_t * block)
+static uint32_t CacheData_Table_Find(cache_data_t data, uint64_t address)
 {
-    if (set->oldest == NULL) {
-        set->oldest = block;
+    uint32_t position = CacheData_Table_Home(data, address);
+    for (;;) {
+        uint32_t block = data->block_table[position];
+        if (block == NO_BLOCK || data->lru_blocks[block].address == address) {
+            return position;
+        }
+        position = (position + 1) & data->table_mask;
     }
+}
 
-    if (set->newest != NULL) {
-        set->newest->newer = block;
+static void CacheData_Table_Remove(cache_data_t data, uint32_t position)
+{
+    uint32_t hole = position;
+    uint32_t next = position;
+    for (;;) {
+        next = (next + 1) & data->table_mask;
+        uint32_t block = data->block_table[next];
+        if (block == NO_BLOCK) {
+            break;
+        }
+
+        // An entry can fill the hole unless its probe started after the hole
+        uint32_t home = CacheData_Table_Home(data, data->lru_blocks[block].address);
+        if (((next - home) & data->table_mask) >= ((next - hole) & data->table_mask)) {
+            data->block_table[hole] = block;
+            hole = next;
+        }
     }
+    data->block_table[hole] = NO_BLOCK;
+}
+
+static uint32_t CacheData_Table_Home(cache_data_t data, uint64_t address)
+{
+    uint64_t block_number = address >> data->set_index_shift;
+    return (block_number * HASH_MULTIPLIER) >> data->table_shift;
+}
+
+static void CacheData_Lru_Unlink(cache_data_t data, lru_set_t * set, uint32_t block)
+{
+    lru_block_t * lru_block = &data->lru_blocks[block];
+    if (lru_block->newer == NO_BLOCK) {
+        set->newest = lru_block->older;
+    }
+    else {
+        data->lru_blocks[lru_block->newer].older = lru_block->older;
+    }
+    if (lru_block->older == NO_BLOCK) {
+        set->oldest = lru_block->newer;
+    }
+    else {
+        data->lru_blocks[lru_block->older].newer = lru_block->newer;
+    }
+}
 
-    block->older = set->newest;
-    block->newer = NULL;
+static void CacheData_Lru_PushNewest(cache_data_t data, lru_set_t * set, uint32_t block)
+{
+    lru_block_t * lru_block = &data->lru_blocks[block];
+    lru_block->newer = NO_BLOCK;
+    lru_block->older = set->newest;
+    if (set->newest == NO_BLOCK) {
+        set->oldest = block;
+    }
+    else {
+        data->lru_blocks[set->newest].newer = block;
+    }
     set->newest = block;
+}
+
+static bool CacheData_IsBlockDirty(cache_data_t data, uint32_t block)
+{
+    return (data->dirty_blocks[block / 64] >> (block % 64)) & 1;
+}
+
+static void CacheData_SetBlockDirty(cache_data_t data, uint32_t block, bool dirty)
+{
+    uint64_t bit = (uint64_t) 1 << (block % 64);
+    if (dirty) {
+        data->dirty_blocks[block / 64] |= bit;
+    }
+    else {
+        data->dirty_blocks[block / 64] &= ~bit;
+    }
+}
+
+static KERNEL_INLINE uint64_t CacheData_Evict(cache_data_t data,
+                                              geometry_t geometry,
+                                              uint64_t address,
+                                              uint64_t evicted_address,
+                                              bool evicted_dirty,
+                                              bool * dirty,
+                                              result_t * result)
+{
+    uint64_t dirty_kickout_address = 0;
+    *dirty = false;
+
+    if (geometry.victim_set_len_blocks == 0) {
+        // This case is only present to facilitate tests that don't use a
+        // victim cache. In the final implementation, the victim cache is
+        // always 8 entries long, and so one could in theory enable a
+        // switch to turn this off. However, I'm writing this comment after
+        // all simulations have been run. Something about barn doors and
+        // horses?
+        if (evicted_dirty) {
+            dirty_kickout_address = evicted_address;
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+        }
+        else {
+            *result = RESULT_MISS_KICKOUT;
+        }
+        return dirty_kickout_address;
+    }
+
+    set_t victim_set = CacheData_GetVictimSet(data, geometry);
+    uint32_t victim_way = CacheData_Set_GetMatchingWay(data, &victim_set, address);
+
+    if (victim_way != NO_WAY) {
+        // Block in victim cache
+        *dirty = CacheData_Set_IsDirty(&victim_set, victim_way);
+        *result = RESULT_HIT_VICTIM_CACHE;
+    }
+    else if (victim_set.state->n_valid_blocks < victim_set.len) {
+        // Victim cache not full
+        victim_way = CacheData_Set_AddWay(&victim_set);
+        *result = RESULT_MISS;
+    }
+    else {
+        // Victim cache full
+        victim_way = CacheData_Set_GetOldestWay(&victim_set);
+        if (CacheData_Set_IsDirty(&victim_set, victim_way)) {
+            dirty_kickout_address = victim_set.addresses[victim_way];
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+        }
+        else {
+            *result = RESULT_MISS_KICKOUT;
+        }
+    }
+
+    // The evicted block becomes the victim cache's newest, in whichever way
+    // was freed for it
+    victim_set.addresses[victim_way] = evicted_address;
+    CacheData_Set_SetDirty(&victim_set, victim_way, evicted_dirty);
+    CacheData_Set_Touch(&victim_set, victim_way);
+
+    return dirty_kickout_address;
+}
+
+static geometry_t CacheData_GetGeometry(cache_data_t data)
+{
+    geometry_t geometry = {
+        data->set_len_blocks,
+        data->set_index_shift,
+        data->victim_set_len_blocks,
+    };
+    return geometry;
+}
+
+static KERNEL_INLINE uint32_t CacheData_GetSetIndex(cache_data_t data,
+                                                    geometry_t geometry,
+                                                    uint64_t address)
+{
+    return (address >> geometry.block_shift) & (data->n_sets - 1);
+}
+
+static KERNEL_INLINE set_t CacheData_GetSet(cache_data_t data,
+                                            geometry_t geometry,
+                                            uint64_t address)
+{
+    uint32_t set_index = CacheData_GetSetIndex(data, geometry, address);
+    return CacheData_SetAt(data->sets + set_index * CacheData_SetSize(geometry.set_len_blocks),
+                           geometry.set_len_blocks);
+}
+
+static KERNEL_INLINE set_t CacheData_GetVictimSet(cache_data_t data, geometry_t geometry)
+{
+    return CacheData_SetAt(data->victim_set, geometry.victim_set_len_blocks);
+}
+
+static uint64_t CacheData_BlockAlignAddress(cache_data_t data,
+                                            uint64_t address)
+{
+    return address & data->block_mask;
+}
+
+static KERNEL_INLINE size_t CacheData_SetSize(uint32_t len)
+{
+    size_t n_dirty_words = CEIL_DIVIDE(len, 64);
+    size_t size = sizeof(uint64_t) * (len + n_dirty_words) +
+                  sizeof(set_state_t) +
+                  sizeof(uint16_t) * len;
+
+    // Keeps the next set's addresses aligned
+    return CEIL_DIVIDE(size, sizeof(uint64_t)) * sizeof(uint64_t);
+}
+
+static KERNEL_INLINE set_t CacheData_SetAt(uint8_t * storage, uint32_t len)
+{
+    size_t n_dirty_words = CEIL_DIVIDE(len, 64);
+
+    set_t set;
+    set.addresses      = (uint64_t *) storage;
+    set.dirty          = set.addresses + len;
+    set.state          = (set_state_t *) (set.dirty + n_dirty_words);
+    set.ranks          = (uint16_t *) (set.state + 1);
+    set.len            = len;
 
-    set->n_valid_blocks += 1;
+    return set;
+}
+
+static void CacheData_Set_Clear(uint8_t * storage, uint32_t len)
+{
+    memset(storage, 0, CacheData_SetSize(len));
+
+    set_t set = CacheData_SetAt(storage, len);
+    uint32_t way;
+    for (way = 0; way < len; way++) {
+        set.addresses[way] = EMPTY_ADDRESS;
+    }
+}
+
+static KERNEL_INLINE uint32_t CacheData_Set_GetMatchingWay(cache_data_t data,
+                                                           set_t const * set,
+                                                           uint64_t address)
+{
+    uint32_t n_valid_blocks = set->state->n_valid_blocks;
+    if (n_valid_blocks == 0) {
+        return NO_WAY;
+    }
+
+    uint32_t way = set->state->newest_way;
+    if (set->addresses[way] == address) {
+        return way;
+    }
+
+    // Sets this large hold whole groups of ways, so can be searched a group
+    // at a time. Empty ways hold an address no block can have
+    if (set->len >= TAG_SEARCH_WIDTH) {
+        return data->search(set->addresses, n_valid_blocks, address);
+    }
+
+    for (way = 0; way < n_valid_blocks; way++) {
+        if (set->addresses[way] == address) {
+            return way;
+        }
+    }
+
+    return NO_WAY;
+}
+
+static uint32_t CacheData_Set_GetOldestWay(set_t const * set)
+{
+    uint32_t oldest_rank = set->state->n_valid_blocks - 1;
+    uint32_t way;
+    for (way = 0; way < oldest_rank; way++) {
+        if (set->ranks[way] == oldest_rank) {
+            break;
+        }
+    }
+
+    return way;
+}
+
+static uint32_t CacheData_Set_AddWay(set_t * set)
+{
+    uint32_t way = set->state->n_valid_blocks;
+
+    // Ranked behind every valid block, so the caller's touch moves them all
+    set->ranks[way] = way;
+    set->state->n_valid_blocks += 1;
+
+    return way;
+}
+
+static KERNEL_INLINE void CacheData_Set_Touch(set_t * set, uint32_t way)
+{
+    if (way == set->state->newest_way) {
+        return;
+    }
+
+    // Every block newer than this one ages by one. Branch-free, so the loop
+    // vectorizes. Empty ways age too, so the bound is the set's length (a
+    // constant in specialized kernels); they're given a rank when filled
+    uint16_t rank = set->ranks[way];
+    uint32_t i;
+    for (i = 0; i < set->len; i++) {
+        set->ranks[i] += set->ranks[i] < rank;
+    }
+    set->ranks[way] = 0;
+    set->state->newest_way = way;
+}
+
+static bool CacheData_Set_IsDirty(set_t const * set, uint32_t way)
+{
+    return (set->dirty[way / 64] >> (way % 64)) & 1;
+}
+
+static void CacheData_Set_SetDirty(set_t * set, uint32_t way, bool dirty)
+{
+    uint64_t bit = (uint64_t) 1 << (way % 64);
+    if (dirty) {
+        set->dirty[way / 64] |= bit;
+    }
+    else {
+        set->dirty[way / 64] &= ~bit;
+    }
 }
 
 static void CacheData_Set_Print(cache_data_t data,
-                                set_t * set,
+                                set_t const * set,
+                                bool is_victim_set,
                                 uint32_t set_index)
 {
-    bool is_victim_set = set == &(data->victim_set);
-    if (!is_victim_set && set->newest == NULL) {
+    uint32_t n_valid_blocks = set->state->n_valid_blocks;
+    if (!is_victim_set && n_valid_blocks == 0) {
         return;
     }
 
-    uint32_t n_blocks = data->set_len_blocks;
+    CacheData_PrintSetStart(is_victim_set, set_index);
+
+    // Blocks are printed from newest to oldest
+    uint32_t way;
+    for (way = 0; way < n_valid_blocks; way++) {
+        data->order[set->ranks[way]] = way;
+    }
+
+    uint32_t block_index;
+    for (block_index = 0; block_index < n_valid_blocks; block_index++) {
+        way = data->order[block_index];
+        CacheData_PrintBlock(data,
+                             is_victim_set,
+                             block_index,
+                             set->len,
+                             set->addresses[way],
+                             CacheData_Set_IsDirty(set, way));
+    }
+    CacheData_PrintSetEnd(is_victim_set, n_valid_blocks, set->len);
+}
+
+static void CacheData_PrintSetStart(bool is_victim_set, uint32_t set_index)
+{
     if (is_victim_set) {
         printf("Victim cache:\n            |");
-        n_blocks = data->victim_set_len_blocks;
     }
     else {
         printf("Index: %4" PRIx32 " |", set_index);
     }
+}
 
-    uint32_t block_index = 0;
-    block_t * block;
+static void CacheData_PrintBlock(cache_data_t data,
+                                 bool is_victim_set,
+                                 uint32_t block_index,
+                                 uint32_t n_blocks,
+                                 uint64_t address,
+                                 bool dirty)
+{
     const char * addr_str = is_victim_set ? "Addr:" : "Tag: ";
-    for_block_in_set(block, set) {
-        uint64_t address = block->address;
-        if (!is_victim_set) {
-            // We actually compute the tag value ONLY when printing, so that we
-            // can directly diff against the golden results
-            address >>= HighestBitSet(data->n_sets * data->block_size_bytes);
-        }
-        printf(" V:%" PRIu32 " D:%" PRIu32 " %s %16" PRIx64 " |",
-               1,
-               block->dirty ? (uint32_t) 1 : (uint32_t) 0,
-               addr_str,
-               address);
-        if ((block_index % 2) == 1 && block_index != n_blocks - 1) {
-            printf("\n            |");
-        }
-        block_index += 1;
+    if (!is_victim_set) {
+        // We actually compute the tag value ONLY when printing, so that we
+        // can directly diff against the golden results
+        address >>= HighestBitSet(data->n_sets * data->block_size_bytes);
     }
-    for (; block_index < n_blocks; block_index++) {
+    printf(" V:%" PRIu32 " D:%" PRIu32 " %s %16" PRIx64 " |",
+           1,
+           dirty ? (uint32_t) 1 : (uint32_t) 0,
+           addr_str,
+           address);
+    if ((block_index % 2) == 1 && block_index != n_blocks - 1) {
+        printf("\n            |");
+    }
+}
+
+static void CacheData_PrintSetEnd(bool is_victim_set,
+                                  uint32_t n_valid_blocks,
+                                  uint32_t n_blocks)
+{
+    const char * addr_str = is_victim_set ? "Addr:" : "Tag: ";
+    uint32_t block_index;
+    for (block_index = n_valid_blocks; block_index < n_blocks; block_index++) {
         printf(" V:0 D:0 %s                - |", addr_str);
         if ((block_index % 2) == 1 && block_index != n_blocks - 1) {
             printf("\n            |");
@@ -13,9 +13,14 @@
 
 #include "Access.h"
 #include "Config.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 #include "Util.h"
 
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -34,6 +39,22 @@ struct _cache_t {
                                                  level */
     cache_data_t            data;           /**< The data, used for
                                                  book-keeping */
+    uint32_t                result_cycles[CACHE_N_RESULTS];
+                                            /**< Cycles spent at this level
+                                                 for each result */
+    uint64_t                block_mask;     /**< Clears the offset within a
+                                                 block from an address */
+    uint64_t                last_block;     /**< Address of the block last
+                                                 accessed, which is always
+                                                 the newest in its set */
+    bool                    has_last_block; /**< Whether any block has been
+                                                 accessed yet */
+    bool                    last_block_dirty; /**< Whether the last block is
+                                                   known to be dirty */
+    stack_distance_t        stack_distances[CACHE_MAX_STACK_DISTANCES];
+                                            /**< Count every lookup in
+                                                 other caches */
+    uint32_t                n_stack_distances;
 };
 
 /* --- PRIVATE MACROS ------------------------------------------------------- */
@@ -60,6 +81,19 @@ cache_t CacheInternals_Create(mem_access_f_t sub_access_f,
     cache->stats            = stats;
     cache->sub_mem          = sub_mem;
     cache->sub_access_f     = sub_access_f;
+    cache->block_mask       = AlignmentMask(config->block_size_bytes);
+    cache->last_block       = 0;
+    cache->has_last_block   = false;
+    cache->last_block_dirty = false;
+    cache->n_stack_distances = 0;
+
+    uint32_t miss_cycles = config->miss_time_cycles + config->hit_time_cycles;
+    cache->result_cycles[RESULT_HIT]                = config->hit_time_cycles;
+    cache->result_cycles[RESULT_HIT_VICTIM_CACHE]   = miss_cycles;
+    cache->result_cycles[RESULT_MISS]               = miss_cycles;
+    cache->result_cycles[RESULT_MISS_KICKOUT]       = miss_cycles;
+    cache->result_cycles[RESULT_MISS_DIRTY_KICKOUT] = miss_cycles;
+
     cache->data             = CacheData_Create(n_sets,
                                                set_len,
                                                config->block_size_bytes,
@@ -80,60 +114,103 @@ void CacheInternals_Destroy(cache_t cache)
     }
 }
 
-uint32_t CacheInternals_Access(cache_t cache, access_t const * access)
+void CacheInternals_Lookup(cache_t cache,
+                           access_t const * access,
+                           uint32_t n_accesses,
+                           cache_lookup_t * lookup)
 {
+    // Another access to the block accessed last is a hit that changes nothing:
+    // the block is already the newest in its set. Only a write to a block not
+    // yet known to be dirty has to go to CacheData, to mark it so
+    uint64_t block = access->address & cache->block_mask;
+    bool write = access->type == TYPE_WRITE;
+
+    // After the first access, the block is the newest in its set, and dirty
+    // if this is a write, so the rest are hits that change nothing
+    lookup->n_hits           = n_accesses - 1;
+    lookup->block_size_bytes = cache->config->block_size_bytes;
+
+    uint32_t i;
+    for (i = 0; i < cache->n_stack_distances; i++) {
+        StackDistance_Access(cache->stack_distances[i], access->address, n_accesses, write);
+    }
+
+    if (cache->has_last_block &&
+        block == cache->last_block &&
+        (cache->last_block_dirty || !write)) {
+        lookup->result = RESULT_HIT;
+        lookup->cycles = n_accesses * cache->config->hit_time_cycles;
+        CacheInternals_Record(cache, lookup);
+        return;
+    }
+
     // All the work is really done here. This module just looks at the results
-    // from CacheData, computes the cycles required to have made that happen,
-    // and performs any required accesses to lower levels
-    result_t result;
-    uint64_t dirty_kickout_address;
-    if (access->type == TYPE_WRITE) {
-        dirty_kickout_address = CacheData_Write(cache->data,
-                                                access->address,
-                                                &result);
+    // from CacheData, and computes the cycles required to have made that
+    // happen
+    if (write) {
+        lookup->dirty_kickout_address = CacheData_Write(cache->data,
+                                                        access->address,
+                                                        &lookup->result);
     }
     else {
-        dirty_kickout_address = CacheData_Read(cache->data,
-                                               access->address,
-                                               &result);
+        lookup->dirty_kickout_address = CacheData_Read(cache->data,
+                                                       access->address,
+                                                       &lookup->result);
     }
+    lookup->cycles = cache->result_cycles[lookup->result] +
+                     lookup->n_hits * cache->config->hit_time_cycles;
+
+    // Whatever happened, the block is now the newest in its set. A block that
+    // was only read may be dirty from before, in which case the next write to
+    // it just takes the long way once
+    cache->last_block       = block;
+    cache->has_last_block   = true;
+    cache->last_block_dirty = write;
+
+    // Misses are recorded by the caller, once it has accessed the next level
+    if (lookup->result < RESULT_MISS) {
+        CacheInternals_Record(cache, lookup);
+    }
+}
 
-    uint32_t access_time_cycles = 0;
-
-    access_t dirty_write;
-    access_t miss_read;
-    switch (result) {
-    case RESULT_MISS_DIRTY_KICKOUT:
-        dirty_write.type    = TYPE_WRITE;
-        dirty_write.address = dirty_kickout_address;
-        dirty_write.n_bytes = cache->config->block_size_bytes;
-
-        access_time_cycles += cache->sub_access_f(cache->sub_mem, &dirty_write);
-        // Intentional fallthrough
-
-    case RESULT_MISS:
-    case RESULT_MISS_KICKOUT:
-        miss_read.type       = TYPE_READ;
-        miss_read.address    = access->address;
-        miss_read.n_bytes    = cache->config->block_size_bytes;
-
-        access_time_cycles += cache->config->miss_time_cycles;
-        access_time_cycles += cache->sub_access_f(cache->sub_mem, &miss_read);
-        break;
+void CacheInternals_Record(cache_t cache, cache_lookup_t const * lookup)
+{
+    Statistics_RecordCacheAccess(cache->stats, lookup->result);
+    if (lookup->n_hits > 0) {
+        Statistics_RecordCacheHits(cache->stats, lookup->n_hits);
+    }
+}
 
-    case RESULT_HIT_VICTIM_CACHE:
-        access_time_cycles += cache->config->miss_time_cycles;
-        break;
+uint32_t CacheInternals_Access(cache_t cache, access_t const * access)
+{
+    return CacheInternals_AccessThrough(cache,
+                                        access,
+                                        1,
+                                        cache->sub_access_f,
+                                        cache->sub_mem);
+}
 
-    default:
-        break;
+void CacheInternals_AttachStackDistance(cache_t cache, stack_distance_t stack_distance)
+{
+    if (stack_distance == NULL) {
+        cache->n_stack_distances = 0;
     }
+    else if (cache->n_stack_distances == CACHE_MAX_STACK_DISTANCES) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+    else {
+        cache->stack_distances[cache->n_stack_distances++] = stack_distance;
+    }
+}
 
-    access_time_cycles += cache->config->hit_time_cycles;
-
-    Statistics_RecordCacheAccess(cache->stats, result);
+void CacheInternals_Prefetch(cache_t cache, uint64_t address)
+{
+    CacheData_Prefetch(cache->data, address);
+}
 
-    return access_time_cycles;
+bool CacheInternals_PrefetchEnabled(cache_t cache)
+{
+    return CacheData_PrefetchEnabled(cache->data);
 }
 
 void CacheInternals_Print(cache_t cache)
@@ -0,0 +1,756 @@
+/**
+ * @file    DeltaTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   DeltaTrace Source
+ *
+ * @addtogroup DELTATRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "DeltaTrace.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   The streams of a chunk, in the order they're stored */
+enum DELTA_TRACE_STREAM {
+    STREAM_OPS,             /**< Type of each run */
+    STREAM_RUNS,            /**< Instruction run starts and lengths */
+    STREAM_FETCH_SIZES,     /**< Size of each instruction fetch */
+    STREAM_READS,           /**< Read addresses */
+    STREAM_READ_SIZES,      /**< Size of each read */
+    STREAM_WRITES,          /**< Write addresses */
+    STREAM_WRITE_SIZES,     /**< Size of each write */
+};
+
+/**@brief   Longest varint encoding of a 64-bit value [bytes] */
+#define VARINT_MAX_LEN      (10)
+
+/**@brief   Most bytes each stream can hold per record */
+static size_t const stream_bound[DELTA_TRACE_N_STREAMS] = {
+    [STREAM_OPS]         = 1,
+    [STREAM_RUNS]        = 2 * VARINT_MAX_LEN,
+    [STREAM_FETCH_SIZES] = 5,
+    [STREAM_READS]       = VARINT_MAX_LEN,
+    [STREAM_READ_SIZES]  = 5,
+    [STREAM_WRITES]      = VARINT_MAX_LEN,
+    [STREAM_WRITE_SIZES] = 5,
+};
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of a chunk encoder */
+struct _delta_trace_encoder_t {
+    uint8_t * streams[DELTA_TRACE_N_STREAMS];   /**< Each stream, before
+                                                     deflating */
+    uint32_t capacity;                          /**< Records the streams have
+                                                     space for */
+
+    uint8_t * chunk;                            /**< The encoded chunk */
+    size_t chunk_size;                          /**< Size of @p chunk [bytes] */
+};
+
+/**@brief   The internals of a chunk decoder
+ *
+ * @note    The chunk is decoded as a whole into runs, so taking accesses from
+ *          it only has to step through them
+ */
+struct _delta_trace_decoder_t {
+    uint8_t * streams[DELTA_TRACE_N_STREAMS];   /**< Inflated streams */
+    size_t stream_sizes[DELTA_TRACE_N_STREAMS]; /**< Space in each stream */
+
+    access_run_t * runs;                        /**< The chunk's runs */
+    uint32_t * sizes;                           /**< Size of each access, in
+                                                     trace order */
+    uint32_t capacity;                          /**< Records @p runs and
+                                                     @p sizes have space for */
+
+    uint32_t n_runs;                            /**< Runs in the chunk */
+    uint32_t run;                               /**< Run holding the next
+                                                     access */
+    uint32_t n_taken;                           /**< Accesses of @p run already
+                                                     taken */
+    uint64_t bytes_taken;                       /**< Bytes of @p run already
+                                                     taken */
+    bool ended;                                 /**< Whether the end of the
+                                                     trace was decoded */
+};
+
+/**@brief   The internals of a delta trace writer */
+struct _delta_trace_writer_t {
+    FILE * file;                    /**< The file being written */
+    delta_trace_encoder_t encoder;  /**< Encoder for buffered accesses */
+
+    uint32_t chunk_len;             /**< Records per chunk */
+    access_t * accesses;            /**< Accesses of the current chunk */
+    uint32_t n_buffered;            /**< Accesses in @p accesses */
+    uint64_t n_records;             /**< Records written */
+};
+
+/**@brief   A position within a stream being decoded */
+typedef struct {
+    uint8_t const * next;           /**< Next byte to decode */
+    uint8_t const * end;            /**< End of the stream */
+} stream_cursor_t;
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Make room in @p encoder for @p n_records records */
+static void DeltaTrace_GrowEncoder(delta_trace_encoder_t encoder, uint32_t n_records);
+
+/**@brief   Make room in @p decoder for @p n_records records */
+static void DeltaTrace_GrowDecoder(delta_trace_decoder_t decoder, uint32_t n_records);
+
+/**@brief   Get a stream of a chunk, inflating it if it was deflated
+ *
+ * @return  The stream's bytes. Either in @p data, or in the decoder
+ */
+static uint8_t const * DeltaTrace_InflateStream(delta_trace_decoder_t decoder,
+                                                uint32_t stream,
+                                                uint8_t const * data,
+                                                uint32_t raw_length,
+                                                uint32_t stored_length);
+
+/**@brief   Decode the streams of a chunk into runs */
+static void DeltaTrace_DecodeRuns(delta_trace_decoder_t decoder,
+                                  stream_cursor_t * cursors,
+                                  uint32_t n_records);
+
+/**@brief   Encode and write the buffered accesses as a chunk */
+static void DeltaTrace_FlushChunk(delta_trace_writer_t writer);
+
+/**@brief   Write @p length bytes to the writer's file, or throw */
+static void DeltaTrace_WriteBytes(delta_trace_writer_t writer,
+                                  uint8_t const * buffer,
+                                  size_t length);
+
+/**@brief   Append @p value to a stream as a varint
+ *
+ * @return  The end of the value
+ */
+static inline uint8_t * DeltaTrace_PutVarint(uint8_t * bytes, uint64_t value);
+
+/**@brief   Take a varint from a stream, or throw if it runs out */
+static inline uint64_t DeltaTrace_GetVarint(stream_cursor_t * cursor);
+
+/**@brief   Map a signed difference to an unsigned value, small either side of
+ *          zero
+ */
+static inline uint64_t DeltaTrace_ZigZag(uint64_t delta);
+
+/**@brief   Undo @ref DeltaTrace_ZigZag */
+static inline uint64_t DeltaTrace_UnZigZag(uint64_t value);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void DeltaTrace_CheckHeader(uint8_t const * header)
+{
+    uint32_t chunk_len = GetLE32(&header[12]);
+    if (memcmp(&header[0], DELTA_TRACE_MAGIC, 8) != 0 ||
+        GetLE32(&header[8]) != DELTA_TRACE_VERSION ||
+        chunk_len == 0 ||
+        chunk_len > DELTA_TRACE_MAX_LEN) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+}
+
+delta_trace_encoder_t DeltaTrace_CreateEncoder(void)
+{
+    return (delta_trace_encoder_t) calloc(1, sizeof(struct _delta_trace_encoder_t));
+}
+
+void DeltaTrace_DestroyEncoder(delta_trace_encoder_t encoder)
+{
+    if (encoder) {
+        uint32_t i;
+        for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+            free(encoder->streams[i]);
+        }
+        free(encoder->chunk);
+        free(encoder);
+    }
+}
+
+size_t DeltaTrace_EncodeChunk(delta_trace_encoder_t encoder,
+                              access_t const * accesses,
+                              uint32_t n_accesses,
+                              uint8_t const * * chunk)
+{
+    if (n_accesses == 0 || n_accesses > DELTA_TRACE_MAX_LEN) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+    DeltaTrace_GrowEncoder(encoder, n_accesses);
+
+    uint8_t * ends[DELTA_TRACE_N_STREAMS];
+    uint32_t i;
+    for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+        ends[i] = encoder->streams[i];
+    }
+
+    // Differences are taken within the chunk only, so chunks stand alone
+    uint64_t run_end       = 0;
+    uint64_t last_read     = 0;
+    uint64_t last_write    = 0;
+    uint64_t run_start     = 0;
+    bool in_run            = false;
+
+    for (i = 0; i < n_accesses; i++) {
+        access_t const * access = &accesses[i];
+        if (access->n_bytes == 0) {
+            ThrowHere(ARGUMENT_ERROR);
+        }
+
+        if (access->type != TYPE_INSTR && in_run) {
+            ends[STREAM_RUNS] = DeltaTrace_PutVarint(ends[STREAM_RUNS], run_end - run_start);
+            in_run = false;
+        }
+
+        switch (access->type) {
+        case TYPE_INSTR:
+            if (in_run && access->address == run_end) {
+                run_end += access->n_bytes;
+            }
+            else {
+                if (in_run) {
+                    ends[STREAM_RUNS] = DeltaTrace_PutVarint(ends[STREAM_RUNS],
+                                                             run_end - run_start);
+                }
+                *ends[STREAM_OPS]++ = TYPE_INSTR;
+                ends[STREAM_RUNS] = DeltaTrace_PutVarint(ends[STREAM_RUNS],
+                    DeltaTrace_ZigZag(access->address - run_end));
+                run_start = access->address;
+                run_end   = access->address + access->n_bytes;
+                in_run    = true;
+            }
+            ends[STREAM_FETCH_SIZES] = DeltaTrace_PutVarint(ends[STREAM_FETCH_SIZES],
+                                                            access->n_bytes);
+            break;
+
+        case TYPE_READ:
+            *ends[STREAM_OPS]++ = TYPE_READ;
+            ends[STREAM_READS] = DeltaTrace_PutVarint(ends[STREAM_READS],
+                DeltaTrace_ZigZag(access->address - last_read));
+            ends[STREAM_READ_SIZES] = DeltaTrace_PutVarint(ends[STREAM_READ_SIZES],
+                                                           access->n_bytes);
+            last_read = access->address;
+            break;
+
+        case TYPE_WRITE:
+            *ends[STREAM_OPS]++ = TYPE_WRITE;
+            ends[STREAM_WRITES] = DeltaTrace_PutVarint(ends[STREAM_WRITES],
+                DeltaTrace_ZigZag(access->address - last_write));
+            ends[STREAM_WRITE_SIZES] = DeltaTrace_PutVarint(ends[STREAM_WRITE_SIZES],
+                                                            access->n_bytes);
+            last_write = access->address;
+            break;
+
+        default:
+            ThrowHere(ARGUMENT_ERROR);
+        }
+    }
+    if (in_run) {
+        ends[STREAM_RUNS] = DeltaTrace_PutVarint(ends[STREAM_RUNS], run_end - run_start);
+    }
+
+    uint8_t * header = encoder->chunk;
+    size_t length = DELTA_TRACE_CHUNK_HEADER_SIZE;
+    for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+        uLong raw_length = ends[i] - encoder->streams[i];
+        uLongf stored_length = encoder->chunk_size - length;
+
+        // Streams that don't shrink are stored as they are
+        if (compress(&encoder->chunk[length], &stored_length,
+                     encoder->streams[i], raw_length) != Z_OK ||
+            stored_length >= raw_length) {
+            memcpy(&encoder->chunk[length], encoder->streams[i], raw_length);
+            stored_length = raw_length;
+        }
+
+        PutLE32(&header[8 + 8 * i], (uint32_t) raw_length);
+        PutLE32(&header[12 + 8 * i], (uint32_t) stored_length);
+        length += stored_length;
+    }
+    PutLE32(&header[0], n_accesses);
+    PutLE32(&header[4], (uint32_t) (length - DELTA_TRACE_CHUNK_HEADER_SIZE));
+
+    *chunk = encoder->chunk;
+    return length;
+}
+
+delta_trace_decoder_t DeltaTrace_CreateDecoder(void)
+{
+    return (delta_trace_decoder_t) calloc(1, sizeof(struct _delta_trace_decoder_t));
+}
+
+void DeltaTrace_DestroyDecoder(delta_trace_decoder_t decoder)
+{
+    if (decoder) {
+        uint32_t i;
+        for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+            free(decoder->streams[i]);
+        }
+        free(decoder->runs);
+        free(decoder->sizes);
+        free(decoder);
+    }
+}
+
+size_t DeltaTrace_DecodeChunk(delta_trace_decoder_t decoder,
+                              uint8_t const * data,
+                              size_t length)
+{
+    if (length < DELTA_TRACE_CHUNK_HEADER_SIZE) {
+        return 0;
+    }
+
+    uint32_t n_records      = GetLE32(&data[0]);
+    uint32_t payload_length = GetLE32(&data[4]);
+    if (n_records > DELTA_TRACE_MAX_LEN) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    if (length - DELTA_TRACE_CHUNK_HEADER_SIZE < payload_length) {
+        return 0;
+    }
+
+    decoder->n_runs      = 0;
+    decoder->run         = 0;
+    decoder->n_taken     = 0;
+    decoder->bytes_taken = 0;
+    if (n_records == 0) {
+        if (payload_length != 0) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+        decoder->ended = true;
+        return DELTA_TRACE_CHUNK_HEADER_SIZE;
+    }
+
+    stream_cursor_t cursors[DELTA_TRACE_N_STREAMS];
+    uint8_t const * payload = &data[DELTA_TRACE_CHUNK_HEADER_SIZE];
+    size_t position = 0;
+    uint32_t i;
+    for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+        uint32_t raw_length    = GetLE32(&data[8 + 8 * i]);
+        uint32_t stored_length = GetLE32(&data[12 + 8 * i]);
+        if (stored_length > payload_length - position ||
+            raw_length > (uint64_t) n_records * stream_bound[i]) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+
+        cursors[i].next = DeltaTrace_InflateStream(decoder, i, &payload[position],
+                                                   raw_length, stored_length);
+        cursors[i].end  = cursors[i].next + raw_length;
+        position += stored_length;
+    }
+    if (position != payload_length) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    DeltaTrace_GrowDecoder(decoder, n_records);
+    DeltaTrace_DecodeRuns(decoder, cursors, n_records);
+
+    return DELTA_TRACE_CHUNK_HEADER_SIZE + payload_length;
+}
+
+bool DeltaTrace_Ended(delta_trace_decoder_t decoder)
+{
+    return decoder->ended;
+}
+
+uint32_t DeltaTrace_ReadAccesses(delta_trace_decoder_t decoder,
+                                 access_t * accesses,
+                                 uint32_t max_accesses)
+{
+    uint32_t n_read = 0;
+    while (n_read < max_accesses && decoder->run < decoder->n_runs) {
+        access_run_t const * run = &decoder->runs[decoder->run];
+
+        uint64_t address = run->address + decoder->bytes_taken;
+        uint32_t k = decoder->n_taken;
+        while (k < run->n_accesses && n_read < max_accesses) {
+            accesses[n_read].type    = run->type;
+            accesses[n_read].address = address;
+            accesses[n_read].n_bytes = run->sizes[k];
+            address += run->sizes[k];
+            k++;
+            n_read++;
+        }
+
+        if (k == run->n_accesses) {
+            decoder->run++;
+            decoder->n_taken     = 0;
+            decoder->bytes_taken = 0;
+        }
+        else {
+            decoder->n_taken     = k;
+            decoder->bytes_taken = address - run->address;
+        }
+    }
+
+    return n_read;
+}
+
+uint32_t DeltaTrace_ReadRuns(delta_trace_decoder_t decoder,
+                             access_run_t * runs,
+                             uint32_t max_runs)
+{
+    uint32_t n_read = 0;
+    while (n_read < max_runs && decoder->run < decoder->n_runs) {
+        access_run_t const * run = &decoder->runs[decoder->run];
+
+        runs[n_read].type       = run->type;
+        runs[n_read].address    = run->address + decoder->bytes_taken;
+        runs[n_read].n_bytes    = run->n_bytes - decoder->bytes_taken;
+        runs[n_read].n_accesses = run->n_accesses - decoder->n_taken;
+        runs[n_read].sizes      = run->sizes + decoder->n_taken;
+        n_read++;
+
+        decoder->run++;
+        decoder->n_taken     = 0;
+        decoder->bytes_taken = 0;
+    }
+
+    return n_read;
+}
+
+delta_trace_writer_t DeltaTrace_CreateWriter(FILE * file, uint32_t chunk_len)
+{
+    if (chunk_len == 0 || chunk_len > DELTA_TRACE_MAX_LEN) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    delta_trace_writer_t writer = (delta_trace_writer_t) calloc(1, sizeof(*writer));
+    if (writer == NULL) {
+        return NULL;
+    }
+
+    writer->file      = file;
+    writer->chunk_len = chunk_len;
+    writer->encoder   = DeltaTrace_CreateEncoder();
+    writer->accesses  = (access_t *) malloc((size_t) chunk_len * sizeof(access_t));
+    if (writer->encoder == NULL || writer->accesses == NULL) {
+        DeltaTrace_DestroyWriter(writer);
+        return NULL;
+    }
+
+    uint8_t header[DELTA_TRACE_HEADER_SIZE];
+    memcpy(&header[0], DELTA_TRACE_MAGIC, 8);
+    PutLE32(&header[8], DELTA_TRACE_VERSION);
+    PutLE32(&header[12], chunk_len);
+    PutLE64(&header[16], 0);
+
+    CEXCEPTION_T e;
+    Try {
+        DeltaTrace_WriteBytes(writer, header, sizeof(header));
+    }
+    Catch (e) {
+        DeltaTrace_DestroyWriter(writer);
+        Throw(e);
+    }
+
+    return writer;
+}
+
+void DeltaTrace_DestroyWriter(delta_trace_writer_t writer)
+{
+    if (writer) {
+        DeltaTrace_DestroyEncoder(writer->encoder);
+        free(writer->accesses);
+        free(writer);
+    }
+}
+
+void DeltaTrace_Write(delta_trace_writer_t writer,
+                      access_t const * accesses,
+                      uint32_t n_accesses)
+{
+    while (n_accesses > 0) {
+        uint32_t n_copied = writer->chunk_len - writer->n_buffered;
+        if (n_copied > n_accesses) {
+            n_copied = n_accesses;
+        }
+        memcpy(&writer->accesses[writer->n_buffered], accesses, n_copied * sizeof(access_t));
+        writer->n_buffered += n_copied;
+        accesses   += n_copied;
+        n_accesses -= n_copied;
+
+        if (writer->n_buffered == writer->chunk_len) {
+            DeltaTrace_FlushChunk(writer);
+        }
+    }
+}
+
+void DeltaTrace_WriteChunk(delta_trace_writer_t writer,
+                           uint8_t const * chunk,
+                           size_t length,
+                           uint32_t n_records)
+{
+    if (n_records > writer->chunk_len) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+    if (writer->n_buffered > 0) {
+        DeltaTrace_FlushChunk(writer);
+    }
+
+    DeltaTrace_WriteBytes(writer, chunk, length);
+    writer->n_records += n_records;
+}
+
+uint64_t DeltaTrace_Finish(delta_trace_writer_t writer)
+{
+    if (writer->n_buffered > 0) {
+        DeltaTrace_FlushChunk(writer);
+    }
+
+    uint8_t end[DELTA_TRACE_CHUNK_HEADER_SIZE];
+    memset(end, 0, sizeof(end));
+    DeltaTrace_WriteBytes(writer, end, sizeof(end));
+
+    if (fflush(writer->file) != 0) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    return writer->n_records;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void DeltaTrace_GrowEncoder(delta_trace_encoder_t encoder, uint32_t n_records)
+{
+    if (n_records <= encoder->capacity) {
+        return;
+    }
+
+    size_t chunk_size = DELTA_TRACE_CHUNK_HEADER_SIZE;
+    uint32_t i;
+    for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+        size_t stream_size = (size_t) n_records * stream_bound[i];
+        uint8_t * stream = (uint8_t *) realloc(encoder->streams[i], stream_size);
+        if (stream == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        encoder->streams[i] = stream;
+        chunk_size += compressBound(stream_size);
+    }
+
+    uint8_t * chunk = (uint8_t *) realloc(encoder->chunk, chunk_size);
+    if (chunk == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    encoder->chunk      = chunk;
+    encoder->chunk_size = chunk_size;
+    encoder->capacity   = n_records;
+}
+
+static void DeltaTrace_GrowDecoder(delta_trace_decoder_t decoder, uint32_t n_records)
+{
+    if (n_records <= decoder->capacity) {
+        return;
+    }
+
+    access_run_t * runs = (access_run_t *) realloc(decoder->runs,
+                                                   n_records * sizeof(access_run_t));
+    if (runs == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    decoder->runs = runs;
+
+    uint32_t * sizes = (uint32_t *) realloc(decoder->sizes, n_records * sizeof(uint32_t));
+    if (sizes == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    decoder->sizes    = sizes;
+    decoder->capacity = n_records;
+}
+
+static uint8_t const * DeltaTrace_InflateStream(delta_trace_decoder_t decoder,
+                                                uint32_t stream,
+                                                uint8_t const * data,
+                                                uint32_t raw_length,
+                                                uint32_t stored_length)
+{
+    if (stored_length == raw_length) {
+        return data;
+    }
+
+    if (raw_length > decoder->stream_sizes[stream]) {
+        uint8_t * buffer = (uint8_t *) realloc(decoder->streams[stream], raw_length);
+        if (buffer == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        decoder->streams[stream]      = buffer;
+        decoder->stream_sizes[stream] = raw_length;
+    }
+
+    uLongf length = raw_length;
+    if (uncompress(decoder->streams[stream], &length, data, stored_length) != Z_OK ||
+        length != raw_length) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    return decoder->streams[stream];
+}
+
+static void DeltaTrace_DecodeRuns(delta_trace_decoder_t decoder,
+                                  stream_cursor_t * cursors,
+                                  uint32_t n_records)
+{
+    uint64_t run_end    = 0;
+    uint64_t last_read  = 0;
+    uint64_t last_write = 0;
+
+    uint32_t * sizes = decoder->sizes;
+    uint32_t n_decoded = 0;
+    uint32_t n_runs = 0;
+
+    while (cursors[STREAM_OPS].next < cursors[STREAM_OPS].end) {
+        // Every run holds at least one record
+        if (n_decoded == n_records) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+
+        access_run_t * run = &decoder->runs[n_runs++];
+        run->type  = *cursors[STREAM_OPS].next++;
+        run->sizes = &sizes[n_decoded];
+
+        stream_cursor_t * size_cursor;
+        switch (run->type) {
+        case TYPE_INSTR:
+            run->address = run_end + DeltaTrace_UnZigZag(DeltaTrace_GetVarint(&cursors[STREAM_RUNS]));
+            run->n_bytes = DeltaTrace_GetVarint(&cursors[STREAM_RUNS]);
+            run_end = run->address + run->n_bytes;
+            size_cursor = &cursors[STREAM_FETCH_SIZES];
+            break;
+
+        case TYPE_READ:
+            last_read += DeltaTrace_UnZigZag(DeltaTrace_GetVarint(&cursors[STREAM_READS]));
+            run->address = last_read;
+            run->n_bytes = 0;
+            size_cursor = &cursors[STREAM_READ_SIZES];
+            break;
+
+        case TYPE_WRITE:
+            last_write += DeltaTrace_UnZigZag(DeltaTrace_GetVarint(&cursors[STREAM_WRITES]));
+            run->address = last_write;
+            run->n_bytes = 0;
+            size_cursor = &cursors[STREAM_WRITE_SIZES];
+            break;
+
+        default:
+            ThrowHere(BAD_TRACE_FILE);
+            return;
+        }
+
+        // A read or write is a single access. An instruction run takes fetches
+        // until they cover its bytes exactly
+        uint64_t n_bytes = 0;
+        uint32_t n_accesses = 0;
+        do {
+            uint64_t size = DeltaTrace_GetVarint(size_cursor);
+            if (size == 0 || size > UINT32_MAX || n_decoded == n_records) {
+                ThrowHere(BAD_TRACE_FILE);
+            }
+            sizes[n_decoded++] = (uint32_t) size;
+            n_bytes += size;
+            n_accesses++;
+        } while (run->type == TYPE_INSTR && n_bytes < run->n_bytes);
+
+        if (run->type == TYPE_INSTR && n_bytes != run->n_bytes) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+        run->n_bytes    = n_bytes;
+        run->n_accesses = n_accesses;
+    }
+
+    uint32_t i;
+    for (i = 0; i < DELTA_TRACE_N_STREAMS; i++) {
+        if (cursors[i].next != cursors[i].end) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+    }
+    if (n_decoded != n_records) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    decoder->n_runs = n_runs;
+}
+
+static void DeltaTrace_FlushChunk(delta_trace_writer_t writer)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(writer->encoder, writer->accesses,
+                                           writer->n_buffered, &chunk);
+
+    DeltaTrace_WriteBytes(writer, chunk, length);
+    writer->n_records += writer->n_buffered;
+    writer->n_buffered = 0;
+}
+
+static void DeltaTrace_WriteBytes(delta_trace_writer_t writer,
+                                  uint8_t const * buffer,
+                                  size_t length)
+{
+    if (fwrite(buffer, 1, length, writer->file) != length) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+}
+
+static inline uint8_t * DeltaTrace_PutVarint(uint8_t * bytes, uint64_t value)
+{
+    while (value >= 0x80) {
+        *bytes++ = (uint8_t) value | 0x80;
+        value >>= 7;
+    }
+    *bytes++ = (uint8_t) value;
+
+    return bytes;
+}
+
+static inline uint64_t DeltaTrace_GetVarint(stream_cursor_t * cursor)
+{
+    uint64_t value = 0;
+    uint32_t shift;
+    for (shift = 0; shift < 7 * VARINT_MAX_LEN; shift += 7) {
+        if (cursor->next == cursor->end) {
+            break;
+        }
+
+        uint8_t byte = *cursor->next++;
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+
+    ThrowHere(BAD_TRACE_FILE);
+    return 0;
+}
+
+static inline uint64_t DeltaTrace_ZigZag(uint64_t delta)
+{
+    return (delta << 1) ^ (uint64_t) ((int64_t) delta >> 63);
+}
+
+static inline uint64_t DeltaTrace_UnZigZag(uint64_t value)
+{
+    return (value >> 1) ^ (uint64_t) -(int64_t) (value & 1);
+}
+
+/** @} addtogroup DELTATRACE */
@@ -32,6 +32,7 @@ char const * const exception_descriptors[MAX_EXCEPTION_N] = {
     [INVALID_OPERATION]     = "Bad operation specifier."
                                " Valid values are I, W, or R",
     [INVALID_ACCESS_SIZE]   = "Invalid number of bytes accessed",
+    [BAD_TRACE_FILE]        = "Unreadable or malformed trace file",
 };
 
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
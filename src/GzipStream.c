@@ -0,0 +1,262 @@
+/**
+ * @file    GzipStream.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   GzipStream Source
+ *
+ * @addtogroup GZIPSTREAM
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for dup()
+#define _DEFAULT_SOURCE
+
+#include "GzipStream.h"
+
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <zlib.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Number of blocks shared between the decompressor and consumer */
+#define GZIP_STREAM_N_BLOCKS        (2)
+
+/**@brief   Decompressed bytes per block [bytes] */
+#define GZIP_STREAM_BLOCK_SIZE      (4 << 20)
+
+/**@brief   Size of zlib's compressed input buffer [bytes] */
+#define GZIP_STREAM_INPUT_SIZE      (1 << 20)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   A single block of decompressed data */
+typedef struct {
+    char * buffer;              /**< Headroom, then the block itself */
+    size_t length;              /**< Decompressed bytes in the block */
+    bool full;                  /**< Whether the block belongs to the
+                                     consumer */
+    bool last;                  /**< Whether this is the file's final block */
+    bool error;                 /**< Whether decompression failed */
+} gzip_block_t;
+
+/**@brief   The internals of a gzip stream
+ *
+ * @note    A block is owned by the decompressor while it isn't full, and by
+ *          the consumer while it is. Only @p full (and @p stop) need the lock
+ *          to be read or written
+ */
+struct _gzip_stream_t {
+    gzFile gz;                  /**< The compressed file */
+    size_t headroom;            /**< Bytes reserved before each block */
+
+    gzip_block_t blocks[GZIP_STREAM_N_BLOCKS];
+    uint32_t next;              /**< Block the consumer will receive next */
+    bool held;                  /**< Whether the consumer holds the block
+                                     before @p next */
+
+    pthread_t thread;           /**< The decompression thread */
+    bool started;               /**< Whether @p thread was started */
+    pthread_mutex_t lock;       /**< Protects block ownership and @p stop */
+    pthread_cond_t filled;      /**< Signalled when a block becomes full */
+    pthread_cond_t emptied;     /**< Signalled when a block is handed back */
+    bool stop;                  /**< Whether the decompressor should exit */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Decompression thread entry point */
+static void * GzipStream_Inflate(void * arg);
+
+/**@brief   Inflate as much of the file as fits in @p block */
+static void GzipStream_FillBlock(gzip_stream_t stream, gzip_block_t * block);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+gzip_stream_t GzipStream_Create(int fd, size_t headroom)
+{
+    gzip_stream_t stream = (gzip_stream_t) calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    stream->headroom = headroom;
+    pthread_mutex_init(&stream->lock, NULL);
+    pthread_cond_init(&stream->filled, NULL);
+    pthread_cond_init(&stream->emptied, NULL);
+
+    uint32_t i;
+    for (i = 0; i < GZIP_STREAM_N_BLOCKS; i++) {
+        stream->blocks[i].buffer = (char *) malloc(headroom + GZIP_STREAM_BLOCK_SIZE);
+        if (stream->blocks[i].buffer == NULL) {
+            GzipStream_Destroy(stream);
+            return NULL;
+        }
+    }
+
+    // gzclose() closes the descriptor it was given, which belongs to the
+    // caller
+    int gz_fd = dup(fd);
+    stream->gz = gz_fd < 0 ? NULL : gzdopen(gz_fd, "rb");
+    if (stream->gz == NULL) {
+        if (gz_fd >= 0) close(gz_fd);
+        GzipStream_Destroy(stream);
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    gzbuffer(stream->gz, GZIP_STREAM_INPUT_SIZE);
+
+    if (pthread_create(&stream->thread, NULL, GzipStream_Inflate, stream) != 0) {
+        GzipStream_Destroy(stream);
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    stream->started = true;
+
+    return stream;
+}
+
+void GzipStream_Destroy(gzip_stream_t stream)
+{
+    if (stream) {
+        if (stream->started) {
+            pthread_mutex_lock(&stream->lock);
+            stream->stop = true;
+            pthread_cond_signal(&stream->emptied);
+            pthread_mutex_unlock(&stream->lock);
+
+            pthread_join(stream->thread, NULL);
+        }
+        if (stream->gz) {
+            gzclose(stream->gz);
+        }
+
+        pthread_mutex_destroy(&stream->lock);
+        pthread_cond_destroy(&stream->filled);
+        pthread_cond_destroy(&stream->emptied);
+
+        uint32_t i;
+        for (i = 0; i < GZIP_STREAM_N_BLOCKS; i++) {
+            free(stream->blocks[i].buffer);
+        }
+        free(stream);
+    }
+}
+
+char const * GzipStream_Next(gzip_stream_t stream,
+                             char const * carry,
+                             size_t n_carry,
+                             size_t * length,
+                             bool * last)
+{
+    gzip_block_t * block = &stream->blocks[stream->next];
+
+    pthread_mutex_lock(&stream->lock);
+    while (!block->full) {
+        pthread_cond_wait(&stream->filled, &stream->lock);
+    }
+    pthread_mutex_unlock(&stream->lock);
+
+    // The previous block is still held, so the carry can be copied straight
+    // out of it
+    char * data = block->buffer + stream->headroom - n_carry;
+    memcpy(data, carry, n_carry);
+
+    if (stream->held) {
+        uint32_t previous = (stream->next + GZIP_STREAM_N_BLOCKS - 1) %
+                            GZIP_STREAM_N_BLOCKS;
+
+        pthread_mutex_lock(&stream->lock);
+        stream->blocks[previous].full = false;
+        pthread_cond_signal(&stream->emptied);
+        pthread_mutex_unlock(&stream->lock);
+    }
+    stream->held = true;
+    stream->next = (stream->next + 1) % GZIP_STREAM_N_BLOCKS;
+
+    if (block->error) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    *length = n_carry + block->length;
+    *last   = block->last;
+
+    return data;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void * GzipStream_Inflate(void * arg)
+{
+    gzip_stream_t stream = (gzip_stream_t) arg;
+
+    uint32_t i = 0;
+    while (true) {
+        gzip_block_t * block = &stream->blocks[i];
+
+        pthread_mutex_lock(&stream->lock);
+        while (block->full && !stream->stop) {
+            pthread_cond_wait(&stream->emptied, &stream->lock);
+        }
+        bool stop = stream->stop;
+        pthread_mutex_unlock(&stream->lock);
+
+        if (stop) {
+            break;
+        }
+
+        GzipStream_FillBlock(stream, block);
+
+        pthread_mutex_lock(&stream->lock);
+        block->full = true;
+        pthread_cond_signal(&stream->filled);
+        pthread_mutex_unlock(&stream->lock);
+
+        if (block->last) {
+            break;
+        }
+        i = (i + 1) % GZIP_STREAM_N_BLOCKS;
+    }
+
+    return NULL;
+}
+
+static void GzipStream_FillBlock(gzip_stream_t stream, gzip_block_t * block)
+{
+    char * out = block->buffer + stream->headroom;
+
+    block->length = 0;
+    block->last   = false;
+    block->error  = false;
+
+    while (block->length < GZIP_STREAM_BLOCK_SIZE) {
+        int n_read = gzread(stream->gz,
+                            out + block->length,
+                            GZIP_STREAM_BLOCK_SIZE - block->length);
+        if (n_read <= 0) {
+            // A truncated file reads as a clean end-of-file, but leaves an
+            // error behind
+            int errnum = Z_OK;
+            gzerror(stream->gz, &errnum);
+
+            block->last  = true;
+            block->error = n_read < 0 || errnum != Z_OK;
+            break;
+        }
+        block->length += n_read;
+    }
+}
+
+/** @} addtogroup GZIPSTREAM */
@@ -15,6 +15,7 @@
 #include "CacheInternals.h"
 #include "Config.h"
 #include "L2Cache.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 
 #include <stdbool.h>
@@ -22,6 +23,11 @@
 #include <stdlib.h>
 
 /* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   How many accesses ahead of the one being simulated a batch
+ *          prefetches
+ */
+#define PREFETCH_DISTANCE   (8)
 /* --- PRIVATE DATATYPES ---------------------------------------------------- */
 
 /**@brief   The L1Cache is really just a thin wrapper around the internals
@@ -29,11 +35,26 @@
  */
 struct _l1_cache_t {
     cache_t internals;      /**< This does all the work */
+    l2_cache_t l2_cache;    /**< The next level, always an L2 cache */
+    uint32_t lookup_bytes;  /**< Bytes covered by each lookup: a block, but
+                                 never less than a bus word */
+    bool prefetch_l1;       /**< Whether this cache is worth prefetching */
+    bool prefetch_l2;       /**< Whether the L2 cache is worth prefetching */
 };
 
 /* --- PRIVATE MACROS ------------------------------------------------------- */
 /* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
 
+/**@brief   The cache of the pair an access of type @p type goes to */
+static l1_cache_t _L1Cache_Select(l1_cache_t instr_cache,
+                                  l1_cache_t data_cache,
+                                  uint8_t type);
+
+/**@brief   Prefetch the sets, in this cache and the L2 cache, an access to
+ *          @p address will look at
+ */
+static void _L1Cache_Prefetch(l1_cache_t cache, uint64_t address);
+
 /**@brief   Wrapper function that allows abstraction through CacheInternals */
 static uint32_t _L1Cache_AccessL2(void * _l2_cache, access_t const * access);
 
@@ -58,6 +79,13 @@ l1_cache_t L1Cache_Create(l2_cache_t l2_cache,
         free(cache);
         return NULL;
     }
+    cache->l2_cache     = l2_cache;
+    cache->lookup_bytes = config->block_size_bytes;
+    if (cache->lookup_bytes < L1_BUS_WIDTH_BYTES) {
+        cache->lookup_bytes = L1_BUS_WIDTH_BYTES;
+    }
+    cache->prefetch_l1 = CacheInternals_PrefetchEnabled(cache->internals);
+    cache->prefetch_l2 = L2Cache_PrefetchEnabled(l2_cache);
 
     return cache;
 }
@@ -72,7 +100,80 @@ void L1Cache_Destroy(l1_cache_t cache)
 
 uint32_t L1Cache_Access(l1_cache_t cache, access_t const * access)
 {
-    return CacheInternals_Access(cache->internals, access);
+    return CacheInternals_AccessThrough(cache->internals,
+                                        access,
+                                        1,
+                                        _L1Cache_AccessL2,
+                                        cache->l2_cache);
+}
+
+uint32_t L1Cache_AccessSpan(l1_cache_t cache, access_t const * access)
+{
+    access_t word_access = {
+        .type    = access->type,
+        .address = access->address,
+        .n_bytes = L1_BUS_WIDTH_BYTES,
+    };
+    uint64_t end_address = access->address + access->n_bytes;
+
+    uint32_t access_cycles = 0;
+    while (word_access.address < end_address) {
+        // The words up to the end of this block, or of the span
+        uint64_t block_end = (word_access.address | (cache->lookup_bytes - 1)) + 1;
+        if (block_end > end_address) {
+            block_end = end_address;
+        }
+        uint32_t n_words = (block_end - word_access.address) / L1_BUS_WIDTH_BYTES;
+
+        access_cycles += CacheInternals_AccessThrough(cache->internals,
+                                                      &word_access,
+                                                      n_words,
+                                                      _L1Cache_AccessL2,
+                                                      cache->l2_cache);
+        word_access.address = block_end;
+    }
+
+    return access_cycles;
+}
+
+void L1Cache_AccessBatch(l1_cache_t instr_cache,
+                         l1_cache_t data_cache,
+                         access_t const * accesses,
+                         uint32_t n_accesses,
+                         uint32_t * cycles,
+                         uint32_t * n_aligned)
+{
+    // Small caches stay in the host's caches, so looking ahead only costs time
+    bool prefetch = instr_cache->prefetch_l1 || instr_cache->prefetch_l2 ||
+                    data_cache->prefetch_l1  || data_cache->prefetch_l2;
+
+    uint32_t i;
+    for (i = 0; prefetch && i < n_accesses && i < PREFETCH_DISTANCE; i++) {
+        _L1Cache_Prefetch(_L1Cache_Select(instr_cache, data_cache, accesses[i].type),
+                          accesses[i].address);
+    }
+
+    for (i = 0; i < n_accesses; i++) {
+        if (prefetch && i + PREFETCH_DISTANCE < n_accesses) {
+            access_t const * upcoming = &accesses[i + PREFETCH_DISTANCE];
+            _L1Cache_Prefetch(_L1Cache_Select(instr_cache, data_cache, upcoming->type),
+                              upcoming->address);
+        }
+
+        access_t bus_aligned_access;
+        Access_Align(&bus_aligned_access, &accesses[i], L1_BUS_WIDTH_BYTES);
+
+        n_aligned[i] = bus_aligned_access.n_bytes / L1_BUS_WIDTH_BYTES;
+        cycles[i]    = L1Cache_AccessSpan(_L1Cache_Select(instr_cache,
+                                                          data_cache,
+                                                          accesses[i].type),
+                                          &bus_aligned_access);
+    }
+}
+
+void L1Cache_AttachStackDistance(l1_cache_t l1_cache, stack_distance_t stack_distance)
+{
+    CacheInternals_AttachStackDistance(l1_cache->internals, stack_distance);
 }
 
 void L1Cache_Print(l1_cache_t l1_cache)
@@ -82,6 +183,23 @@ void L1Cache_Print(l1_cache_t l1_cache)
 
 /* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
 
+static l1_cache_t _L1Cache_Select(l1_cache_t instr_cache,
+                                  l1_cache_t data_cache,
+                                  uint8_t type)
+{
+    return type == TYPE_INSTR ? instr_cache : data_cache;
+}
+
+static void _L1Cache_Prefetch(l1_cache_t cache, uint64_t address)
+{
+    if (cache->prefetch_l1) {
+        CacheInternals_Prefetch(cache->internals, address);
+    }
+    if (cache->prefetch_l2) {
+        L2Cache_Prefetch(cache->l2_cache, address);
+    }
+}
+
 static uint32_t _L1Cache_AccessL2(void * _l2_cache, access_t const * access)
 {
     l2_cache_t l2_cache = _l2_cache;
@@ -14,7 +14,9 @@
 #include "Access.h"
 #include "CacheInternals.h"
 #include "Config.h"
+#include "L2Stream.h"
 #include "MainMem.h"
+#include "StackDistance.h"
 #include "Statistics.h"
 #include "Util.h"
 
@@ -30,9 +32,13 @@
  */
 struct _l2_cache_t {
     cache_t               internals;        /**< This does most of the work */
+    main_mem_t            main_mem;         /**< The next level, always main
+                                                 memory */
     cache_param_t const * config;           /**< The cache's config */
     uint32_t              bus_width_shift;  /**< A divide-shift to get the
                                                  busloads for a request */
+    l2_stream_writer_t    capture;          /**< Records every access, if not
+                                                 NULL */
 };
 
 /* --- PRIVATE MACROS ------------------------------------------------------- */
@@ -63,8 +69,10 @@ l2_cache_t L2Cache_Create(main_mem_t mem,
         return NULL;
     }
 
+    cache->main_mem        = mem;
     cache->config          = config;
     cache->bus_width_shift = HighestBitSet(config->bus_width_bytes);
+    cache->capture         = NULL;
 
     return cache;
 }
@@ -79,15 +87,42 @@ void L2Cache_Destroy(l2_cache_t cache)
 
 uint32_t L2Cache_Access(l2_cache_t cache, access_t const * access)
 {
-    uint32_t access_time_cycles = CacheInternals_Access(cache->internals, access);
+    uint32_t access_time_cycles = CacheInternals_AccessThrough(cache->internals,
+                                                               access,
+                                                               1,
+                                                               _L2Cache_AccessMainMem,
+                                                               cache->main_mem);
 
     access_time_cycles += cache->config->transfer_time_cycles *
                           (access->n_bytes >> cache->bus_width_shift);
 
+    if (cache->capture != NULL) {
+        L2Stream_Record(cache->capture, access, access_time_cycles);
+    }
 
     return access_time_cycles;
 }
 
+void L2Cache_Prefetch(l2_cache_t cache, uint64_t address)
+{
+    CacheInternals_Prefetch(cache->internals, address);
+}
+
+bool L2Cache_PrefetchEnabled(l2_cache_t cache)
+{
+    return CacheInternals_PrefetchEnabled(cache->internals);
+}
+
+void L2Cache_AttachStackDistance(l2_cache_t cache, stack_distance_t stack_distance)
+{
+    CacheInternals_AttachStackDistance(cache->internals, stack_distance);
+}
+
+void L2Cache_AttachCapture(l2_cache_t cache, l2_stream_writer_t writer)
+{
+    cache->capture = writer;
+}
+
 void L2Cache_Print(l2_cache_t cache)
 {
     CacheInternals_Print(cache->internals);
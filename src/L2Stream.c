@@ -0,0 +1,416 @@
+/**
+ * @file    L2Stream.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   L2Stream Source
+ *
+ * @addtogroup L2STREAM
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "L2Stream.h"
+
+#include "Access.h"
+#include "Config.h"
+#include "Statistics.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Bytes buffered between stdio calls */
+#define BUFFER_LEN          (64 * 1024)
+
+/**@brief   Longest varint encoding of a 64-bit value [bytes] */
+#define VARINT_MAX_LEN      (10)
+
+/**@brief   Longest record [bytes] */
+#define RECORD_MAX_LEN      (1 + VARINT_MAX_LEN)
+
+/**@brief   Number of kinds of reference an access can be made for */
+#define N_ORIGINS           (3)
+
+/**@brief   Index of the instruction fetch origin, the only one sent by L1i */
+#define ORIGIN_INSTR        (0)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of an L2 stream writer */
+struct _l2_stream_writer_t {
+    FILE * file;
+    cache_param_t l1_config;
+    uint32_t origin;                    /**< Index of the current origin */
+    uint64_t last_address[2];           /**< Last address sent by L1i, L1d */
+    uint64_t l2_cycles[N_ORIGINS];      /**< Cycles L2 took for each origin */
+    uint64_t n_records;
+    uint32_t len;                       /**< Bytes in @p buffer */
+    uint8_t buffer[BUFFER_LEN];
+};
+
+/**@brief   The internals of an L2 stream reader */
+struct _l2_stream_reader_t {
+    FILE * file;
+    char const * path;
+    cache_param_t l1_config;
+    uint64_t last_address[2];           /**< Last address sent by L1i, L1d */
+    uint64_t n_records;                 /**< Records in the stream */
+    uint64_t n_read;                    /**< Records read so far */
+    bool ended;                         /**< Whether the end tag has been read */
+    bool eof;                           /**< Whether the file is read whole */
+    uint8_t trailer[L2_STREAM_TRAILER_SIZE];
+    uint32_t pos;                       /**< Next byte of @p buffer to decode */
+    uint32_t len;                       /**< Bytes in @p buffer */
+    uint8_t buffer[BUFFER_LEN];
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Write out every buffered record */
+static void L2Stream_Flush(l2_stream_writer_t writer);
+
+/**@brief   Move the bytes not yet decoded to the front of the buffer, and
+ *          fill the rest from the file
+ */
+static void L2Stream_Refill(l2_stream_reader_t reader);
+
+/**@brief   Encode a cache's configuration as 32 bytes */
+static void L2Stream_PutConfig(uint8_t * bytes, cache_param_t const * config);
+
+/**@brief   Decode a cache's configuration from 32 bytes */
+static void L2Stream_GetConfig(cache_param_t * config, uint8_t const * bytes);
+
+/**@brief   Encode a cache's statistics as 48 bytes */
+static void L2Stream_PutCacheStats(uint8_t * bytes, cache_stats_t const * stats);
+
+/**@brief   Decode a cache's statistics from 48 bytes, keeping its name */
+static void L2Stream_GetCacheStats(cache_stats_t * stats, uint8_t const * bytes);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   The reference type of each origin index */
+static uint8_t const origin_types[N_ORIGINS] = { TYPE_INSTR, TYPE_READ, TYPE_WRITE };
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+l2_stream_writer_t L2Stream_CreateWriter(char const * path, cache_param_t const * l1_config)
+{
+    l2_stream_writer_t writer = (l2_stream_writer_t) calloc(1, sizeof(*writer));
+    if (writer == NULL) {
+        return NULL;
+    }
+
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL) {
+        free(writer);
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    writer->l1_config = *l1_config;
+
+    memcpy(&writer->buffer[0], L2_STREAM_MAGIC, 8);
+    PutLE32(&writer->buffer[8], L2_STREAM_VERSION);
+    PutLE32(&writer->buffer[12], 0);
+    writer->len = L2_STREAM_HEADER_SIZE;
+
+    return writer;
+}
+
+void L2Stream_DestroyWriter(l2_stream_writer_t writer)
+{
+    if (writer) {
+        fclose(writer->file);
+        free(writer);
+    }
+}
+
+void L2Stream_SetOrigin(l2_stream_writer_t writer, uint8_t type)
+{
+    switch (type) {
+    case TYPE_INSTR:
+        writer->origin = ORIGIN_INSTR;
+        break;
+    case TYPE_READ:
+        writer->origin = 1;
+        break;
+    case TYPE_WRITE:
+        writer->origin = 2;
+        break;
+    default:
+        ThrowHere(INVALID_OPERATION);
+    }
+}
+
+void L2Stream_Record(l2_stream_writer_t writer, access_t const * access, uint32_t cycles)
+{
+    if (access->n_bytes != writer->l1_config.block_size_bytes) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    if (writer->len > BUFFER_LEN - RECORD_MAX_LEN) {
+        L2Stream_Flush(writer);
+    }
+
+    uint8_t * bytes = &writer->buffer[writer->len];
+    *bytes++ = (writer->origin << 1) | (access->type == TYPE_WRITE);
+
+    uint64_t * last_address = &writer->last_address[writer->origin != ORIGIN_INSTR];
+    uint64_t delta = access->address - *last_address;
+    uint64_t value = (delta << 1) ^ (uint64_t) ((int64_t) delta >> 63);
+    while (value >= 0x80) {
+        *bytes++ = (uint8_t) value | 0x80;
+        value >>= 7;
+    }
+    *bytes++ = (uint8_t) value;
+    *last_address = access->address;
+
+    writer->len = bytes - writer->buffer;
+    writer->l2_cycles[writer->origin] += cycles;
+    writer->n_records++;
+}
+
+void L2Stream_Finish(l2_stream_writer_t writer, stats_t const * stats)
+{
+    if (writer->len > BUFFER_LEN - 1 - L2_STREAM_TRAILER_SIZE) {
+        L2Stream_Flush(writer);
+    }
+
+    uint8_t * bytes = &writer->buffer[writer->len];
+    *bytes++ = L2_STREAM_END_TAG;
+
+    L2Stream_PutConfig(&bytes[0], &writer->l1_config);
+    PutLE64(&bytes[32], writer->n_records);
+
+    // Each kind of reference, with the cycles L2 took for it taken back out
+    uint64_t const counts[N_ORIGINS][3] = {
+        { stats->instr_count, stats->instr_count_aligned, stats->instr_cycles },
+        { stats->read_count,  stats->read_count_aligned,  stats->read_cycles  },
+        { stats->write_count, stats->write_count_aligned, stats->write_cycles },
+    };
+    uint32_t const order[N_ORIGINS] = { 1, 2, ORIGIN_INSTR };
+    uint32_t i;
+    for (i = 0; i < N_ORIGINS; i++) {
+        uint32_t origin = order[i];
+        PutLE64(&bytes[40 + 24 * i],      counts[origin][0]);
+        PutLE64(&bytes[40 + 24 * i + 8],  counts[origin][1]);
+        PutLE64(&bytes[40 + 24 * i + 16], counts[origin][2] - writer->l2_cycles[origin]);
+    }
+
+    L2Stream_PutCacheStats(&bytes[112], &stats->l1i);
+    L2Stream_PutCacheStats(&bytes[160], &stats->l1d);
+
+    writer->len += 1 + L2_STREAM_TRAILER_SIZE;
+    L2Stream_Flush(writer);
+    if (fflush(writer->file) != 0) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+}
+
+l2_stream_reader_t L2Stream_CreateReader(char const * path)
+{
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    l2_stream_reader_t reader = (l2_stream_reader_t) calloc(1, sizeof(*reader));
+    if (reader == NULL) {
+        fclose(file);
+        return NULL;
+    }
+    reader->file = file;
+    reader->path = path;
+
+    CEXCEPTION_T e;
+    Try {
+        // The trailer is read first, so the stream is known to be finished
+        uint8_t header[L2_STREAM_HEADER_SIZE];
+        uint8_t end[1 + L2_STREAM_TRAILER_SIZE];
+        if (fread(header, sizeof(header), 1, file) != 1 ||
+            memcmp(&header[0], L2_STREAM_MAGIC, 8) != 0 ||
+            GetLE32(&header[8]) != L2_STREAM_VERSION ||
+            fseek(file, -(long) sizeof(end), SEEK_END) != 0 ||
+            ftell(file) < L2_STREAM_HEADER_SIZE ||
+            fread(end, sizeof(end), 1, file) != 1 ||
+            end[0] != L2_STREAM_END_TAG ||
+            fseek(file, L2_STREAM_HEADER_SIZE, SEEK_SET) != 0) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+
+        memcpy(reader->trailer, &end[1], L2_STREAM_TRAILER_SIZE);
+        L2Stream_GetConfig(&reader->l1_config, &reader->trailer[0]);
+        reader->n_records = GetLE64(&reader->trailer[32]);
+    }
+    Catch (e) {
+        L2Stream_DestroyReader(reader);
+        Throw(e);
+    }
+
+    return reader;
+}
+
+void L2Stream_DestroyReader(l2_stream_reader_t reader)
+{
+    if (reader) {
+        fclose(reader->file);
+        free(reader);
+    }
+}
+
+cache_param_t const * L2Stream_Config(l2_stream_reader_t reader)
+{
+    return &reader->l1_config;
+}
+
+void L2Stream_ReadStats(l2_stream_reader_t reader, stats_t * stats)
+{
+    uint8_t const * bytes = reader->trailer;
+
+    stats->read_count          = GetLE64(&bytes[40]);
+    stats->read_count_aligned  = GetLE64(&bytes[48]);
+    stats->read_cycles         = GetLE64(&bytes[56]);
+    stats->write_count         = GetLE64(&bytes[64]);
+    stats->write_count_aligned = GetLE64(&bytes[72]);
+    stats->write_cycles        = GetLE64(&bytes[80]);
+    stats->instr_count         = GetLE64(&bytes[88]);
+    stats->instr_count_aligned = GetLE64(&bytes[96]);
+    stats->instr_cycles        = GetLE64(&bytes[104]);
+
+    L2Stream_GetCacheStats(&stats->l1i, &bytes[112]);
+    L2Stream_GetCacheStats(&stats->l1d, &bytes[160]);
+}
+
+uint32_t L2Stream_Read(l2_stream_reader_t reader,
+                       access_t * accesses,
+                       uint8_t * origins,
+                       uint32_t max_accesses)
+{
+    uint32_t n_read = 0;
+    while (n_read < max_accesses && !reader->ended) {
+        if (reader->len - reader->pos < RECORD_MAX_LEN && !reader->eof) {
+            L2Stream_Refill(reader);
+        }
+        if (reader->pos == reader->len) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->path, reader->n_read);
+        }
+
+        uint8_t tag = reader->buffer[reader->pos++];
+        if (tag == L2_STREAM_END_TAG) {
+            if (reader->n_read != reader->n_records) {
+                ThrowWithLocationInfo(BAD_TRACE_FILE, reader->path, reader->n_read);
+            }
+            reader->ended = true;
+            break;
+        }
+
+        uint32_t origin = tag >> 1;
+        if (origin >= N_ORIGINS) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->path, reader->n_read);
+        }
+
+        uint64_t value = 0;
+        uint32_t shift = 0;
+        uint8_t byte;
+        do {
+            if (reader->pos == reader->len || shift >= 7 * VARINT_MAX_LEN) {
+                ThrowWithLocationInfo(BAD_TRACE_FILE, reader->path, reader->n_read);
+            }
+            byte = reader->buffer[reader->pos++];
+            value |= (uint64_t) (byte & 0x7f) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        uint64_t * last_address = &reader->last_address[origin != ORIGIN_INSTR];
+        *last_address += (value >> 1) ^ -(value & 1);
+
+        accesses[n_read].type    = (tag & 1) ? TYPE_WRITE : TYPE_READ;
+        accesses[n_read].address = *last_address;
+        accesses[n_read].n_bytes = reader->l1_config.block_size_bytes;
+        origins[n_read]          = origin_types[origin];
+        n_read++;
+        reader->n_read++;
+    }
+
+    return n_read;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void L2Stream_Flush(l2_stream_writer_t writer)
+{
+    if (fwrite(writer->buffer, 1, writer->len, writer->file) != writer->len) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+    writer->len = 0;
+}
+
+static void L2Stream_Refill(l2_stream_reader_t reader)
+{
+    uint32_t remaining = reader->len - reader->pos;
+    memmove(reader->buffer, &reader->buffer[reader->pos], remaining);
+    reader->pos = 0;
+
+    size_t n_bytes = fread(&reader->buffer[remaining], 1, BUFFER_LEN - remaining, reader->file);
+    if (n_bytes < BUFFER_LEN - remaining) {
+        if (ferror(reader->file)) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->path, reader->n_read);
+        }
+        reader->eof = true;
+    }
+    reader->len = remaining + n_bytes;
+}
+
+static void L2Stream_PutConfig(uint8_t * bytes, cache_param_t const * config)
+{
+    PutLE32(&bytes[0],  config->block_size_bytes);
+    PutLE32(&bytes[4],  config->cache_size_bytes);
+    PutLE32(&bytes[8],  config->associativity);
+    PutLE32(&bytes[12], config->hit_time_cycles);
+    PutLE32(&bytes[16], config->miss_time_cycles);
+    PutLE32(&bytes[20], config->transfer_time_cycles);
+    PutLE32(&bytes[24], config->bus_width_bytes);
+    PutLE32(&bytes[28], 0);
+}
+
+static void L2Stream_GetConfig(cache_param_t * config, uint8_t const * bytes)
+{
+    config->block_size_bytes     = GetLE32(&bytes[0]);
+    config->cache_size_bytes     = GetLE32(&bytes[4]);
+    config->associativity        = GetLE32(&bytes[8]);
+    config->hit_time_cycles      = GetLE32(&bytes[12]);
+    config->miss_time_cycles     = GetLE32(&bytes[16]);
+    config->transfer_time_cycles = GetLE32(&bytes[20]);
+    config->bus_width_bytes      = GetLE32(&bytes[24]);
+}
+
+static void L2Stream_PutCacheStats(uint8_t * bytes, cache_stats_t const * stats)
+{
+    PutLE64(&bytes[0],  stats->hit_count);
+    PutLE64(&bytes[8],  stats->miss_count);
+    PutLE64(&bytes[16], stats->kickouts);
+    PutLE64(&bytes[24], stats->dirty_kickouts);
+    PutLE64(&bytes[32], stats->transfers);
+    PutLE64(&bytes[40], stats->vc_hit_count);
+}
+
+static void L2Stream_GetCacheStats(cache_stats_t * stats, uint8_t const * bytes)
+{
+    stats->hit_count      = GetLE64(&bytes[0]);
+    stats->miss_count     = GetLE64(&bytes[8]);
+    stats->kickouts       = GetLE64(&bytes[16]);
+    stats->dirty_kickouts = GetLE64(&bytes[24]);
+    stats->transfers      = GetLE64(&bytes[32]);
+    stats->vc_hit_count   = GetLE64(&bytes[40]);
+}
+
+/** @} addtogroup L2STREAM */
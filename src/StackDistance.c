@@ -0,0 +1,552 @@
+/**
+ * @file    StackDistance.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   StackDistance Source
+ *
+ * @addtogroup STACKDISTANCE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "StackDistance.h"
+
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Marks a position in a set's stack whose block was accessed again */
+#define NO_BLOCK            (UINT32_MAX)
+
+/**@brief   Fewest positions a set's stack is given room for */
+#define MIN_STACK_LEN       (16)
+
+/**@brief   Blocks the block table starts with room for */
+#define MIN_BLOCKS          (1024)
+
+/**@brief   Multiplier spreading block numbers over the block table's slots */
+#define HASH_MULTIPLIER     (0x9e3779b97f4a7c15ull)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The accesses to one set of one cache
+ *
+ * @note    Positions count from 1, one per access to the set, oldest first.
+ *          @p tree is a Fenwick tree over them, counting one at each
+ *          block's latest position
+ */
+typedef struct {
+    uint32_t * tree;        /**< Latest positions up to each, in Fenwick form */
+    uint32_t * blocks;      /**< The block accessed at each position, or
+                                 @ref NO_BLOCK once it's been accessed again */
+    uint32_t len;           /**< Room for positions */
+    uint32_t top;           /**< Positions used */
+    uint32_t n_live;        /**< Blocks in the stack */
+} set_stack_t;
+
+/**@brief   The internals of a stack distance counter
+ *
+ * @note    Each block seen is numbered in order, and its latest position in
+ *          every cache's stack is kept at @p positions[block * n_caches + i].
+ *          @p slots is an open-addressed table of block numbers plus one,
+ *          indexed by a hash of the block's address
+ */
+struct _stack_distance_t {
+    uint32_t block_shift;       /**< Turns an address into a block address */
+    uint32_t block_size_bytes;
+    uint32_t n_caches;
+    uint32_t ways[STACK_DISTANCE_MAX_CACHES];
+    bool hits_carry;            /**< Whether a hit in one cache is a hit in
+                                     every later one: true when none has
+                                     fewer ways than the one before */
+
+    set_stack_t * stacks;       /**< Every cache's sets. Cache @p i's start at
+                                     @p 2^i - 1 */
+
+    uint64_t * addresses;       /**< Block address of each block seen */
+    uint32_t * positions;       /**< Each block's latest position in each cache */
+    uint32_t * dirty;           /**< Each block's dirtiness, a bit per cache */
+    uint32_t n_blocks;          /**< Blocks seen */
+    uint32_t max_blocks;        /**< Room for blocks */
+
+    uint32_t * slots;           /**< The block table */
+    uint32_t slot_shift;        /**< Turns a hash into a slot index */
+    uint32_t slot_mask;         /**< Number of slots, less one */
+
+    uint64_t hits[STACK_DISTANCE_MAX_CACHES];
+    uint64_t misses[STACK_DISTANCE_MAX_CACHES];
+    uint64_t kickouts[STACK_DISTANCE_MAX_CACHES];
+    uint64_t dirty_kickouts[STACK_DISTANCE_MAX_CACHES];
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Create a counter for @p n_caches caches, whose ways are left for
+ *          the caller to fill in
+ */
+static stack_distance_t StackDistance_Allocate(uint32_t block_size_bytes, uint32_t n_caches);
+
+/**@brief   The number of the block at @p block_address, numbering it first if
+ *          it hasn't been seen
+ *
+ * @param[out] is_new:  Whether the block had to be numbered
+ */
+static uint32_t StackDistance_FindBlock(stack_distance_t stack_distance,
+                                        uint64_t block_address,
+                                        bool * is_new);
+
+/**@brief   Double the room for blocks, and the block table with it
+ *
+ * @throws ALLOCATION_FAILURE
+ */
+static void StackDistance_Grow(stack_distance_t stack_distance);
+
+/**@brief   Push @p block onto the top of a stack of cache @p i
+ *
+ * @return  The block's new position
+ *
+ * @throws ALLOCATION_FAILURE
+ */
+static uint32_t StackDistance_Push(stack_distance_t stack_distance,
+                                   set_stack_t * stack,
+                                   uint32_t i,
+                                   uint32_t block);
+
+/**@brief   Squeeze the positions of blocks since accessed again out of a
+ *          stack of cache @p i, renumbering the rest and leaving room for as
+ *          many again
+ *
+ * @throws ALLOCATION_FAILURE
+ */
+static void StackDistance_Compact(stack_distance_t stack_distance,
+                                  set_stack_t * stack,
+                                  uint32_t i);
+
+/**@brief   The number of blocks at positions up to and including @p position */
+static uint32_t SetStack_CountTo(set_stack_t const * stack, uint32_t position);
+
+
+/**@brief   Add @p delta to the count at @p position */
+static void SetStack_Add(set_stack_t * stack, uint32_t position, int32_t delta);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+stack_distance_t StackDistance_Create(uint32_t block_size_bytes,
+                                      uint32_t associativity,
+                                      uint32_t n_caches)
+{
+    if (!IS_POWER_OF_TWO(block_size_bytes) ||
+        associativity == 0 ||
+        n_caches == 0 ||
+        n_caches > STACK_DISTANCE_MAX_CACHES) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    stack_distance_t stack_distance = StackDistance_Allocate(block_size_bytes, n_caches);
+    if (stack_distance == NULL) {
+        return NULL;
+    }
+
+    uint32_t i;
+    for (i = 0; i < n_caches; i++) {
+        stack_distance->ways[i] = associativity;
+    }
+    stack_distance->hits_carry = true;
+
+    return stack_distance;
+}
+
+stack_distance_t StackDistance_CreateAllWays(uint32_t block_size_bytes,
+                                             uint32_t cache_size_bytes)
+{
+    if (!IS_POWER_OF_TWO(block_size_bytes) ||
+        cache_size_bytes < block_size_bytes ||
+        !IS_POWER_OF_TWO(cache_size_bytes / block_size_bytes) ||
+        HighestBitSet(cache_size_bytes / block_size_bytes) >= STACK_DISTANCE_MAX_CACHES) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    uint32_t n_blocks = cache_size_bytes / block_size_bytes;
+    uint32_t n_caches = HighestBitSet(n_blocks) + 1;
+    stack_distance_t stack_distance = StackDistance_Allocate(block_size_bytes, n_caches);
+    if (stack_distance == NULL) {
+        return NULL;
+    }
+
+    // Each cache has twice the sets of the one before, and half the ways
+    uint32_t i;
+    for (i = 0; i < n_caches; i++) {
+        stack_distance->ways[i] = n_blocks >> i;
+    }
+    stack_distance->hits_carry = n_caches == 1;
+
+    return stack_distance;
+}
+
+void StackDistance_Destroy(stack_distance_t stack_distance)
+{
+    if (stack_distance) {
+        if (stack_distance->stacks) {
+            size_t i;
+            for (i = 0; i < ((size_t) 1 << stack_distance->n_caches) - 1; i++) {
+                free(stack_distance->stacks[i].tree);
+                free(stack_distance->stacks[i].blocks);
+            }
+        }
+        free(stack_distance->stacks);
+        free(stack_distance->addresses);
+        free(stack_distance->positions);
+        free(stack_distance->dirty);
+        free(stack_distance->slots);
+        free(stack_distance);
+    }
+}
+
+void StackDistance_Access(stack_distance_t stack_distance,
+                          uint64_t address,
+                          uint32_t n_accesses,
+                          bool write)
+{
+    uint64_t block_address = address >> stack_distance->block_shift;
+
+    bool is_new;
+    uint32_t block = StackDistance_FindBlock(stack_distance, block_address, &is_new);
+    uint32_t * positions = &stack_distance->positions[(size_t) block * stack_distance->n_caches];
+    uint32_t * dirty = &stack_distance->dirty[block];
+    uint32_t written = write ? UINT32_MAX : 0;
+    bool hit = false;
+
+    uint32_t i;
+    for (i = 0; i < stack_distance->n_caches; i++) {
+        uint32_t set = block_address & ((1u << i) - 1);
+        set_stack_t * stack = &stack_distance->stacks[(1u << i) - 1 + set];
+        uint32_t bit = 1u << i;
+
+        // A miss kicks out a block whenever the set is full
+        if (is_new) {
+            stack_distance->misses[i]++;
+            stack_distance->kickouts[i] += stack->n_live >= stack_distance->ways[i];
+            stack_distance->hits[i] += n_accesses - 1;
+            *dirty = (*dirty & ~bit) | (written & bit);
+            positions[i] = StackDistance_Push(stack_distance, stack, i, block);
+            continue;
+        }
+
+        // A block already on top of its set's stack is on top of its (smaller)
+        // set in every later cache too, and stays there
+        uint32_t position = positions[i];
+        if (position == stack->top) {
+            for (; i < stack_distance->n_caches; i++) {
+                stack_distance->hits[i] += n_accesses;
+            }
+            *dirty |= written;
+            break;
+        }
+
+        // The blocks above this one are those of its set touched since. There
+        // can be no more of them than positions above it
+        uint32_t ways = stack_distance->ways[i];
+        hit = (hit && stack_distance->hits_carry) ||
+              stack->top - position < ways ||
+              stack->n_live - SetStack_CountTo(stack, position) < ways;
+
+        if (hit) {
+            stack_distance->hits[i] += n_accesses;
+            *dirty |= written & bit;
+        }
+        else {
+            // Which block a miss kicks out takes a search to find, but the
+            // block missing now was kicked out since its last access, as it
+            // was then. So each kickout is counted when the block comes back,
+            // or (if it never does) when the counts are read
+            stack_distance->misses[i]++;
+            stack_distance->kickouts[i]++;
+            stack_distance->dirty_kickouts[i] += (*dirty & bit) != 0;
+            stack_distance->hits[i] += n_accesses - 1;
+            *dirty = (*dirty & ~bit) | (written & bit);
+        }
+
+        SetStack_Add(stack, position, -1);
+        stack->blocks[position - 1] = NO_BLOCK;
+        stack->n_live--;
+        positions[i] = StackDistance_Push(stack_distance, stack, i, block);
+    }
+}
+
+uint32_t StackDistance_Caches(stack_distance_t stack_distance)
+{
+    return stack_distance->n_caches;
+}
+
+uint64_t StackDistance_SizeBytes(stack_distance_t stack_distance, uint32_t i)
+{
+    return ((uint64_t) stack_distance->block_size_bytes * stack_distance->ways[i]) << i;
+}
+
+uint32_t StackDistance_Ways(stack_distance_t stack_distance, uint32_t i)
+{
+    return stack_distance->ways[i];
+}
+
+uint64_t StackDistance_Hits(stack_distance_t stack_distance, uint32_t i)
+{
+    return stack_distance->hits[i];
+}
+
+uint64_t StackDistance_Misses(stack_distance_t stack_distance, uint32_t i)
+{
+    return stack_distance->misses[i];
+}
+
+uint64_t StackDistance_Kickouts(stack_distance_t stack_distance, uint32_t i)
+{
+    return stack_distance->kickouts[i];
+}
+
+uint64_t StackDistance_DirtyKickouts(stack_distance_t stack_distance, uint32_t i)
+{
+    // Add the dirty blocks kicked out that haven't come back
+    uint64_t dirty_kickouts = stack_distance->dirty_kickouts[i];
+    uint32_t block;
+    for (block = 0; block < stack_distance->n_blocks; block++) {
+        if (stack_distance->dirty[block] & (1u << i)) {
+            uint32_t set = stack_distance->addresses[block] & ((1u << i) - 1);
+            set_stack_t const * stack = &stack_distance->stacks[(1u << i) - 1 + set];
+            uint32_t position = stack_distance->positions[(size_t) block * stack_distance->n_caches + i];
+            dirty_kickouts += stack->n_live - SetStack_CountTo(stack, position) >=
+                              stack_distance->ways[i];
+        }
+    }
+
+    return dirty_kickouts;
+}
+
+void StackDistance_Print(stack_distance_t stack_distance, char const * name)
+{
+    printf("  Memory Level: %s (block size = %" PRIu32 ")\n",
+           name, stack_distance->block_size_bytes);
+    printf("    %10s %5s %12s %12s %10s %10s %10s\n",
+           "Size", "Ways", "Hit Count", "Miss Count", "Kickouts", "Dirty", "Miss Rate");
+
+    uint32_t i;
+    for (i = 0; i < stack_distance->n_caches; i++) {
+        uint64_t hits   = stack_distance->hits[i];
+        uint64_t misses = stack_distance->misses[i];
+        uint64_t total  = hits + misses;
+        printf("    %10" PRIu64 " %5" PRIu32 " %12" PRIu64 " %12" PRIu64
+               " %10" PRIu64 " %10" PRIu64 " %9.4f%%\n",
+               StackDistance_SizeBytes(stack_distance, i), stack_distance->ways[i],
+               hits, misses, stack_distance->kickouts[i],
+               StackDistance_DirtyKickouts(stack_distance, i),
+               total > 0 ? 100.0 * misses / total : 0.0);
+    }
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static stack_distance_t StackDistance_Allocate(uint32_t block_size_bytes, uint32_t n_caches)
+{
+    stack_distance_t stack_distance = (stack_distance_t) calloc(1, sizeof(*stack_distance));
+    if (stack_distance == NULL) {
+        return NULL;
+    }
+
+    stack_distance->block_shift      = HighestBitSet(block_size_bytes);
+    stack_distance->block_size_bytes = block_size_bytes;
+    stack_distance->n_caches         = n_caches;
+    stack_distance->max_blocks       = MIN_BLOCKS;
+    stack_distance->slot_mask        = 2 * MIN_BLOCKS - 1;
+    stack_distance->slot_shift       = 64 - HighestBitSet(2 * MIN_BLOCKS);
+
+    stack_distance->stacks    = (set_stack_t *) calloc(((size_t) 1 << n_caches) - 1,
+                                                       sizeof(set_stack_t));
+    stack_distance->addresses = (uint64_t *) malloc(MIN_BLOCKS * sizeof(uint64_t));
+    stack_distance->positions = (uint32_t *) malloc((size_t) MIN_BLOCKS * n_caches *
+                                                    sizeof(uint32_t));
+    stack_distance->dirty     = (uint32_t *) malloc(MIN_BLOCKS * sizeof(uint32_t));
+    stack_distance->slots     = (uint32_t *) calloc(2 * MIN_BLOCKS, sizeof(uint32_t));
+    if (stack_distance->stacks == NULL ||
+        stack_distance->addresses == NULL ||
+        stack_distance->positions == NULL ||
+        stack_distance->dirty == NULL ||
+        stack_distance->slots == NULL) {
+        StackDistance_Destroy(stack_distance);
+        return NULL;
+    }
+
+    return stack_distance;
+}
+
+static uint32_t StackDistance_FindBlock(stack_distance_t stack_distance,
+                                        uint64_t block_address,
+                                        bool * is_new)
+{
+    uint32_t slot = (block_address * HASH_MULTIPLIER) >> stack_distance->slot_shift;
+    while (stack_distance->slots[slot] != 0) {
+        uint32_t block = stack_distance->slots[slot] - 1;
+        if (stack_distance->addresses[block] == block_address) {
+            *is_new = false;
+            return block;
+        }
+        slot = (slot + 1) & stack_distance->slot_mask;
+    }
+
+    if (stack_distance->n_blocks == stack_distance->max_blocks) {
+        StackDistance_Grow(stack_distance);
+        return StackDistance_FindBlock(stack_distance, block_address, is_new);
+    }
+
+    uint32_t block = stack_distance->n_blocks++;
+    stack_distance->addresses[block] = block_address;
+    stack_distance->slots[slot]      = block + 1;
+
+    *is_new = true;
+    return block;
+}
+
+static void StackDistance_Grow(stack_distance_t stack_distance)
+{
+    if (stack_distance->max_blocks > UINT32_MAX / 4) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    uint32_t max_blocks = 2 * stack_distance->max_blocks;
+    uint32_t n_slots    = 2 * max_blocks;
+
+    uint64_t * addresses = (uint64_t *) realloc(stack_distance->addresses,
+                                                max_blocks * sizeof(uint64_t));
+    if (addresses == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    stack_distance->addresses = addresses;
+
+    uint32_t * positions = (uint32_t *) realloc(stack_distance->positions,
+                                                (size_t) max_blocks *
+                                                stack_distance->n_caches *
+                                                sizeof(uint32_t));
+    if (positions == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    stack_distance->positions = positions;
+
+    uint32_t * dirty = (uint32_t *) realloc(stack_distance->dirty, max_blocks * sizeof(uint32_t));
+    if (dirty == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    stack_distance->dirty = dirty;
+
+    uint32_t * slots = (uint32_t *) calloc(n_slots, sizeof(uint32_t));
+    if (slots == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    free(stack_distance->slots);
+    stack_distance->slots      = slots;
+    stack_distance->slot_mask  = n_slots - 1;
+    stack_distance->slot_shift = 64 - HighestBitSet(n_slots);
+    stack_distance->max_blocks = max_blocks;
+
+    uint32_t block;
+    for (block = 0; block < stack_distance->n_blocks; block++) {
+        uint32_t slot = (stack_distance->addresses[block] * HASH_MULTIPLIER) >>
+                        stack_distance->slot_shift;
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & stack_distance->slot_mask;
+        }
+        slots[slot] = block + 1;
+    }
+}
+
+static uint32_t StackDistance_Push(stack_distance_t stack_distance,
+                                   set_stack_t * stack,
+                                   uint32_t i,
+                                   uint32_t block)
+{
+    if (stack->top == stack->len) {
+        StackDistance_Compact(stack_distance, stack, i);
+    }
+
+    uint32_t position = ++stack->top;
+    stack->blocks[position - 1] = block;
+    stack->n_live++;
+    SetStack_Add(stack, position, 1);
+
+    return position;
+}
+
+static void StackDistance_Compact(stack_distance_t stack_distance,
+                                  set_stack_t * stack,
+                                  uint32_t i)
+{
+    // Blocks keep their order, moving down over those accessed again
+    uint32_t n_caches = stack_distance->n_caches;
+    uint32_t top = 0;
+    uint32_t position;
+    for (position = 1; position <= stack->top; position++) {
+        uint32_t block = stack->blocks[position - 1];
+        if (block != NO_BLOCK) {
+            stack->blocks[top++] = block;
+            stack_distance->positions[(size_t) block * n_caches + i] = top;
+        }
+    }
+    stack->top = top;
+
+    uint32_t len = 2 * stack->n_live;
+    if (len < MIN_STACK_LEN) {
+        len = MIN_STACK_LEN;
+    }
+    if (len != stack->len) {
+        uint32_t * blocks = (uint32_t *) realloc(stack->blocks, len * sizeof(uint32_t));
+        if (blocks == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        stack->blocks = blocks;
+
+        uint32_t * tree = (uint32_t *) realloc(stack->tree, (len + 1) * sizeof(uint32_t));
+        if (tree == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        stack->tree = tree;
+        stack->len  = len;
+    }
+
+    // Every remaining position is counted. Each entry covers the positions
+    // from just past the one its lowest bit clears, up to its own
+    for (position = 1; position <= stack->len; position++) {
+        uint32_t first = position - (position & -position);
+        stack->tree[position] = position <= top ? position - first :
+                                first < top     ? top - first      :
+                                                  0;
+    }
+}
+
+static uint32_t SetStack_CountTo(set_stack_t const * stack, uint32_t position)
+{
+    uint32_t count = 0;
+    for (; position > 0; position -= position & -position) {
+        count += stack->tree[position];
+    }
+
+    return count;
+}
+
+static void SetStack_Add(set_stack_t * stack, uint32_t position, int32_t delta)
+{
+    for (; position <= stack->len; position += position & -position) {
+        stack->tree[position] += delta;
+    }
+}
+
+/** @} addtogroup STACKDISTANCE */
@@ -135,6 +135,21 @@ void Statistics_RecordAccess(stats_t * stats,
     }
 }
 
+void Statistics_RecordCycles(stats_t * stats, uint8_t type, uint32_t cycles)
+{
+    switch(type) {
+    case TYPE_READ:
+        stats->read_cycles  += cycles;
+        break;
+    case TYPE_WRITE:
+        stats->write_cycles += cycles;
+        break;
+    case TYPE_INSTR:
+        stats->instr_cycles += cycles;
+        break;
+    }
+}
+
 void Statistics_RecordCacheAccess(cache_stats_t * cache_stats,
                                   result_t result)
 {
@@ -164,6 +179,11 @@ void Statistics_RecordCacheAccess(cache_stats_t * cache_stats,
 
 }
 
+void Statistics_RecordCacheHits(cache_stats_t * cache_stats, uint32_t n_hits)
+{
+    cache_stats->hit_count += n_hits;
+}
+
 /* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
 
 static double Statistics_Percentage(uint64_t number, uint64_t total)
@@ -0,0 +1,194 @@
+/**
+ * @file    TagSearch.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TagSearch Source
+ *
+ * @addtogroup TAGSEARCH
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "TagSearch.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TAG_SEARCH_X86
+#include <immintrin.h>
+#endif
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Search without vector instructions */
+static uint32_t TagSearch_Scalar(uint64_t const * addresses,
+                                 uint32_t n_addresses,
+                                 uint64_t address);
+
+#ifdef TAG_SEARCH_X86
+
+/**@brief   Search with SSE2, which has no 64-bit compare */
+static uint32_t TagSearch_Sse2(uint64_t const * addresses,
+                               uint32_t n_addresses,
+                               uint64_t address);
+
+/**@brief   Search with AVX2 */
+static uint32_t TagSearch_Avx2(uint64_t const * addresses,
+                               uint32_t n_addresses,
+                               uint64_t address);
+
+/**@brief   Search with AVX-512 */
+static uint32_t TagSearch_Avx512(uint64_t const * addresses,
+                                 uint32_t n_addresses,
+                                 uint64_t address);
+
+#endif /* ifdef TAG_SEARCH_X86 */
+
+/**@brief   Check whether the host supports @p level */
+static bool TagSearch_Supported(tag_search_level_t level);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   Implementation of each level, where compiled in */
+static tag_search_t const searches[TAG_SEARCH_N_LEVELS] = {
+    [TAG_SEARCH_SCALAR] = TagSearch_Scalar,
+#ifdef TAG_SEARCH_X86
+    [TAG_SEARCH_SSE2]   = TagSearch_Sse2,
+    [TAG_SEARCH_AVX2]   = TagSearch_Avx2,
+    [TAG_SEARCH_AVX512] = TagSearch_Avx512,
+#endif
+};
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+tag_search_level_t TagSearch_BestLevel(void)
+{
+    tag_search_level_t level = TAG_SEARCH_N_LEVELS - 1;
+    while (level > TAG_SEARCH_SCALAR && TagSearch_Get(level) == NULL) {
+        level--;
+    }
+
+    return level;
+}
+
+tag_search_t TagSearch_Get(tag_search_level_t level)
+{
+    if (level >= TAG_SEARCH_N_LEVELS || !TagSearch_Supported(level)) {
+        return NULL;
+    }
+
+    return searches[level];
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint32_t TagSearch_Scalar(uint64_t const * addresses,
+                                 uint32_t n_addresses,
+                                 uint64_t address)
+{
+    uint32_t i;
+    for (i = 0; i < n_addresses; i++) {
+        if (addresses[i] == address) {
+            return i;
+        }
+    }
+
+    return TAG_SEARCH_NO_MATCH;
+}
+
+#ifdef TAG_SEARCH_X86
+
+__attribute__((target("sse2")))
+static uint32_t TagSearch_Sse2(uint64_t const * addresses,
+                               uint32_t n_addresses,
+                               uint64_t address)
+{
+    __m128i needle = _mm_set1_epi64x((long long) address);
+
+    uint32_t base;
+    for (base = 0; base < n_addresses; base += TAG_SEARCH_WIDTH) {
+        uint32_t matches = 0;
+        uint32_t i;
+        for (i = 0; i < TAG_SEARCH_WIDTH; i += 2) {
+            __m128i tags = _mm_loadu_si128((__m128i const *) &addresses[base + i]);
+
+            // Both 32-bit halves of an address must match
+            __m128i equal = _mm_cmpeq_epi32(tags, needle);
+            equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+            matches |= (uint32_t) _mm_movemask_pd(_mm_castsi128_pd(equal)) << i;
+        }
+        if (matches != 0) {
+            return base + __builtin_ctz(matches);
+        }
+    }
+
+    return TAG_SEARCH_NO_MATCH;
+}
+
+__attribute__((target("avx2")))
+static uint32_t TagSearch_Avx2(uint64_t const * addresses,
+                               uint32_t n_addresses,
+                               uint64_t address)
+{
+    __m256i needle = _mm256_set1_epi64x((long long) address);
+
+    uint32_t base;
+    for (base = 0; base < n_addresses; base += TAG_SEARCH_WIDTH) {
+        __m256i low  = _mm256_loadu_si256((__m256i const *) &addresses[base]);
+        __m256i high = _mm256_loadu_si256((__m256i const *) &addresses[base + 4]);
+        uint32_t matches =
+            (uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(low, needle))) |
+            (uint32_t) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(high, needle))) << 4;
+        if (matches != 0) {
+            return base + __builtin_ctz(matches);
+        }
+    }
+
+    return TAG_SEARCH_NO_MATCH;
+}
+
+__attribute__((target("avx512f")))
+static uint32_t TagSearch_Avx512(uint64_t const * addresses,
+                                 uint32_t n_addresses,
+                                 uint64_t address)
+{
+    __m512i needle = _mm512_set1_epi64((long long) address);
+
+    uint32_t base;
+    for (base = 0; base < n_addresses; base += TAG_SEARCH_WIDTH) {
+        __m512i tags = _mm512_loadu_si512((void const *) &addresses[base]);
+        uint32_t matches = _mm512_cmpeq_epi64_mask(tags, needle);
+        if (matches != 0) {
+            return base + __builtin_ctz(matches);
+        }
+    }
+
+    return TAG_SEARCH_NO_MATCH;
+}
+
+#endif /* ifdef TAG_SEARCH_X86 */
+
+static bool TagSearch_Supported(tag_search_level_t level)
+{
+    switch (level) {
+    case TAG_SEARCH_SCALAR:
+        return true;
+#ifdef TAG_SEARCH_X86
+    case TAG_SEARCH_SSE2:
+        return __builtin_cpu_supports("sse2");
+    case TAG_SEARCH_AVX2:
+        return __builtin_cpu_supports("avx2");
+    case TAG_SEARCH_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+
+/** @} addtogroup TAGSEARCH */
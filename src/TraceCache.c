@@ -0,0 +1,277 @@
+/**
+ * @file    TraceCache.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceCache Source
+ *
+ * @addtogroup TRACECACHE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for pread()
+#define _DEFAULT_SOURCE
+
+#include "TraceCache.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Longest path of a converted trace, or its partial copy */
+#define TRACE_CACHE_PATH_LEN    (4096)
+
+/**@brief   Multiplier used by the content hash (the 64-bit golden ratio) */
+#define TRACE_CACHE_HASH_PRIME  (0x9e3779b97f4a7c15ULL)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of a trace's cache entry */
+struct _trace_cache_t {
+    char path[TRACE_CACHE_PATH_LEN];            /**< The converted trace */
+    char partial_path[TRACE_CACHE_PATH_LEN];    /**< Its copy, while recording */
+    bool hit;                                   /**< Whether @p path exists */
+
+    FILE * file;                                /**< The partial copy, or NULL
+                                                     if not recording */
+    block_trace_writer_t writer;                /**< Writer for @p file */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Hash the size and contents of the trace in @p fd
+ *
+ * @return  Whether the trace should be cached at all
+ */
+static bool TraceCache_Hash(int fd, uint64_t * hash, uint64_t * size);
+
+/**@brief   Start recording a trace into a partial copy */
+static void TraceCache_StartRecording(trace_cache_t cache, char const * dir);
+
+/**@brief   Stop recording, and delete the partial copy */
+static void TraceCache_Abandon(trace_cache_t cache);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+trace_cache_t TraceCache_Create(char const * dir, char const * trace_file, bool record)
+{
+    trace_cache_t cache = (trace_cache_t) calloc(1, sizeof(*cache));
+    if (cache == NULL) {
+        return NULL;
+    }
+
+    if (dir == NULL || trace_file == NULL) {
+        return cache;
+    }
+
+    int fd = open(trace_file, O_RDONLY);
+    if (fd < 0) {
+        return cache;
+    }
+
+    uint64_t hash;
+    uint64_t size;
+    bool cacheable = TraceCache_Hash(fd, &hash, &size);
+    close(fd);
+    if (!cacheable) {
+        return cache;
+    }
+
+    int length = snprintf(cache->path, sizeof(cache->path), "%s/%016" PRIx64 "-%" PRIu64 ".blk",
+                          dir, hash, size);
+    if (length < 0 || (size_t) length >= sizeof(cache->path)) {
+        cache->path[0] = '\0';
+        return cache;
+    }
+
+    if (access(cache->path, R_OK) == 0) {
+        cache->hit = true;
+    }
+    else if (record) {
+        TraceCache_StartRecording(cache, dir);
+    }
+
+    return cache;
+}
+
+void TraceCache_Destroy(trace_cache_t cache)
+{
+    if (cache) {
+        TraceCache_Abandon(cache);
+        free(cache);
+    }
+}
+
+char const * TraceCache_Path(trace_cache_t cache)
+{
+    return cache->hit ? cache->path : NULL;
+}
+
+bool TraceCache_Recording(trace_cache_t cache)
+{
+    return cache->file != NULL;
+}
+
+void TraceCache_Record(trace_cache_t cache, access_t const * accesses, uint32_t n_accesses)
+{
+    if (cache->file == NULL) {
+        return;
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        BlockTrace_Write(cache->writer, accesses, n_accesses);
+    }
+    Catch (e) {
+        TraceCache_Abandon(cache);
+    }
+}
+
+bool TraceCache_Commit(trace_cache_t cache)
+{
+    if (cache->file == NULL) {
+        return false;
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        BlockTrace_Finish(cache->writer);
+    }
+    Catch (e) {
+        TraceCache_Abandon(cache);
+        return false;
+    }
+
+    BlockTrace_DestroyWriter(cache->writer);
+    cache->writer = NULL;
+
+    bool closed = fclose(cache->file) == 0;
+    cache->file = NULL;
+
+    // Renaming is atomic, so a run that looks the trace up concurrently sees
+    // either nothing or the whole copy
+    if (!closed || rename(cache->partial_path, cache->path) != 0) {
+        unlink(cache->partial_path);
+        return false;
+    }
+
+    cache->hit = true;
+    return true;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static bool TraceCache_Hash(int fd, uint64_t * hash, uint64_t * size)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        return false;
+    }
+
+    // Binary, block and delta traces are already as fast to read as the copy
+    // would be
+    char magic[8];
+    if (pread(fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+        (memcmp(magic, BINARY_TRACE_MAGIC, 8) == 0 ||
+         memcmp(magic, BLOCK_TRACE_MAGIC, 8) == 0 ||
+         memcmp(magic, DELTA_TRACE_MAGIC, 8) == 0)) {
+        return false;
+    }
+
+    uint8_t const * contents = (uint8_t const *) mmap(NULL, st.st_size, PROT_READ,
+                                                      MAP_PRIVATE, fd, 0);
+    if (contents == MAP_FAILED) {
+        return false;
+    }
+    madvise((void *) contents, st.st_size, MADV_SEQUENTIAL);
+
+    // Eight bytes at a time, so hashing costs far less than parsing
+    uint64_t h = (uint64_t) st.st_size * TRACE_CACHE_HASH_PRIME;
+    size_t length = st.st_size;
+    size_t i;
+    for (i = 0; i + 8 <= length; i += 8) {
+        uint64_t word;
+        memcpy(&word, &contents[i], sizeof(word));
+        h = ((h << 31) | (h >> 33)) ^ word;
+        h *= TRACE_CACHE_HASH_PRIME;
+    }
+    for (; i < length; i++) {
+        h = ((h << 31) | (h >> 33)) ^ contents[i];
+        h *= TRACE_CACHE_HASH_PRIME;
+    }
+    h ^= h >> 29;
+
+    munmap((void *) contents, st.st_size);
+
+    *hash = h;
+    *size = length;
+    return true;
+}
+
+static void TraceCache_StartRecording(trace_cache_t cache, char const * dir)
+{
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+        return;
+    }
+
+    // Each run records into its own copy, so concurrent runs don't collide
+    int length = snprintf(cache->partial_path, sizeof(cache->partial_path), "%s.%ld.partial",
+                          cache->path, (long) getpid());
+    if (length < 0 || (size_t) length >= sizeof(cache->partial_path)) {
+        return;
+    }
+
+    cache->file = fopen(cache->partial_path, "wb");
+    if (cache->file == NULL) {
+        return;
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        cache->writer = BlockTrace_CreateWriter(cache->file, BLOCK_TRACE_DEFAULT_LEN);
+    }
+    Catch (e) {
+        cache->writer = NULL;
+    }
+    if (cache->writer == NULL) {
+        TraceCache_Abandon(cache);
+    }
+}
+
+static void TraceCache_Abandon(trace_cache_t cache)
+{
+    if (cache->file != NULL) {
+        BlockTrace_DestroyWriter(cache->writer);
+        cache->writer = NULL;
+
+        fclose(cache->file);
+        cache->file = NULL;
+
+        unlink(cache->partial_path);
+    }
+}
+
+/** @} addtogroup TRACECACHE */
@@ -0,0 +1,399 @@
+/**
+ * @file    TraceIndex.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceIndex Source
+ *
+ * @addtogroup TRACEINDEX
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for pread() and st_mtim
+#define _DEFAULT_SOURCE
+
+#include "TraceIndex.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Longest path of a sidecar, or its partial copy */
+#define TRACE_INDEX_PATH_LEN        (4096)
+
+/**@brief   Checkpoints allocated for a new index */
+#define INITIAL_CHECKPOINTS         (64)
+
+/**@brief   Multiplier used to hash a trace's identity (the 64-bit golden
+ *          ratio)
+ */
+#define TRACE_INDEX_HASH_PRIME      (0x9e3779b97f4a7c15ULL)
+
+/**@brief   Number of values identifying a trace file */
+#define N_IDENTITY                  (5)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of a checkpoint index */
+struct _trace_index_t {
+    char path[TRACE_INDEX_PATH_LEN];    /**< The sidecar */
+    char const * dir;                   /**< Directory holding @p path */
+    bool active;                        /**< Whether the trace is indexed */
+    uint32_t interval;                  /**< References between checkpoints */
+    uint64_t identity[N_IDENTITY];      /**< Size, modification time (s, ns),
+                                             device and inode of the trace */
+
+    trace_checkpoint_t * checkpoints;   /**< Checkpoint k is at reference
+                                             k * interval */
+    uint64_t n_checkpoints;             /**< Valid entries in @p checkpoints */
+    uint64_t max_checkpoints;           /**< Space in @p checkpoints */
+    uint64_t n_saved;                   /**< Checkpoints in the sidecar */
+
+    trace_checkpoint_t position;        /**< The state of the trace just
+                                             before the next access read */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Find @p trace_file's identity, and whether it should be indexed */
+static bool TraceIndex_Identify(trace_index_t index, char const * trace_file);
+
+/**@brief   Load checkpoints from the sidecar, if it matches the trace */
+static void TraceIndex_Load(trace_index_t index);
+
+/**@brief   Append @p checkpoint to the index
+ *
+ * @return  Whether there was room for it
+ */
+static bool TraceIndex_Append(trace_index_t index, trace_checkpoint_t const * checkpoint);
+
+/**@brief   Encode a checkpoint as it's stored in the sidecar */
+static void TraceIndex_EncodeEntry(uint8_t * entry, trace_checkpoint_t const * checkpoint);
+
+/**@brief   Decode a checkpoint stored in the sidecar */
+static void TraceIndex_DecodeEntry(trace_checkpoint_t * checkpoint, uint8_t const * entry);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+trace_index_t TraceIndex_Create(char const * dir, char const * trace_file, uint32_t interval)
+{
+    if (interval == 0) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    trace_index_t index = (trace_index_t) calloc(1, sizeof(*index));
+    if (index == NULL) {
+        return NULL;
+    }
+    index->interval = interval;
+
+    if (dir == NULL || trace_file == NULL || !TraceIndex_Identify(index, trace_file)) {
+        return index;
+    }
+
+    uint64_t hash = 0;
+    uint32_t i;
+    for (i = 0; i < N_IDENTITY; i++) {
+        hash = ((hash << 31) | (hash >> 33)) ^ index->identity[i];
+        hash *= TRACE_INDEX_HASH_PRIME;
+    }
+
+    int length = snprintf(index->path, sizeof(index->path), "%s/%016" PRIx64 ".idx", dir, hash);
+    if (length < 0 || (size_t) length >= sizeof(index->path)) {
+        return index;
+    }
+
+    index->checkpoints = (trace_checkpoint_t *) calloc(INITIAL_CHECKPOINTS,
+                                                       sizeof(trace_checkpoint_t));
+    if (index->checkpoints == NULL) {
+        TraceIndex_Destroy(index);
+        return NULL;
+    }
+    index->max_checkpoints = INITIAL_CHECKPOINTS;
+
+    // The start of the trace is always a checkpoint
+    index->n_checkpoints = 1;
+    index->dir           = dir;
+    index->active        = true;
+
+    TraceIndex_Load(index);
+
+    return index;
+}
+
+void TraceIndex_Destroy(trace_index_t index)
+{
+    if (index) {
+        free(index->checkpoints);
+        free(index);
+    }
+}
+
+bool TraceIndex_Active(trace_index_t index)
+{
+    return index->active;
+}
+
+uint64_t TraceIndex_Checkpoints(trace_index_t index)
+{
+    return index->n_checkpoints;
+}
+
+void TraceIndex_Seek(trace_index_t index, uint64_t record, trace_checkpoint_t * checkpoint)
+{
+    if (!index->active) {
+        memset(checkpoint, 0, sizeof(*checkpoint));
+        return;
+    }
+
+    uint64_t k = record / index->interval;
+    if (k >= index->n_checkpoints) {
+        k = index->n_checkpoints - 1;
+    }
+
+    index->position = index->checkpoints[k];
+    *checkpoint     = index->position;
+}
+
+uint32_t TraceIndex_Limit(trace_index_t index, uint32_t max_accesses)
+{
+    if (!index->active) {
+        return max_accesses;
+    }
+
+    uint64_t next = index->n_checkpoints * index->interval;
+    if (next - index->position.record < max_accesses) {
+        return next - index->position.record;
+    }
+    return max_accesses;
+}
+
+void TraceIndex_Record(trace_index_t index,
+                       access_t const * accesses,
+                       uint32_t n_accesses,
+                       uint64_t offset)
+{
+    if (!index->active) {
+        return;
+    }
+
+    trace_checkpoint_t * position = &(index->position);
+
+    uint32_t i;
+    for (i = 0; i < n_accesses; i++) {
+        // Split the same way as the simulator's L1 bus
+        access_t aligned;
+        Access_Align(&aligned, &accesses[i], 4);
+        uint64_t n_aligned = aligned.n_bytes >> 2;
+
+        switch (accesses[i].type) {
+            case TYPE_READ:
+                position->read_count++;
+                position->read_count_aligned += n_aligned;
+                break;
+            case TYPE_WRITE:
+                position->write_count++;
+                position->write_count_aligned += n_aligned;
+                break;
+            case TYPE_INSTR:
+                position->instr_count++;
+                position->instr_count_aligned += n_aligned;
+                break;
+        }
+    }
+    position->record += n_accesses;
+
+    if (position->record == index->n_checkpoints * index->interval) {
+        position->offset = offset;
+        if (!TraceIndex_Append(index, position)) {
+            // Without room for the checkpoint, nothing past it can be indexed
+            index->active = false;
+        }
+    }
+}
+
+bool TraceIndex_Save(trace_index_t index)
+{
+    if (index->n_checkpoints == index->n_saved) {
+        return true;
+    }
+
+    if (mkdir(index->dir, 0777) != 0 && errno != EEXIST) {
+        return false;
+    }
+
+    // Written in full to a copy of its own, so concurrent runs don't collide
+    char partial_path[TRACE_INDEX_PATH_LEN + 32];
+    snprintf(partial_path, sizeof(partial_path), "%s.%ld.partial", index->path, (long) getpid());
+
+    FILE * file = fopen(partial_path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    uint8_t header[TRACE_INDEX_HEADER_SIZE];
+    memcpy(&header[0], TRACE_INDEX_MAGIC, 8);
+    PutLE32(&header[8], TRACE_INDEX_VERSION);
+    PutLE32(&header[12], index->interval);
+    uint32_t i;
+    for (i = 0; i < N_IDENTITY; i++) {
+        PutLE64(&header[16 + 8 * i], index->identity[i]);
+    }
+    PutLE64(&header[56], index->n_checkpoints);
+    bool ok = fwrite(header, sizeof(header), 1, file) == 1;
+
+    uint64_t k;
+    for (k = 0; ok && k < index->n_checkpoints; k++) {
+        uint8_t entry[TRACE_INDEX_ENTRY_SIZE];
+        TraceIndex_EncodeEntry(entry, &index->checkpoints[k]);
+        ok = fwrite(entry, sizeof(entry), 1, file) == 1;
+    }
+
+    ok = fclose(file) == 0 && ok;
+    if (!ok || rename(partial_path, index->path) != 0) {
+        unlink(partial_path);
+        return false;
+    }
+
+    index->n_saved = index->n_checkpoints;
+    return true;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static bool TraceIndex_Identify(trace_index_t index, char const * trace_file)
+{
+    int fd = open(trace_file, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    bool indexable = fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0;
+
+    // Binary and block traces can already be seeked directly, and delta
+    // traces have no lines to seek to
+    char magic[8];
+    if (indexable &&
+        pread(fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+        (memcmp(magic, BINARY_TRACE_MAGIC, 8) == 0 ||
+         memcmp(magic, BLOCK_TRACE_MAGIC, 8) == 0 ||
+         memcmp(magic, DELTA_TRACE_MAGIC, 8) == 0)) {
+        indexable = false;
+    }
+    close(fd);
+
+    if (indexable) {
+        index->identity[0] = st.st_size;
+        index->identity[1] = st.st_mtim.tv_sec;
+        index->identity[2] = st.st_mtim.tv_nsec;
+        index->identity[3] = st.st_dev;
+        index->identity[4] = st.st_ino;
+    }
+
+    return indexable;
+}
+
+static void TraceIndex_Load(trace_index_t index)
+{
+    FILE * file = fopen(index->path, "rb");
+    if (file == NULL) {
+        return;
+    }
+
+    uint8_t header[TRACE_INDEX_HEADER_SIZE];
+    bool valid = fread(header, sizeof(header), 1, file) == 1 &&
+                 memcmp(&header[0], TRACE_INDEX_MAGIC, 8) == 0 &&
+                 GetLE32(&header[8]) == TRACE_INDEX_VERSION &&
+                 GetLE32(&header[12]) == index->interval;
+
+    uint32_t i;
+    for (i = 0; valid && i < N_IDENTITY; i++) {
+        valid = GetLE64(&header[16 + 8 * i]) == index->identity[i];
+    }
+
+    // Anything short of a valid checkpoint ends the index. The first
+    // checkpoint is the start of the trace, so is already known
+    uint64_t n_checkpoints = valid ? GetLE64(&header[56]) : 0;
+    uint64_t k;
+    for (k = 0; k < n_checkpoints; k++) {
+        uint8_t entry[TRACE_INDEX_ENTRY_SIZE];
+        if (fread(entry, sizeof(entry), 1, file) != 1) {
+            break;
+        }
+
+        trace_checkpoint_t checkpoint;
+        TraceIndex_DecodeEntry(&checkpoint, entry);
+        checkpoint.record = k * index->interval;
+        if (k > 0 && !TraceIndex_Append(index, &checkpoint)) {
+            break;
+        }
+    }
+
+    fclose(file);
+    index->n_saved = index->n_checkpoints;
+}
+
+static bool TraceIndex_Append(trace_index_t index, trace_checkpoint_t const * checkpoint)
+{
+    if (index->n_checkpoints == index->max_checkpoints) {
+        uint64_t max_checkpoints = 2 * index->max_checkpoints;
+        trace_checkpoint_t * checkpoints = (trace_checkpoint_t *)
+            realloc(index->checkpoints, max_checkpoints * sizeof(trace_checkpoint_t));
+        if (checkpoints == NULL) {
+            return false;
+        }
+        index->checkpoints     = checkpoints;
+        index->max_checkpoints = max_checkpoints;
+    }
+
+    index->checkpoints[index->n_checkpoints] = *checkpoint;
+    index->n_checkpoints++;
+    return true;
+}
+
+static void TraceIndex_EncodeEntry(uint8_t * entry, trace_checkpoint_t const * checkpoint)
+{
+    PutLE64(&entry[0],  checkpoint->offset);
+    PutLE64(&entry[8],  checkpoint->read_count);
+    PutLE64(&entry[16], checkpoint->read_count_aligned);
+    PutLE64(&entry[24], checkpoint->write_count);
+    PutLE64(&entry[32], checkpoint->write_count_aligned);
+    PutLE64(&entry[40], checkpoint->instr_count);
+    PutLE64(&entry[48], checkpoint->instr_count_aligned);
+}
+
+static void TraceIndex_DecodeEntry(trace_checkpoint_t * checkpoint, uint8_t const * entry)
+{
+    checkpoint->offset              = GetLE64(&entry[0]);
+    checkpoint->read_count          = GetLE64(&entry[8]);
+    checkpoint->read_count_aligned  = GetLE64(&entry[16]);
+    checkpoint->write_count         = GetLE64(&entry[24]);
+    checkpoint->write_count_aligned = GetLE64(&entry[32]);
+    checkpoint->instr_count         = GetLE64(&entry[40]);
+    checkpoint->instr_count_aligned = GetLE64(&entry[48]);
+}
+
+/** @} addtogroup TRACEINDEX */
@@ -0,0 +1,877 @@
+/**
+ * @file    TraceReader.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TraceReader Source
+ *
+ * @addtogroup TRACEREADER
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for madvise() and pread()
+#define _DEFAULT_SOURCE
+
+#include "TraceReader.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockStream.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "GzipStream.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Size of the block used for traces that can't be mapped [bytes] */
+#define TRACE_BLOCK_SIZE        (1 << 20)
+
+/**@brief   How far the cursor must advance through a mapped trace before the
+ *          pages behind it are released [bytes]
+ */
+#define TRACE_RELEASE_SIZE      (16 << 20)
+
+/**@brief   Longest partial line that can be carried between decompressed
+ *          blocks [bytes]
+ */
+#define TRACE_CARRY_SIZE        (64 << 10)
+
+/**@brief   Number of accesses discarded at once when skipping through a trace
+ *          that can't be seeked
+ */
+#define TRACE_SKIP_BATCH_LEN    (4096)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   The internals of a trace reader
+ *
+ * @note    Whether the trace is mapped or read in blocks, the bytes available
+ *          for parsing are described by a single window (@p data, @p length).
+ *          A mapped trace's window is the entire file, and is final from the
+ *          start. A compressed trace's window is a decompressed block.
+ *          The window of a block trace holds whole records only. A delta
+ *          trace's window holds its chunks, which are decoded one at a time.
+ */
+struct _trace_reader_t {
+    char const * name;          /**< The trace's name, for error messages */
+    bool binary;                /**< Whether the trace is a binary trace */
+    int fd;                     /**< The trace's file descriptor */
+    bool owns_fd;               /**< Whether @p fd should be closed */
+
+    char * map;                 /**< The mapped trace, or NULL */
+    size_t map_length;          /**< Length of @p map [bytes] */
+    size_t released;            /**< Bytes of @p map that have been released */
+
+    char * block;               /**< Block buffer for unmapped traces, or
+                                     NULL */
+    size_t block_size;          /**< Size of @p block [bytes] */
+
+    gzip_stream_t gzip;         /**< Decompressor for gzip traces, or NULL */
+    block_stream_t blocks;      /**< Decompressor for block traces, or NULL */
+    delta_trace_decoder_t delta;    /**< Decoder for delta traces, or NULL */
+
+    access_t * scratch;         /**< Accesses wrapped as runs by @ref
+                                     TraceReader_ReadRuns, or NULL */
+    uint32_t scratch_len;       /**< Accesses @p scratch has space for */
+
+    char const * data;          /**< Start of the window */
+    size_t length;              /**< Length of the window [bytes] */
+    size_t offset;              /**< Parsing cursor within the window */
+    bool final;                 /**< Whether the window ends the trace */
+    uint64_t consumed;          /**< Bytes of the (uncompressed) trace before
+                                     the window */
+
+    uint64_t line_no;           /**< Text line (or binary record) number of
+                                     the next access */
+    uint64_t n_records;         /**< Record count from a binary header */
+};
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Whether @p reader's file is gzip-compressed
+ *
+ * @note    Only regular files are checked, since the check must not consume
+ *          anything
+ */
+static bool TraceReader_IsGzip(trace_reader_t reader);
+
+/**@brief   Map @p reader's file, if it's a regular file
+ *
+ * @return  Whether the file was mapped
+ */
+static bool TraceReader_Map(trace_reader_t reader);
+
+/**@brief   Advance the window of a trace that isn't mapped */
+static void TraceReader_Fill(trace_reader_t reader);
+
+/**@brief   Read more of an unmapped trace into the block buffer
+ *
+ * Bytes not yet consumed are moved to the beginning of the block first
+ */
+static void TraceReader_FillBlock(trace_reader_t reader);
+
+/**@brief   Start decompressing a block trace at @p record
+ *
+ * Pick up from the start of the block holding it
+ */
+static void TraceReader_StartBlocks(trace_reader_t reader, uint64_t record);
+
+/**@brief   Move to the next decompressed block of a block trace */
+static void TraceReader_FillBlocks(trace_reader_t reader);
+
+/**@brief   Move to the next decompressed block of a gzip trace
+ *
+ * Bytes not yet consumed are carried to the beginning of the new block
+ */
+static void TraceReader_FillGzip(trace_reader_t reader);
+
+/**@brief   Give back pages of a mapped trace that have been parsed */
+static void TraceReader_Release(trace_reader_t reader);
+
+/**@brief   Read and validate a binary trace's header */
+static void TraceReader_ReadHeader(trace_reader_t reader);
+
+/**@brief   Fill the window until it holds at least @p length bytes, or the
+ *          trace ends
+ *
+ * @return  Whether the window holds @p length bytes
+ */
+static bool TraceReader_Peek(trace_reader_t reader, size_t length);
+
+/**@brief   Whether the trace starts with a delta trace's header
+ *
+ * @note    Read through the window rather than the file, so that delta traces
+ *          are recognized on pipes too
+ */
+static bool TraceReader_IsDelta(trace_reader_t reader);
+
+/**@brief   Check a delta trace's header, and start decoding its chunks */
+static void TraceReader_StartDelta(trace_reader_t reader);
+
+/**@brief   Decode the next chunk of a delta trace, if the window holds it
+ *
+ * @return  Whether a chunk was decoded
+ */
+static bool TraceReader_NextChunk(trace_reader_t reader);
+
+/**@brief   Parse as many text accesses as the window holds */
+static uint32_t TraceReader_DecodeText(trace_reader_t reader,
+                                       access_t * accesses,
+                                       uint32_t max_accesses);
+
+/**@brief   Decode as many binary accesses as the window holds */
+static uint32_t TraceReader_DecodeBinary(trace_reader_t reader,
+                                         access_t * accesses,
+                                         uint32_t max_accesses);
+
+/**@brief   Decode the next @p n_accesses records of the window, which holds
+ *          at least that many
+ *
+ * @throws INVALID_OPERATION    As @ref BinaryTrace_DecodeAccess() does,
+ *                              located at the record in the trace
+ * @throws INVALID_ACCESS_SIZE  Likewise
+ */
+static void TraceReader_DecodeRecords(trace_reader_t reader,
+                                      access_t * accesses,
+                                      uint32_t n_accesses);
+
+/**@brief   Decode as many delta trace accesses as the window holds */
+static uint32_t TraceReader_DecodeDelta(trace_reader_t reader,
+                                        access_t * accesses,
+                                        uint32_t max_accesses);
+
+/**@brief   Decode the runs left in the current chunk of a delta trace, or
+ *          the next chunk if the window holds it
+ */
+static uint32_t TraceReader_DecodeDeltaRuns(trace_reader_t reader,
+                                            access_run_t * runs,
+                                            uint32_t max_runs);
+
+/**@brief   Whether nothing more can be read from the trace */
+static bool TraceReader_Ended(trace_reader_t reader);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+trace_reader_t TraceReader_Create(char const * path, bool binary)
+{
+    int fd = STDIN_FILENO;
+    if (path != NULL) {
+        fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+    }
+
+    trace_reader_t reader = (trace_reader_t) malloc(sizeof(*reader));
+    if (reader == NULL) {
+        if (path != NULL) close(fd);
+        return NULL;
+    }
+
+    reader->name        = path != NULL ? path : "stdin";
+    reader->binary      = binary;
+    reader->fd          = fd;
+    reader->owns_fd     = path != NULL;
+    reader->map         = NULL;
+    reader->map_length  = 0;
+    reader->released    = 0;
+    reader->block       = NULL;
+    reader->block_size  = 0;
+    reader->gzip        = NULL;
+    reader->blocks      = NULL;
+    reader->delta       = NULL;
+    reader->scratch     = NULL;
+    reader->scratch_len = 0;
+    reader->data        = NULL;
+    reader->length      = 0;
+    reader->offset      = 0;
+    reader->final       = false;
+    reader->consumed    = 0;
+    reader->line_no     = 1;
+    reader->n_records   = BINARY_TRACE_UNKNOWN_LENGTH;
+
+    if (BlockTrace_IsBlockTrace(reader->fd)) {
+        // Block traces are always binary, and have no leading header
+        reader->binary = true;
+
+        CEXCEPTION_T e;
+        Try {
+            TraceReader_StartBlocks(reader, 0);
+        }
+        Catch (e) {
+            TraceReader_Destroy(reader);
+            Throw(e);
+        }
+        if (reader->blocks == NULL) {
+            TraceReader_Destroy(reader);
+            return NULL;
+        }
+    }
+    else if (TraceReader_IsGzip(reader)) {
+        CEXCEPTION_T e;
+        Try {
+            reader->gzip = GzipStream_Create(reader->fd, TRACE_CARRY_SIZE);
+        }
+        Catch (e) {
+            TraceReader_Destroy(reader);
+            ThrowWithLocationInfo(e, reader->name, 0);
+        }
+        if (reader->gzip == NULL) {
+            TraceReader_Destroy(reader);
+            return NULL;
+        }
+    }
+    else if (!TraceReader_Map(reader)) {
+        reader->block = (char *) malloc(TRACE_BLOCK_SIZE);
+        if (reader->block == NULL) {
+            TraceReader_Destroy(reader);
+            return NULL;
+        }
+        reader->block_size = TRACE_BLOCK_SIZE;
+        reader->data = reader->block;
+    }
+
+    if (reader->gzip == NULL && reader->blocks == NULL) {
+        // Delta traces are always binary, and recognized whatever the caller
+        // said
+        volatile bool is_delta = false;
+        CEXCEPTION_T e;
+        Try {
+            is_delta = TraceReader_IsDelta(reader);
+            if (is_delta) {
+                TraceReader_StartDelta(reader);
+            }
+        }
+        Catch (e) {
+            TraceReader_Destroy(reader);
+            Throw(e);
+        }
+        if (is_delta && reader->delta == NULL) {
+            TraceReader_Destroy(reader);
+            return NULL;
+        }
+    }
+
+    if (binary && reader->blocks == NULL && reader->delta == NULL) {
+        CEXCEPTION_T e;
+        Try {
+            TraceReader_ReadHeader(reader);
+        }
+        Catch (e) {
+            TraceReader_Destroy(reader);
+            Throw(e);
+        }
+    }
+
+    return reader;
+}
+
+void TraceReader_Destroy(trace_reader_t reader)
+{
+    if (reader) {
+        if (reader->map) {
+            munmap(reader->map, reader->map_length);
+        }
+        if (reader->block) {
+            free(reader->block);
+        }
+        GzipStream_Destroy(reader->gzip);
+        BlockStream_Destroy(reader->blocks);
+        DeltaTrace_DestroyDecoder(reader->delta);
+        free(reader->scratch);
+        if (reader->owns_fd) {
+            close(reader->fd);
+        }
+        free(reader);
+    }
+}
+
+uint32_t TraceReader_Read(trace_reader_t reader,
+                          access_t * accesses,
+                          uint32_t max_accesses)
+{
+    uint32_t n_read = 0;
+    while (n_read < max_accesses) {
+        if (reader->delta) {
+            n_read += TraceReader_DecodeDelta(reader,
+                                              accesses + n_read,
+                                              max_accesses - n_read);
+        }
+        else if (reader->binary) {
+            n_read += TraceReader_DecodeBinary(reader,
+                                               accesses + n_read,
+                                               max_accesses - n_read);
+        }
+        else {
+            n_read += TraceReader_DecodeText(reader,
+                                             accesses + n_read,
+                                             max_accesses - n_read);
+        }
+
+        if (n_read == max_accesses || TraceReader_Ended(reader)) {
+            break;
+        }
+        TraceReader_Fill(reader);
+    }
+
+    if (reader->map) {
+        TraceReader_Release(reader);
+    }
+
+    if (reader->delta) {
+        // The trace must run up to its end chunk
+        if (n_read < max_accesses && !DeltaTrace_Ended(reader->delta)) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, reader->line_no - 1);
+        }
+    }
+    else if (reader->binary && reader->final && n_read < max_accesses) {
+        // A partial record, or fewer records than the header promised, means
+        // the trace was truncated
+        uint64_t n_decoded = reader->line_no - 1;
+        if (reader->offset != reader->length ||
+            (reader->n_records != BINARY_TRACE_UNKNOWN_LENGTH &&
+             reader->n_records != n_decoded)) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, n_decoded);
+        }
+    }
+
+    return n_read;
+}
+
+uint64_t TraceReader_Skip(trace_reader_t reader, uint64_t n_accesses)
+{
+    if (reader->blocks) {
+        // Only the blocks from the new position onwards are decompressed
+        uint64_t record   = reader->line_no - 1;
+        uint64_t n_remain = reader->n_records - record;
+        if (n_accesses > n_remain) {
+            n_accesses = n_remain;
+        }
+        record += n_accesses;
+
+        BlockStream_Destroy(reader->blocks);
+        reader->blocks = NULL;
+        TraceReader_StartBlocks(reader, record);
+        if (reader->blocks == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        reader->line_no = record + 1;
+
+        return n_accesses;
+    }
+
+    if (reader->binary && reader->map && reader->delta == NULL) {
+        // Records in a mapped trace are a fixed width, so can be stepped over
+        size_t n_available = (reader->length - reader->offset) / BINARY_TRACE_RECORD_SIZE;
+        if (n_accesses > n_available) {
+            n_accesses = n_available;
+        }
+        reader->offset  += n_accesses * BINARY_TRACE_RECORD_SIZE;
+        reader->line_no += n_accesses;
+
+        return n_accesses;
+    }
+
+    static access_t discarded[TRACE_SKIP_BATCH_LEN];
+
+    uint64_t n_skipped = 0;
+    while (n_skipped < n_accesses) {
+        uint32_t n_wanted = TRACE_SKIP_BATCH_LEN;
+        if (n_accesses - n_skipped < n_wanted) {
+            n_wanted = n_accesses - n_skipped;
+        }
+
+        uint32_t n_read = TraceReader_Read(reader, discarded, n_wanted);
+        n_skipped += n_read;
+        if (n_read < n_wanted) {
+            break;
+        }
+    }
+
+    return n_skipped;
+}
+
+uint32_t TraceReader_ReadRuns(trace_reader_t reader,
+                              access_run_t * runs,
+                              uint32_t max_runs)
+{
+    if (reader->delta == NULL) {
+        // Every access is a run of its own
+        if (max_runs > reader->scratch_len) {
+            access_t * scratch = (access_t *) realloc(reader->scratch,
+                                                      max_runs * sizeof(access_t));
+            if (scratch == NULL) {
+                ThrowHere(ALLOCATION_FAILURE);
+            }
+            reader->scratch     = scratch;
+            reader->scratch_len = max_runs;
+        }
+
+        uint32_t n_read = TraceReader_Read(reader, reader->scratch, max_runs);
+        uint32_t i;
+        for (i = 0; i < n_read; i++) {
+            runs[i].type       = reader->scratch[i].type;
+            runs[i].address    = reader->scratch[i].address;
+            runs[i].n_bytes    = reader->scratch[i].n_bytes;
+            runs[i].n_accesses = 1;
+            runs[i].sizes      = &(reader->scratch[i].n_bytes);
+        }
+
+        return n_read;
+    }
+
+    // Runs point into the decoded chunk, so are only ever taken from one
+    uint32_t n_read = 0;
+    while (max_runs > 0) {
+        n_read = TraceReader_DecodeDeltaRuns(reader, runs, max_runs);
+
+        if (n_read > 0 || TraceReader_Ended(reader)) {
+            break;
+        }
+        TraceReader_Fill(reader);
+    }
+
+    if (reader->map) {
+        TraceReader_Release(reader);
+    }
+
+    if (n_read == 0 && max_runs > 0 && !DeltaTrace_Ended(reader->delta)) {
+        ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, reader->line_no - 1);
+    }
+
+    return n_read;
+}
+
+uint64_t TraceReader_Offset(trace_reader_t reader)
+{
+    return reader->consumed + reader->offset;
+}
+
+void TraceReader_Seek(trace_reader_t reader, uint64_t offset, uint64_t record)
+{
+    if (reader->binary || offset < TraceReader_Offset(reader)) {
+        ThrowHere(ARGUMENT_ERROR);
+    }
+
+    // Only a mapped trace can be moved through directly. Anything else is
+    // read (and decompressed) up to the offset, but not parsed
+    while (offset - reader->consumed > reader->length) {
+        if (reader->final) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, reader->line_no);
+        }
+        reader->offset = reader->length;
+        TraceReader_Fill(reader);
+    }
+
+    reader->offset  = offset - reader->consumed;
+    reader->line_no = record + 1;
+
+    if (reader->map) {
+        TraceReader_Release(reader);
+    }
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static bool TraceReader_IsGzip(trace_reader_t reader)
+{
+    struct stat st;
+    if (fstat(reader->fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        return false;
+    }
+
+    char magic[2];
+    return pread(reader->fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+           memcmp(magic, GZIP_STREAM_MAGIC, sizeof(magic)) == 0;
+}
+
+static bool TraceReader_Map(trace_reader_t reader)
+{
+    struct stat st;
+    if (fstat(reader->fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        return false;
+    }
+
+    void * map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, reader->fd, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    // The whole trace will be read exactly once, front to back
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    reader->map        = (char *) map;
+    reader->map_length = st.st_size;
+    reader->data       = reader->map;
+    reader->length     = reader->map_length;
+    reader->final      = true;
+
+    return true;
+}
+
+static void TraceReader_Fill(trace_reader_t reader)
+{
+    if (reader->gzip) {
+        TraceReader_FillGzip(reader);
+    }
+    else if (reader->blocks) {
+        TraceReader_FillBlocks(reader);
+    }
+    else {
+        TraceReader_FillBlock(reader);
+    }
+}
+
+static void TraceReader_FillBlock(trace_reader_t reader)
+{
+    size_t n_carried = reader->length - reader->offset;
+    if (n_carried == reader->block_size) {
+        if (reader->delta == NULL) {
+            // A single line filled the whole block
+            ThrowWithLocationInfo(SYNTAX_ERROR, reader->name, reader->line_no);
+        }
+
+        // Delta trace chunks aren't bounded in size, so the block grows to
+        // fit them
+        char * block = (char *) realloc(reader->block, 2 * reader->block_size);
+        if (block == NULL) {
+            ThrowWithLocationInfo(ALLOCATION_FAILURE, reader->name, reader->line_no);
+        }
+        reader->block      = block;
+        reader->block_size = 2 * reader->block_size;
+    }
+    memmove(reader->block, reader->block + reader->offset, n_carried);
+    reader->data = reader->block;
+    reader->consumed += reader->offset;
+    reader->offset = 0;
+    reader->length = n_carried;
+
+    while (reader->length < reader->block_size) {
+        ssize_t n_read = read(reader->fd,
+                              reader->block + reader->length,
+                              reader->block_size - reader->length);
+        if (n_read < 0) {
+            ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, reader->line_no);
+        }
+        if (n_read == 0) {
+            reader->final = true;
+            break;
+        }
+        reader->length += n_read;
+    }
+}
+
+static void TraceReader_StartBlocks(trace_reader_t reader, uint64_t record)
+{
+    CEXCEPTION_T e;
+    Try {
+        reader->blocks = BlockStream_Create(reader->fd, record, 0);
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, 0);
+    }
+
+    if (reader->blocks) {
+        reader->n_records = BlockStream_Records(reader->blocks);
+    }
+    reader->data   = NULL;
+    reader->length = 0;
+    reader->offset = 0;
+    reader->final  = false;
+}
+
+static void TraceReader_FillBlocks(trace_reader_t reader)
+{
+    if (reader->offset != reader->length) {
+        // Blocks only ever hold whole records
+        ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, reader->line_no);
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        reader->data = BlockStream_Next(reader->blocks,
+                                        &(reader->length),
+                                        &(reader->final));
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, reader->line_no);
+    }
+    reader->offset = 0;
+}
+
+static void TraceReader_FillGzip(trace_reader_t reader)
+{
+    size_t n_carried = reader->length - reader->offset;
+    if (n_carried > TRACE_CARRY_SIZE) {
+        // A single line is longer than any trace line could sensibly be
+        ThrowWithLocationInfo(SYNTAX_ERROR, reader->name, reader->line_no);
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        reader->data = GzipStream_Next(reader->gzip,
+                                       reader->data + reader->offset,
+                                       n_carried,
+                                       &(reader->length),
+                                       &(reader->final));
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, reader->line_no);
+    }
+    reader->consumed += reader->offset;
+    reader->offset = 0;
+}
+
+static void TraceReader_Release(trace_reader_t reader)
+{
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    size_t consumed = reader->offset & ~(page_size - 1);
+
+    if (consumed - reader->released >= TRACE_RELEASE_SIZE) {
+        // Drops this process' mapping of the pages only -- they stay in the
+        // page cache for the next run over the same trace
+        madvise(reader->map + reader->released,
+                consumed - reader->released,
+                MADV_DONTNEED);
+        reader->released = consumed;
+    }
+}
+
+static void TraceReader_ReadHeader(trace_reader_t reader)
+{
+    if (!TraceReader_Peek(reader, BINARY_TRACE_HEADER_SIZE)) {
+        ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, 0);
+    }
+
+    binary_trace_header_t header;
+    CEXCEPTION_T e;
+    Try {
+        BinaryTrace_DecodeHeader(&header, (uint8_t const *) reader->data);
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, 0);
+    }
+
+    reader->n_records = header.n_records;
+    reader->offset    = BINARY_TRACE_HEADER_SIZE;
+}
+
+static bool TraceReader_Peek(trace_reader_t reader, size_t length)
+{
+    while (reader->length < length && !reader->final) {
+        TraceReader_Fill(reader);
+    }
+
+    return reader->length >= length;
+}
+
+static bool TraceReader_IsDelta(trace_reader_t reader)
+{
+    size_t magic_length = strlen(DELTA_TRACE_MAGIC);
+
+    return TraceReader_Peek(reader, magic_length) &&
+           memcmp(reader->data, DELTA_TRACE_MAGIC, magic_length) == 0;
+}
+
+static void TraceReader_StartDelta(trace_reader_t reader)
+{
+    if (!TraceReader_Peek(reader, DELTA_TRACE_HEADER_SIZE)) {
+        ThrowWithLocationInfo(BAD_TRACE_FILE, reader->name, 0);
+    }
+
+    CEXCEPTION_T e;
+    Try {
+        DeltaTrace_CheckHeader((uint8_t const *) reader->data);
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, 0);
+    }
+
+    reader->binary = true;
+    reader->delta  = DeltaTrace_CreateDecoder();
+    reader->offset = DELTA_TRACE_HEADER_SIZE;
+}
+
+static bool TraceReader_NextChunk(trace_reader_t reader)
+{
+    if (DeltaTrace_Ended(reader->delta)) {
+        return false;
+    }
+
+    size_t length = 0;
+    CEXCEPTION_T e;
+    Try {
+        length = DeltaTrace_DecodeChunk(reader->delta,
+                                        (uint8_t const *) reader->data + reader->offset,
+                                        reader->length - reader->offset);
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, reader->line_no);
+    }
+    reader->offset += length;
+
+    return length > 0;
+}
+
+static uint32_t TraceReader_DecodeText(trace_reader_t reader,
+                                       access_t * accesses,
+                                       uint32_t max_accesses)
+{
+    uint32_t n_accesses = 0;
+
+    CEXCEPTION_T e;
+    Try {
+        reader->offset += Access_ParseBuffer(reader->data + reader->offset,
+                                             reader->length - reader->offset,
+                                             reader->final,
+                                             accesses,
+                                             max_accesses,
+                                             &n_accesses,
+                                             &(reader->line_no));
+    }
+    Catch (e) {
+        // Manually set file/line number info for the trace
+        ThrowWithLocationInfo(e, reader->name, reader->line_no);
+    }
+
+    return n_accesses;
+}
+
+static uint32_t TraceReader_DecodeBinary(trace_reader_t reader,
+                                         access_t * accesses,
+                                         uint32_t max_accesses)
+{
+    size_t n_available = (reader->length - reader->offset) /
+                         BINARY_TRACE_RECORD_SIZE;
+    uint32_t n_accesses = max_accesses;
+    if (n_available < n_accesses) {
+        n_accesses = n_available;
+    }
+
+    TraceReader_DecodeRecords(reader, accesses, n_accesses);
+
+    return n_accesses;
+}
+
+static void TraceReader_DecodeRecords(trace_reader_t reader,
+                                      access_t * accesses,
+                                      uint32_t n_accesses)
+{
+    uint8_t const * records = (uint8_t const *) (reader->data + reader->offset);
+
+    CEXCEPTION_T e;
+    Try {
+        uint32_t i;
+        for (i = 0; i < n_accesses; i++) {
+            BinaryTrace_DecodeAccess(&accesses[i],
+                                     &records[i * BINARY_TRACE_RECORD_SIZE]);
+            reader->line_no += 1;
+        }
+    }
+    Catch (e) {
+        ThrowWithLocationInfo(e, reader->name, reader->line_no);
+    }
+
+    reader->offset += n_accesses * BINARY_TRACE_RECORD_SIZE;
+}
+
+static uint32_t TraceReader_DecodeDelta(trace_reader_t reader,
+                                        access_t * accesses,
+                                        uint32_t max_accesses)
+{
+    uint32_t n_accesses = 0;
+    while (n_accesses < max_accesses) {
+        uint32_t n_decoded = DeltaTrace_ReadAccesses(reader->delta,
+                                                     accesses + n_accesses,
+                                                     max_accesses - n_accesses);
+        n_accesses      += n_decoded;
+        reader->line_no += n_decoded;
+
+        if (n_decoded == 0 && !TraceReader_NextChunk(reader)) {
+            break;
+        }
+    }
+
+    return n_accesses;
+}
+
+static uint32_t TraceReader_DecodeDeltaRuns(trace_reader_t reader,
+                                            access_run_t * runs,
+                                            uint32_t max_runs)
+{
+    uint32_t n_runs = DeltaTrace_ReadRuns(reader->delta, runs, max_runs);
+    while (n_runs == 0 && TraceReader_NextChunk(reader)) {
+        n_runs = DeltaTrace_ReadRuns(reader->delta, runs, max_runs);
+    }
+
+    uint32_t i;
+    for (i = 0; i < n_runs; i++) {
+        reader->line_no += runs[i].n_accesses;
+    }
+
+    return n_runs;
+}
+
+static bool TraceReader_Ended(trace_reader_t reader)
+{
+    return reader->final || (reader->delta != NULL && DeltaTrace_Ended(reader->delta));
+}
+
+/** @} addtogroup TRACEREADER */
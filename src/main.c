@@ -9,23 +9,34 @@
 
 /* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
 
+// Required for sysconf()
+#define _DEFAULT_SOURCE
+
 #include "Access.h"
+#include "AccessRing.h"
 #include "CException.h"
 #include "CExceptionConfig.h"
 #include "Config.h"
 #include "ExceptionTypes.h"
 #include "L1Cache.h"
 #include "L2Cache.h"
+#include "L2Stream.h"
 #include "MainMem.h"
+#include "StackDistance.h"
 #include "Statistics.h"
+#include "TraceCache.h"
+#include "TraceIndex.h"
+#include "TraceReader.h"
 #include "Util.h"
 
 #include <inttypes.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 /* --- PRIVATE DATATYPES ---------------------------------------------------- */
 
@@ -37,6 +48,41 @@ typedef struct {
     l1_cache_t l1d_cache;        /**< L1d -> L2 */
 } memory_t;
 
+/**@brief   Counters for every level of a hierarchy, each counting that
+ *          level's lookups in other caches, if sweeping
+ */
+typedef struct {
+    stack_distance_t l1i;
+    stack_distance_t l1d;
+    stack_distance_t l2;
+} sweep_t;
+
+/**@brief   One configuration being simulated, with the hierarchy it
+ *          describes and the statistics gathered on it
+ */
+typedef struct {
+    char const * config_file;    /**< Where the configuration was read from, or NULL */
+    config_t config;
+    stats_t stats;
+    memory_t mem;
+    sweep_t sizes;               /**< Every size, at each level's ways */
+    sweep_t ways;                /**< Every associativity, at each level's size */
+} simulation_t;
+
+/**@brief   A thread simulating some of the configurations, each batch of the
+ *          trace at a time
+ */
+typedef struct {
+    pthread_t thread;
+    uint32_t index;                 /**< Consumer index in the ring. Worker zero
+                                         is the main thread */
+    simulation_t * simulations;     /**< The worker's own configurations */
+    uint32_t n_simulations;
+    unsigned int error;             /**< Exception the worker stopped with */
+    char const * error_file;        /**< File the worker's exception came from */
+    unsigned int error_line;        /**< Line the worker's exception came from */
+} worker_t;
+
 /* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
 
 /**@brief   Creates the full memory hierarchy */
@@ -45,29 +91,128 @@ static void Memory_Create(memory_t * mem, stats_t * stats, config_t * config);
 /**@brief   Tears down the memory hierarchy */
 static void Memory_Destroy(memory_t * mem);
 
+/**@brief   Have every level of a simulation's hierarchy counted at every size
+ *          around its configured one, or if @p all_ways at every
+ *          associativity of its configured size
+ */
+static void Sweep_Create(sweep_t * sweep, simulation_t * simulation, bool all_ways);
+
+/**@brief   Create a counter for the caches around one configured by
+ *          @p config: either the sizes around it, or if @p all_ways every
+ *          associativity of its size
+ */
+static stack_distance_t Sweep_CreateLevel(cache_param_t const * config, bool all_ways);
+
+/**@brief   Prints the miss rate of every cache counted, under @p title. The
+ *          L1 caches' are left out unless @p l1_simulated
+ */
+static void Sweep_Print(sweep_t const * sweep, char const * title, bool l1_simulated);
+
+/**@brief   Frees every counter of a sweep */
+static void Sweep_Destroy(sweep_t * sweep);
+
 /**@brief   Parse command-line options*/
 static void parse_args(int argc, char const * const * const argv,
-                       char const * * config_file, char const * * trace_name);
+                       char const * * config_files, uint32_t * n_config_files,
+                       char const * * trace_name, char const * * trace_file,
+                       bool * binary_trace, uint64_t * skip, uint64_t * count,
+                       char const * * cache_dir, uint32_t * n_threads,
+                       bool * sweep_sizes, bool * sweep_ways,
+                       char const * * capture_file, char const * * replay_file);
 
 /**@brief   Prints an ultra-useful usage message */
 static void usage(char const * call);
 
-/**@brief   Handle the topmost-level logic for an access */
-static uint32_t do_access(memory_t * mem, access_t const * access, uint32_t * n_aligned);
+/**@brief   Simulate every configuration on a trace, sharing the
+ *          configurations between up to @p n_threads threads
+ */
+static void simulate_all(char const * trace_file, bool binary_trace,
+                         uint64_t skip, uint64_t count,
+                         char const * cache_dir, uint32_t n_threads);
+
+/**@brief   Simulate every configuration's L2 cache and main memory on the
+ *          accesses a captured stream's L1 caches made, taking the L1 caches'
+ *          results from the stream
+ */
+static void replay_all(char const * replay_file);
+
+/**@brief   Simulate a batch of trace accesses, and record their statistics */
+static void simulate_batch(memory_t * mem,
+                           stats_t * stats,
+                           access_t const * accesses,
+                           uint32_t n_accesses);
+
+/**@brief   Read the next accesses from the trace, stopping at the next
+ *          checkpoint so that the trace's index can record it
+ */
+static uint32_t read_trace(access_t * accesses, uint32_t max_accesses);
+
+/**@brief   Skip the start of the trace, jumping to the nearest checkpoint if
+ *          the trace is indexed
+ */
+static void skip_trace(uint64_t n_accesses);
+
+/**@brief   Parse the trace into batches, on a thread of its own */
+static void * parse_trace(void * arg);
+
+/**@brief   Simulate every access in a trace on each of a worker's
+ *          configurations, as batches arrive from the parser
+ *
+ * @note    Exceptions are caught and kept in the worker, and the ring closed
+ *          so that every other thread stops too
+ */
+static void simulate_trace(worker_t * worker);
 
-/**@brief   Prints the results of a completed simulation */
+/**@brief   Entry point of every worker but the main thread */
+static void * simulate_worker(void * arg);
+
+/**@brief   Prints the results of a completed simulation. The L1 caches'
+ *          contents are left out unless @p l1_simulated
+ */
 static void print_results(memory_t * mem, char const * config_file, char const * trace_name,
-                          config_t * config, stats_t * stats);
+                          config_t * config, stats_t * stats, bool l1_simulated);
 
 /**@brief   Used to do cleanup at exit, no matter what */
 static void exit_cleanup(void);
 
 /* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Number of accesses read from the trace at once */
+#define TRACE_BATCH_LEN     (4096)
+
+/**@brief   Number of batches the parser may get ahead of the simulation */
+#define TRACE_RING_LEN      (8)
+
+/**@brief   Index of the parser thread's exception stack. Worker @p i (other
+ *          than the main thread) uses the one @p i past this
+ */
+#define PARSER_EXCEPTION_ID (1)
+
+/**@brief   Number of sizes counted above each level's configured one when
+ *          sweeping, each double the last
+ */
+#define SWEEP_DOUBLINGS     (4)
+
+/**@brief   Most workers simulating at once, one per remaining exception stack */
+#define MAX_WORKERS         (CEXCEPTION_NUM_ID - PARSER_EXCEPTION_ID)
+
 /* --- PRIVATE MACROS ------------------------------------------------------- */
 /* --- PUBLIC VARIABLES ----------------------------------------------------- */
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 
-static memory_t mem;
+static simulation_t * simulations;
+static uint32_t n_simulations;
+static worker_t workers[MAX_WORKERS];
+static uint32_t n_workers_started;
+static trace_reader_t reader;
+static trace_cache_t cache;
+static trace_index_t trace_index;
+static uint64_t n_remaining;
+static access_ring_t ring;
+static pthread_t parser;
+static bool parser_started;
+static l2_stream_writer_t capture;
+static l2_stream_reader_t replay;
 
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 
@@ -79,30 +224,94 @@ int main(int argc, char const * const * const argv)
         return 1;
     }
 
-    char const * config_file = NULL;
+    // Every other argument could be a config file, and none means the default
+    char const * * config_files = malloc((argc + 1) * sizeof(*config_files));
+    if (config_files == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    uint32_t n_config_files = 0;
     char const * trace_name = NULL;
-    parse_args(argc, argv, &config_file, &trace_name);
-
-    config_t config;
-    Config_FromFile(config_file, &config);
-
-    stats_t stats;
-    Statistics_Create(&stats);
+    char const * trace_file = NULL;
+    bool binary_trace = false;
+    uint64_t skip = 0;
+    uint64_t count = UINT64_MAX;
+    uint32_t n_threads = 0;
+    bool sweep_sizes = false;
+    bool sweep_ways = false;
+    char const * capture_file = NULL;
+    char const * replay_file = NULL;
+    char const * cache_dir = getenv(TRACE_CACHE_DIR_VARIABLE);
+    if (cache_dir == NULL || cache_dir[0] == '\0') {
+        cache_dir = TRACE_CACHE_DEFAULT_DIR;
+    }
+    parse_args(argc, argv, config_files, &n_config_files, &trace_name, &trace_file,
+               &binary_trace, &skip, &count, &cache_dir, &n_threads, &sweep_sizes,
+               &sweep_ways, &capture_file, &replay_file);
+    if (n_config_files == 0) {
+        config_files[n_config_files++] = NULL;
+    }
+    if (capture_file != NULL && (replay_file != NULL || n_config_files > 1)) {
+        printf("'--capture-l2' takes a single configuration, simulated on a trace\n\n");
+        usage(argv[0]);
+        exit(-1);
+    }
 
-    Memory_Create(&mem, &stats, &config);
+    // Each configuration gets a hierarchy of its own, all fed the same trace
+    simulations = calloc(n_config_files, sizeof(*simulations));
+    if (simulations == NULL) {
+        free(config_files);
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    n_simulations = n_config_files;
 
-    char line[128];
-    while (fgets(line, sizeof(line), stdin)) {
-        access_t access;
-        Access_ParseLine(line, &access);
+    uint32_t i;
+    for (i = 0; i < n_simulations; i++) {
+        simulation_t * simulation = &simulations[i];
+        simulation->config_file = config_files[i];
+        Config_FromFile(simulation->config_file, &(simulation->config));
+        Statistics_Create(&(simulation->stats));
+        Memory_Create(&(simulation->mem), &(simulation->stats), &(simulation->config));
+        if (sweep_sizes) {
+            Sweep_Create(&(simulation->sizes), simulation, false);
+        }
+        if (sweep_ways) {
+            Sweep_Create(&(simulation->ways), simulation, true);
+        }
+    }
+    free(config_files);
+
+    // The L1 caches' accesses to L2 can be recorded as they're simulated, and
+    // later stand in for them
+    if (capture_file != NULL) {
+        capture = L2Stream_CreateWriter(capture_file, &(simulations[0].config.l1));
+        if (capture == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        L2Cache_AttachCapture(simulations[0].mem.l2_cache, capture);
+    }
 
-        uint32_t n_aligned;
-        uint32_t access_cycles = do_access(&mem, &access, &n_aligned);
+    if (replay_file != NULL) {
+        replay_all(replay_file);
+    }
+    else {
+        simulate_all(trace_file, binary_trace, skip, count, cache_dir, n_threads);
+    }
 
-        Statistics_RecordAccess(&stats, access.type, access_cycles, n_aligned);
+    if (capture != NULL) {
+        L2Stream_Finish(capture, &(simulations[0].stats));
     }
 
-    print_results(&mem, config_file, trace_name, &config, &stats);
+    for (i = 0; i < n_simulations; i++) {
+        simulation_t * simulation = &simulations[i];
+        print_results(&(simulation->mem), simulation->config_file, trace_name,
+                      &(simulation->config), &(simulation->stats), replay == NULL);
+        if (sweep_sizes) {
+            Sweep_Print(&(simulation->sizes), "Miss rate by cache size", replay == NULL);
+        }
+        if (sweep_ways) {
+            Sweep_Print(&(simulation->ways), "Miss rate by associativity", replay == NULL);
+        }
+    }
 
     return 0;
 }
@@ -125,15 +334,74 @@ static void Memory_Destroy(memory_t * mem)
     MainMem_Destroy(mem->main_mem);
 }
 
-static void parse_args(int argc, char const * const * const argv,
-                       char const * * config_file, char const * * trace_name)
+static void Sweep_Create(sweep_t * sweep, simulation_t * simulation, bool all_ways)
 {
-    if (argc > 4) {
-        printf("Too many arguments\n\n");
-        usage(argv[0]);
-        exit(-1);
+    sweep->l1i = Sweep_CreateLevel(&(simulation->config.l1), all_ways);
+    sweep->l1d = Sweep_CreateLevel(&(simulation->config.l1), all_ways);
+    sweep->l2  = Sweep_CreateLevel(&(simulation->config.l2), all_ways);
+
+    L1Cache_AttachStackDistance(simulation->mem.l1i_cache, sweep->l1i);
+    L1Cache_AttachStackDistance(simulation->mem.l1d_cache, sweep->l1d);
+    L2Cache_AttachStackDistance(simulation->mem.l2_cache,  sweep->l2);
+}
+
+static stack_distance_t Sweep_CreateLevel(cache_param_t const * config, bool all_ways)
+{
+    stack_distance_t stack_distance;
+    if (all_ways) {
+        stack_distance = StackDistance_CreateAllWays(config->block_size_bytes,
+                                                     config->cache_size_bytes);
+    }
+    else {
+        // From a single set up to a few doublings past the configured size
+        uint32_t n_sets = config->cache_size_bytes / config->block_size_bytes / config->associativity;
+        uint32_t n_sizes = HighestBitSet(n_sets) + 1 + SWEEP_DOUBLINGS;
+        if (n_sizes > STACK_DISTANCE_MAX_CACHES) {
+            n_sizes = STACK_DISTANCE_MAX_CACHES;
+        }
+
+        stack_distance = StackDistance_Create(config->block_size_bytes,
+                                              config->associativity,
+                                              n_sizes);
     }
+    if (stack_distance == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    return stack_distance;
+}
+
+static void Sweep_Print(sweep_t const * sweep, char const * title, bool l1_simulated)
+{
+    printf("%s - LRU, without victim cache\n\n", title);
+
+    if (l1_simulated) {
+        StackDistance_Print(sweep->l1i, "L1i");
+        printf("\n");
+
+        StackDistance_Print(sweep->l1d, "L1d");
+        printf("\n");
+    }
+
+    StackDistance_Print(sweep->l2, "L2");
+    printf("\n");
+}
+
+static void Sweep_Destroy(sweep_t * sweep)
+{
+    StackDistance_Destroy(sweep->l1i);
+    StackDistance_Destroy(sweep->l1d);
+    StackDistance_Destroy(sweep->l2);
+}
 
+static void parse_args(int argc, char const * const * const argv,
+                       char const * * config_files, uint32_t * n_config_files,
+                       char const * * trace_name, char const * * trace_file,
+                       bool * binary_trace, uint64_t * skip, uint64_t * count,
+                       char const * * cache_dir, uint32_t * n_threads,
+                       bool * sweep_sizes, bool * sweep_ways,
+                       char const * * capture_file, char const * * replay_file)
+{
     int i;
     for (i = 1; i < argc; i++) {
         if ((strcmp("-h", argv[i]) == 0) || (strcmp("--help", argv[i]) == 0)) {
@@ -149,49 +417,415 @@ static void parse_args(int argc, char const * const * const argv,
             *trace_name = argv[i + 1];
             i++;
         }
-        else {
-            if (*config_file != NULL) {
-                printf("extra argument '%s'\n\n", argv[i]);
+        else if (strcmp("-f", argv[i]) == 0) {
+            if (i == argc - 1) {
+                printf("'-f' takes an argument\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            *trace_file = argv[i + 1];
+            i++;
+        }
+        else if (strcmp("--skip", argv[i]) == 0) {
+            char * end = NULL;
+            if (i < argc - 1) {
+                *skip = strtoull(argv[i + 1], &end, 10);
+            }
+            if (end == NULL || end == argv[i + 1] || *end != '\0') {
+                printf("'--skip' takes a number of references\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            i++;
+        }
+        else if (strcmp("--count", argv[i]) == 0) {
+            char * end = NULL;
+            if (i < argc - 1) {
+                *count = strtoull(argv[i + 1], &end, 10);
+            }
+            if (end == NULL || end == argv[i + 1] || *end != '\0') {
+                printf("'--count' takes a number of references\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            i++;
+        }
+        else if (strcmp("--cache", argv[i]) == 0) {
+            if (i == argc - 1) {
+                printf("'--cache' takes an argument\n\n");
                 usage(argv[0]);
                 exit(-1);
             }
-            *config_file = argv[i];
+            *cache_dir = argv[i + 1];
+            i++;
+        }
+        else if (strcmp("-j", argv[i]) == 0) {
+            char * end = NULL;
+            if (i < argc - 1) {
+                *n_threads = strtoul(argv[i + 1], &end, 10);
+            }
+            if (end == NULL || end == argv[i + 1] || *end != '\0') {
+                printf("'-j' takes a number of threads\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            i++;
+        }
+        else if (strcmp("--no-cache", argv[i]) == 0) {
+            *cache_dir = NULL;
+        }
+        else if (strcmp("--binary", argv[i]) == 0) {
+            *binary_trace = true;
+        }
+        else if (strcmp("--sweep-sizes", argv[i]) == 0) {
+            *sweep_sizes = true;
+        }
+        else if (strcmp("--sweep-ways", argv[i]) == 0) {
+            *sweep_ways = true;
+        }
+        else if (strcmp("--capture-l2", argv[i]) == 0) {
+            if (i == argc - 1) {
+                printf("'--capture-l2' takes an argument\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            *capture_file = argv[i + 1];
+            i++;
+        }
+        else if (strcmp("--replay-l2", argv[i]) == 0) {
+            if (i == argc - 1) {
+                printf("'--replay-l2' takes an argument\n\n");
+                usage(argv[0]);
+                exit(-1);
+            }
+            *replay_file = argv[i + 1];
+            i++;
+        }
+        else {
+            config_files[(*n_config_files)++] = argv[i];
         }
     }
 }
 
 static void usage(char const * call)
 {
-    printf("Usage: %s [config_file] [-t <trace_name>]\n"
-            "    If only one argument is given, it is assumed to be config_file.\n", call);
+    printf("Usage: %s [config_file...] [-t <trace_name>] [-f <trace_file>] [--binary]\n"
+            "          [--skip <n>] [--count <m>] [--cache <dir> | --no-cache] [-j <threads>]\n"
+            "          [--sweep-sizes] [--sweep-ways] [--capture-l2 <file> | --replay-l2 <file>]\n"
+            "    Every config_file given is simulated on the same pass through the\n"
+            "    trace, and its results printed in turn. With none, the default\n"
+            "    configuration is simulated.\n"
+            "    -j sets the number of threads the configurations are shared between\n"
+            "    (default: one per core).\n"
+            "    The trace is read from trace_file if given, otherwise stdin.\n"
+            "    --binary reads a binary trace (see tools/convert) rather than text.\n"
+            "    --skip starts simulating at the n'th reference (counting from 0).\n"
+            "    --count stops simulating after m references.\n"
+            "    --cache keeps converted copies of text trace_files in dir (default:\n"
+            "    $" TRACE_CACHE_DIR_VARIABLE ", or " TRACE_CACHE_DEFAULT_DIR "), so each is only parsed once.\n"
+            "    Checkpoints through them are kept there too, so --skip can jump\n"
+            "    close to the n'th reference. --no-cache does neither.\n"
+            "    --sweep-sizes also prints, for each level, the miss rate of LRU caches\n"
+            "    of every power-of-two size up to 16x the configured one, with its\n"
+            "    block size and ways but no victim cache.\n"
+            "    --sweep-ways likewise prints the miss rate of LRU caches of the\n"
+            "    configured size and every power-of-two associativity, from fully\n"
+            "    associative down to direct mapped.\n"
+            "    --capture-l2 writes every access the L1 caches make to L2, and their\n"
+            "    results, to file. Only a single config_file may be given.\n"
+            "    --replay-l2 simulates L2 and main memory on the accesses captured in\n"
+            "    file instead of reading a trace. Every config_file must have the L1\n"
+            "    configuration the capture was made with, and the L1 caches' final\n"
+            "    contents aren't printed.\n", call);
 }
 
-static uint32_t do_access(memory_t * mem, access_t const * access, uint32_t * n_aligned)
+static void simulate_all(char const * trace_file, bool binary_trace,
+                         uint64_t skip, uint64_t count,
+                         char const * cache_dir, uint32_t n_threads)
 {
-    access_t l1_bus_aligned_access;
-    Access_Align(&l1_bus_aligned_access, access, 4);
+    // A text trace that has been simulated before is read from its converted
+    // copy; otherwise, it's copied as it's parsed (if it will be read whole)
+    bool whole_trace = skip == 0 && count == UINT64_MAX;
+    cache = TraceCache_Create(binary_trace ? NULL : cache_dir, trace_file, whole_trace);
+    if (cache == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    if (TraceCache_Path(cache) != NULL) {
+        trace_file = TraceCache_Path(cache);
+    }
 
-    *n_aligned = l1_bus_aligned_access.n_bytes >> 2;
-    l1_bus_aligned_access.n_bytes = 4;
+    reader = TraceReader_Create(trace_file, binary_trace);
+    if (reader == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
 
-    l1_cache_t top_cache = mem->l1d_cache;
-    uint32_t access_cycles = 0;
-    if (l1_bus_aligned_access.type == TYPE_INSTR) {
-        top_cache = mem->l1i_cache;
-        access_cycles = 1;
+    trace_index = TraceIndex_Create(binary_trace ? NULL : cache_dir, trace_file,
+                                    TRACE_INDEX_DEFAULT_INTERVAL);
+    if (trace_index == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
     }
 
+    skip_trace(skip);
+    n_remaining = count;
+
+    // Each worker takes an equal share of the configurations
+    if (n_threads == 0) {
+        long n_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        n_threads = n_cores > 0 ? n_cores : 1;
+    }
+    uint32_t n_workers = n_simulations;
+    if (n_workers > n_threads) {
+        n_workers = n_threads;
+    }
+    if (n_workers > MAX_WORKERS) {
+        n_workers = MAX_WORKERS;
+    }
     uint32_t i;
-    for (i = 0; i < *n_aligned; i++) {
-        access_cycles += L1Cache_Access(top_cache, &l1_bus_aligned_access);
-        l1_bus_aligned_access.address += 4;
+    for (i = 0; i < n_workers; i++) {
+        uint32_t first = (uint64_t) i * n_simulations / n_workers;
+        uint32_t last  = (uint64_t) (i + 1) * n_simulations / n_workers;
+        workers[i].index         = i;
+        workers[i].simulations   = &simulations[first];
+        workers[i].n_simulations = last - first;
+        workers[i].error         = CEXCEPTION_NONE;
+    }
+
+    ring = AccessRing_Create(TRACE_RING_LEN, TRACE_BATCH_LEN, n_workers);
+    if (ring == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    // Parsing and simulation each take a core
+    if (pthread_create(&parser, NULL, parse_trace, NULL) != 0) {
+        printf("Failed to start trace parser\n");
+        exit(1);
+    }
+    parser_started = true;
+
+    // The main thread is the first worker
+    for (n_workers_started = 1; n_workers_started < n_workers; n_workers_started++) {
+        worker_t * worker = &workers[n_workers_started];
+        if (pthread_create(&(worker->thread), NULL, simulate_worker, worker) != 0) {
+            printf("Failed to start simulation worker\n");
+            exit(1);
+        }
+    }
+    simulate_trace(&workers[0]);
+
+    for (i = 1; i < n_workers_started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    n_workers_started = 0;
+
+    for (i = 0; i < n_workers; i++) {
+        if (workers[i].error != CEXCEPTION_NONE) {
+            ThrowWithLocationInfo(workers[i].error, workers[i].error_file, workers[i].error_line);
+        }
+    }
+}
+
+static void replay_all(char const * replay_file)
+{
+    replay = L2Stream_CreateReader(replay_file);
+    if (replay == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    // Everything the L1 caches did is as captured, so must be what every
+    // configuration's would do
+    cache_param_t const * l1_config = L2Stream_Config(replay);
+    uint32_t i;
+    for (i = 0; i < n_simulations; i++) {
+        simulation_t * simulation = &simulations[i];
+        if (memcmp(&(simulation->config.l1), l1_config, sizeof(*l1_config)) != 0) {
+            printf("%s: L1 configuration differs from the one '%s' was captured with\n",
+                   simulation->config_file != NULL ? simulation->config_file : "default",
+                   replay_file);
+            exit(-1);
+        }
+        L2Stream_ReadStats(replay, &(simulation->stats));
+    }
+
+    static access_t accesses[TRACE_BATCH_LEN];
+    static uint8_t origins[TRACE_BATCH_LEN];
+    uint32_t n_accesses;
+    while ((n_accesses = L2Stream_Read(replay, accesses, origins, TRACE_BATCH_LEN)) > 0) {
+        for (i = 0; i < n_simulations; i++) {
+            simulation_t * simulation = &simulations[i];
+
+            uint32_t j;
+            for (j = 0; j < n_accesses; j++) {
+                uint32_t cycles = L2Cache_Access(simulation->mem.l2_cache, &accesses[j]);
+                Statistics_RecordCycles(&(simulation->stats), origins[j], cycles);
+            }
+        }
+    }
+}
+
+static void simulate_batch(memory_t * mem,
+                           stats_t * stats,
+                           access_t const * accesses,
+                           uint32_t n_accesses)
+{
+    static _Thread_local uint32_t cycles[TRACE_BATCH_LEN];
+    static _Thread_local uint32_t n_aligned[TRACE_BATCH_LEN];
+
+    uint32_t i;
+    if (capture != NULL) {
+        // A capture records which reference each access to L2 is made for, so
+        // the references are simulated one at a time
+        for (i = 0; i < n_accesses; i++) {
+            L2Stream_SetOrigin(capture, accesses[i].type);
+            L1Cache_AccessBatch(mem->l1i_cache, mem->l1d_cache, &accesses[i], 1,
+                                &cycles[i], &n_aligned[i]);
+        }
+    }
+    else {
+        L1Cache_AccessBatch(mem->l1i_cache, mem->l1d_cache, accesses, n_accesses, cycles, n_aligned);
     }
 
-    return access_cycles;
+    for (i = 0; i < n_accesses; i++) {
+        // Instruction fetches take a cycle more
+        uint32_t access_cycles = cycles[i];
+        if (accesses[i].type == TYPE_INSTR) {
+            access_cycles += 1;
+        }
+
+        Statistics_RecordAccess(stats, accesses[i].type, access_cycles, n_aligned[i]);
+    }
+}
+
+static uint32_t read_trace(access_t * accesses, uint32_t max_accesses)
+{
+    uint32_t n_wanted = TraceIndex_Limit(trace_index, max_accesses);
+    uint32_t n_read = TraceReader_Read(reader, accesses, n_wanted);
+    TraceIndex_Record(trace_index, accesses, n_read, TraceReader_Offset(reader));
+
+    return n_read;
+}
+
+static void skip_trace(uint64_t n_accesses)
+{
+    if (!TraceIndex_Active(trace_index)) {
+        TraceReader_Skip(reader, n_accesses);
+        return;
+    }
+
+    trace_checkpoint_t checkpoint;
+    TraceIndex_Seek(trace_index, n_accesses, &checkpoint);
+    if (checkpoint.record > 0) {
+        TraceReader_Seek(reader, checkpoint.offset, checkpoint.record);
+    }
+
+    // The rest is parsed, both to find the reference and to extend the index
+    static access_t discarded[TRACE_BATCH_LEN];
+    uint64_t n_skipped = checkpoint.record;
+    while (n_skipped < n_accesses) {
+        uint32_t n_wanted = TRACE_BATCH_LEN;
+        if (n_accesses - n_skipped < n_wanted) {
+            n_wanted = n_accesses - n_skipped;
+        }
+
+        uint32_t n_read = read_trace(discarded, n_wanted);
+        if (n_read == 0) {
+            break;
+        }
+        n_skipped += n_read;
+    }
+}
+
+static void * parse_trace(void * arg)
+{
+    (void) arg;
+    exception_thread_id = PARSER_EXCEPTION_ID;
+
+    access_batch_t * batch;
+    while ((batch = AccessRing_Claim(ring)) != NULL) {
+        // Exceptions can't cross threads, so they're passed along with the
+        // final batch and re-thrown by the simulation
+        CEXCEPTION_T e;
+        Try {
+            uint32_t n_wanted = TRACE_BATCH_LEN;
+            if (n_remaining < n_wanted) {
+                n_wanted = n_remaining;
+            }
+
+            batch->n_accesses = n_wanted > 0 ? read_trace(batch->accesses, n_wanted) : 0;
+            batch->error      = CEXCEPTION_NONE;
+            n_remaining      -= batch->n_accesses;
+
+            // The copy and index are complete before the simulation can finish
+            if (batch->n_accesses > 0) {
+                TraceCache_Record(cache, batch->accesses, batch->n_accesses);
+            }
+            else {
+                TraceCache_Commit(cache);
+                TraceIndex_Save(trace_index);
+            }
+        }
+        Catch (e) {
+            batch->n_accesses = 0;
+            batch->error      = e;
+            batch->error_file = exception_file;
+            batch->error_line = exception_line;
+        }
+
+        bool done = batch->n_accesses == 0;
+        AccessRing_Publish(ring);
+        if (done) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static void simulate_trace(worker_t * worker)
+{
+    while (true) {
+        access_batch_t const * batch = AccessRing_Acquire(ring, worker->index);
+        if (batch == NULL) {
+            break;
+        }
+        if (batch->n_accesses == 0) {
+            worker->error      = batch->error;
+            worker->error_file = batch->error_file;
+            worker->error_line = batch->error_line;
+            break;
+        }
+
+        CEXCEPTION_T e;
+        Try {
+            uint32_t i;
+            for (i = 0; i < worker->n_simulations; i++) {
+                simulate_batch(&(worker->simulations[i].mem), &(worker->simulations[i].stats),
+                               batch->accesses, batch->n_accesses);
+            }
+        }
+        Catch (e) {
+            worker->error      = e;
+            worker->error_file = exception_file;
+            worker->error_line = exception_line;
+            AccessRing_Close(ring);
+            break;
+        }
+
+        AccessRing_Release(ring, worker->index);
+    }
+}
+
+static void * simulate_worker(void * arg)
+{
+    worker_t * worker = (worker_t *) arg;
+    exception_thread_id = PARSER_EXCEPTION_ID + worker->index;
+
+    simulate_trace(worker);
+
+    return NULL;
 }
 
 static void print_results(memory_t * mem, char const * config_file, char const * trace_name,
-                          config_t * config, stats_t * stats)
+                          config_t * config, stats_t * stats, bool l1_simulated)
 {
     // This is designed to print EXACTLY like the sample traces. It's close
     // enough that a direct diff (ignoring whitespace) can be used to compare
@@ -230,13 +864,15 @@ static void print_results(memory_t * mem, char const * config_file, char const *
 
     printf("Cache final contents - Index and Tag values are in HEX\n\n");
 
-    printf("Memory Level: L1i\n");
-    L1Cache_Print(mem->l1i_cache);
-    printf("\n");
+    if (l1_simulated) {
+        printf("Memory Level: L1i\n");
+        L1Cache_Print(mem->l1i_cache);
+        printf("\n");
 
-    printf("Memory Level: L1d\n");
-    L1Cache_Print(mem->l1d_cache);
-    printf("\n");
+        printf("Memory Level: L1d\n");
+        L1Cache_Print(mem->l1d_cache);
+        printf("\n");
+    }
 
     printf("Memory Level: L2\n");
     L2Cache_Print(mem->l2_cache);
@@ -245,7 +881,30 @@ static void print_results(memory_t * mem, char const * config_file, char const *
 
 static void exit_cleanup(void)
 {
-    Memory_Destroy(&mem);
+    if (parser_started || n_workers_started > 1) {
+        AccessRing_Close(ring);
+    }
+    uint32_t i;
+    for (i = 1; i < n_workers_started; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+    if (parser_started) {
+        pthread_join(parser, NULL);
+    }
+    AccessRing_Destroy(ring);
+    TraceReader_Destroy(reader);
+    TraceCache_Destroy(cache);
+    TraceIndex_Destroy(trace_index);
+    L2Stream_DestroyWriter(capture);
+    L2Stream_DestroyReader(replay);
+    if (simulations != NULL) {
+        for (i = 0; i < n_simulations; i++) {
+            Memory_Destroy(&(simulations[i].mem));
+            Sweep_Destroy(&(simulations[i].sizes));
+            Sweep_Destroy(&(simulations[i].ways));
+        }
+        free(simulations);
+    }
 }
 
 /** @} defgroup MAIN */
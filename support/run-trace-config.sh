@@ -23,4 +23,4 @@ timefile=${timesdir}/${resultsname}.time
 
 echo "Running '${trace_basename}' with config '${config_basename}'"
 
-$(zcat ${trace} | time -o ${timefile} ${sim} ${config} -t ${trace_basename} > ${resultsfile})
+$(time -o ${timefile} ${sim} ${config} -t ${trace_basename} -f ${trace} > ${resultsfile})
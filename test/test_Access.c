@@ -155,6 +155,148 @@ void test_SyntaxErrorThrowsException(void)
                          "No exception on invalid syntax");
 }
 
+void test_OutOfRangeFieldsThrowException(void)
+{
+    access_t dummy_access;
+    shouldCauseException("R 1ffff880012345678 4",
+                         &dummy_access,
+                         SYNTAX_ERROR,
+                         "No exception on 17-digit address");
+    shouldCauseException("R 7fff5a8487d8 4294967296",
+                         &dummy_access,
+                         SYNTAX_ERROR,
+                         "No exception on 33-bit size");
+    shouldCauseException("R -7fff5a8487d8 4",
+                         &dummy_access,
+                         SYNTAX_ERROR,
+                         "No exception on signed address");
+}
+
+void test_LeadingZerosDontCountTowardAddressWidth(void)
+{
+    access_t expected_access = {
+        .type       = TYPE_WRITE,
+        .address    = 0xFFFF880012345678,
+        .n_bytes    = UINT32_MAX,
+    };
+
+    access_t access;
+    ZERO_STRUCT(access);
+
+    Access_ParseLine("W 0x0000ffff880012345678 4294967295\n", &access);
+
+    TEST_ASSERT_EQUAL_access_t(expected_access, access);
+}
+
+void test_Access_ParseBuffer_should_ParseEveryCompleteLine(void)
+{
+    const char buffer[] = "I 7f81ce2206b0 3\n"
+                          "W 7fff5a8487d8 8\n"
+                          "R 7F81CE441B80 8\n";
+    access_t expected_accesses[] = {
+        { .type = TYPE_INSTR, .address = 0x7F81CE2206B0, .n_bytes = 3 },
+        { .type = TYPE_WRITE, .address = 0x7FFF5A8487D8, .n_bytes = 8 },
+        { .type = TYPE_READ,  .address = 0x7F81CE441B80, .n_bytes = 8 },
+    };
+
+    access_t accesses[4];
+    uint32_t n_accesses;
+    uint64_t line_no = 1;
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), false,
+                                           accesses, 4, &n_accesses, &line_no);
+
+    TEST_ASSERT_EQUAL_UINT32(strlen(buffer), n_consumed);
+    TEST_ASSERT_EQUAL_UINT32(3, n_accesses);
+    TEST_ASSERT_EQUAL_UINT64(4, line_no);
+    uint32_t i;
+    for (i = 0; i < n_accesses; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected_accesses[i], accesses[i]);
+    }
+}
+
+void test_Access_ParseBuffer_should_LeavePartialLine_when_NotFinal(void)
+{
+    const char buffer[] = "I 7f81ce2206b0 3\nW 7fff5a84";
+
+    access_t accesses[4];
+    uint32_t n_accesses;
+    uint64_t line_no = 10;
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), false,
+                                           accesses, 4, &n_accesses, &line_no);
+
+    TEST_ASSERT_EQUAL_UINT32(strlen("I 7f81ce2206b0 3\n"), n_consumed);
+    TEST_ASSERT_EQUAL_UINT32(1, n_accesses);
+    TEST_ASSERT_EQUAL_UINT64(11, line_no);
+}
+
+void test_Access_ParseBuffer_should_ParsePartialLine_when_Final(void)
+{
+    const char buffer[] = "I 7f81ce2206b0 3\nW 7fff5a8487d8 8";
+    access_t expected_access = {
+        .type       = TYPE_WRITE,
+        .address    = 0x7FFF5A8487D8,
+        .n_bytes    = 8,
+    };
+
+    access_t accesses[4];
+    uint32_t n_accesses;
+    uint64_t line_no = 1;
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), true,
+                                           accesses, 4, &n_accesses, &line_no);
+
+    TEST_ASSERT_EQUAL_UINT32(strlen(buffer), n_consumed);
+    TEST_ASSERT_EQUAL_UINT32(2, n_accesses);
+    TEST_ASSERT_EQUAL_access_t(expected_access, accesses[1]);
+}
+
+void test_Access_ParseBuffer_should_StopAtMaxAccesses(void)
+{
+    const char buffer[] = "I 10 4\nI 14 4\nI 18 4\n";
+
+    access_t accesses[2];
+    uint32_t n_accesses;
+    uint64_t line_no = 1;
+    size_t n_consumed = Access_ParseBuffer(buffer, strlen(buffer), true,
+                                           accesses, 2, &n_accesses, &line_no);
+
+    TEST_ASSERT_EQUAL_UINT32(strlen("I 10 4\nI 14 4\n"), n_consumed);
+    TEST_ASSERT_EQUAL_UINT32(2, n_accesses);
+    TEST_ASSERT_EQUAL_UINT64(3, line_no);
+}
+
+void test_Access_ParseBuffer_should_ReportOffendingLine_when_LineIsInvalid(void)
+{
+    const char * buffers[] = {
+        "I 10 4\nI 14 4\nD 18 4\n",
+        "I 10 4\nI 14 4\nR 18 0\n",
+        "I 10 4\nI 14 4\n\n",
+        "I 10 4\nI 14 4\nR 7fff5a8487d8 woooord\n",
+    };
+    CEXCEPTION_T expected_e[] = {
+        INVALID_OPERATION,
+        INVALID_ACCESS_SIZE,
+        SYNTAX_ERROR,
+        SYNTAX_ERROR,
+    };
+
+    uint32_t i;
+    for (i = 0; i < ARRAY_ELEMENTS(buffers); i++) {
+        access_t accesses[4];
+        uint32_t n_accesses;
+        uint64_t line_no = 5;
+
+        CEXCEPTION_T e = CEXCEPTION_NONE;
+        Try {
+            Access_ParseBuffer(buffers[i], strlen(buffers[i]), true,
+                               accesses, 4, &n_accesses, &line_no);
+        }
+        Catch (e) {
+        }
+        TEST_ASSERT_EQUAL_HEX32(expected_e[i], e);
+        TEST_ASSERT_EQUAL_UINT64(7, line_no);
+    }
+}
+
 void test_Access_Align_should_NotModifyAccess_when_AccessIsAlreadyAligned(void)
 {
     access_t access = {
@@ -0,0 +1,320 @@
+/**
+ * @file    test_AccessRing.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestAccessRing Source
+ *
+ * @addtogroup TEST_ACCESSRING
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for nanosleep()
+#define _DEFAULT_SOURCE
+
+#include "unity.h"
+#include "AccessRing.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <pthread.h>
+#include <time.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define N_BATCHES   (4)
+#define BATCH_LEN   (16)
+
+/**@brief   Number of batches pushed through by the threaded tests */
+#define N_STREAMED  (10000)
+
+/**@brief   Number of consumers sharing the broadcast ring */
+#define N_CONSUMERS (3)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Producer for the threaded tests. Numbers every access in order */
+static void * produce(void * arg);
+
+/**@brief   Consumer for the threaded tests. Checks every access arrives, in
+ *          order
+ *
+ * @return  NULL if the whole stream was seen in order
+ */
+static void * consume(void * arg);
+
+/**@brief   Consumer that expects the ring to close before anything arrives
+ *
+ * @return  NULL if @ref AccessRing_Acquire returned NULL
+ */
+static void * wait_for_close(void * arg);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static access_ring_t ring;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    ring = AccessRing_Create(N_BATCHES, BATCH_LEN, 1);
+    TEST_ASSERT_NOT_NULL(ring);
+}
+
+void tearDown(void)
+{
+    AccessRing_Destroy(ring);
+}
+
+void test_AccessRing_Create_should_ThrowException_when_LengthIsNotPowerOfTwo(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        AccessRing_Create(3, BATCH_LEN, 1);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_AccessRing_Create_should_ThrowException_when_NoConsumers(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        AccessRing_Create(N_BATCHES, BATCH_LEN, 0);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_AccessRing_should_DeliverBatchesInOrder(void)
+{
+    uint32_t i;
+    for (i = 0; i < N_BATCHES; i++) {
+        access_batch_t * batch = AccessRing_Claim(ring);
+        TEST_ASSERT_NOT_NULL(batch);
+        batch->accesses[0].address = i;
+        batch->n_accesses = 1;
+        AccessRing_Publish(ring);
+    }
+
+    for (i = 0; i < N_BATCHES; i++) {
+        access_batch_t const * batch = AccessRing_Acquire(ring, 0);
+        TEST_ASSERT_EQUAL_UINT32(1, batch->n_accesses);
+        TEST_ASSERT_EQUAL_UINT64(i, batch->accesses[0].address);
+        AccessRing_Release(ring, 0);
+    }
+}
+
+void test_AccessRing_should_ReuseBatches_when_Released(void)
+{
+    uint32_t i;
+    for (i = 0; i < 3 * N_BATCHES; i++) {
+        access_batch_t * batch = AccessRing_Claim(ring);
+        batch->accesses[BATCH_LEN - 1].address = i;
+        batch->n_accesses = BATCH_LEN;
+        AccessRing_Publish(ring);
+
+        access_batch_t const * received = AccessRing_Acquire(ring, 0);
+        TEST_ASSERT_EQUAL_PTR(batch, received);
+        TEST_ASSERT_EQUAL_UINT64(i, received->accesses[BATCH_LEN - 1].address);
+        AccessRing_Release(ring, 0);
+    }
+}
+
+void test_AccessRing_Claim_should_ReturnNull_when_Closed(void)
+{
+    AccessRing_Close(ring);
+    TEST_ASSERT_NULL(AccessRing_Claim(ring));
+}
+
+void test_AccessRing_Claim_should_ReturnNull_when_ClosedWhileFull(void)
+{
+    uint32_t i;
+    for (i = 0; i < N_BATCHES; i++) {
+        TEST_ASSERT_NOT_NULL(AccessRing_Claim(ring));
+        AccessRing_Publish(ring);
+    }
+
+    // Would otherwise wait forever for the consumer
+    AccessRing_Close(ring);
+    TEST_ASSERT_NULL(AccessRing_Claim(ring));
+}
+
+void test_AccessRing_Acquire_should_ReturnNull_when_ClosedWhileEmpty(void)
+{
+    TEST_ASSERT_NOT_NULL(AccessRing_Claim(ring));
+    AccessRing_Publish(ring);
+    AccessRing_Close(ring);
+
+    // Batches already published are still delivered
+    TEST_ASSERT_NOT_NULL(AccessRing_Acquire(ring, 0));
+    AccessRing_Release(ring, 0);
+    TEST_ASSERT_NULL(AccessRing_Acquire(ring, 0));
+}
+
+void test_AccessRing_Acquire_should_Wake_when_ClosedWhileAsleep(void)
+{
+    pthread_t consumer;
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumer, NULL, wait_for_close, NULL));
+
+    // Long enough for the consumer to stop yielding and go to sleep
+    struct timespec const delay = { .tv_sec = 0, .tv_nsec = 50 * 1000 * 1000 };
+    nanosleep(&delay, NULL);
+    AccessRing_Close(ring);
+
+    void * result;
+    pthread_join(consumer, &result);
+    TEST_ASSERT_NULL(result);
+}
+
+void test_AccessRing_should_PassEveryAccess_between_Threads(void)
+{
+    pthread_t producer;
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, produce, NULL));
+
+    uint64_t expected = 0;
+    while (true) {
+        access_batch_t const * batch = AccessRing_Acquire(ring, 0);
+        if (batch->n_accesses == 0) {
+            break;
+        }
+
+        uint32_t i;
+        for (i = 0; i < batch->n_accesses; i++) {
+            TEST_ASSERT_EQUAL_UINT64(expected, batch->accesses[i].address);
+            expected++;
+        }
+        AccessRing_Release(ring, 0);
+    }
+
+    pthread_join(producer, NULL);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t) N_STREAMED * BATCH_LEN, expected);
+}
+
+void test_AccessRing_Claim_should_WaitForEveryConsumer(void)
+{
+    AccessRing_Destroy(ring);
+    ring = AccessRing_Create(N_BATCHES, BATCH_LEN, N_CONSUMERS);
+    TEST_ASSERT_NOT_NULL(ring);
+
+    uint32_t i;
+    for (i = 0; i < N_BATCHES; i++) {
+        TEST_ASSERT_NOT_NULL(AccessRing_Claim(ring));
+        AccessRing_Publish(ring);
+    }
+
+    // All but the last consumer are done with every batch
+    uint32_t consumer;
+    for (consumer = 0; consumer < N_CONSUMERS - 1; consumer++) {
+        for (i = 0; i < N_BATCHES; i++) {
+            AccessRing_Acquire(ring, consumer);
+            AccessRing_Release(ring, consumer);
+        }
+    }
+
+    // Would otherwise wait forever for the last
+    AccessRing_Close(ring);
+    TEST_ASSERT_NULL(AccessRing_Claim(ring));
+}
+
+void test_AccessRing_should_PassEveryAccess_to_EveryConsumer(void)
+{
+    AccessRing_Destroy(ring);
+    ring = AccessRing_Create(N_BATCHES, BATCH_LEN, N_CONSUMERS);
+    TEST_ASSERT_NOT_NULL(ring);
+
+    pthread_t producer;
+    pthread_t consumers[N_CONSUMERS];
+    uint32_t indices[N_CONSUMERS];
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, produce, NULL));
+
+    uint32_t i;
+    for (i = 0; i < N_CONSUMERS; i++) {
+        indices[i] = i;
+        TEST_ASSERT_EQUAL(0, pthread_create(&consumers[i], NULL, consume, &indices[i]));
+    }
+
+    for (i = 0; i < N_CONSUMERS; i++) {
+        void * result;
+        pthread_join(consumers[i], &result);
+        TEST_ASSERT_NULL(result);
+    }
+    pthread_join(producer, NULL);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void * produce(void * arg)
+{
+    (void) arg;
+
+    uint64_t address = 0;
+    uint32_t n;
+    for (n = 0; n <= N_STREAMED; n++) {
+        access_batch_t * batch = AccessRing_Claim(ring);
+
+        batch->n_accesses = n < N_STREAMED ? BATCH_LEN : 0;
+        uint32_t i;
+        for (i = 0; i < batch->n_accesses; i++) {
+            batch->accesses[i].address = address++;
+        }
+
+        AccessRing_Publish(ring);
+    }
+
+    return NULL;
+}
+
+static void * consume(void * arg)
+{
+    uint32_t consumer = *(uint32_t *) arg;
+
+    // Unity's assertions can't be used off the main thread, so a failure is
+    // reported through the return value
+    uint64_t expected = 0;
+    bool in_order = true;
+    while (true) {
+        access_batch_t const * batch = AccessRing_Acquire(ring, consumer);
+        if (batch->n_accesses == 0) {
+            break;
+        }
+
+        uint32_t i;
+        for (i = 0; i < batch->n_accesses; i++) {
+            in_order &= batch->accesses[i].address == expected;
+            expected++;
+        }
+        AccessRing_Release(ring, consumer);
+    }
+
+    if (!in_order || expected != (uint64_t) N_STREAMED * BATCH_LEN) {
+        return arg;
+    }
+    return NULL;
+}
+
+static void * wait_for_close(void * arg)
+{
+    (void) arg;
+
+    if (AccessRing_Acquire(ring, 0) != NULL) {
+        return ring;
+    }
+    return NULL;
+}
+
+/** @} addtogroup TEST_ACCESSRING */
@@ -0,0 +1,172 @@
+/**
+ * @file    test_BinaryTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestBinaryTrace Source
+ *
+ * @addtogroup TEST_BINARYTRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "BinaryTrace.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static FILE * file;
+
+static const access_t accesses[] = {
+    { .type = TYPE_INSTR, .address = 0x7F81CE2206B0, .n_bytes = 3 },
+    { .type = TYPE_WRITE, .address = 0x7FFF5A8487D8, .n_bytes = 8 },
+    { .type = TYPE_READ,  .address = 0xFFFFFFFFFFFFFFFC, .n_bytes = 4 },
+};
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+}
+
+void tearDown(void)
+{
+    fclose(file);
+}
+
+void test_BinaryTrace_DecodeAccess_should_ReverseEncodeAccess(void)
+{
+    uint8_t record[BINARY_TRACE_RECORD_SIZE];
+
+    uint32_t i;
+    for (i = 0; i < ARRAY_ELEMENTS(accesses); i++) {
+        access_t access;
+        ZERO_STRUCT(access);
+
+        BinaryTrace_EncodeAccess(record, &accesses[i]);
+        BinaryTrace_DecodeAccess(&access, record);
+
+        TEST_ASSERT_EQUAL_access_t(accesses[i], access);
+    }
+}
+
+void test_BinaryTrace_EncodeAccess_should_UseLittleEndianLayout(void)
+{
+    uint8_t expected_record[BINARY_TRACE_RECORD_SIZE] = {
+        0xD8, 0x87, 0x84, 0x5A, 0xFF, 0x7F, 0x00, 0x00,
+        0x08, 0x00, 0x00, 0x00,
+        'W',  0x00, 0x00, 0x00,
+    };
+    uint8_t record[BINARY_TRACE_RECORD_SIZE];
+
+    BinaryTrace_EncodeAccess(record, &accesses[1]);
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_record, record, BINARY_TRACE_RECORD_SIZE);
+}
+
+void test_BinaryTrace_DecodeAccess_should_ThrowException_when_TypeIsInvalid(void)
+{
+    uint8_t record[BINARY_TRACE_RECORD_SIZE];
+    access_t access;
+
+    BinaryTrace_EncodeAccess(record, &accesses[0]);
+    record[12] = 'D';
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BinaryTrace_DecodeAccess(&access, record);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(INVALID_OPERATION, e);
+}
+
+void test_BinaryTrace_ReadHeader_should_ReturnCountWrittenByWriteHeader(void)
+{
+    binary_trace_header_t header;
+
+    BinaryTrace_WriteHeader(file, 123456789012ull);
+    rewind(file);
+    BinaryTrace_ReadHeader(file, &header);
+
+    TEST_ASSERT_EQUAL_UINT32(BINARY_TRACE_VERSION, header.version);
+    TEST_ASSERT_EQUAL_UINT32(BINARY_TRACE_RECORD_SIZE, header.record_size);
+    TEST_ASSERT_EQUAL_HEX64(123456789012ull, header.n_records);
+}
+
+void test_BinaryTrace_ReadHeader_should_ThrowException_when_MagicIsWrong(void)
+{
+    binary_trace_header_t header;
+
+    fputs("I 7f81ce2206b0 3\nI 7f81ce2206b3 5\n", file);
+    rewind(file);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BinaryTrace_ReadHeader(file, &header);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_BinaryTrace_Read_should_ReturnAccessesWrittenByWrite(void)
+{
+    access_t read_accesses[ARRAY_ELEMENTS(accesses) + 1];
+
+    BinaryTrace_WriteHeader(file, ARRAY_ELEMENTS(accesses));
+    BinaryTrace_Write(file, accesses, ARRAY_ELEMENTS(accesses));
+    rewind(file);
+
+    binary_trace_header_t header;
+    BinaryTrace_ReadHeader(file, &header);
+    uint32_t n_read = BinaryTrace_Read(file, read_accesses, ARRAY_ELEMENTS(read_accesses));
+
+    TEST_ASSERT_EQUAL_UINT32(ARRAY_ELEMENTS(accesses), n_read);
+    uint32_t i;
+    for (i = 0; i < n_read; i++) {
+        TEST_ASSERT_EQUAL_access_t(accesses[i], read_accesses[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, BinaryTrace_Read(file, read_accesses, 1));
+}
+
+void test_BinaryTrace_Read_should_ThrowException_when_RecordIsTruncated(void)
+{
+    access_t read_accesses[ARRAY_ELEMENTS(accesses)];
+
+    BinaryTrace_Write(file, accesses, 1);
+    fputc(0, file);
+    rewind(file);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BinaryTrace_Read(file, read_accesses, ARRAY_ELEMENTS(read_accesses));
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+/** @} addtogroup TEST_BINARYTRACE */
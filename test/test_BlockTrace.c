@@ -0,0 +1,280 @@
+/**
+ * @file    test_BlockTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestBlockTrace Source
+ *
+ * @addtogroup TEST_BLOCKTRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for fileno()
+#define _DEFAULT_SOURCE
+
+#include "unity.h"
+#include "BlockTrace.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Records per block in the test traces */
+#define BLOCK_LEN   (4)
+
+/**@brief   Records in the test traces. Leaves the last block partly full */
+#define N_RECORDS   (10)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Write @p n_records distinct accesses to @p file as a block trace */
+static void write_trace(FILE * file, uint32_t n_records);
+
+/**@brief   The access written as record @p i by @ref write_trace */
+static access_t record(uint32_t i);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static FILE * file;
+static block_trace_index_t trace_index;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    trace_index.entries = NULL;
+}
+
+void tearDown(void)
+{
+    BlockTrace_FreeIndex(&trace_index);
+    fclose(file);
+}
+
+void test_BlockTrace_IsBlockTrace_should_RecognizeMagic(void)
+{
+    write_trace(file, N_RECORDS);
+    TEST_ASSERT_TRUE(BlockTrace_IsBlockTrace(fileno(file)));
+}
+
+void test_BlockTrace_IsBlockTrace_should_RejectBinaryTrace(void)
+{
+    BinaryTrace_WriteHeader(file, 0);
+    fflush(file);
+    TEST_ASSERT_FALSE(BlockTrace_IsBlockTrace(fileno(file)));
+}
+
+void test_BlockTrace_ReadIndex_should_DescribeEveryBlock(void)
+{
+    write_trace(file, N_RECORDS);
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    TEST_ASSERT_EQUAL_UINT32(BLOCK_LEN, trace_index.block_len);
+    TEST_ASSERT_EQUAL_UINT64(3, trace_index.n_blocks);
+    TEST_ASSERT_EQUAL_UINT64(N_RECORDS, trace_index.n_records);
+
+    TEST_ASSERT_EQUAL_UINT64(0, trace_index.entries[0].first_record);
+    TEST_ASSERT_EQUAL_UINT64(4, trace_index.entries[1].first_record);
+    TEST_ASSERT_EQUAL_UINT64(8, trace_index.entries[2].first_record);
+    TEST_ASSERT_EQUAL_UINT32(4, trace_index.entries[0].n_records);
+    TEST_ASSERT_EQUAL_UINT32(2, trace_index.entries[2].n_records);
+    TEST_ASSERT_EQUAL_UINT64(BLOCK_TRACE_HEADER_SIZE, trace_index.entries[0].offset);
+}
+
+void test_BlockTrace_DecompressBlock_should_RecoverRecords(void)
+{
+    write_trace(file, N_RECORDS);
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    block_trace_entry_t const * entry = &trace_index.entries[1];
+    uint8_t compressed[256];
+    TEST_ASSERT_TRUE(entry->compressed_length <= sizeof(compressed));
+    fseek(file, entry->offset, SEEK_SET);
+    TEST_ASSERT_EQUAL(1, fread(compressed, entry->compressed_length, 1, file));
+
+    uint8_t records[BLOCK_LEN * BINARY_TRACE_RECORD_SIZE];
+    TEST_ASSERT_TRUE(BlockTrace_DecompressBlock(records, compressed, entry));
+
+    uint32_t i;
+    for (i = 0; i < entry->n_records; i++) {
+        access_t access;
+        BinaryTrace_DecodeAccess(&access, &records[i * BINARY_TRACE_RECORD_SIZE]);
+        TEST_ASSERT_EQUAL_access_t(record(4 + i), access);
+    }
+}
+
+void test_BlockTrace_DecompressBlock_should_Fail_when_BlockIsCorrupt(void)
+{
+    write_trace(file, N_RECORDS);
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    uint8_t compressed[256];
+    memset(compressed, 0xa5, sizeof(compressed));
+
+    uint8_t records[BLOCK_LEN * BINARY_TRACE_RECORD_SIZE];
+    TEST_ASSERT_FALSE(BlockTrace_DecompressBlock(records, compressed, &trace_index.entries[0]));
+}
+
+void test_BlockTrace_FindBlock_should_FindBlockHoldingRecord(void)
+{
+    write_trace(file, N_RECORDS);
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    TEST_ASSERT_EQUAL_UINT64(0, BlockTrace_FindBlock(&trace_index, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, BlockTrace_FindBlock(&trace_index, 3));
+    TEST_ASSERT_EQUAL_UINT64(1, BlockTrace_FindBlock(&trace_index, 4));
+    TEST_ASSERT_EQUAL_UINT64(2, BlockTrace_FindBlock(&trace_index, 9));
+    TEST_ASSERT_EQUAL_UINT64(3, BlockTrace_FindBlock(&trace_index, 10));
+}
+
+void test_BlockTrace_ReadIndex_should_HandleEmptyTrace(void)
+{
+    write_trace(file, 0);
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+
+    TEST_ASSERT_EQUAL_UINT64(0, trace_index.n_blocks);
+    TEST_ASSERT_EQUAL_UINT64(0, trace_index.n_records);
+    TEST_ASSERT_EQUAL_UINT64(0, BlockTrace_FindBlock(&trace_index, 0));
+}
+
+void test_BlockTrace_ReadIndex_should_ThrowException_when_TrailerIsMissing(void)
+{
+    write_trace(file, N_RECORDS);
+
+    // Chop the trailer off by copying everything but it to a new file
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file) - BLOCK_TRACE_TRAILER_SIZE;
+    uint8_t contents[1024];
+    TEST_ASSERT_TRUE(length <= (long) sizeof(contents));
+    rewind(file);
+    TEST_ASSERT_EQUAL(1, fread(contents, length, 1, file));
+
+    FILE * truncated = tmpfile();
+    TEST_ASSERT_NOT_NULL(truncated);
+    fwrite(contents, length, 1, truncated);
+    fflush(truncated);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BlockTrace_ReadIndex(fileno(truncated), &trace_index);
+    }
+    Catch (e) {
+    }
+    fclose(truncated);
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_BlockTrace_CreateWriter_should_ThrowException_when_BlockLenIsZero(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BlockTrace_CreateWriter(file, 0);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_BlockTrace_WriteBlock_should_AppendPrecompressedBlock(void)
+{
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, BLOCK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    // One record buffered, so the writer must flush it as its own block first
+    access_t access = record(0);
+    BlockTrace_Write(writer, &access, 1);
+
+    uint8_t records[BLOCK_LEN * BINARY_TRACE_RECORD_SIZE];
+    uint32_t i;
+    for (i = 0; i < BLOCK_LEN; i++) {
+        access = record(1 + i);
+        BinaryTrace_EncodeAccess(&records[i * BINARY_TRACE_RECORD_SIZE], &access);
+    }
+
+    uint8_t compressed[256];
+    size_t length = 0;
+    TEST_ASSERT_TRUE(BlockTrace_CompressBound(BLOCK_LEN) <= sizeof(compressed));
+    TEST_ASSERT_TRUE(BlockTrace_CompressBlock(compressed, &length, records, BLOCK_LEN));
+    BlockTrace_WriteBlock(writer, compressed, length, BLOCK_LEN);
+
+    TEST_ASSERT_EQUAL_UINT64(1 + BLOCK_LEN, BlockTrace_Finish(writer));
+    BlockTrace_DestroyWriter(writer);
+
+    BlockTrace_ReadIndex(fileno(file), &trace_index);
+    TEST_ASSERT_EQUAL_UINT64(2, trace_index.n_blocks);
+    TEST_ASSERT_EQUAL_UINT32(1, trace_index.entries[0].n_records);
+    TEST_ASSERT_EQUAL_UINT64(1, trace_index.entries[1].first_record);
+    TEST_ASSERT_EQUAL_UINT32(length, trace_index.entries[1].compressed_length);
+
+    uint8_t decompressed[BLOCK_LEN * BINARY_TRACE_RECORD_SIZE];
+    TEST_ASSERT_TRUE(BlockTrace_DecompressBlock(decompressed, compressed,
+                                                &trace_index.entries[1]));
+    TEST_ASSERT_EQUAL_MEMORY(records, decompressed, sizeof(records));
+}
+
+void test_BlockTrace_WriteBlock_should_ThrowException_when_BlockIsTooLong(void)
+{
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, BLOCK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    uint8_t compressed[1] = { 0 };
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        BlockTrace_WriteBlock(writer, compressed, sizeof(compressed), BLOCK_LEN + 1);
+    }
+    Catch (e) {
+    }
+    BlockTrace_DestroyWriter(writer);
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void write_trace(FILE * file, uint32_t n_records)
+{
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, BLOCK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    // Written one at a time, so blocks fill partway through a write
+    uint32_t i;
+    for (i = 0; i < n_records; i++) {
+        access_t access = record(i);
+        BlockTrace_Write(writer, &access, 1);
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(n_records, BlockTrace_Finish(writer));
+    BlockTrace_DestroyWriter(writer);
+}
+
+static access_t record(uint32_t i)
+{
+    static enum ACCESS_TYPE const types[] = { TYPE_INSTR, TYPE_READ, TYPE_WRITE };
+
+    access_t access = {
+        .type    = types[i % ARRAY_ELEMENTS(types)],
+        .address = 0x7fff00000000 + 8 * i,
+        .n_bytes = 1 + (i % 8),
+    };
+    return access;
+}
+
+/** @} addtogroup TEST_BLOCKTRACE */
@@ -0,0 +1,144 @@
+/**
+ * @file    test_CacheData_Batch.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestCacheDataBatch Source
+ *
+ * @addtogroup TEST_CACHEDATA_BATCH
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "CacheData.h"
+#include "unity.h"
+
+#include "Access.h"
+#include "TagSearch.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define BLOCK_SIZE_BYTES    (64)
+#define VICTIM_SET_LEN      (8)
+
+/**@brief   Blocks in each cache compared. Enough to be prefetched */
+#define N_BLOCKS            (256 * 1024)
+
+/**@brief   Accesses in each batch. Not a multiple of anything */
+#define BATCH_LEN           (999)
+
+/**@brief   Batches in each comparison */
+#define N_BATCHES           (20)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Run the same accesses through two caches of @p set_len ways, one
+ *          in batches and one access at a time, which must behave identically
+ */
+static void compare_with_single(uint32_t set_len);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static cache_data_t batch_cache;
+static cache_data_t single_cache;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    batch_cache  = NULL;
+    single_cache = NULL;
+}
+
+void tearDown(void)
+{
+    CacheData_Destroy(batch_cache);
+    CacheData_Destroy(single_cache);
+}
+
+void test_CacheData_PrefetchEnabled_should_DependOnSize(void)
+{
+    batch_cache  = CacheData_Create(N_BLOCKS / 4, 4, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+    single_cache = CacheData_Create(64, 4, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+    TEST_ASSERT_NOT_NULL(batch_cache);
+    TEST_ASSERT_NOT_NULL(single_cache);
+
+    TEST_ASSERT_TRUE(CacheData_PrefetchEnabled(batch_cache));
+    TEST_ASSERT_FALSE(CacheData_PrefetchEnabled(single_cache));
+
+    // Only a hint, either way
+    CacheData_Prefetch(batch_cache, 0x1000);
+    CacheData_Prefetch(single_cache, 0x1000);
+    TEST_ASSERT_FALSE(CacheData_Contains(batch_cache, 0x1000));
+}
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_DirectMapped(void)
+{
+    compare_with_single(1);
+}
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_FourWay(void)
+{
+    compare_with_single(4);
+}
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_Compact(void)
+{
+    compare_with_single(16);
+}
+
+void test_CacheData_AccessBatch_should_MatchSingleAccesses_when_Hashed(void)
+{
+    compare_with_single(64);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void compare_with_single(uint32_t set_len)
+{
+    batch_cache  = CacheData_Create(N_BLOCKS / set_len, set_len, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+    single_cache = CacheData_Create(N_BLOCKS / set_len, set_len, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+    TEST_ASSERT_NOT_NULL(batch_cache);
+    TEST_ASSERT_NOT_NULL(single_cache);
+    TEST_ASSERT_TRUE(CacheData_PrefetchEnabled(batch_cache));
+
+    static access_t accesses[BATCH_LEN];
+    static result_t results[BATCH_LEN];
+    static uint64_t kickouts[BATCH_LEN];
+
+    // Twice as many blocks as the cache holds, so sets keep evicting
+    uint32_t state = 7;
+    uint32_t batch;
+    for (batch = 0; batch < N_BATCHES; batch++) {
+        uint32_t i;
+        for (i = 0; i < BATCH_LEN; i++) {
+            state = state * 1103515245 + 12345;
+            accesses[i].type    = (state >> 28) & 1 ? TYPE_WRITE : TYPE_READ;
+            accesses[i].address = 0x20000000 + ((state >> 4) % (2 * N_BLOCKS)) * BLOCK_SIZE_BYTES;
+            accesses[i].n_bytes = 4;
+        }
+
+        CacheData_AccessBatch(batch_cache, accesses, BATCH_LEN, results, kickouts);
+
+        for (i = 0; i < BATCH_LEN; i++) {
+            result_t result;
+            uint64_t kickout = accesses[i].type == TYPE_WRITE ?
+                               CacheData_Write(single_cache, accesses[i].address, &result) :
+                               CacheData_Read(single_cache, accesses[i].address, &result);
+            TEST_ASSERT_EQUAL(result, results[i]);
+            TEST_ASSERT_EQUAL_HEX64(kickout, kickouts[i]);
+        }
+    }
+}
+
+/** @} addtogroup TEST_CACHEDATA_BATCH */
@@ -0,0 +1,260 @@
+/**
+ * @file    test_CacheData_Compact.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestCacheDataCompact Source
+ *
+ * @addtogroup TEST_CACHEDATA_COMPACT
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "CacheData.h"
+#include "unity.h"
+
+#include "TagSearch.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Sets in the cache. With @ref SET_LEN, large enough to be compact */
+#define N_SETS              (8192)
+#define SET_LEN             (8)
+#define BLOCK_SIZE_BYTES    (64)
+#define VICTIM_SET_LEN      (8)
+
+/**@brief   Sets touched by the model comparison, spread over the whole index */
+#define N_MODEL_SETS        (64)
+
+/**@brief   Distinct tags touched in each of those sets */
+#define N_MODEL_TAGS        (12)
+
+/**@brief   Accesses made by the model comparison */
+#define N_MODEL_ACCESSES    (50000)
+
+/**@brief   Lowest address the model comparison touches. High enough that
+ *          rebuilt addresses need most of a tag's 32 bits
+ */
+#define MODEL_BASE_ADDRESS  (0x0007ffe000000000)
+
+/**@brief   Added to an address to give one in the same set whose tag needs
+ *          more than 32 bits, as kernel addresses do
+ */
+#define WIDE_OFFSET         (0xffff800000000000)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   A set of the reference model. Blocks are kept newest first */
+typedef struct {
+    uint64_t addresses[SET_LEN];
+    bool dirty[SET_LEN];
+    uint32_t n_valid;
+} model_set_t;
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   The address of the @p i th block mapping to set @p set */
+static uint64_t address_in_set(uint32_t set, uint32_t i);
+
+/**@brief   Access @p address in the reference model, with no victim cache
+ *
+ * @return  The address of a block kicked out dirty, if any
+ */
+static uint64_t model_access(model_set_t * sets, uint64_t address, bool write, result_t * result);
+
+/**@brief   Make @p n_accesses random accesses to both the cache and the model,
+ *          checking that they agree. If @p wide, every other block has an
+ *          address too wide for a 32-bit tag
+ */
+static void check_model(model_set_t * sets, uint32_t * state, uint32_t n_accesses, bool wide);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static cache_data_t cache_data;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    cache_data = CacheData_Create(N_SETS, SET_LEN, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+}
+
+void tearDown(void)
+{
+    CacheData_Destroy(cache_data);
+}
+
+void test_CacheData_Read_should_KickoutFullAddress_when_BlockHasBeenWritten(void)
+{
+    result_t result;
+
+    CacheData_Write(cache_data, address_in_set(N_SETS - 1, 0) + 5, &result);
+
+    uint32_t i;
+    for (i = 1; i < SET_LEN + VICTIM_SET_LEN; i++) {
+        TEST_ASSERT_EQUAL_HEX64(0, CacheData_Read(cache_data, address_in_set(N_SETS - 1, i), &result));
+    }
+
+    TEST_ASSERT_EQUAL_HEX64(address_in_set(N_SETS - 1, 0),
+                            CacheData_Read(cache_data, address_in_set(N_SETS - 1, i), &result));
+    TEST_ASSERT_EQUAL(RESULT_MISS_DIRTY_KICKOUT, result);
+    TEST_ASSERT_FALSE(CacheData_Contains(cache_data, address_in_set(N_SETS - 1, 0)));
+}
+
+void test_CacheData_Read_should_HitVictimSet_when_BlockWasEvicted(void)
+{
+    result_t result;
+
+    uint32_t i;
+    for (i = 0; i <= SET_LEN; i++) {
+        CacheData_Read(cache_data, address_in_set(3, i), &result);
+        TEST_ASSERT_EQUAL(RESULT_MISS, result);
+    }
+
+    CacheData_Read(cache_data, address_in_set(3, 0), &result);
+    TEST_ASSERT_EQUAL(RESULT_HIT_VICTIM_CACHE, result);
+    CacheData_Read(cache_data, address_in_set(3, 0), &result);
+    TEST_ASSERT_EQUAL(RESULT_HIT, result);
+}
+
+void test_CacheData_Read_should_KeepEveryBlock_when_TagDoesNotFit(void)
+{
+    uint64_t wide_address = address_in_set(7, 0) + WIDE_OFFSET;
+    result_t result;
+
+    TEST_ASSERT_FALSE(CacheData_Contains(cache_data, wide_address));
+
+    CacheData_Write(cache_data, address_in_set(7, 0), &result);
+    uint32_t i;
+    for (i = 1; i < SET_LEN - 1; i++) {
+        CacheData_Read(cache_data, address_in_set(7, i), &result);
+    }
+
+    CacheData_Read(cache_data, wide_address, &result);
+    TEST_ASSERT_EQUAL(RESULT_MISS, result);
+    CacheData_Read(cache_data, wide_address, &result);
+    TEST_ASSERT_EQUAL(RESULT_HIT, result);
+    TEST_ASSERT_TRUE(CacheData_Contains(cache_data, wide_address));
+    for (i = 0; i < SET_LEN - 1; i++) {
+        TEST_ASSERT_TRUE(CacheData_Contains(cache_data, address_in_set(7, i)));
+    }
+
+    // The oldest block is still dirty, and still the oldest
+    for (i = SET_LEN - 1; i < 2 * SET_LEN - 1; i++) {
+        TEST_ASSERT_EQUAL_HEX64(0, CacheData_Read(cache_data, address_in_set(7, i), &result));
+    }
+    TEST_ASSERT_EQUAL_HEX64(address_in_set(7, 0),
+                            CacheData_Read(cache_data, address_in_set(7, i), &result));
+    TEST_ASSERT_EQUAL(RESULT_MISS_DIRTY_KICKOUT, result);
+}
+
+void test_CacheData_Access_should_MatchModel_when_NoVictimSet(void)
+{
+    CacheData_Destroy(cache_data);
+    cache_data = CacheData_Create(N_SETS, SET_LEN, BLOCK_SIZE_BYTES, 0);
+    TEST_ASSERT_NOT_NULL(cache_data);
+
+    static model_set_t sets[N_SETS];
+    memset(sets, 0, sizeof(sets));
+
+    uint32_t state = 12345;
+    check_model(sets, &state, N_MODEL_ACCESSES, false);
+}
+
+void test_CacheData_Access_should_MatchModel_when_TagsOutgrowCompactSets(void)
+{
+    CacheData_Destroy(cache_data);
+    cache_data = CacheData_Create(N_SETS, SET_LEN, BLOCK_SIZE_BYTES, 0);
+    TEST_ASSERT_NOT_NULL(cache_data);
+
+    static model_set_t sets[N_SETS];
+    memset(sets, 0, sizeof(sets));
+
+    // Every set is part-way through its LRU order when the cache is widened
+    uint32_t state = 54321;
+    check_model(sets, &state, N_MODEL_ACCESSES / 2, false);
+    check_model(sets, &state, N_MODEL_ACCESSES / 2, true);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint64_t address_in_set(uint32_t set, uint32_t i)
+{
+    return MODEL_BASE_ADDRESS + ((uint64_t) i * N_SETS + set) * BLOCK_SIZE_BYTES;
+}
+
+static void check_model(model_set_t * sets, uint32_t * state, uint32_t n_accesses, bool wide)
+{
+    uint32_t i;
+    for (i = 0; i < n_accesses; i++) {
+        *state = *state * 1103515245 + 12345;
+        uint32_t set = ((*state >> 8) % N_MODEL_SETS) * (N_SETS / N_MODEL_SETS) + 1;
+        uint32_t tag = (*state >> 16) % N_MODEL_TAGS;
+        uint64_t address = address_in_set(set, tag);
+        if (wide && (tag & 1)) {
+            address += WIDE_OFFSET;
+        }
+        bool write = (*state >> 28) & 1;
+
+        result_t expected_result;
+        result_t actual_result;
+        uint64_t expected = model_access(sets, address, write, &expected_result);
+        uint64_t actual = write ? CacheData_Write(cache_data, address, &actual_result) :
+                                  CacheData_Read(cache_data, address, &actual_result);
+        TEST_ASSERT_EQUAL(expected_result, actual_result);
+        TEST_ASSERT_EQUAL_HEX64(expected, actual);
+    }
+}
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, bool write, result_t * result)
+{
+    model_set_t * set = &sets[(address / BLOCK_SIZE_BYTES) % N_SETS];
+    uint64_t dirty_kickout_address = 0;
+    bool dirty = false;
+
+    uint32_t way;
+    for (way = 0; way < set->n_valid; way++) {
+        if (set->addresses[way] == address) {
+            break;
+        }
+    }
+
+    if (way < set->n_valid) {
+        dirty = set->dirty[way];
+        *result = RESULT_HIT;
+    }
+    else if (set->n_valid < SET_LEN) {
+        way = set->n_valid++;
+        *result = RESULT_MISS;
+    }
+    else {
+        way = SET_LEN - 1;
+        if (set->dirty[way]) {
+            dirty_kickout_address = set->addresses[way];
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+        }
+        else {
+            *result = RESULT_MISS_KICKOUT;
+        }
+    }
+
+    // Move to the front
+    memmove(&set->addresses[1], &set->addresses[0], way * sizeof(set->addresses[0]));
+    memmove(&set->dirty[1], &set->dirty[0], way * sizeof(set->dirty[0]));
+    set->addresses[0] = address;
+    set->dirty[0]     = dirty || write;
+
+    return dirty_kickout_address;
+}
+
+/** @} addtogroup TEST_CACHEDATA_COMPACT */
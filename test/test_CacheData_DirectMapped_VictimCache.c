@@ -12,6 +12,7 @@
 #include "CacheData.h"
 #include "unity.h"
 
+#include "TagSearch.h"
 #include "Util.h"
 
 #include "CException.h"
@@ -0,0 +1,202 @@
+/**
+ * @file    test_CacheData_HighlyAssociative.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestCacheDataHighlyAssociative Source
+ *
+ * @addtogroup TEST_CACHEDATA_HIGHLYASSOCIATIVE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "CacheData.h"
+#include "unity.h"
+
+#include "TagSearch.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define N_SETS              (4)
+#define SET_LEN             (64)
+#define BLOCK_SIZE_BYTES    (4)
+#define VICTIM_SET_LEN      (8)
+
+/**@brief   Distinct blocks touched by the model comparison */
+#define N_MODEL_BLOCKS      (1024)
+
+/**@brief   Accesses made by the model comparison */
+#define N_MODEL_ACCESSES    (50000)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   A set of the reference model. Blocks are kept newest first */
+typedef struct {
+    uint64_t addresses[SET_LEN];
+    bool dirty[SET_LEN];
+    uint32_t n_valid;
+} model_set_t;
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   The address of the @p i th block mapping to set @p set */
+static uint64_t address_in_set(uint32_t set, uint32_t i);
+
+/**@brief   Access @p address in the reference model, with no victim cache
+ *
+ * @return  The address of a block kicked out dirty, if any
+ */
+static uint64_t model_access(model_set_t * sets, uint64_t address, bool write, result_t * result);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static cache_data_t cache_data;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    cache_data = CacheData_Create(N_SETS, SET_LEN, BLOCK_SIZE_BYTES, VICTIM_SET_LEN);
+}
+
+void tearDown(void)
+{
+    CacheData_Destroy(cache_data);
+}
+
+void test_CacheData_Read_should_EvictOnlyFromFullSet(void)
+{
+    result_t result;
+
+    CacheData_Read(cache_data, address_in_set(1, 0), &result);
+
+    uint32_t i;
+    for (i = 0; i < SET_LEN; i++) {
+        CacheData_Read(cache_data, address_in_set(0, i), &result);
+        TEST_ASSERT_EQUAL(RESULT_MISS, result);
+    }
+    CacheData_Read(cache_data, address_in_set(0, SET_LEN), &result);
+    TEST_ASSERT_EQUAL(RESULT_MISS, result);
+
+    // The set's oldest went to the victim set, and the other set is untouched
+    CacheData_Read(cache_data, address_in_set(1, 0), &result);
+    TEST_ASSERT_EQUAL(RESULT_HIT, result);
+    CacheData_Read(cache_data, address_in_set(0, 0), &result);
+    TEST_ASSERT_EQUAL(RESULT_HIT_VICTIM_CACHE, result);
+}
+
+void test_CacheData_Read_should_KickoutFromVictimSetDirty_when_BlockHasBeenWritten(void)
+{
+    result_t result;
+
+    CacheData_Write(cache_data, address_in_set(2, 0), &result);
+
+    uint32_t i;
+    for (i = 1; i < SET_LEN + VICTIM_SET_LEN; i++) {
+        TEST_ASSERT_EQUAL_HEX64(0, CacheData_Read(cache_data, address_in_set(2, i), &result));
+    }
+
+    TEST_ASSERT_EQUAL_HEX64(address_in_set(2, 0),
+                            CacheData_Read(cache_data, address_in_set(2, i), &result));
+    TEST_ASSERT_EQUAL(RESULT_MISS_DIRTY_KICKOUT, result);
+    TEST_ASSERT_FALSE(CacheData_Contains(cache_data, address_in_set(2, 0)));
+}
+
+void test_CacheData_Access_should_MatchModel_when_NoVictimSet(void)
+{
+    CacheData_Destroy(cache_data);
+    cache_data = CacheData_Create(N_SETS, SET_LEN, BLOCK_SIZE_BYTES, 0);
+    TEST_ASSERT_NOT_NULL(cache_data);
+
+    static model_set_t sets[N_SETS];
+    memset(sets, 0, sizeof(sets));
+
+    // Enough blocks per set to keep evicting, and enough accesses to move
+    // entries around the block table many times over
+    uint32_t state = 12345;
+    uint32_t i;
+    for (i = 0; i < N_MODEL_ACCESSES; i++) {
+        state = state * 1103515245 + 12345;
+        uint64_t address = 0x40000000 + ((state >> 8) % N_MODEL_BLOCKS) * BLOCK_SIZE_BYTES;
+        bool write = (state >> 28) & 1;
+
+        result_t expected_result;
+        result_t actual_result;
+        uint64_t expected = model_access(sets, address, write, &expected_result);
+        uint64_t actual = write ? CacheData_Write(cache_data, address, &actual_result) :
+                                  CacheData_Read(cache_data, address, &actual_result);
+        TEST_ASSERT_EQUAL(expected_result, actual_result);
+        TEST_ASSERT_EQUAL_HEX64(expected, actual);
+    }
+
+    for (i = 0; i < N_MODEL_BLOCKS; i++) {
+        uint64_t address = 0x40000000 + i * BLOCK_SIZE_BYTES;
+        model_set_t const * set = &sets[i % N_SETS];
+        bool expected = false;
+        uint32_t j;
+        for (j = 0; j < set->n_valid; j++) {
+            expected |= set->addresses[j] == address;
+        }
+        TEST_ASSERT_EQUAL(expected, CacheData_Contains(cache_data, address));
+    }
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint64_t address_in_set(uint32_t set, uint32_t i)
+{
+    return 0x71234000 + (i * N_SETS + set) * BLOCK_SIZE_BYTES;
+}
+
+static uint64_t model_access(model_set_t * sets, uint64_t address, bool write, result_t * result)
+{
+    model_set_t * set = &sets[(address / BLOCK_SIZE_BYTES) % N_SETS];
+    uint64_t dirty_kickout_address = 0;
+    bool dirty = false;
+
+    uint32_t way;
+    for (way = 0; way < set->n_valid; way++) {
+        if (set->addresses[way] == address) {
+            break;
+        }
+    }
+
+    if (way < set->n_valid) {
+        dirty = set->dirty[way];
+        *result = RESULT_HIT;
+    }
+    else if (set->n_valid < SET_LEN) {
+        way = set->n_valid++;
+        *result = RESULT_MISS;
+    }
+    else {
+        way = SET_LEN - 1;
+        if (set->dirty[way]) {
+            dirty_kickout_address = set->addresses[way];
+            *result = RESULT_MISS_DIRTY_KICKOUT;
+        }
+        else {
+            *result = RESULT_MISS_KICKOUT;
+        }
+    }
+
+    // Move to the front
+    memmove(&set->addresses[1], &set->addresses[0], way * sizeof(set->addresses[0]));
+    memmove(&set->dirty[1], &set->dirty[0], way * sizeof(set->dirty[0]));
+    set->addresses[0] = address;
+    set->dirty[0]     = dirty || write;
+
+    return dirty_kickout_address;
+}
+
+/** @} addtogroup TEST_CACHEDATA_HIGHLYASSOCIATIVE */
@@ -0,0 +1,132 @@
+/**
+ * @file    test_CacheData_Kernels.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestCacheDataKernels Source
+ *
+ * @addtogroup TEST_CACHEDATA_KERNELS
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "CacheData.h"
+#include "unity.h"
+
+#include "TagSearch.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define N_SETS              (16)
+
+/**@brief   Block size with a specialized kernel */
+#define KERNEL_BLOCK_SIZE   (32)
+
+/**@brief   Block size without one. Addresses are scaled down to match */
+#define GENERIC_BLOCK_SIZE  (16)
+
+/**@brief   Distinct blocks touched */
+#define N_BLOCKS            (N_SETS * 24)
+
+/**@brief   Accesses made in each comparison */
+#define N_ACCESSES          (20000)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Run the same accesses through a cache with a specialized kernel and
+ *          one using the generic path, which must behave identically
+ */
+static void compare_with_generic(uint32_t set_len, uint32_t victim_len);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static cache_data_t kernel_cache;
+static cache_data_t generic_cache;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    kernel_cache  = NULL;
+    generic_cache = NULL;
+}
+
+void tearDown(void)
+{
+    CacheData_Destroy(kernel_cache);
+    CacheData_Destroy(generic_cache);
+}
+
+void test_CacheData_Kernel_should_MatchGeneric_when_DirectMapped(void)
+{
+    compare_with_generic(1, 8);
+}
+
+void test_CacheData_Kernel_should_MatchGeneric_when_DirectMappedWithoutVictimSet(void)
+{
+    compare_with_generic(1, 0);
+}
+
+void test_CacheData_Kernel_should_MatchGeneric_when_TwoWay(void)
+{
+    compare_with_generic(2, 8);
+}
+
+void test_CacheData_Kernel_should_MatchGeneric_when_FourWayWithoutVictimSet(void)
+{
+    compare_with_generic(4, 0);
+}
+
+void test_CacheData_Kernel_should_MatchGeneric_when_EightWay(void)
+{
+    compare_with_generic(8, 8);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void compare_with_generic(uint32_t set_len, uint32_t victim_len)
+{
+    const uint32_t scale = KERNEL_BLOCK_SIZE / GENERIC_BLOCK_SIZE;
+
+    kernel_cache  = CacheData_Create(N_SETS, set_len, KERNEL_BLOCK_SIZE, victim_len);
+    generic_cache = CacheData_Create(N_SETS, set_len, GENERIC_BLOCK_SIZE, victim_len);
+    TEST_ASSERT_NOT_NULL(kernel_cache);
+    TEST_ASSERT_NOT_NULL(generic_cache);
+
+    uint32_t state = 1;
+    uint32_t i;
+    for (i = 0; i < N_ACCESSES; i++) {
+        state = state * 1103515245 + 12345;
+        uint64_t block = (state >> 8) % N_BLOCKS;
+        uint64_t offset = (state >> 4) % KERNEL_BLOCK_SIZE;
+        uint64_t address = 0x10000000 + block * KERNEL_BLOCK_SIZE + offset;
+        bool write = (state >> 28) & 1;
+
+        result_t kernel_result;
+        result_t generic_result;
+        uint64_t kernel_kickout;
+        uint64_t generic_kickout;
+        if (write) {
+            kernel_kickout  = CacheData_Write(kernel_cache, address, &kernel_result);
+            generic_kickout = CacheData_Write(generic_cache, address / scale, &generic_result);
+        }
+        else {
+            kernel_kickout  = CacheData_Read(kernel_cache, address, &kernel_result);
+            generic_kickout = CacheData_Read(generic_cache, address / scale, &generic_result);
+        }
+        TEST_ASSERT_EQUAL(generic_result, kernel_result);
+        TEST_ASSERT_EQUAL_HEX64(generic_kickout * scale, kernel_kickout);
+    }
+}
+
+/** @} addtogroup TEST_CACHEDATA_KERNELS */
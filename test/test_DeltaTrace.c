@@ -0,0 +1,325 @@
+/**
+ * @file    test_DeltaTrace.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestDeltaTrace Source
+ *
+ * @addtogroup TEST_DELTATRACE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "DeltaTrace.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Records per chunk in the written test traces */
+#define CHUNK_LEN   (4)
+
+/**@brief   Accesses in @ref accesses */
+#define N_ACCESSES  (ARRAY_ELEMENTS(accesses))
+
+/**@brief   Most bytes a written test trace can take */
+#define MAX_TRACE_SIZE  (4096)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Read the whole of @p file into @p trace
+ *
+ * @return  Length of the trace [bytes]
+ */
+static size_t read_file(FILE * file, uint8_t * trace);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   A short trace: a run of sequential fetches broken by data accesses,
+ *          a jump backwards, and addresses that wrap
+ */
+static access_t const accesses[] = {
+    { TYPE_INSTR, 0x400000,             4 },
+    { TYPE_INSTR, 0x400004,             3 },
+    { TYPE_READ,  0x7fff0010,           8 },
+    { TYPE_INSTR, 0x400007,             5 },
+    { TYPE_INSTR, 0x40000c,             2 },
+    { TYPE_WRITE, 0x7fff0008,           4 },
+    { TYPE_READ,  0x601000,             1 },
+    { TYPE_INSTR, 0x3ffff0,             6 },
+    { TYPE_INSTR, 0x3ffff6,             6 },
+    { TYPE_INSTR, 0x3ffffc,             4 },
+    { TYPE_WRITE, 0xfffffffffffffff8,   8 },
+    { TYPE_WRITE, 0x10,                 8 },
+};
+
+static delta_trace_encoder_t encoder;
+static delta_trace_decoder_t decoder;
+static FILE * file;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    encoder = DeltaTrace_CreateEncoder();
+    decoder = DeltaTrace_CreateDecoder();
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(encoder);
+    TEST_ASSERT_NOT_NULL(decoder);
+    TEST_ASSERT_NOT_NULL(file);
+}
+
+void tearDown(void)
+{
+    DeltaTrace_DestroyEncoder(encoder);
+    DeltaTrace_DestroyDecoder(decoder);
+    fclose(file);
+}
+
+void test_DeltaTrace_DecodeChunk_should_RecoverEncodedAccesses(void)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, N_ACCESSES, &chunk);
+    TEST_ASSERT_EQUAL(length, DeltaTrace_DecodeChunk(decoder, chunk, length));
+    TEST_ASSERT_FALSE(DeltaTrace_Ended(decoder));
+
+    access_t actual[N_ACCESSES + 1];
+    TEST_ASSERT_EQUAL_UINT32(N_ACCESSES, DeltaTrace_ReadAccesses(decoder, actual, N_ACCESSES + 1));
+    uint32_t i;
+    for (i = 0; i < N_ACCESSES; i++) {
+        TEST_ASSERT_EQUAL_access_t(accesses[i], actual[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, DeltaTrace_ReadAccesses(decoder, actual, 1));
+}
+
+void test_DeltaTrace_ReadRuns_should_CollapseSequentialFetches(void)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, N_ACCESSES, &chunk);
+    DeltaTrace_DecodeChunk(decoder, chunk, length);
+
+    access_run_t runs[N_ACCESSES];
+    TEST_ASSERT_EQUAL_UINT32(8, DeltaTrace_ReadRuns(decoder, runs, N_ACCESSES));
+
+    TEST_ASSERT_EQUAL_HEX8(TYPE_INSTR, runs[0].type);
+    TEST_ASSERT_EQUAL_HEX64(0x400000, runs[0].address);
+    TEST_ASSERT_EQUAL_UINT64(7, runs[0].n_bytes);
+    TEST_ASSERT_EQUAL_UINT32(2, runs[0].n_accesses);
+    TEST_ASSERT_EQUAL_UINT32(4, runs[0].sizes[0]);
+    TEST_ASSERT_EQUAL_UINT32(3, runs[0].sizes[1]);
+
+    TEST_ASSERT_EQUAL_HEX8(TYPE_READ, runs[1].type);
+    TEST_ASSERT_EQUAL_UINT32(1, runs[1].n_accesses);
+
+    // A fetch following on from the last, after a data access, starts a run
+    // of its own
+    TEST_ASSERT_EQUAL_HEX64(0x400007, runs[2].address);
+    TEST_ASSERT_EQUAL_UINT64(7, runs[2].n_bytes);
+
+    TEST_ASSERT_EQUAL_HEX64(0x3ffff0, runs[5].address);
+    TEST_ASSERT_EQUAL_UINT32(3, runs[5].n_accesses);
+    TEST_ASSERT_EQUAL_UINT64(16, runs[5].n_bytes);
+}
+
+void test_DeltaTrace_ReadRuns_should_ReturnRemainder_when_RunIsPartlyRead(void)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, &accesses[7], 3, &chunk);
+    DeltaTrace_DecodeChunk(decoder, chunk, length);
+
+    access_t access;
+    TEST_ASSERT_EQUAL_UINT32(1, DeltaTrace_ReadAccesses(decoder, &access, 1));
+    TEST_ASSERT_EQUAL_access_t(accesses[7], access);
+
+    access_run_t run;
+    TEST_ASSERT_EQUAL_UINT32(1, DeltaTrace_ReadRuns(decoder, &run, 1));
+    TEST_ASSERT_EQUAL_HEX64(accesses[8].address, run.address);
+    TEST_ASSERT_EQUAL_UINT64(10, run.n_bytes);
+    TEST_ASSERT_EQUAL_UINT32(2, run.n_accesses);
+    TEST_ASSERT_EQUAL_UINT32(6, run.sizes[0]);
+    TEST_ASSERT_EQUAL_UINT32(4, run.sizes[1]);
+
+    TEST_ASSERT_EQUAL_UINT32(0, DeltaTrace_ReadRuns(decoder, &run, 1));
+}
+
+void test_DeltaTrace_DecodeChunk_should_ReturnZero_when_ChunkIsIncomplete(void)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, N_ACCESSES, &chunk);
+
+    TEST_ASSERT_EQUAL(0, DeltaTrace_DecodeChunk(decoder, chunk, length - 1));
+    TEST_ASSERT_EQUAL(0, DeltaTrace_DecodeChunk(decoder, chunk, DELTA_TRACE_CHUNK_HEADER_SIZE - 1));
+}
+
+void test_DeltaTrace_DecodeChunk_should_ThrowException_when_ChunkIsCorrupt(void)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, N_ACCESSES, &chunk);
+
+    // Claiming one record more than the streams hold
+    uint8_t corrupt[1024];
+    TEST_ASSERT_TRUE(length <= sizeof(corrupt));
+    memcpy(corrupt, chunk, length);
+    PutLE32(&corrupt[0], N_ACCESSES + 1);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        DeltaTrace_DecodeChunk(decoder, corrupt, length);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_DeltaTrace_EncodeChunk_should_ThrowException_when_AccessIsInvalid(void)
+{
+    access_t invalid[] = {
+        { TYPE_INSTR, 0x400000, 4 },
+        { 'X',        0x400004, 4 },
+    };
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    uint8_t const * chunk;
+    Try {
+        DeltaTrace_EncodeChunk(encoder, invalid, ARRAY_ELEMENTS(invalid), &chunk);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+
+    invalid[1].type    = TYPE_INSTR;
+    invalid[1].n_bytes = 0;
+    e = CEXCEPTION_NONE;
+    Try {
+        DeltaTrace_EncodeChunk(encoder, invalid, ARRAY_ELEMENTS(invalid), &chunk);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_DeltaTrace_Finish_should_WriteChunksAndEnd(void)
+{
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, CHUNK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    // Written in uneven pieces, so chunks fill partway through a write
+    DeltaTrace_Write(writer, &accesses[0], 3);
+    DeltaTrace_Write(writer, &accesses[3], N_ACCESSES - 4);
+    DeltaTrace_Write(writer, &accesses[N_ACCESSES - 1], 1);
+    TEST_ASSERT_EQUAL_UINT64(N_ACCESSES, DeltaTrace_Finish(writer));
+    DeltaTrace_DestroyWriter(writer);
+
+    uint8_t trace[MAX_TRACE_SIZE];
+    size_t length = read_file(file, trace);
+    DeltaTrace_CheckHeader(trace);
+    TEST_ASSERT_EQUAL_UINT32(CHUNK_LEN, GetLE32(&trace[12]));
+
+    access_t actual[N_ACCESSES];
+    uint32_t n_actual = 0;
+    uint32_t n_chunks = 0;
+    size_t offset = DELTA_TRACE_HEADER_SIZE;
+    while (!DeltaTrace_Ended(decoder)) {
+        size_t chunk_length = DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+        TEST_ASSERT_NOT_EQUAL(0, chunk_length);
+        offset += chunk_length;
+        n_actual += DeltaTrace_ReadAccesses(decoder, &actual[n_actual], N_ACCESSES - n_actual);
+        n_chunks++;
+    }
+
+    TEST_ASSERT_EQUAL(length, offset);
+    TEST_ASSERT_EQUAL_UINT32(1 + N_ACCESSES / CHUNK_LEN, n_chunks);
+    TEST_ASSERT_EQUAL_UINT32(N_ACCESSES, n_actual);
+    uint32_t i;
+    for (i = 0; i < N_ACCESSES; i++) {
+        TEST_ASSERT_EQUAL_access_t(accesses[i], actual[i]);
+    }
+}
+
+void test_DeltaTrace_WriteChunk_should_AppendPrecompressedChunk(void)
+{
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, CHUNK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    // One access buffered, so the writer must flush it as its own chunk first
+    DeltaTrace_Write(writer, &accesses[0], 1);
+
+    uint8_t const * chunk;
+    size_t chunk_length = DeltaTrace_EncodeChunk(encoder, &accesses[1], CHUNK_LEN, &chunk);
+    DeltaTrace_WriteChunk(writer, chunk, chunk_length, CHUNK_LEN);
+    TEST_ASSERT_EQUAL_UINT64(1 + CHUNK_LEN, DeltaTrace_Finish(writer));
+    DeltaTrace_DestroyWriter(writer);
+
+    uint8_t trace[MAX_TRACE_SIZE];
+    size_t length = read_file(file, trace);
+    size_t offset = DELTA_TRACE_HEADER_SIZE;
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+    TEST_ASSERT_EQUAL_MEMORY(chunk, &trace[offset], chunk_length);
+
+    access_t actual[CHUNK_LEN];
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+    TEST_ASSERT_EQUAL_UINT32(CHUNK_LEN, DeltaTrace_ReadAccesses(decoder, actual, CHUNK_LEN));
+    TEST_ASSERT_EQUAL_access_t(accesses[1], actual[0]);
+
+    offset += DeltaTrace_DecodeChunk(decoder, &trace[offset], length - offset);
+    TEST_ASSERT_TRUE(DeltaTrace_Ended(decoder));
+    TEST_ASSERT_EQUAL(length, offset);
+}
+
+void test_DeltaTrace_CreateWriter_should_ThrowException_when_ChunkLenIsZero(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        DeltaTrace_CreateWriter(file, 0);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_DeltaTrace_CheckHeader_should_ThrowException_when_VersionIsWrong(void)
+{
+    uint8_t header[DELTA_TRACE_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, DELTA_TRACE_MAGIC, 8);
+    PutLE32(&header[8], DELTA_TRACE_VERSION + 1);
+    PutLE32(&header[12], CHUNK_LEN);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        DeltaTrace_CheckHeader(header);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static size_t read_file(FILE * file, uint8_t * trace)
+{
+    rewind(file);
+    size_t length = fread(trace, 1, MAX_TRACE_SIZE, file);
+    TEST_ASSERT_TRUE(length < MAX_TRACE_SIZE);
+
+    return length;
+}
+
+/** @} addtogroup TEST_DELTATRACE */
@@ -24,6 +24,7 @@
 
 #include "mock_CacheData.h"
 #include "mock_L2Cache.h"
+#include "mock_StackDistance.h"
 #include "mock_Statistics.h"
 
 #include <stdbool.h>
@@ -58,6 +59,8 @@ void setUp(void)
                                      config.l1.block_size_bytes,
                                      8,
                                      dummy_cache_data);
+    CacheData_PrefetchEnabled_ExpectAndReturn(dummy_cache_data, false);
+    L2Cache_PrefetchEnabled_ExpectAndReturn(dummy_l2_cache, false);
 
     l1_cache = L1Cache_Create(dummy_l2_cache, dummy_cache_stats, &(config.l1));
 }
@@ -454,6 +457,231 @@ void test_WriteDirtyKickout_should_CauseL2Write_then_L2Read(void)
     TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L1Cache_Access(l1_cache, &access));
 }
 
+void test_RepeatedBlockAccess_should_HitWithoutCacheData(void)
+{
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x4cd7f0c00,
+        .n_bytes = 4,
+    };
+
+    result_t result = RESULT_MISS;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+
+    access_t expected_memory_access = {
+        .type = TYPE_READ,
+        .address = access.address,
+        .n_bytes = config.l1.block_size_bytes,
+    };
+    L2Cache_Access_ExpectAndReturn(dummy_l2_cache, &expected_memory_access, 19);
+
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    L1Cache_Access(l1_cache, &access);
+
+    // The rest of the block, read again
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, RESULT_HIT);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, RESULT_HIT);
+    access.address += 4;
+    TEST_ASSERT_EQUAL_UINT32(config.l1.hit_time_cycles, L1Cache_Access(l1_cache, &access));
+    access.address += config.l1.block_size_bytes - 8;
+    TEST_ASSERT_EQUAL_UINT32(config.l1.hit_time_cycles, L1Cache_Access(l1_cache, &access));
+}
+
+void test_WriteAfterRead_should_MarkBlockDirtyOnce(void)
+{
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x4cd7f0c00,
+        .n_bytes = 4,
+    };
+
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    L1Cache_Access(l1_cache, &access);
+
+    // Only the first write has to reach CacheData, to set the dirty bit
+    access.type = TYPE_WRITE;
+    CacheData_Write_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Write_IgnoreArg_result();
+    CacheData_Write_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    L1Cache_Access(l1_cache, &access);
+
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, RESULT_HIT);
+    L1Cache_Access(l1_cache, &access);
+
+    // Another block goes back to CacheData
+    access.address += config.l1.block_size_bytes;
+    CacheData_Write_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Write_IgnoreArg_result();
+    CacheData_Write_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    L1Cache_Access(l1_cache, &access);
+}
+
+void test_AccessSpan_should_LookUpBlockOnce(void)
+{
+    access_t access = {
+        .type = TYPE_WRITE,
+        .address = 0x4cd7f0c00,
+        .n_bytes = 4 * L1_BUS_WIDTH_BYTES,
+    };
+
+    result_t result = RESULT_HIT;
+    CacheData_Write_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Write_IgnoreArg_result();
+    CacheData_Write_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 3);
+
+    uint32_t expected_access_cycles = 4 * config.l1.hit_time_cycles;
+    TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L1Cache_AccessSpan(l1_cache, &access));
+}
+
+void test_AccessSpan_should_LookUpEachBlock_when_SpanCrossesBlocks(void)
+{
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x4cd7f0c00 + config.l1.block_size_bytes - L1_BUS_WIDTH_BYTES,
+        .n_bytes = 3 * L1_BUS_WIDTH_BYTES,
+    };
+
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    // The next block starts with a word of its own, then one more hit
+    CacheData_Read_ExpectAndReturn(dummy_cache_data,
+                                   access.address + L1_BUS_WIDTH_BYTES,
+                                   NULL,
+                                   0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 1);
+
+    uint32_t expected_access_cycles = 3 * config.l1.hit_time_cycles;
+    TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L1Cache_AccessSpan(l1_cache, &access));
+}
+
+void test_AccessSpan_should_CountEachLookup_when_StackDistanceIsAttached(void)
+{
+    stack_distance_t dummy_stack_distance = (stack_distance_t) 8;
+    L1Cache_AttachStackDistance(l1_cache, dummy_stack_distance);
+
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x4cd7f0c00,
+        .n_bytes = 2 * L1_BUS_WIDTH_BYTES,
+    };
+
+    StackDistance_Access_Expect(dummy_stack_distance, access.address, 2, false);
+
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 1);
+
+    // Repeats that skip the cache's data are still counted
+    StackDistance_Access_Expect(dummy_stack_distance, access.address, 2, false);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 1);
+
+    L1Cache_AccessSpan(l1_cache, &access);
+    L1Cache_AccessSpan(l1_cache, &access);
+}
+
+void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void)
+{
+    uint32_t i;
+    for (i = 0; i < CACHE_MAX_STACK_DISTANCES; i++) {
+        L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+    }
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+
+    // Detaching makes room again
+    L1Cache_AttachStackDistance(l1_cache, NULL);
+    L1Cache_AttachStackDistance(l1_cache, (stack_distance_t) 8);
+}
+
+void test_AccessBatch_should_AlignAndSimulateInOrder(void)
+{
+    access_t accesses[] = {
+        { .type = TYPE_INSTR, .address = 0x4cd7f0c02, .n_bytes = 4 },
+        { .type = TYPE_WRITE, .address = 0x4cd7f1000, .n_bytes = 8 },
+    };
+    uint32_t cycles[ARRAY_ELEMENTS(accesses)];
+    uint32_t n_aligned[ARRAY_ELEMENTS(accesses)];
+
+    // The fetch straddles two words of one block
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, 0x4cd7f0c00, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 1);
+
+    CacheData_Write_ExpectAndReturn(dummy_cache_data, 0x4cd7f1000, NULL, 0);
+    CacheData_Write_IgnoreArg_result();
+    CacheData_Write_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+    Statistics_RecordCacheHits_Expect(dummy_cache_stats, 1);
+
+    L1Cache_AccessBatch(l1_cache, l1_cache, accesses, ARRAY_ELEMENTS(accesses), cycles, n_aligned);
+
+    TEST_ASSERT_EQUAL_UINT32(2, n_aligned[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, n_aligned[1]);
+    TEST_ASSERT_EQUAL_UINT32(2 * config.l1.hit_time_cycles, cycles[0]);
+    TEST_ASSERT_EQUAL_UINT32(2 * config.l1.hit_time_cycles, cycles[1]);
+}
+
+void test_AccessBatch_should_PrefetchAhead_when_CachesAreLarge(void)
+{
+    CacheData_Destroy_Expect(dummy_cache_data);
+    L1Cache_Destroy(l1_cache);
+
+    CacheData_Create_IgnoreAndReturn(dummy_cache_data);
+    CacheData_PrefetchEnabled_ExpectAndReturn(dummy_cache_data, true);
+    L2Cache_PrefetchEnabled_ExpectAndReturn(dummy_l2_cache, true);
+    l1_cache = L1Cache_Create(dummy_l2_cache, dummy_cache_stats, &(config.l1));
+
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x4cd7f0c00,
+        .n_bytes = 4,
+    };
+    uint32_t cycles;
+    uint32_t n_aligned;
+
+    CacheData_Prefetch_Expect(dummy_cache_data, access.address);
+    L2Cache_Prefetch_Expect(dummy_l2_cache, access.address);
+
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    L1Cache_AccessBatch(l1_cache, l1_cache, &access, 1, &cycles, &n_aligned);
+    TEST_ASSERT_EQUAL_UINT32(config.l1.hit_time_cycles, cycles);
+}
+
 /* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
 
 /** @} addtogroup TEST_L1DIRECTMAPPED */
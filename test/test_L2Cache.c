@@ -23,7 +23,9 @@
 #include "ConfigDefaults.h"
 
 #include "mock_CacheData.h"
+#include "mock_L2Stream.h"
 #include "mock_MainMem.h"
+#include "mock_StackDistance.h"
 #include "mock_Statistics.h"
 
 #include <stdbool.h>
@@ -63,7 +65,7 @@ void setUp(void)
     CacheData_Create_ExpectAndReturn(n_blocks,
                                      1,
                                      config.l2.block_size_bytes,
-                                     8,
+                                     victim_cache_len,
                                      dummy_cache_data);
 
     l2_cache = L2Cache_Create(dummy_main_mem, dummy_cache_stats, &(config.l2));
@@ -477,6 +479,96 @@ void test_WriteDirtyKickout_should_CauseWriteback(void)
     TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L2Cache_Access(l2_cache, &access));
 }
 
+void test_Access_should_CountEachAccess_when_StackDistancesAreAttached(void)
+{
+    stack_distance_t dummy_stack_distances[] = {
+        (stack_distance_t) 8,
+        (stack_distance_t) 16,
+    };
+    L2Cache_AttachStackDistance(l2_cache, dummy_stack_distances[0]);
+    L2Cache_AttachStackDistance(l2_cache, dummy_stack_distances[1]);
+
+    access_t access = {
+        .type = TYPE_WRITE,
+        .address = 0x10123400,
+        .n_bytes = config.l1.block_size_bytes,
+    };
+
+    StackDistance_Access_Expect(dummy_stack_distances[0], access.address, 1, true);
+    StackDistance_Access_Expect(dummy_stack_distances[1], access.address, 1, true);
+
+    result_t result = RESULT_HIT;
+    CacheData_Write_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Write_IgnoreArg_result();
+    CacheData_Write_ReturnThruPtr_result(&result);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    // Repeats that skip the cache's data are still counted
+    StackDistance_Access_Expect(dummy_stack_distances[0], access.address, 1, true);
+    StackDistance_Access_Expect(dummy_stack_distances[1], access.address, 1, true);
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    L2Cache_Access(l2_cache, &access);
+    L2Cache_Access(l2_cache, &access);
+}
+
+void test_AttachStackDistance_should_ThrowException_when_TooManyAreAttached(void)
+{
+    uint32_t i;
+    for (i = 0; i < CACHE_MAX_STACK_DISTANCES; i++) {
+        L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+    }
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+
+    // Detaching makes room again
+    L2Cache_AttachStackDistance(l2_cache, NULL);
+    L2Cache_AttachStackDistance(l2_cache, (stack_distance_t) 8);
+}
+
+void test_Access_should_RecordAccessAndCycles_when_CaptureIsAttached(void)
+{
+    l2_stream_writer_t dummy_writer = (l2_stream_writer_t) 8;
+    L2Cache_AttachCapture(l2_cache, dummy_writer);
+
+    access_t access = {
+        .type = TYPE_READ,
+        .address = 0x10123400,
+        .n_bytes = config.l1.block_size_bytes,
+    };
+
+    result_t result = RESULT_HIT;
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    uint32_t expected_access_cycles = config.l2.hit_time_cycles +
+                                      l1_block_transfer_cycles;
+    L2Stream_Record_Expect(dummy_writer, &access, expected_access_cycles);
+
+    TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L2Cache_Access(l2_cache, &access));
+
+    // Detaching stops the recording
+    L2Cache_AttachCapture(l2_cache, NULL);
+    access.address += config.l2.block_size_bytes;
+
+    CacheData_Read_ExpectAndReturn(dummy_cache_data, access.address, NULL, 0);
+    CacheData_Read_IgnoreArg_result();
+    CacheData_Read_ReturnThruPtr_result(&result);
+
+    Statistics_RecordCacheAccess_Expect(dummy_cache_stats, result);
+
+    TEST_ASSERT_EQUAL_UINT32(expected_access_cycles, L2Cache_Access(l2_cache, &access));
+}
+
 /* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
 
 /** @} addtogroup TEST_L2CACHE */
@@ -0,0 +1,234 @@
+/**
+ * @file    test_L2Stream.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestL2Stream Source
+ *
+ * @addtogroup TEST_L2STREAM
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "L2Stream.h"
+
+#include "Access.h"
+#include "Config.h"
+#include "Statistics.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define STREAM_PATH         "build/test/test_L2Stream.bin"
+#define BLOCK_SIZE_BYTES    (32)
+
+/**@brief   Accesses in the round trip. Enough to fill the buffers many times */
+#define N_ACCESSES          (100000)
+
+/**@brief   Accesses read at once. Not a multiple of anything */
+#define BATCH_LEN           (777)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static cache_param_t const l1_config = {
+    .block_size_bytes     = BLOCK_SIZE_BYTES,
+    .cache_size_bytes     = 8192,
+    .associativity        = 2,
+    .hit_time_cycles      = 1,
+    .miss_time_cycles     = 1,
+    .transfer_time_cycles = 0,
+    .bus_width_bytes      = 4,
+};
+
+static l2_stream_writer_t writer;
+static l2_stream_reader_t reader;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    remove(STREAM_PATH);
+    writer = NULL;
+    reader = NULL;
+}
+
+void tearDown(void)
+{
+    L2Stream_DestroyWriter(writer);
+    L2Stream_DestroyReader(reader);
+    remove(STREAM_PATH);
+}
+
+void test_L2Stream_CreateReader_should_ThrowException_when_FileIsMissing(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        reader = L2Stream_CreateReader(STREAM_PATH);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_L2Stream_CreateReader_should_ThrowException_when_StreamIsNotFinished(void)
+{
+    writer = L2Stream_CreateWriter(STREAM_PATH, &l1_config);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = BLOCK_SIZE_BYTES };
+    L2Stream_Record(writer, &access, 10);
+    L2Stream_DestroyWriter(writer);
+    writer = NULL;
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        reader = L2Stream_CreateReader(STREAM_PATH);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_L2Stream_Record_should_ThrowException_when_AccessIsNotABlock(void)
+{
+    writer = L2Stream_CreateWriter(STREAM_PATH, &l1_config);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = 4 };
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        L2Stream_Record(writer, &access, 10);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+
+    e = CEXCEPTION_NONE;
+    Try {
+        L2Stream_SetOrigin(writer, 'X');
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(INVALID_OPERATION, e);
+}
+
+void test_L2Stream_Read_should_ReturnEveryAccessInOrder(void)
+{
+    static access_t accesses[N_ACCESSES];
+    static uint8_t origins[N_ACCESSES];
+    uint8_t const types[] = { TYPE_INSTR, TYPE_READ, TYPE_WRITE };
+
+    writer = L2Stream_CreateWriter(STREAM_PATH, &l1_config);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    // Addresses both near the last and far from it, in both directions
+    uint32_t state = 42;
+    uint32_t i;
+    for (i = 0; i < N_ACCESSES; i++) {
+        state = state * 1103515245 + 12345;
+        origins[i] = types[(state >> 28) % 3];
+        accesses[i].type    = (state >> 27) & 1 ? TYPE_WRITE : TYPE_READ;
+        accesses[i].n_bytes = BLOCK_SIZE_BYTES;
+        accesses[i].address = (state >> 26) & 1 ?
+                              (uint64_t) state << 20 :
+                              0x7fff0000 + ((state >> 8) & 0xff) * BLOCK_SIZE_BYTES + (state & 3) * 4;
+
+        L2Stream_SetOrigin(writer, origins[i]);
+        L2Stream_Record(writer, &accesses[i], 0);
+    }
+
+    stats_t stats;
+    Statistics_Create(&stats);
+    L2Stream_Finish(writer, &stats);
+    L2Stream_DestroyWriter(writer);
+    writer = NULL;
+
+    reader = L2Stream_CreateReader(STREAM_PATH);
+    TEST_ASSERT_NOT_NULL(reader);
+
+    uint32_t n_read = 0;
+    while (true) {
+        access_t batch[BATCH_LEN];
+        uint8_t batch_origins[BATCH_LEN];
+        uint32_t n = L2Stream_Read(reader, batch, batch_origins, BATCH_LEN);
+        if (n == 0) {
+            break;
+        }
+
+        TEST_ASSERT_TRUE(n_read + n <= N_ACCESSES);
+        for (i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_HEX8(accesses[n_read + i].type, batch[i].type);
+            TEST_ASSERT_EQUAL_HEX64(accesses[n_read + i].address, batch[i].address);
+            TEST_ASSERT_EQUAL_UINT32(BLOCK_SIZE_BYTES, batch[i].n_bytes);
+            TEST_ASSERT_EQUAL_HEX8(origins[n_read + i], batch_origins[i]);
+        }
+        n_read += n;
+    }
+    TEST_ASSERT_EQUAL_UINT32(N_ACCESSES, n_read);
+}
+
+void test_L2Stream_ReadStats_should_LeaveOut_CyclesSpentInL2(void)
+{
+    writer = L2Stream_CreateWriter(STREAM_PATH, &l1_config);
+    TEST_ASSERT_NOT_NULL(writer);
+
+    access_t access = { .type = TYPE_READ, .address = 0x1000, .n_bytes = BLOCK_SIZE_BYTES };
+    L2Stream_SetOrigin(writer, TYPE_INSTR);
+    L2Stream_Record(writer, &access, 40);
+    L2Stream_SetOrigin(writer, TYPE_WRITE);
+    L2Stream_Record(writer, &access, 50);
+    access.type = TYPE_WRITE;
+    L2Stream_Record(writer, &access, 60);
+
+    stats_t stats;
+    Statistics_Create(&stats);
+    Statistics_RecordAccess(&stats, TYPE_INSTR, 42, 1);
+    Statistics_RecordAccess(&stats, TYPE_WRITE, 112, 2);
+    Statistics_RecordAccess(&stats, TYPE_READ, 1, 1);
+    stats.l1i.miss_count     = 1;
+    stats.l1d.hit_count      = 1;
+    stats.l1d.miss_count     = 1;
+    stats.l1d.dirty_kickouts = 1;
+    L2Stream_Finish(writer, &stats);
+    L2Stream_DestroyWriter(writer);
+    writer = NULL;
+
+    reader = L2Stream_CreateReader(STREAM_PATH);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_MEMORY(&l1_config, L2Stream_Config(reader), sizeof(l1_config));
+
+    stats_t replayed;
+    Statistics_Create(&replayed);
+    L2Stream_ReadStats(reader, &replayed);
+
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.instr_count);
+    TEST_ASSERT_EQUAL_UINT64(2, replayed.instr_cycles);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.write_count);
+    TEST_ASSERT_EQUAL_UINT64(2, replayed.write_count_aligned);
+    TEST_ASSERT_EQUAL_UINT64(2, replayed.write_cycles);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.read_count);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.read_cycles);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.l1i.miss_count);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.l1d.hit_count);
+    TEST_ASSERT_EQUAL_UINT64(1, replayed.l1d.dirty_kickouts);
+    TEST_ASSERT_EQUAL_UINT64(0, replayed.l2.miss_count);
+    TEST_ASSERT_EQUAL_STRING(stats.l1d.name, replayed.l1d.name);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+/** @} addtogroup TEST_L2STREAM */
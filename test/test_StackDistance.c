@@ -0,0 +1,317 @@
+/**
+ * @file    test_StackDistance.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestStackDistance Source
+ *
+ * @addtogroup TEST_STACKDISTANCE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "StackDistance.h"
+
+#include "CacheData.h"
+#include "TagSearch.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define BLOCK_SIZE_BYTES    (16)
+
+/**@brief   Sizes compared, from one set up */
+#define N_SIZES             (8)
+
+/**@brief   Size of every cache compared across associativities. Its ways
+ *          range from @ref N_SIZES blocks down to one
+ */
+#define ALL_WAYS_SIZE_BYTES (128 * BLOCK_SIZE_BYTES)
+
+/**@brief   Associativities compared at @ref ALL_WAYS_SIZE_BYTES. No more
+ *          than @ref N_SIZES
+ */
+#define N_WAYS              (8)
+
+/**@brief   Distinct blocks touched. More than the largest cache holds */
+#define N_BLOCKS            (3000)
+
+/**@brief   Accesses made in each comparison. Enough to compact every stack
+ *          many times over
+ */
+#define N_ACCESSES          (200000)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Run the same accesses through a stack distance counter for every
+ *          size at @p associativity, and a cache without a victim set for
+ *          each, which must count the same
+ */
+static void compare_with_caches(uint32_t associativity);
+
+/**@brief   Run accesses through @p stack_distance and the caches it counts,
+ *          checking each cache's hits, misses and kickouts
+ *
+ * @param[in] hot_blocks:   Blocks most accesses go to
+ */
+static void run_and_compare(uint32_t n_caches, uint32_t hot_blocks);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static stack_distance_t stack_distance;
+static cache_data_t caches[N_SIZES];
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    stack_distance = NULL;
+
+    uint32_t i;
+    for (i = 0; i < N_SIZES; i++) {
+        caches[i] = NULL;
+    }
+}
+
+void tearDown(void)
+{
+    StackDistance_Destroy(stack_distance);
+
+    uint32_t i;
+    for (i = 0; i < N_SIZES; i++) {
+        CacheData_Destroy(caches[i]);
+    }
+}
+
+void test_StackDistance_Create_should_ThrowException_when_ParameterIsOutOfRange(void)
+{
+    uint32_t const params[][3] = {
+        { 24, 1, N_SIZES },
+        { BLOCK_SIZE_BYTES, 0, N_SIZES },
+        { BLOCK_SIZE_BYTES, 1, 0 },
+        { BLOCK_SIZE_BYTES, 1, STACK_DISTANCE_MAX_CACHES + 1 },
+    };
+
+    uint32_t i;
+    for (i = 0; i < ARRAY_ELEMENTS(params); i++) {
+        CEXCEPTION_T e = CEXCEPTION_NONE;
+        Try {
+            StackDistance_Create(params[i][0], params[i][1], params[i][2]);
+        }
+        Catch (e) {
+        }
+        TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+    }
+}
+
+void test_StackDistance_SizeBytes_should_DoubleFromOneSet(void)
+{
+    stack_distance = StackDistance_Create(BLOCK_SIZE_BYTES, 4, N_SIZES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    TEST_ASSERT_EQUAL_UINT32(N_SIZES, StackDistance_Caches(stack_distance));
+    TEST_ASSERT_EQUAL_UINT64(64, StackDistance_SizeBytes(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(64 << (N_SIZES - 1), StackDistance_SizeBytes(stack_distance, N_SIZES - 1));
+}
+
+void test_StackDistance_Access_should_CountRepeatsAsHits(void)
+{
+    stack_distance = StackDistance_Create(BLOCK_SIZE_BYTES, 1, N_SIZES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    StackDistance_Access(stack_distance, 0x1004, 3, false);
+    StackDistance_Access(stack_distance, 0x100c, 1, true);
+
+    uint32_t i;
+    for (i = 0; i < N_SIZES; i++) {
+        TEST_ASSERT_EQUAL_UINT64(3, StackDistance_Hits(stack_distance, i));
+        TEST_ASSERT_EQUAL_UINT64(1, StackDistance_Misses(stack_distance, i));
+    }
+}
+
+void test_StackDistance_Access_should_SeeConflicts_only_when_SetsAreShared(void)
+{
+    stack_distance = StackDistance_Create(BLOCK_SIZE_BYTES, 1, N_SIZES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    // Two blocks that share a set in the two smallest caches alone
+    uint32_t i;
+    for (i = 0; i < 5; i++) {
+        StackDistance_Access(stack_distance, 0x4000, 1, false);
+        StackDistance_Access(stack_distance, 0x4000 + 2 * BLOCK_SIZE_BYTES, 1, false);
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(0,  StackDistance_Hits(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(10, StackDistance_Misses(stack_distance, 1));
+    TEST_ASSERT_EQUAL_UINT64(0,  StackDistance_Hits(stack_distance, 1));
+    TEST_ASSERT_EQUAL_UINT64(8,  StackDistance_Hits(stack_distance, 2));
+    TEST_ASSERT_EQUAL_UINT64(2,  StackDistance_Misses(stack_distance, 2));
+    TEST_ASSERT_EQUAL_UINT64(9,  StackDistance_Kickouts(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(0,  StackDistance_Kickouts(stack_distance, 2));
+}
+
+void test_StackDistance_CreateAllWays_should_ThrowException_when_ParameterIsOutOfRange(void)
+{
+    uint32_t const params[][2] = {
+        { 24, 24 * 16 },
+        { BLOCK_SIZE_BYTES, BLOCK_SIZE_BYTES / 2 },
+        { BLOCK_SIZE_BYTES, 3 * BLOCK_SIZE_BYTES },
+        { BLOCK_SIZE_BYTES, BLOCK_SIZE_BYTES << STACK_DISTANCE_MAX_CACHES },
+    };
+
+    uint32_t i;
+    for (i = 0; i < ARRAY_ELEMENTS(params); i++) {
+        CEXCEPTION_T e = CEXCEPTION_NONE;
+        Try {
+            StackDistance_CreateAllWays(params[i][0], params[i][1]);
+        }
+        Catch (e) {
+        }
+        TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+    }
+}
+
+void test_StackDistance_CreateAllWays_should_HalveWaysFromFullyAssociative(void)
+{
+    stack_distance = StackDistance_CreateAllWays(BLOCK_SIZE_BYTES, ALL_WAYS_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    TEST_ASSERT_EQUAL_UINT32(N_WAYS, StackDistance_Caches(stack_distance));
+
+    uint32_t i;
+    for (i = 0; i < N_WAYS; i++) {
+        TEST_ASSERT_EQUAL_UINT32(128 >> i, StackDistance_Ways(stack_distance, i));
+        TEST_ASSERT_EQUAL_UINT64(ALL_WAYS_SIZE_BYTES, StackDistance_SizeBytes(stack_distance, i));
+    }
+}
+
+void test_StackDistance_Access_should_CountDirtyKickouts_only_when_Written(void)
+{
+    stack_distance = StackDistance_CreateAllWays(BLOCK_SIZE_BYTES, 2 * BLOCK_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    // Three blocks, then the first again. All share the two-way cache's one
+    // set, but only the first two share a set in the direct-mapped one. Each
+    // kicks out the first block, dirty, then the second, clean
+    StackDistance_Access(stack_distance, 0x8000, 1, true);
+    StackDistance_Access(stack_distance, 0x8000 + 2 * BLOCK_SIZE_BYTES, 1, false);
+    StackDistance_Access(stack_distance, 0x8000 + 1 * BLOCK_SIZE_BYTES, 1, false);
+    StackDistance_Access(stack_distance, 0x8000, 1, false);
+
+    TEST_ASSERT_EQUAL_UINT64(2, StackDistance_Kickouts(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(1, StackDistance_DirtyKickouts(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(2, StackDistance_Kickouts(stack_distance, 1));
+    TEST_ASSERT_EQUAL_UINT64(1, StackDistance_DirtyKickouts(stack_distance, 1));
+    TEST_ASSERT_EQUAL_UINT64(4, StackDistance_Misses(stack_distance, 0));
+    TEST_ASSERT_EQUAL_UINT64(4, StackDistance_Misses(stack_distance, 1));
+}
+
+void test_StackDistance_should_MatchCaches_when_DirectMapped(void)
+{
+    compare_with_caches(1);
+}
+
+void test_StackDistance_should_MatchCaches_when_FourWay(void)
+{
+    compare_with_caches(4);
+}
+
+void test_StackDistance_should_MatchCaches_when_HighlyAssociative(void)
+{
+    compare_with_caches(32);
+}
+
+void test_StackDistance_should_MatchCaches_when_EveryAssociativity(void)
+{
+    stack_distance = StackDistance_CreateAllWays(BLOCK_SIZE_BYTES, ALL_WAYS_SIZE_BYTES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    uint32_t i;
+    for (i = 0; i < N_WAYS; i++) {
+        caches[i] = CacheData_Create(1u << i, 128 >> i, BLOCK_SIZE_BYTES, 0);
+        TEST_ASSERT_NOT_NULL(caches[i]);
+    }
+
+    run_and_compare(N_WAYS, 160);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void compare_with_caches(uint32_t associativity)
+{
+    stack_distance = StackDistance_Create(BLOCK_SIZE_BYTES, associativity, N_SIZES);
+    TEST_ASSERT_NOT_NULL(stack_distance);
+
+    uint32_t i;
+    for (i = 0; i < N_SIZES; i++) {
+        caches[i] = CacheData_Create(1u << i, associativity, BLOCK_SIZE_BYTES, 0);
+        TEST_ASSERT_NOT_NULL(caches[i]);
+    }
+
+    run_and_compare(N_SIZES, N_BLOCKS / 16);
+}
+
+static void run_and_compare(uint32_t n_caches, uint32_t hot_blocks)
+{
+    uint64_t hits[N_SIZES]           = { 0 };
+    uint64_t misses[N_SIZES]         = { 0 };
+    uint64_t kickouts[N_SIZES]       = { 0 };
+    uint64_t dirty_kickouts[N_SIZES] = { 0 };
+
+    // Most accesses go to a few hot blocks, so every cache sees some hits
+    uint32_t state = 99;
+    uint32_t n;
+    for (n = 0; n < N_ACCESSES; n++) {
+        state = state * 1103515245 + 12345;
+        uint32_t range = (state >> 30) == 0 ? N_BLOCKS : hot_blocks;
+        uint64_t address = 0x30000000 + ((state >> 8) % range) * BLOCK_SIZE_BYTES +
+                           (state >> 4) % BLOCK_SIZE_BYTES;
+        bool write = (state >> 29) & 1;
+
+        StackDistance_Access(stack_distance, address, 1, write);
+
+        uint32_t i;
+        for (i = 0; i < n_caches; i++) {
+            result_t result;
+            if (write) {
+                CacheData_Write(caches[i], address, &result);
+            }
+            else {
+                CacheData_Read(caches[i], address, &result);
+            }
+
+            if (result == RESULT_HIT) {
+                hits[i]++;
+            }
+            else {
+                misses[i]++;
+            }
+            if (result == RESULT_MISS_KICKOUT || result == RESULT_MISS_DIRTY_KICKOUT) {
+                kickouts[i]++;
+            }
+            if (result == RESULT_MISS_DIRTY_KICKOUT) {
+                dirty_kickouts[i]++;
+            }
+        }
+    }
+
+    uint32_t i;
+    for (i = 0; i < n_caches; i++) {
+        TEST_ASSERT_EQUAL_UINT64(hits[i],           StackDistance_Hits(stack_distance, i));
+        TEST_ASSERT_EQUAL_UINT64(misses[i],         StackDistance_Misses(stack_distance, i));
+        TEST_ASSERT_EQUAL_UINT64(kickouts[i],       StackDistance_Kickouts(stack_distance, i));
+        TEST_ASSERT_EQUAL_UINT64(dirty_kickouts[i], StackDistance_DirtyKickouts(stack_distance, i));
+    }
+}
+
+/** @} addtogroup TEST_STACKDISTANCE */
@@ -172,6 +172,19 @@ void test_Statistics_RecordAccess_should_RecordMultipleAccesses(void)
     TEST_ASSERT_EQUAL_UINT64(cycles*3, stats.read_cycles);
 }
 
+void test_Statistics_RecordCycles_should_AddCyclesWithoutCountingAccesses(void)
+{
+    Statistics_RecordAccess(&stats, TYPE_WRITE, 21, 1);
+    Statistics_RecordCycles(&stats, TYPE_WRITE, 100);
+    Statistics_RecordCycles(&stats, TYPE_INSTR, 7);
+
+    TEST_ASSERT_EQUAL_UINT64(1,   stats.write_count);
+    TEST_ASSERT_EQUAL_UINT64(121, stats.write_cycles);
+    TEST_ASSERT_EQUAL_UINT64(0,   stats.instr_count);
+    TEST_ASSERT_EQUAL_UINT64(7,   stats.instr_cycles);
+    TEST_ASSERT_EQUAL_UINT64(0,   stats.read_cycles);
+}
+
 void test_Statistics_RecordCacheAccess_should_RecordCacheHit(void)
 {
     Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT);
@@ -184,6 +197,19 @@ void test_Statistics_RecordCacheAccess_should_RecordCacheHit(void)
     TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.vc_hit_count);
 }
 
+void test_Statistics_RecordCacheHits_should_RecordOnlyHits(void)
+{
+    Statistics_RecordCacheHits(&(stats.l1d), 7);
+    Statistics_RecordCacheHits(&(stats.l1d), 0);
+
+    TEST_ASSERT_EQUAL_UINT64(7, stats.l1d.hit_count);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.miss_count);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.kickouts);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.dirty_kickouts);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.transfers);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.l1d.vc_hit_count);
+}
+
 void test_Statistics_RecordCacheAccess_should_RecordVictimCacheHit(void)
 {
     Statistics_RecordCacheAccess(&(stats.l1d), RESULT_HIT_VICTIM_CACHE);
@@ -0,0 +1,126 @@
+/**
+ * @file    test_TagSearch.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestTagSearch Source
+ *
+ * @addtogroup TEST_TAGSEARCH
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "TagSearch.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include <stdint.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Length of the test array. Two whole groups */
+#define N_ADDRESSES     (2 * TAG_SEARCH_WIDTH)
+
+/**@brief   Held by unused entries, as in a cache set */
+#define EMPTY_ADDRESS   (UINT64_MAX)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static uint64_t addresses[N_ADDRESSES];
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    uint32_t i;
+    for (i = 0; i < N_ADDRESSES; i++) {
+        addresses[i] = 0x1000 + 0x40 * i;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+void test_TagSearch_Get_should_AlwaysProvideScalarAndBest(void)
+{
+    TEST_ASSERT_NOT_NULL(TagSearch_Get(TAG_SEARCH_SCALAR));
+    TEST_ASSERT_NOT_NULL(TagSearch_Get(TagSearch_BestLevel()));
+    TEST_ASSERT_NULL(TagSearch_Get(TAG_SEARCH_N_LEVELS));
+}
+
+void test_TagSearch_should_FindEveryPosition(void)
+{
+    tag_search_level_t level;
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+        tag_search_t search = TagSearch_Get(level);
+        if (search == NULL) {
+            continue;
+        }
+
+        uint32_t i;
+        for (i = 0; i < N_ADDRESSES; i++) {
+            TEST_ASSERT_EQUAL_UINT32(i, search(addresses, N_ADDRESSES, addresses[i]));
+        }
+        TEST_ASSERT_EQUAL_UINT32(TAG_SEARCH_NO_MATCH, search(addresses, N_ADDRESSES, 0x40));
+        TEST_ASSERT_EQUAL_UINT32(TAG_SEARCH_NO_MATCH, search(addresses, 0, addresses[0]));
+    }
+}
+
+void test_TagSearch_should_ReturnFirstMatch(void)
+{
+    addresses[3]                    = addresses[11];
+    addresses[TAG_SEARCH_WIDTH + 5] = addresses[11];
+
+    tag_search_level_t level;
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+        tag_search_t search = TagSearch_Get(level);
+        if (search != NULL) {
+            TEST_ASSERT_EQUAL_UINT32(3, search(addresses, N_ADDRESSES, addresses[11]));
+        }
+    }
+}
+
+void test_TagSearch_should_CompareWholeAddress(void)
+{
+    // Matches in either half alone are not matches
+    addresses[2] = 0x0000000100001000;
+    addresses[5] = 0x0000000200001000;
+    uint64_t address = 0x0000000300001000;
+
+    tag_search_level_t level;
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+        tag_search_t search = TagSearch_Get(level);
+        if (search != NULL) {
+            TEST_ASSERT_EQUAL_UINT32(TAG_SEARCH_NO_MATCH, search(addresses, N_ADDRESSES, address));
+            TEST_ASSERT_EQUAL_UINT32(5, search(addresses, N_ADDRESSES, addresses[5]));
+        }
+    }
+}
+
+void test_TagSearch_should_SearchPartialGroup_when_RestIsEmpty(void)
+{
+    uint32_t i;
+    for (i = 3; i < N_ADDRESSES; i++) {
+        addresses[i] = EMPTY_ADDRESS;
+    }
+
+    tag_search_level_t level;
+    for (level = TAG_SEARCH_SCALAR; level < TAG_SEARCH_N_LEVELS; level++) {
+        tag_search_t search = TagSearch_Get(level);
+        if (search != NULL) {
+            TEST_ASSERT_EQUAL_UINT32(2, search(addresses, 3, addresses[2]));
+            TEST_ASSERT_EQUAL_UINT32(TAG_SEARCH_NO_MATCH, search(addresses, 3, 0x1000 + 0x40 * 4));
+        }
+    }
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+/** @} addtogroup TEST_TAGSEARCH */
@@ -0,0 +1,203 @@
+/**
+ * @file    test_TraceCache.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestTraceCache Source
+ *
+ * @addtogroup TEST_TRACECACHE
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "TraceCache.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockStream.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "GzipStream.h"
+#include "TraceReader.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define TEXT_TRACE      "traces/traces-short/tr1"
+#define OTHER_TRACE     "traces/traces-short/tr2"
+#define BINARY_TRACE    "build/test/test_TraceCache.bin"
+#define CACHE_DIR       "build/test/test_TraceCache"
+
+/**@brief   Most accesses read from the short traces */
+#define MAX_ACCESSES    (64)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Read every access in @p path */
+static uint32_t read_trace(char const * path, access_t * accesses);
+
+/**@brief   Delete the cache directory and everything in it */
+static void remove_cache(void);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static trace_cache_t cache;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    remove_cache();
+    cache = NULL;
+}
+
+void tearDown(void)
+{
+    TraceCache_Destroy(cache);
+    remove_cache();
+    remove(BINARY_TRACE);
+}
+
+void test_TraceCache_Create_should_Record_when_TraceIsNotCached(void)
+{
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_TRUE(TraceCache_Recording(cache));
+}
+
+void test_TraceCache_Create_should_NotRecord_when_NotAsked(void)
+{
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, false);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_FALSE(TraceCache_Recording(cache));
+}
+
+void test_TraceCache_Commit_should_AddCopyMatchingTrace(void)
+{
+    access_t expected[MAX_ACCESSES];
+    uint32_t n_expected = read_trace(TEXT_TRACE, expected);
+
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TraceCache_Record(cache, expected, n_expected);
+    TEST_ASSERT_TRUE(TraceCache_Commit(cache));
+    TEST_ASSERT_NOT_NULL(TraceCache_Path(cache));
+    TraceCache_Destroy(cache);
+
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TEST_ASSERT_FALSE(TraceCache_Recording(cache));
+    TEST_ASSERT_NOT_NULL(TraceCache_Path(cache));
+
+    access_t actual[MAX_ACCESSES];
+    uint32_t n_actual = read_trace(TraceCache_Path(cache), actual);
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceCache_Create_should_Miss_when_TraceDiffers(void)
+{
+    access_t accesses[MAX_ACCESSES];
+    uint32_t n_accesses = read_trace(TEXT_TRACE, accesses);
+
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TraceCache_Record(cache, accesses, n_accesses);
+    TEST_ASSERT_TRUE(TraceCache_Commit(cache));
+    TraceCache_Destroy(cache);
+
+    cache = TraceCache_Create(CACHE_DIR, OTHER_TRACE, true);
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_TRUE(TraceCache_Recording(cache));
+}
+
+void test_TraceCache_Destroy_should_DiscardCopy_when_NotCommitted(void)
+{
+    access_t accesses[MAX_ACCESSES];
+    read_trace(TEXT_TRACE, accesses);
+
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TraceCache_Record(cache, accesses, 2);
+    TraceCache_Destroy(cache);
+
+    cache = TraceCache_Create(CACHE_DIR, TEXT_TRACE, true);
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_TRUE(TraceCache_Recording(cache));
+}
+
+void test_TraceCache_Create_should_NotRecord_when_TraceIsBinary(void)
+{
+    FILE * file = fopen(BINARY_TRACE, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    BinaryTrace_WriteHeader(file, 0);
+    fclose(file);
+
+    cache = TraceCache_Create(CACHE_DIR, BINARY_TRACE, true);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_FALSE(TraceCache_Recording(cache));
+    TEST_ASSERT_FALSE(TraceCache_Commit(cache));
+}
+
+void test_TraceCache_Create_should_NotRecord_when_DirectoryCannotBeCreated(void)
+{
+    cache = TraceCache_Create(CACHE_DIR "/missing/cache", TEXT_TRACE, true);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_NULL(TraceCache_Path(cache));
+    TEST_ASSERT_FALSE(TraceCache_Recording(cache));
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint32_t read_trace(char const * path, access_t * accesses)
+{
+    trace_reader_t reader = TraceReader_Create(path, false);
+    TEST_ASSERT_NOT_NULL(reader);
+    uint32_t n_accesses = TraceReader_Read(reader, accesses, MAX_ACCESSES);
+    TEST_ASSERT_TRUE(n_accesses < MAX_ACCESSES);
+    TraceReader_Destroy(reader);
+
+    return n_accesses;
+}
+
+static void remove_cache(void)
+{
+    DIR * dir = opendir(CACHE_DIR);
+    if (dir == NULL) {
+        return;
+    }
+
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", CACHE_DIR, entry->d_name);
+        if (entry->d_name[0] != '.') {
+            unlink(path);
+        }
+    }
+    closedir(dir);
+    rmdir(CACHE_DIR);
+}
+
+/** @} addtogroup TEST_TRACECACHE */
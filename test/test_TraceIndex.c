@@ -0,0 +1,256 @@
+/**
+ * @file    test_TraceIndex.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestTraceIndex Source
+ *
+ * @addtogroup TEST_TRACEINDEX
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "TraceIndex.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockStream.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "GzipStream.h"
+#include "TraceReader.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <dirent.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define TEXT_TRACE      "traces/traces-short/tr3"
+#define BINARY_TRACE    "build/test/test_TraceIndex.bin"
+#define INDEX_DIR       "build/test/test_TraceIndex"
+
+/**@brief   References in @ref TEXT_TRACE */
+#define N_ACCESSES      (50)
+
+/**@brief   References between checkpoints in the test index */
+#define INTERVAL        (8)
+
+/**@brief   Accesses read at once. Not a multiple of @ref INTERVAL, so reads
+ *          must be limited to stop at checkpoints
+ */
+#define BATCH_LEN       (5)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Read the rest of the trace through @p index, as the simulator does
+ *
+ * @return  The number of accesses read
+ */
+static uint32_t read_through(trace_reader_t reader, trace_index_t index, access_t * accesses);
+
+/**@brief   Delete the index directory and everything in it */
+static void remove_index(void);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static trace_index_t trace_index;
+static trace_reader_t reader;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    remove_index();
+    trace_index = NULL;
+    reader      = NULL;
+}
+
+void tearDown(void)
+{
+    TraceIndex_Destroy(trace_index);
+    TraceReader_Destroy(reader);
+    remove_index();
+    remove(BINARY_TRACE);
+}
+
+void test_TraceIndex_Create_should_ThrowException_when_IntervalIsZero(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        TraceIndex_Create(INDEX_DIR, TEXT_TRACE, 0);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_TraceIndex_Create_should_BeInactive_when_TraceIsBinary(void)
+{
+    FILE * file = fopen(BINARY_TRACE, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    BinaryTrace_WriteHeader(file, 0);
+    fclose(file);
+
+    trace_index = TraceIndex_Create(INDEX_DIR, BINARY_TRACE, INTERVAL);
+    TEST_ASSERT_NOT_NULL(trace_index);
+    TEST_ASSERT_FALSE(TraceIndex_Active(trace_index));
+    TEST_ASSERT_EQUAL_UINT32(1000, TraceIndex_Limit(trace_index, 1000));
+
+    trace_checkpoint_t checkpoint;
+    TraceIndex_Seek(trace_index, 20, &checkpoint);
+    TEST_ASSERT_EQUAL_UINT64(0, checkpoint.record);
+    TEST_ASSERT_EQUAL_UINT64(0, checkpoint.offset);
+}
+
+void test_TraceIndex_Limit_should_StopReadsAtNextCheckpoint(void)
+{
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, INTERVAL);
+    TEST_ASSERT_TRUE(TraceIndex_Active(trace_index));
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL, TraceIndex_Limit(trace_index, 1000));
+
+    access_t accesses[N_ACCESSES];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    uint32_t n_read = TraceReader_Read(reader, accesses, 3);
+    TraceIndex_Record(trace_index, accesses, n_read, TraceReader_Offset(reader));
+
+    TEST_ASSERT_EQUAL_UINT32(INTERVAL - 3, TraceIndex_Limit(trace_index, 1000));
+    TEST_ASSERT_EQUAL_UINT32(2, TraceIndex_Limit(trace_index, 2));
+}
+
+void test_TraceIndex_Record_should_AddCheckpointEveryInterval(void)
+{
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, INTERVAL);
+    reader = TraceReader_Create(TEXT_TRACE, false);
+
+    access_t accesses[N_ACCESSES];
+    TEST_ASSERT_EQUAL_UINT32(N_ACCESSES, read_through(reader, trace_index, accesses));
+    TEST_ASSERT_EQUAL_UINT64(1 + N_ACCESSES / INTERVAL, TraceIndex_Checkpoints(trace_index));
+
+    // The counts at a checkpoint cover every access before it
+    trace_checkpoint_t expected;
+    memset(&expected, 0, sizeof(expected));
+    uint32_t i;
+    for (i = 0; i < 3 * INTERVAL; i++) {
+        access_t aligned;
+        Access_Align(&aligned, &accesses[i], 4);
+        if (accesses[i].type == TYPE_READ) {
+            expected.read_count++;
+            expected.read_count_aligned += aligned.n_bytes >> 2;
+        }
+        else if (accesses[i].type == TYPE_WRITE) {
+            expected.write_count++;
+            expected.write_count_aligned += aligned.n_bytes >> 2;
+        }
+        else {
+            expected.instr_count++;
+            expected.instr_count_aligned += aligned.n_bytes >> 2;
+        }
+    }
+
+    trace_checkpoint_t checkpoint;
+    TraceIndex_Seek(trace_index, 3 * INTERVAL + 1, &checkpoint);
+    TEST_ASSERT_EQUAL_UINT64(3 * INTERVAL, checkpoint.record);
+    TEST_ASSERT_EQUAL_UINT64(expected.read_count, checkpoint.read_count);
+    TEST_ASSERT_EQUAL_UINT64(expected.read_count_aligned, checkpoint.read_count_aligned);
+    TEST_ASSERT_EQUAL_UINT64(expected.write_count, checkpoint.write_count);
+    TEST_ASSERT_EQUAL_UINT64(expected.write_count_aligned, checkpoint.write_count_aligned);
+    TEST_ASSERT_EQUAL_UINT64(expected.instr_count, checkpoint.instr_count);
+    TEST_ASSERT_EQUAL_UINT64(expected.instr_count_aligned, checkpoint.instr_count_aligned);
+}
+
+void test_TraceIndex_Seek_should_FindLineInSavedIndex(void)
+{
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, INTERVAL);
+    reader = TraceReader_Create(TEXT_TRACE, false);
+
+    access_t expected[N_ACCESSES];
+    read_through(reader, trace_index, expected);
+    TEST_ASSERT_TRUE(TraceIndex_Save(trace_index));
+    TraceIndex_Destroy(trace_index);
+    TraceReader_Destroy(reader);
+
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, INTERVAL);
+    TEST_ASSERT_EQUAL_UINT64(1 + N_ACCESSES / INTERVAL, TraceIndex_Checkpoints(trace_index));
+
+    trace_checkpoint_t checkpoint;
+    TraceIndex_Seek(trace_index, 2 * INTERVAL + 3, &checkpoint);
+    TEST_ASSERT_EQUAL_UINT64(2 * INTERVAL, checkpoint.record);
+
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TraceReader_Seek(reader, checkpoint.offset, checkpoint.record);
+
+    access_t actual[N_ACCESSES];
+    uint32_t n_actual = read_through(reader, trace_index, actual);
+    TEST_ASSERT_EQUAL_UINT32(N_ACCESSES - 2 * INTERVAL, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[2 * INTERVAL + i], actual[i]);
+    }
+}
+
+void test_TraceIndex_Create_should_IgnoreSidecar_when_IntervalDiffers(void)
+{
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, INTERVAL);
+    reader = TraceReader_Create(TEXT_TRACE, false);
+
+    access_t accesses[N_ACCESSES];
+    read_through(reader, trace_index, accesses);
+    TEST_ASSERT_TRUE(TraceIndex_Save(trace_index));
+    TraceIndex_Destroy(trace_index);
+
+    trace_index = TraceIndex_Create(INDEX_DIR, TEXT_TRACE, 2 * INTERVAL);
+    TEST_ASSERT_TRUE(TraceIndex_Active(trace_index));
+    TEST_ASSERT_EQUAL_UINT64(1, TraceIndex_Checkpoints(trace_index));
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint32_t read_through(trace_reader_t reader, trace_index_t index, access_t * accesses)
+{
+    uint32_t n_total = 0;
+    uint32_t n_read;
+    do {
+        uint32_t n_wanted = TraceIndex_Limit(index, BATCH_LEN);
+        n_read = TraceReader_Read(reader, &accesses[n_total], n_wanted);
+        TraceIndex_Record(index, &accesses[n_total], n_read, TraceReader_Offset(reader));
+        n_total += n_read;
+    } while (n_read > 0);
+
+    return n_total;
+}
+
+static void remove_index(void)
+{
+    DIR * dir = opendir(INDEX_DIR);
+    if (dir == NULL) {
+        return;
+    }
+
+    struct dirent * entry;
+    while ((entry = readdir(dir)) != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", INDEX_DIR, entry->d_name);
+        if (entry->d_name[0] != '.') {
+            unlink(path);
+        }
+    }
+    closedir(dir);
+    rmdir(INDEX_DIR);
+}
+
+/** @} addtogroup TEST_TRACEINDEX */
@@ -0,0 +1,580 @@
+/**
+ * @file    test_TraceReader.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   TestTraceReader Source
+ *
+ * @addtogroup TEST_TRACEREADER
+ * @{
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+#include "unity.h"
+#include "TraceReader.h"
+#include "unity_Helper.h"
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockStream.h"
+#include "BlockTrace.h"
+#include "DeltaTrace.h"
+#include "GzipStream.h"
+#include "Util.h"
+
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "ExceptionTypes.h"
+
+#include "test_utilities.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+#define TEXT_TRACE      "traces/traces-short/tr1"
+#define BAD_TEXT_TRACE  "test/support/trace_with_error_line_3"
+#define BINARY_TRACE    "build/test/test_TraceReader.bin"
+#define GZIP_TRACE      "build/test/test_TraceReader.gz"
+#define BLOCK_TRACE     "build/test/test_TraceReader.blk"
+#define DELTA_TRACE     "build/test/test_TraceReader.dlt"
+
+/**@brief   Records per block in the block trace. Splits tr1 over a few */
+#define BLOCK_LEN       (3)
+
+/**@brief   Records per chunk in the delta trace. Splits tr1 over a few */
+#define CHUNK_LEN       (5)
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Parse @p path line-by-line, as a reference for the reader */
+static uint32_t read_reference(char const * path, access_t * accesses, uint32_t max_accesses);
+
+/**@brief   Write @p path as a binary trace holding @p accesses */
+static void write_binary(char const * path, access_t const * accesses,
+                         uint32_t n_accesses, uint64_t header_count);
+
+/**@brief   Write the contents of @p path, gzipped, to @p gz_path
+ *
+ * @note    If @p truncate is set, the last few bytes of the compressed stream
+ *          are dropped
+ */
+static void write_gzip(char const * path, char const * gz_path, bool truncate);
+
+/**@brief   Write @p path as a block trace holding @p accesses */
+static void write_blocks(char const * path, access_t const * accesses, uint32_t n_accesses);
+
+/**@brief   Write @p path as a delta trace holding @p accesses
+ *
+ * @note    If @p truncate is set, the end of the trace is dropped
+ */
+static void write_delta(char const * path, access_t const * accesses, uint32_t n_accesses,
+                        bool truncate);
+
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+static trace_reader_t reader;
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+void setUp(void)
+{
+    reader = NULL;
+}
+
+void tearDown(void)
+{
+    TraceReader_Destroy(reader);
+    remove(BINARY_TRACE);
+    remove(GZIP_TRACE);
+    remove(BLOCK_TRACE);
+    remove(DELTA_TRACE);
+}
+
+void test_TraceReader_Read_should_MatchParseLine_when_ReadingTextFile(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+
+    access_t actual[32];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, TraceReader_Read(reader, actual, 32));
+}
+
+void test_TraceReader_Read_should_ReturnFullBatches_until_TraceEnds(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+
+    access_t actual[3];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+
+    uint32_t n_total = 0;
+    uint32_t n_read;
+    while ((n_read = TraceReader_Read(reader, actual, 3)) > 0) {
+        uint32_t i;
+        for (i = 0; i < n_read; i++) {
+            TEST_ASSERT_EQUAL_access_t(expected[n_total + i], actual[i]);
+        }
+        n_total += n_read;
+        if (n_total < n_expected) {
+            TEST_ASSERT_EQUAL_UINT32(3, n_read);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_total);
+}
+
+void test_TraceReader_Read_should_PointToBadTraceLine(void)
+{
+    access_t accesses[8];
+
+    reader = TraceReader_Create(BAD_TEXT_TRACE, false);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        TraceReader_Read(reader, accesses, 8);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(SYNTAX_ERROR, e);
+    TEST_ASSERT_EQUAL_STRING(BAD_TEXT_TRACE, exception_file);
+    TEST_ASSERT_EQUAL(3, exception_line);
+}
+
+void test_TraceReader_Create_should_ThrowException_when_FileDoesNotExist(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        reader = TraceReader_Create("doesnt/exist/at/all", false);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_TraceReader_Read_should_MatchText_when_ReadingBinaryFile(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_binary(BINARY_TRACE, expected, n_expected, n_expected);
+
+    access_t actual[32];
+    reader = TraceReader_Create(BINARY_TRACE, true);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceReader_Read_should_ThrowException_when_BinaryTraceIsShort(void)
+{
+    access_t accesses[32];
+    uint32_t n_accesses = read_reference(TEXT_TRACE, accesses, 32);
+    write_binary(BINARY_TRACE, accesses, n_accesses, n_accesses + 1);
+
+    reader = TraceReader_Create(BINARY_TRACE, true);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        TraceReader_Read(reader, accesses, 32);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_TraceReader_Create_should_ThrowException_when_BinaryHeaderIsBad(void)
+{
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        reader = TraceReader_Create(TEXT_TRACE, true);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+}
+
+void test_TraceReader_Read_should_MatchText_when_ReadingGzipFile(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_gzip(TEXT_TRACE, GZIP_TRACE, false);
+
+    access_t actual[32];
+    reader = TraceReader_Create(GZIP_TRACE, false);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceReader_Read_should_ThrowException_when_GzipFileIsTruncated(void)
+{
+    access_t accesses[32];
+    write_gzip(TEXT_TRACE, GZIP_TRACE, true);
+
+    reader = TraceReader_Create(GZIP_TRACE, false);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        TraceReader_Read(reader, accesses, 32);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+    TEST_ASSERT_EQUAL_STRING(GZIP_TRACE, exception_file);
+}
+
+void test_TraceReader_Read_should_MatchText_when_ReadingBlockTrace(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_blocks(BLOCK_TRACE, expected, n_expected);
+
+    // Block traces are recognized without being told they're binary
+    access_t actual[32];
+    reader = TraceReader_Create(BLOCK_TRACE, false);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceReader_Skip_should_StartMidBlock_when_ReadingBlockTrace(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_blocks(BLOCK_TRACE, expected, n_expected);
+
+    access_t actual[32];
+    reader = TraceReader_Create(BLOCK_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT64(4, TraceReader_Skip(reader, 4));
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected - 4, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[4 + i], actual[i]);
+    }
+}
+
+void test_TraceReader_Skip_should_StopAtEnd_when_SkippingPastEnd(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_blocks(BLOCK_TRACE, expected, n_expected);
+
+    access_t actual[32];
+    reader = TraceReader_Create(BLOCK_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT64(n_expected, TraceReader_Skip(reader, 1000));
+    TEST_ASSERT_EQUAL_UINT32(0, TraceReader_Read(reader, actual, 32));
+
+    TraceReader_Destroy(reader);
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT64(n_expected, TraceReader_Skip(reader, 1000));
+    TEST_ASSERT_EQUAL_UINT32(0, TraceReader_Read(reader, actual, 32));
+}
+
+void test_TraceReader_Skip_should_DiscardAccesses_when_ReadingText(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+
+    access_t actual[32];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT64(7, TraceReader_Skip(reader, 7));
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected - 7, n_actual);
+    TEST_ASSERT_EQUAL_access_t(expected[7], actual[0]);
+}
+
+void test_TraceReader_Seek_should_MoveToOffset_when_ReadingText(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+
+    // Find where the fifth line starts
+    access_t actual[32];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT32(4, TraceReader_Read(reader, actual, 4));
+    uint64_t offset = TraceReader_Offset(reader);
+    TraceReader_Destroy(reader);
+
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TraceReader_Seek(reader, offset, 4);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected - 4, n_actual);
+    TEST_ASSERT_EQUAL_access_t(expected[4], actual[0]);
+}
+
+void test_TraceReader_Seek_should_MoveToOffset_when_ReadingGzipFile(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_gzip(TEXT_TRACE, GZIP_TRACE, false);
+
+    access_t actual[32];
+    reader = TraceReader_Create(GZIP_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT32(6, TraceReader_Read(reader, actual, 6));
+    uint64_t offset = TraceReader_Offset(reader);
+    TraceReader_Destroy(reader);
+
+    reader = TraceReader_Create(GZIP_TRACE, false);
+    TraceReader_Seek(reader, offset, 6);
+    TEST_ASSERT_EQUAL_UINT64(offset, TraceReader_Offset(reader));
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected - 6, n_actual);
+    TEST_ASSERT_EQUAL_access_t(expected[6], actual[0]);
+}
+
+void test_TraceReader_Seek_should_ThrowException_when_TraceIsBinary(void)
+{
+    access_t accesses[32];
+    uint32_t n_accesses = read_reference(TEXT_TRACE, accesses, 32);
+    write_binary(BINARY_TRACE, accesses, n_accesses, n_accesses);
+
+    reader = TraceReader_Create(BINARY_TRACE, true);
+
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        TraceReader_Seek(reader, 0, 0);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(ARGUMENT_ERROR, e);
+}
+
+void test_TraceReader_Skip_should_StepOverRecords_when_ReadingBinaryFile(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_binary(BINARY_TRACE, expected, n_expected, n_expected);
+
+    access_t actual[32];
+    reader = TraceReader_Create(BINARY_TRACE, true);
+    TEST_ASSERT_EQUAL_UINT64(3, TraceReader_Skip(reader, 3));
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected - 3, n_actual);
+    TEST_ASSERT_EQUAL_access_t(expected[3], actual[0]);
+}
+
+void test_TraceReader_Read_should_MatchText_when_ReadingDeltaTrace(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_delta(DELTA_TRACE, expected, n_expected, false);
+
+    // Delta traces are recognized without being told they're binary
+    access_t actual[32];
+    reader = TraceReader_Create(DELTA_TRACE, false);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceReader_ReadRuns_should_ExpandToText_when_ReadingDeltaTrace(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_delta(DELTA_TRACE, expected, n_expected, false);
+
+    // Started mid-run, to check the rest of the run is returned
+    access_t actual[32];
+    reader = TraceReader_Create(DELTA_TRACE, false);
+    uint32_t n_actual = TraceReader_Read(reader, actual, 1);
+
+    // Each chunk's runs are expanded before the next chunk is read
+    uint32_t n_total = 0;
+    access_run_t runs[32];
+    uint32_t n_runs;
+    while ((n_runs = TraceReader_ReadRuns(reader, runs, 32)) > 0) {
+        uint32_t i;
+        for (i = 0; i < n_runs; i++) {
+            uint64_t address = runs[i].address;
+            uint32_t k;
+            for (k = 0; k < runs[i].n_accesses; k++) {
+                actual[n_actual].type    = runs[i].type;
+                actual[n_actual].address = address;
+                actual[n_actual].n_bytes = runs[i].sizes[k];
+                address += runs[i].sizes[k];
+                n_actual++;
+            }
+            TEST_ASSERT_EQUAL_UINT64(runs[i].n_bytes, address - runs[i].address);
+        }
+        n_total += n_runs;
+    }
+
+    // Sequential fetches were collapsed
+    TEST_ASSERT_TRUE(n_total < n_expected - 1);
+    TEST_ASSERT_EQUAL_UINT32(n_expected, n_actual);
+    uint32_t i;
+    for (i = 0; i < n_actual; i++) {
+        TEST_ASSERT_EQUAL_access_t(expected[i], actual[i]);
+    }
+}
+
+void test_TraceReader_ReadRuns_should_WrapEachAccess_when_ReadingText(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+
+    access_run_t runs[32];
+    reader = TraceReader_Create(TEXT_TRACE, false);
+    TEST_ASSERT_EQUAL_UINT32(n_expected, TraceReader_ReadRuns(reader, runs, 32));
+
+    uint32_t i;
+    for (i = 0; i < n_expected; i++) {
+        TEST_ASSERT_EQUAL_HEX8(expected[i].type, runs[i].type);
+        TEST_ASSERT_EQUAL_HEX64(expected[i].address, runs[i].address);
+        TEST_ASSERT_EQUAL_UINT64(expected[i].n_bytes, runs[i].n_bytes);
+        TEST_ASSERT_EQUAL_UINT32(1, runs[i].n_accesses);
+        TEST_ASSERT_EQUAL_UINT32(expected[i].n_bytes, runs[i].sizes[0]);
+    }
+}
+
+void test_TraceReader_Read_should_ThrowException_when_DeltaTraceIsTruncated(void)
+{
+    access_t expected[32];
+    uint32_t n_expected = read_reference(TEXT_TRACE, expected, 32);
+    write_delta(DELTA_TRACE, expected, n_expected, true);
+
+    access_t actual[32];
+    CEXCEPTION_T e = CEXCEPTION_NONE;
+    Try {
+        reader = TraceReader_Create(DELTA_TRACE, false);
+        TraceReader_Read(reader, actual, 32);
+    }
+    Catch (e) {
+    }
+    TEST_ASSERT_EQUAL_HEX32(BAD_TRACE_FILE, e);
+    TEST_ASSERT_EQUAL_STRING(DELTA_TRACE, exception_file);
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static uint32_t read_reference(char const * path, access_t * accesses, uint32_t max_accesses)
+{
+    FILE * file = fopen(path, "r");
+    TEST_ASSERT_NOT_NULL(file);
+
+    uint32_t n_accesses = 0;
+    char line[128];
+    while (n_accesses < max_accesses && fgets(line, sizeof(line), file)) {
+        Access_ParseLine(line, &accesses[n_accesses]);
+        n_accesses++;
+    }
+
+    fclose(file);
+    return n_accesses;
+}
+
+static void write_binary(char const * path, access_t const * accesses,
+                         uint32_t n_accesses, uint64_t header_count)
+{
+    FILE * file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+
+    BinaryTrace_WriteHeader(file, header_count);
+    BinaryTrace_Write(file, accesses, n_accesses);
+
+    fclose(file);
+}
+
+static void write_gzip(char const * path, char const * gz_path, bool truncate)
+{
+    char text[4096];
+    FILE * file = fopen(path, "r");
+    TEST_ASSERT_NOT_NULL(file);
+    size_t length = fread(text, 1, sizeof(text), file);
+    fclose(file);
+
+    uint8_t compressed[4096];
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    TEST_ASSERT_EQUAL(Z_OK, deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                         15 + 16, 8, Z_DEFAULT_STRATEGY));
+    z.next_in   = (uint8_t *) text;
+    z.avail_in  = length;
+    z.next_out  = compressed;
+    z.avail_out = sizeof(compressed);
+    TEST_ASSERT_EQUAL(Z_STREAM_END, deflate(&z, Z_FINISH));
+    size_t n_compressed = z.total_out;
+    deflateEnd(&z);
+
+    if (truncate) {
+        // Drops part of the trailing checksum and length
+        n_compressed -= 4;
+    }
+
+    file = fopen(gz_path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL(n_compressed, fwrite(compressed, 1, n_compressed, file));
+    fclose(file);
+}
+
+static void write_blocks(char const * path, access_t const * accesses, uint32_t n_accesses)
+{
+    FILE * file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+
+    block_trace_writer_t writer = BlockTrace_CreateWriter(file, BLOCK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+    BlockTrace_Write(writer, accesses, n_accesses);
+    BlockTrace_Finish(writer);
+    BlockTrace_DestroyWriter(writer);
+
+    fclose(file);
+}
+
+static void write_delta(char const * path, access_t const * accesses, uint32_t n_accesses,
+                        bool truncate)
+{
+    FILE * file = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+
+    delta_trace_writer_t writer = DeltaTrace_CreateWriter(file, CHUNK_LEN);
+    TEST_ASSERT_NOT_NULL(writer);
+    DeltaTrace_Write(writer, accesses, n_accesses);
+    if (truncate) {
+        // Leaves off the last chunk, and the end of the trace
+        DeltaTrace_DestroyWriter(writer);
+        fclose(file);
+        return;
+    }
+    DeltaTrace_Finish(writer);
+    DeltaTrace_DestroyWriter(writer);
+
+    fclose(file);
+}
+
+/** @} addtogroup TEST_TRACEREADER */
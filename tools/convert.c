@@ -0,0 +1,851 @@
+/**
+ * @file    convert.c
+ * @author  Austin Glaser <austin@boulderes.com>
+ * @brief   Text to Binary Trace Converter
+ *
+ * @defgroup CONVERT Convert
+ * @{
+ *
+ * @brief   Converts a text trace (as consumed by the simulator on stdin) into
+ *          the binary format described in @ref BINARYTRACE, the block
+ *          trace container described in @ref BLOCKTRACE, or the delta
+ *          encoding described in @ref DELTATRACE
+ *
+ * An uncompressed text trace in a regular file is converted on every core: it
+ * is mapped, split into chunks at line boundaries, and each chunk is parsed
+ * (and, for a block or delta trace, compressed) by whichever thread takes
+ * it. The results are written in chunk order. Anything else is converted
+ * serially.
+ *
+ * Blocks (and delta trace chunks) are aligned to the whole trace, not to the
+ * chunks of text, so the output doesn't depend on how the trace was read. A
+ * chunk only compresses the blocks that lie wholly within it; the accesses
+ * either side are handed to the writer, which completes the blocks spanning
+ * two chunks.
+ */
+
+/* --- PRIVATE DEPENDENCIES ------------------------------------------------- */
+
+// Required for madvise() and pread()
+#define _DEFAULT_SOURCE
+
+#include "Access.h"
+#include "BinaryTrace.h"
+#include "BlockTrace.h"
+#include "CException.h"
+#include "CExceptionConfig.h"
+#include "DeltaTrace.h"
+#include "ExceptionTypes.h"
+#include "GzipStream.h"
+#include "TraceReader.h"
+#include "Util.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* --- PRIVATE DATATYPES ---------------------------------------------------- */
+
+/**@brief   Where converted accesses go */
+typedef struct {
+    FILE * file;                    /**< The output file */
+    block_trace_writer_t blocks;    /**< Writer for a block trace, or NULL */
+    delta_trace_writer_t delta;     /**< Writer for a delta trace, or NULL */
+} output_t;
+
+/**@brief   One block (or delta trace chunk) compressed by a conversion
+ *          thread
+ */
+typedef struct {
+    size_t length;                  /**< Length of the compressed block */
+    uint32_t n_records;             /**< Records in the block */
+} chunk_block_t;
+
+/**@brief   A chunk of text, converted
+ *
+ * @note    Chunk k is always converted into slot (k % n_slots), and only once
+ *          chunk (k - n_slots) has been written
+ */
+typedef struct {
+    uint64_t chunk;                 /**< Number of the chunk held */
+    bool ready;                     /**< Whether the chunk is converted */
+
+    access_t * accesses;            /**< The chunk's accesses, as parsed */
+    uint32_t max_accesses;          /**< Space in @p accesses */
+    uint32_t n_head;                /**< Block and delta traces: accesses that
+                                         complete the block earlier chunks left
+                                         unfinished */
+    uint32_t tail_start;            /**< Block and delta traces: the first
+                                         access after the last whole block */
+
+    uint8_t * data;                 /**< Encoded records, compressed blocks,
+                                         or delta trace chunks */
+    size_t length;                  /**< Valid bytes in @p data */
+    size_t capacity;                /**< Space in @p data */
+
+    chunk_block_t * blocks;         /**< Compressed blocks in @p data */
+    uint32_t n_blocks;              /**< Valid entries in @p blocks */
+    uint32_t max_blocks;            /**< Space in @p blocks */
+
+    uint32_t n_records;             /**< Accesses in the chunk */
+    uint64_t line_no;               /**< Line within the chunk being parsed */
+    unsigned int error;             /**< Exception conversion failed with */
+} chunk_slot_t;
+
+/**@brief   State shared by the conversion threads and the writer */
+typedef struct {
+    char const * text;              /**< The mapped text trace */
+    size_t text_length;             /**< Length of @p text [bytes] */
+    bool blocks;                    /**< Whether chunks are compressed into
+                                         blocks */
+    bool delta;                     /**< Whether chunks are delta encoded */
+
+    chunk_slot_t * slots;           /**< Converted chunks, waiting to be
+                                         written */
+    uint32_t n_slots;               /**< Number of slots in @p slots */
+
+    pthread_mutex_t lock;           /**< Protects everything below */
+    pthread_cond_t ready;           /**< Signalled when a chunk is converted */
+    pthread_cond_t written;         /**< Signalled when a chunk is written */
+    pthread_cond_t counted;         /**< Signalled when a chunk's accesses are
+                                         counted */
+    size_t cursor;                  /**< Start of the next chunk of text */
+    uint64_t next_chunk;            /**< Number of the next chunk */
+    uint64_t n_written;             /**< Chunks written so far */
+    uint64_t n_counted;             /**< Chunks whose accesses have been
+                                         counted, in order */
+    uint64_t n_counted_records;     /**< Accesses in those chunks */
+} converter_t;
+
+/**@brief   A conversion thread's arguments */
+typedef struct {
+    converter_t * converter;        /**< The shared state */
+    unsigned int exception_id;      /**< The thread's exception stack */
+} worker_t;
+
+/* --- PRIVATE FUNCTION PROTOTYPES ------------------------------------------ */
+
+/**@brief   Prints a usage message */
+static void usage(char const * call);
+
+/**@brief   Remove the output file, if it wasn't completed. Registered with
+ *          atexit(), so runs however the conversion fails
+ */
+static void remove_partial(void);
+
+/**@brief   Convert every access in @p reader, one batch at a time
+ *
+ * @return  The number of accesses converted
+ */
+static uint64_t convert(trace_reader_t reader, output_t * output);
+
+/**@brief   Map @p fd, if it holds an uncompressed text trace in a regular file
+ *
+ * @return  The mapped trace, or NULL if it can't be converted in parallel
+ */
+static char const * map_text(int fd, size_t * length);
+
+/**@brief   Convert a mapped text trace on @p n_threads threads
+ *
+ * @return  The number of accesses converted
+ */
+static uint64_t convert_parallel(char const * name,
+                                 char const * text,
+                                 size_t text_length,
+                                 output_t * output,
+                                 uint32_t n_threads);
+
+/**@brief   Conversion thread entry point */
+static void * convert_chunks(void * arg);
+
+/**@brief   Parse (and possibly compress) chunk @p chunk of text into
+ *          @p slot
+ *
+ * A failure is left in @p slot for the writer to report
+ */
+static void convert_chunk(converter_t * converter,
+                          chunk_slot_t * slot,
+                          uint64_t chunk,
+                          char const * text,
+                          size_t length,
+                          uint8_t * records,
+                          delta_trace_encoder_t encoder);
+
+/**@brief   Parse every access in a chunk of text into @p slot */
+static void parse_chunk(chunk_slot_t * slot, char const * text, size_t length);
+
+/**@brief   Wait for every chunk before @p chunk to be counted, then count
+ *          @p chunk's @p n_records accesses
+ *
+ * @return  The number of accesses in the trace before @p chunk
+ */
+static uint64_t count_records(converter_t * converter, uint64_t chunk, uint32_t n_records);
+
+/**@brief   Encode (and possibly compress) the accesses parsed into @p slot,
+ *          the first of which is access @p first_record of the trace
+ */
+static void encode_records(converter_t const * converter,
+                           chunk_slot_t * slot,
+                           uint64_t first_record,
+                           uint8_t * records,
+                           delta_trace_encoder_t encoder);
+
+/**@brief   Make room for @p length more bytes in @p slot */
+static void reserve(chunk_slot_t * slot, size_t length);
+
+/**@brief   Make room for @p n_accesses more parsed accesses in @p slot */
+static void reserve_accesses(chunk_slot_t * slot, uint32_t n_accesses);
+
+/**@brief   Compress @p n_records records as a block at the end of @p slot */
+static void compress_block(chunk_slot_t * slot, uint8_t const * records, uint32_t n_records);
+
+/**@brief   Add a block to @p slot's list of blocks */
+static void add_block(chunk_slot_t * slot, size_t length, uint32_t n_records);
+
+/**@brief   Encode @p n_accesses accesses as a delta trace chunk at the end of
+ *          @p slot
+ */
+static void encode_chunk(chunk_slot_t * slot,
+                         delta_trace_encoder_t encoder,
+                         access_t const * accesses,
+                         uint32_t n_accesses);
+
+/* --- PRIVATE CONSTANTS ---------------------------------------------------- */
+
+/**@brief   Longest output file path, with its partial suffix [bytes] */
+#define CONVERT_PATH_LEN    (4096)
+
+/**@brief   Number of accesses converted at once */
+#define CONVERT_BATCH_LEN   (4096)
+
+/**@brief   Approximate size of each chunk of text [bytes] */
+#define CONVERT_CHUNK_SIZE  (4 << 20)
+
+/**@brief   Converted chunks allowed to wait to be written, per thread */
+#define CONVERT_SLOTS_PER_THREAD    (2)
+
+/**@brief   Most conversion threads. Each needs its own exception stack, and
+ *          the main thread has the first
+ */
+#define CONVERT_MAX_THREADS (CEXCEPTION_NUM_ID - 1)
+
+/* --- PRIVATE MACROS ------------------------------------------------------- */
+/* --- PUBLIC VARIABLES ----------------------------------------------------- */
+/* --- PRIVATE VARIABLES ---------------------------------------------------- */
+
+/**@brief   Where the output is written until it's complete, or empty once it
+ *          has been renamed into place
+ */
+static char partial_path[CONVERT_PATH_LEN];
+
+/* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
+
+/**@brief   Application Entry Point */
+int main(int argc, char const * const * const argv)
+{
+    if (atexit(remove_partial) != 0) {
+        printf("Failed to register cleanup function\n");
+        return 1;
+    }
+
+    bool blocks = false;
+    bool delta = false;
+    uint32_t n_threads = 0;
+    char const * out_file = NULL;
+    char const * in_file = NULL;
+
+    int i;
+    for (i = 1; i < argc; i++) {
+        if (strcmp("-h", argv[i]) == 0 || strcmp("--help", argv[i]) == 0) {
+            usage(argv[0]);
+            return 0;
+        }
+        else if (strcmp("--blocks", argv[i]) == 0) {
+            blocks = true;
+        }
+        else if (strcmp("--delta", argv[i]) == 0) {
+            delta = true;
+        }
+        else if (strcmp("-j", argv[i]) == 0 && i < argc - 1) {
+            n_threads = strtoul(argv[i + 1], NULL, 10);
+            i++;
+        }
+        else if (out_file == NULL) {
+            out_file = argv[i];
+        }
+        else if (in_file == NULL) {
+            in_file = argv[i];
+        }
+        else {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+    if (out_file == NULL || (blocks && delta)) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    if (n_threads == 0) {
+        long n_cores = sysconf(_SC_NPROCESSORS_ONLN);
+        n_threads = n_cores > 0 ? n_cores : 1;
+    }
+    if (n_threads > CONVERT_MAX_THREADS) {
+        n_threads = CONVERT_MAX_THREADS;
+    }
+
+    // The trace is written under a partial name, and only renamed once it's
+    // complete, so a failed conversion never leaves a short trace behind
+    bool to_stdout = strcmp("-", out_file) == 0;
+    if (!to_stdout) {
+        int length = snprintf(partial_path, sizeof(partial_path), "%s.%ld.partial",
+                              out_file, (long) getpid());
+        if (length < 0 || (size_t) length >= sizeof(partial_path)) {
+            partial_path[0] = '\0';
+            printf("Output path '%s' is too long\n", out_file);
+            return -1;
+        }
+    }
+
+    output_t output = {
+        .file   = to_stdout ? stdout : fopen(partial_path, "wb"),
+        .blocks = NULL,
+        .delta  = NULL,
+    };
+    if (output.file == NULL) {
+        partial_path[0] = '\0';
+        printf("Unable to open '%s' for writing\n", out_file);
+        return -1;
+    }
+
+    if (blocks) {
+        output.blocks = BlockTrace_CreateWriter(output.file, BLOCK_TRACE_DEFAULT_LEN);
+        if (output.blocks == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+    }
+    else if (delta) {
+        output.delta = DeltaTrace_CreateWriter(output.file, DELTA_TRACE_DEFAULT_LEN);
+        if (output.delta == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+    }
+    else {
+        // The reference count isn't known until the whole trace has been
+        // read, so the header is re-written afterwards if the output can be
+        // seeked
+        BinaryTrace_WriteHeader(output.file, BINARY_TRACE_UNKNOWN_LENGTH);
+    }
+
+    int fd = in_file != NULL ? open(in_file, O_RDONLY) : STDIN_FILENO;
+    if (fd < 0) {
+        printf("Unable to open '%s' for reading\n", in_file);
+        return -1;
+    }
+
+    size_t text_length = 0;
+    char const * text = map_text(fd, &text_length);
+
+    uint64_t n_accesses;
+    if (text != NULL) {
+        n_accesses = convert_parallel(in_file != NULL ? in_file : "stdin",
+                                      text, text_length, &output, n_threads);
+        munmap((void *) text, text_length);
+    }
+    else {
+        trace_reader_t reader = TraceReader_Create(in_file, false);
+        if (reader == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        n_accesses = convert(reader, &output);
+        TraceReader_Destroy(reader);
+    }
+    if (in_file != NULL) {
+        close(fd);
+    }
+
+    if (blocks) {
+        BlockTrace_Finish(output.blocks);
+        BlockTrace_DestroyWriter(output.blocks);
+    }
+    else if (delta) {
+        DeltaTrace_Finish(output.delta);
+        DeltaTrace_DestroyWriter(output.delta);
+    }
+    else if (!to_stdout) {
+        rewind(output.file);
+        BinaryTrace_WriteHeader(output.file, n_accesses);
+    }
+
+    if (!to_stdout) {
+        bool closed = fclose(output.file) == 0;
+        if (!closed || rename(partial_path, out_file) != 0) {
+            printf("Unable to write '%s'\n", out_file);
+            return -1;
+        }
+        partial_path[0] = '\0';
+    }
+
+    fprintf(stderr, "Converted %" PRIu64 " accesses\n", n_accesses);
+
+    return 0;
+}
+
+/* --- PRIVATE FUNCTION DEFINITIONS ----------------------------------------- */
+
+static void usage(char const * call)
+{
+    printf("Usage: %s [--blocks | --delta] [-j <threads>] <output_file> [input_file]\n"
+           "    Converts a text trace to a binary trace. If input_file is not\n"
+           "    given, the trace is read from stdin. An output_file of '-'\n"
+           "    writes to stdout (a binary header will not record a length).\n"
+           "    --blocks writes a seekable, block-compressed trace instead.\n"
+           "    --delta writes a delta-encoded trace instead, which is far\n"
+           "    smaller but can't be seeked.\n"
+           "    -j sets the number of conversion threads (default: one per\n"
+           "    core). Only uncompressed text in a regular file is converted\n"
+           "    in parallel.\n", call);
+}
+
+static void remove_partial(void)
+{
+    if (partial_path[0] != '\0') {
+        unlink(partial_path);
+    }
+}
+
+static uint64_t convert(trace_reader_t reader, output_t * output)
+{
+    static access_t accesses[CONVERT_BATCH_LEN];
+
+    uint64_t n_accesses = 0;
+    uint32_t n_read;
+    while ((n_read = TraceReader_Read(reader, accesses, CONVERT_BATCH_LEN)) > 0) {
+        if (output->blocks) {
+            BlockTrace_Write(output->blocks, accesses, n_read);
+        }
+        else if (output->delta) {
+            DeltaTrace_Write(output->delta, accesses, n_read);
+        }
+        else {
+            BinaryTrace_Write(output->file, accesses, n_read);
+        }
+        n_accesses += n_read;
+    }
+
+    return n_accesses;
+}
+
+static char const * map_text(int fd, size_t * length)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        return NULL;
+    }
+
+    // Compressed and already-converted traces are left to the trace reader
+    char magic[8];
+    if (pread(fd, magic, sizeof(magic), 0) != sizeof(magic) ||
+        memcmp(magic, GZIP_STREAM_MAGIC, 2) == 0 ||
+        memcmp(magic, BLOCK_TRACE_MAGIC, 8) == 0 ||
+        memcmp(magic, DELTA_TRACE_MAGIC, 8) == 0 ||
+        memcmp(magic, BINARY_TRACE_MAGIC, 8) == 0) {
+        return NULL;
+    }
+
+    void * text = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (text == MAP_FAILED) {
+        return NULL;
+    }
+    madvise(text, st.st_size, MADV_SEQUENTIAL);
+
+    *length = st.st_size;
+    return (char const *) text;
+}
+
+static uint64_t convert_parallel(char const * name,
+                                 char const * text,
+                                 size_t text_length,
+                                 output_t * output,
+                                 uint32_t n_threads)
+{
+    converter_t converter = {
+        .text        = text,
+        .text_length = text_length,
+        .blocks      = output->blocks != NULL,
+        .delta       = output->delta != NULL,
+        .n_slots     = n_threads * CONVERT_SLOTS_PER_THREAD,
+        .cursor      = 0,
+        .next_chunk  = 0,
+        .n_written   = 0,
+        .n_counted   = 0,
+        .n_counted_records = 0,
+    };
+    pthread_mutex_init(&converter.lock, NULL);
+    pthread_cond_init(&converter.ready, NULL);
+    pthread_cond_init(&converter.written, NULL);
+    pthread_cond_init(&converter.counted, NULL);
+
+    converter.slots = (chunk_slot_t *) calloc(converter.n_slots, sizeof(chunk_slot_t));
+    pthread_t * threads = (pthread_t *) calloc(n_threads, sizeof(pthread_t));
+    worker_t * workers = (worker_t *) calloc(n_threads, sizeof(worker_t));
+    if (converter.slots == NULL || threads == NULL || workers == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+
+    uint32_t i;
+    for (i = 0; i < n_threads; i++) {
+        workers[i].converter    = &converter;
+        workers[i].exception_id = i + 1;
+        if (pthread_create(&threads[i], NULL, convert_chunks, &workers[i]) != 0) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+    }
+
+    // Write chunks in order, as they're converted
+    uint64_t n_accesses = 0;
+    uint64_t n_lines = 0;
+    while (true) {
+        uint64_t chunk = converter.n_written;
+        chunk_slot_t * slot = &converter.slots[chunk % converter.n_slots];
+
+        pthread_mutex_lock(&converter.lock);
+        while (!(slot->ready && slot->chunk == chunk) &&
+               !(converter.cursor == text_length && chunk == converter.next_chunk)) {
+            pthread_cond_wait(&converter.ready, &converter.lock);
+        }
+        bool done = !(slot->ready && slot->chunk == chunk);
+        pthread_mutex_unlock(&converter.lock);
+
+        if (done) {
+            break;
+        }
+
+        if (slot->error != CEXCEPTION_NONE) {
+            // Chunks count their own lines, so the trace's line number is
+            // only known here
+            ThrowWithLocationInfo(slot->error, name, n_lines + slot->line_no);
+        }
+
+        // The accesses either side of the chunk's whole blocks finish the
+        // block the last chunk started, and start the next
+        access_t const * tail = &slot->accesses[slot->tail_start];
+        uint32_t n_tail = slot->n_records - slot->tail_start;
+        if (output->blocks) {
+            BlockTrace_Write(output->blocks, slot->accesses, slot->n_head);
+            size_t offset = 0;
+            for (i = 0; i < slot->n_blocks; i++) {
+                BlockTrace_WriteBlock(output->blocks,
+                                      &slot->data[offset],
+                                      slot->blocks[i].length,
+                                      slot->blocks[i].n_records);
+                offset += slot->blocks[i].length;
+            }
+            BlockTrace_Write(output->blocks, tail, n_tail);
+        }
+        else if (output->delta) {
+            DeltaTrace_Write(output->delta, slot->accesses, slot->n_head);
+            size_t offset = 0;
+            for (i = 0; i < slot->n_blocks; i++) {
+                DeltaTrace_WriteChunk(output->delta,
+                                      &slot->data[offset],
+                                      slot->blocks[i].length,
+                                      slot->blocks[i].n_records);
+                offset += slot->blocks[i].length;
+            }
+            DeltaTrace_Write(output->delta, tail, n_tail);
+        }
+        else if (fwrite(slot->data, 1, slot->length, output->file) != slot->length) {
+            ThrowHere(BAD_TRACE_FILE);
+        }
+        n_accesses += slot->n_records;
+        n_lines    += slot->line_no - 1;
+
+        pthread_mutex_lock(&converter.lock);
+        slot->ready = false;
+        converter.n_written++;
+        pthread_cond_broadcast(&converter.written);
+        pthread_mutex_unlock(&converter.lock);
+    }
+
+    for (i = 0; i < n_threads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    for (i = 0; i < converter.n_slots; i++) {
+        free(converter.slots[i].data);
+        free(converter.slots[i].blocks);
+        free(converter.slots[i].accesses);
+    }
+    free(converter.slots);
+    free(threads);
+    free(workers);
+
+    pthread_mutex_destroy(&converter.lock);
+    pthread_cond_destroy(&converter.ready);
+    pthread_cond_destroy(&converter.written);
+    pthread_cond_destroy(&converter.counted);
+
+    return n_accesses;
+}
+
+static void * convert_chunks(void * arg)
+{
+    worker_t * worker = (worker_t *) arg;
+    converter_t * converter = worker->converter;
+    exception_thread_id = worker->exception_id;
+
+    // A failed allocation is reported when the writer reaches the first chunk
+    // this thread takes
+    uint8_t * records = (uint8_t *) malloc((size_t) BLOCK_TRACE_DEFAULT_LEN *
+                                           BINARY_TRACE_RECORD_SIZE);
+    delta_trace_encoder_t encoder = DeltaTrace_CreateEncoder();
+
+    pthread_mutex_lock(&converter->lock);
+    while (true) {
+        while (converter->cursor < converter->text_length &&
+               converter->next_chunk >= converter->n_written + converter->n_slots) {
+            pthread_cond_wait(&converter->written, &converter->lock);
+        }
+        if (converter->cursor == converter->text_length) {
+            break;
+        }
+
+        // Chunks end just after a newline (or at the end of the trace)
+        size_t start = converter->cursor;
+        size_t end = converter->text_length;
+        if (end - start > CONVERT_CHUNK_SIZE) {
+            char const * eol = memchr(converter->text + start + CONVERT_CHUNK_SIZE, '\n',
+                                      end - start - CONVERT_CHUNK_SIZE);
+            if (eol != NULL) {
+                end = eol - converter->text + 1;
+            }
+        }
+        converter->cursor = end;
+
+        uint64_t chunk = converter->next_chunk++;
+        chunk_slot_t * slot = &converter->slots[chunk % converter->n_slots];
+        pthread_mutex_unlock(&converter->lock);
+
+        convert_chunk(converter, slot, chunk, converter->text + start, end - start,
+                      records, encoder);
+
+        pthread_mutex_lock(&converter->lock);
+        slot->chunk = chunk;
+        slot->ready = true;
+        pthread_cond_broadcast(&converter->ready);
+    }
+    // Wakes the writer, in case it's waiting for a chunk that will never come
+    pthread_cond_broadcast(&converter->ready);
+    pthread_mutex_unlock(&converter->lock);
+
+    free(records);
+    DeltaTrace_DestroyEncoder(encoder);
+    return NULL;
+}
+
+static void convert_chunk(converter_t * converter,
+                          chunk_slot_t * slot,
+                          uint64_t chunk,
+                          char const * text,
+                          size_t length,
+                          uint8_t * records,
+                          delta_trace_encoder_t encoder)
+{
+    slot->length     = 0;
+    slot->n_blocks   = 0;
+    slot->n_records  = 0;
+    slot->n_head     = 0;
+    slot->tail_start = 0;
+    slot->line_no    = 1;
+    slot->error      = CEXCEPTION_NONE;
+
+    CEXCEPTION_T e;
+    Try {
+        if (records == NULL || encoder == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        parse_chunk(slot, text, length);
+    }
+    Catch (e) {
+        slot->error = e;
+    }
+
+    // Later chunks can't place their blocks until this one is counted, even
+    // if it failed
+    uint64_t first_record = count_records(converter, chunk, slot->n_records);
+    if (slot->error != CEXCEPTION_NONE) {
+        return;
+    }
+
+    Try {
+        encode_records(converter, slot, first_record, records, encoder);
+    }
+    Catch (e) {
+        slot->error = e;
+    }
+}
+
+static void parse_chunk(chunk_slot_t * slot, char const * text, size_t length)
+{
+    size_t offset = 0;
+    while (offset < length) {
+        reserve_accesses(slot, CONVERT_BATCH_LEN);
+
+        uint32_t n_parsed;
+        offset += Access_ParseBuffer(text + offset, length - offset, true,
+                                     &slot->accesses[slot->n_records], CONVERT_BATCH_LEN,
+                                     &n_parsed, &(slot->line_no));
+        slot->n_records += n_parsed;
+    }
+}
+
+static uint64_t count_records(converter_t * converter, uint64_t chunk, uint32_t n_records)
+{
+    // The chunk before was taken first, and its thread counts it as soon as
+    // it's parsed, so this never waits long
+    pthread_mutex_lock(&converter->lock);
+    while (converter->n_counted != chunk) {
+        pthread_cond_wait(&converter->counted, &converter->lock);
+    }
+    uint64_t first_record = converter->n_counted_records;
+    converter->n_counted_records += n_records;
+    converter->n_counted++;
+    pthread_cond_broadcast(&converter->counted);
+    pthread_mutex_unlock(&converter->lock);
+
+    return first_record;
+}
+
+static void encode_records(converter_t const * converter,
+                           chunk_slot_t * slot,
+                           uint64_t first_record,
+                           uint8_t * records,
+                           delta_trace_encoder_t encoder)
+{
+    uint32_t n_records = slot->n_records;
+    uint32_t i;
+
+    if (!converter->blocks && !converter->delta) {
+        reserve(slot, (size_t) n_records * BINARY_TRACE_RECORD_SIZE);
+        for (i = 0; i < n_records; i++) {
+            BinaryTrace_EncodeAccess(&slot->data[slot->length], &slot->accesses[i]);
+            slot->length += BINARY_TRACE_RECORD_SIZE;
+        }
+        slot->tail_start = n_records;
+        return;
+    }
+
+    // Blocks start every block_len accesses through the trace, as they would
+    // if it were converted serially
+    uint32_t block_len = converter->delta ? DELTA_TRACE_DEFAULT_LEN : BLOCK_TRACE_DEFAULT_LEN;
+    uint32_t n_head = (block_len - first_record % block_len) % block_len;
+    slot->n_head = n_head < n_records ? n_head : n_records;
+
+    uint32_t start;
+    for (start = slot->n_head; n_records - start >= block_len; start += block_len) {
+        if (converter->delta) {
+            encode_chunk(slot, encoder, &slot->accesses[start], block_len);
+            continue;
+        }
+
+        for (i = 0; i < block_len; i++) {
+            BinaryTrace_EncodeAccess(&records[i * BINARY_TRACE_RECORD_SIZE],
+                                     &slot->accesses[start + i]);
+        }
+        compress_block(slot, records, block_len);
+    }
+    slot->tail_start = start;
+}
+
+static void reserve(chunk_slot_t * slot, size_t length)
+{
+    if (slot->length + length <= slot->capacity) {
+        return;
+    }
+
+    size_t capacity = slot->capacity ? slot->capacity : CONVERT_CHUNK_SIZE;
+    while (slot->length + length > capacity) {
+        capacity *= 2;
+    }
+
+    uint8_t * data = (uint8_t *) realloc(slot->data, capacity);
+    if (data == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    slot->data     = data;
+    slot->capacity = capacity;
+}
+
+static void reserve_accesses(chunk_slot_t * slot, uint32_t n_accesses)
+{
+    if (slot->n_records + n_accesses <= slot->max_accesses) {
+        return;
+    }
+
+    uint32_t max_accesses = slot->max_accesses ? slot->max_accesses : CONVERT_BATCH_LEN;
+    while (slot->n_records + n_accesses > max_accesses) {
+        max_accesses *= 2;
+    }
+
+    access_t * accesses = (access_t *) realloc(slot->accesses, max_accesses * sizeof(access_t));
+    if (accesses == NULL) {
+        ThrowHere(ALLOCATION_FAILURE);
+    }
+    slot->accesses     = accesses;
+    slot->max_accesses = max_accesses;
+}
+
+static void compress_block(chunk_slot_t * slot, uint8_t const * records, uint32_t n_records)
+{
+    reserve(slot, BlockTrace_CompressBound(n_records));
+
+    size_t length;
+    if (!BlockTrace_CompressBlock(&slot->data[slot->length], &length, records, n_records)) {
+        ThrowHere(BAD_TRACE_FILE);
+    }
+
+    add_block(slot, length, n_records);
+}
+
+static void encode_chunk(chunk_slot_t * slot,
+                         delta_trace_encoder_t encoder,
+                         access_t const * accesses,
+                         uint32_t n_accesses)
+{
+    uint8_t const * chunk;
+    size_t length = DeltaTrace_EncodeChunk(encoder, accesses, n_accesses, &chunk);
+
+    reserve(slot, length);
+    memcpy(&slot->data[slot->length], chunk, length);
+
+    add_block(slot, length, n_accesses);
+}
+
+static void add_block(chunk_slot_t * slot, size_t length, uint32_t n_records)
+{
+    if (slot->n_blocks == slot->max_blocks) {
+        uint32_t max_blocks = slot->max_blocks ? 2 * slot->max_blocks : 8;
+        chunk_block_t * blocks = (chunk_block_t *)
+            realloc(slot->blocks, max_blocks * sizeof(chunk_block_t));
+        if (blocks == NULL) {
+            ThrowHere(ALLOCATION_FAILURE);
+        }
+        slot->blocks     = blocks;
+        slot->max_blocks = max_blocks;
+    }
+
+    slot->blocks[slot->n_blocks].length    = length;
+    slot->blocks[slot->n_blocks].n_records = n_records;
+    slot->n_blocks++;
+    slot->length += length;
+}
+
+/** @} defgroup CONVERT */